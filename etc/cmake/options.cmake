@@ -80,6 +80,10 @@ macro(ot_option name ot_config description)
 endmacro()
 
 ot_option(OT_15_4 OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE "802.15.4 radio link")
+ot_option(OT_6LOWPAN_FRAGMENT_FORWARDING OPENTHREAD_CONFIG_6LOWPAN_FRAGMENT_FORWARDING_ENABLE "6LoWPAN per-fragment forwarding")
+ot_option(OT_6LOWPAN_REASSEMBLY_INDEX OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_ENABLE "6LoWPAN reassembly index")
+ot_option(OT_ADDRESS_CACHE_DYNAMIC_SIZE OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_DYNAMIC_SIZE_ENABLE "run-time sized EID cache")
+ot_option(OT_ADDRESS_CACHE_INDEX OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_INDEX_ENABLE "EID cache hash index")
 ot_option(OT_ANDROID_NDK OPENTHREAD_CONFIG_ANDROID_NDK_ENABLE "enable android NDK")
 ot_option(OT_ANYCAST_LOCATOR OPENTHREAD_CONFIG_TMF_ANYCAST_LOCATOR_ENABLE "anycast locator")
 ot_option(OT_ASSERT OPENTHREAD_CONFIG_ASSERT_ENABLE "assert function OT_ASSERT()")
@@ -94,6 +98,7 @@ ot_option(OT_BORDER_ROUTING_DHCP6_PD OPENTHREAD_CONFIG_BORDER_ROUTING_DHCP6_PD_E
 ot_option(OT_BORDER_ROUTING_COUNTERS OPENTHREAD_CONFIG_IP6_BR_COUNTERS_ENABLE "border routing counters")
 ot_option(OT_CHANNEL_MANAGER OPENTHREAD_CONFIG_CHANNEL_MANAGER_ENABLE "channel manager")
 ot_option(OT_CHANNEL_MONITOR OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE "channel monitor")
+ot_option(OT_CHILD_TABLE_INDEX OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE "child table lookup indexes")
 ot_option(OT_COAP OPENTHREAD_CONFIG_COAP_API_ENABLE "coap api")
 ot_option(OT_COAP_BLOCK OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE "coap block-wise transfer (RFC7959)")
 ot_option(OT_COAP_OBSERVE OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE "coap observe (RFC7641)")
@@ -107,15 +112,20 @@ ot_option(OT_DHCP6_CLIENT OPENTHREAD_CONFIG_DHCP6_CLIENT_ENABLE "DHCP6 client")
 ot_option(OT_DHCP6_SERVER OPENTHREAD_CONFIG_DHCP6_SERVER_ENABLE "DHCP6 server")
 ot_option(OT_DIAGNOSTIC OPENTHREAD_CONFIG_DIAG_ENABLE "diagnostic")
 ot_option(OT_DNS_CLIENT OPENTHREAD_CONFIG_DNS_CLIENT_ENABLE "DNS client")
+ot_option(OT_DNS_CLIENT_CACHE OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE "DNS client response cache")
 ot_option(OT_DNS_CLIENT_OVER_TCP OPENTHREAD_CONFIG_DNS_CLIENT_OVER_TCP_ENABLE  "Enable dns query over tcp")
 ot_option(OT_DNS_DSO OPENTHREAD_CONFIG_DNS_DSO_ENABLE "DNS Stateful Operations (DSO)")
 ot_option(OT_DNS_UPSTREAM_QUERY OPENTHREAD_CONFIG_DNS_UPSTREAM_QUERY_ENABLE "Allow sending DNS queries to upstream")
 ot_option(OT_DNSSD_SERVER OPENTHREAD_CONFIG_DNSSD_SERVER_ENABLE "DNS-SD server")
+ot_option(OT_DNSSD_SERVER_ANSWER_CACHE OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE "DNS-SD server answer cache")
 ot_option(OT_DUA OPENTHREAD_CONFIG_DUA_ENABLE "Domain Unicast Address (DUA)")
 ot_option(OT_ECDSA OPENTHREAD_CONFIG_ECDSA_ENABLE "ECDSA")
 ot_option(OT_EXTERNAL_HEAP OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE "external heap")
 ot_option(OT_FIREWALL OPENTHREAD_POSIX_CONFIG_FIREWALL_ENABLE "firewall")
+ot_option(OT_HDLC_SLICE_BY_4_FCS OPENTHREAD_SPINEL_CONFIG_HDLC_SLICE_BY_4_FCS_ENABLE "HDLC slice-by-4 FCS")
+ot_option(OT_HEAP_SLAB OPENTHREAD_CONFIG_HEAP_SLAB_ENABLE "heap slab allocator")
 ot_option(OT_HISTORY_TRACKER OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE "history tracker")
+ot_option(OT_INDIRECT_SENDER_MESSAGE_INDEX OPENTHREAD_CONFIG_INDIRECT_SENDER_MESSAGE_INDEX_ENABLE "indirect sender message index")
 ot_option(OT_IP6_FRAGM OPENTHREAD_CONFIG_IP6_FRAGMENTATION_ENABLE "ipv6 fragmentation")
 ot_option(OT_JAM_DETECTION OPENTHREAD_CONFIG_JAM_DETECTION_ENABLE "jam detection")
 ot_option(OT_JOINER OPENTHREAD_CONFIG_JOINER_ENABLE "joiner")
@@ -126,11 +136,14 @@ ot_option(OT_LOG_LEVEL_DYNAMIC OPENTHREAD_CONFIG_LOG_LEVEL_DYNAMIC_ENABLE "dynam
 ot_option(OT_MAC_FILTER OPENTHREAD_CONFIG_MAC_FILTER_ENABLE "mac filter")
 ot_option(OT_MESH_DIAG OPENTHREAD_CONFIG_MESH_DIAG_ENABLE "mesh diag")
 ot_option(OT_MESSAGE_USE_HEAP OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE "heap allocator for message buffers")
+ot_option(OT_MESSAGE_SHARED_BUFFERS OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE "copy-on-write shared message buffers")
+ot_option(OT_MESSAGE_BUFFER_USAGE OPENTHREAD_CONFIG_MESSAGE_BUFFER_USAGE_ENABLE "per-subsystem message buffer usage")
 ot_option(OT_MLE_LONG_ROUTES OPENTHREAD_CONFIG_MLE_LONG_ROUTES_ENABLE "MLE long routes extension (experimental)")
 ot_option(OT_MLR OPENTHREAD_CONFIG_MLR_ENABLE "Multicast Listener Registration (MLR)")
 ot_option(OT_MULTIPLE_INSTANCE OPENTHREAD_CONFIG_MULTIPLE_INSTANCE_ENABLE "multiple instances")
 ot_option(OT_NAT64_BORDER_ROUTING OPENTHREAD_CONFIG_NAT64_BORDER_ROUTING_ENABLE "border routing NAT64")
 ot_option(OT_NAT64_TRANSLATOR OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE "NAT64 translator support")
+ot_option(OT_NAT64_PORT_TRANSLATION OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE "NAT64 port translation (NAPT)")
 ot_option(OT_NEIGHBOR_DISCOVERY_AGENT OPENTHREAD_CONFIG_NEIGHBOR_DISCOVERY_AGENT_ENABLE "neighbor discovery agent")
 ot_option(OT_NETDATA_PUBLISHER OPENTHREAD_CONFIG_NETDATA_PUBLISHER_ENABLE "Network Data publisher")
 ot_option(OT_NETDIAG_CLIENT OPENTHREAD_CONFIG_TMF_NETDIAG_CLIENT_ENABLE "Network Diagnostic client")
@@ -146,11 +159,14 @@ ot_option(OT_SLAAC OPENTHREAD_CONFIG_IP6_SLAAC_ENABLE "SLAAC address")
 ot_option(OT_SNTP_CLIENT OPENTHREAD_CONFIG_SNTP_CLIENT_ENABLE "SNTP client")
 ot_option(OT_SRP_CLIENT OPENTHREAD_CONFIG_SRP_CLIENT_ENABLE "SRP client")
 ot_option(OT_SRP_SERVER OPENTHREAD_CONFIG_SRP_SERVER_ENABLE "SRP server")
+ot_option(OT_SRP_SERVER_PERSISTENCE OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE "SRP server registrations persistence")
 ot_option(OT_TCP OPENTHREAD_CONFIG_TCP_ENABLE "TCP")
 ot_option(OT_TIME_SYNC OPENTHREAD_CONFIG_TIME_SYNC_ENABLE "time synchronization service")
+ot_option(OT_TIMER_WHEEL OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE "timing wheel timer scheduler")
 ot_option(OT_TREL OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE "TREL radio link for Thread over Infrastructure feature")
 ot_option(OT_TX_BEACON_PAYLOAD OPENTHREAD_CONFIG_MAC_OUTGOING_BEACON_PAYLOAD_ENABLE "tx beacon payload")
 ot_option(OT_UDP_FORWARD OPENTHREAD_CONFIG_UDP_FORWARD_ENABLE "UDP forward")
+ot_option(OT_UDP_SOCKET_INDEX OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_ENABLE "UDP socket index")
 ot_option(OT_UPTIME OPENTHREAD_CONFIG_UPTIME_ENABLE "uptime")
 
 option(OT_DOC "Build OpenThread documentation")
@@ -675,6 +675,102 @@ otError otDnsServiceResponseGetHostAddress(const otDnsServiceResponse *aResponse
                                            otIp6Address               *aAddress,
                                            uint32_t                   *aTtl);
 
+/**
+ * Represents the type of a DNS client cache entry (i.e., the query type whose response is cached).
+ *
+ */
+typedef enum
+{
+    OT_DNS_CACHE_ENTRY_IP6_ADDRESS = 0, ///< Response to an IPv6 address (AAAA) resolution query.
+    OT_DNS_CACHE_ENTRY_IP4_ADDRESS = 1, ///< Response to an IPv4 address (A) resolution query.
+    OT_DNS_CACHE_ENTRY_BROWSE      = 2, ///< Response to a browse (PTR) query.
+    OT_DNS_CACHE_ENTRY_SERVICE     = 3, ///< Response to a service instance resolution query (SRV and TXT).
+    OT_DNS_CACHE_ENTRY_SERVICE_SRV = 4, ///< Response to a service instance resolution query (SRV only).
+    OT_DNS_CACHE_ENTRY_SERVICE_TXT = 5, ///< Response to a service instance resolution query (TXT only).
+} otDnsCacheEntryType;
+
+/**
+ * Represents information about a DNS client cache entry.
+ *
+ */
+typedef struct otDnsCacheEntryInfo
+{
+    char                mName[OT_DNS_MAX_NAME_SIZE]; ///< The queried name.
+    otDnsCacheEntryType mType;                       ///< The entry type.
+    otSockAddr          mServerSockAddr;             ///< The server which provided the response.
+    uint32_t            mTtl;                        ///< The remaining TTL (in seconds).
+    bool                mIsNegative;                 ///< Whether the entry is a negative (name error or no data) one.
+} otDnsCacheEntryInfo;
+
+/**
+ * Represents an iterator to go over the DNS client cache entries.
+ *
+ * The iterator MUST be set to zero before the first call to `otDnsClientGetNextCacheEntry()`.
+ *
+ */
+typedef uint16_t otDnsCacheIterator;
+
+/**
+ * Gets the DNS client cache size (the maximum number of cached responses).
+ *
+ * Requires `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE`.
+ *
+ * @param[in]  aInstance   A pointer to an OpenThread instance.
+ *
+ * @returns The current cache size. Zero indicates that the cache is disabled.
+ *
+ */
+uint16_t otDnsClientGetCacheSize(otInstance *aInstance);
+
+/**
+ * Sets the DNS client cache size (the maximum number of cached responses).
+ *
+ * Requires `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE`.
+ *
+ * If the new size is smaller than the number of currently cached responses, the least recently used entries are
+ * removed. Setting the size to zero disables the cache.
+ *
+ * @param[in]  aInstance   A pointer to an OpenThread instance.
+ * @param[in]  aSize       The new cache size.
+ *
+ * @retval OT_ERROR_NONE          The cache size was updated.
+ * @retval OT_ERROR_INVALID_ARGS  @p aSize is larger than `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES`.
+ *
+ */
+otError otDnsClientSetCacheSize(otInstance *aInstance, uint16_t aSize);
+
+/**
+ * Removes all entries from the DNS client cache.
+ *
+ * Requires `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE`.
+ *
+ * The cache is also flushed automatically when the Thread Network Data changes or when the default DNS server
+ * changes.
+ *
+ * @param[in]  aInstance   A pointer to an OpenThread instance.
+ *
+ */
+void otDnsClientFlushCache(otInstance *aInstance);
+
+/**
+ * Gets the next entry in the DNS client cache.
+ *
+ * Requires `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE`.
+ *
+ * Entries are returned from the least to the most recently used.
+ *
+ * @param[in]     aInstance   A pointer to an OpenThread instance.
+ * @param[in,out] aIterator   A pointer to the iterator. MUST be set to zero to get the first entry.
+ * @param[out]    aEntryInfo  A pointer to an `otDnsCacheEntryInfo` to output the entry info.
+ *
+ * @retval OT_ERROR_NONE        Found the next entry. @p aEntryInfo and @p aIterator are updated.
+ * @retval OT_ERROR_NOT_FOUND   No more entries in the cache.
+ *
+ */
+otError otDnsClientGetNextCacheEntry(otInstance          *aInstance,
+                                     otDnsCacheIterator  *aIterator,
+                                     otDnsCacheEntryInfo *aEntryInfo);
+
 /**
  * @}
  *
@@ -160,7 +160,8 @@ typedef struct otDnssdCounters
     uint32_t mNotImplementedResponse; ///< The number of 'not implemented' responses
     uint32_t mOtherResponse;          ///< The number of other responses
 
-    uint32_t mResolvedBySrp; ///< The number of queries completely resolved by the local SRP server
+    uint32_t mResolvedBySrp;   ///< The number of queries completely resolved by the local SRP server
+    uint32_t mResolvedByCache; ///< The number of queries (included in `mResolvedBySrp`) answered from the cache
 } otDnssdCounters;
 
 /**
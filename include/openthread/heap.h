@@ -35,6 +35,7 @@
 #ifndef OPENTHREAD_HEAP_H_
 #define OPENTHREAD_HEAP_H_
 
+#include <openthread/error.h>
 #include <openthread/instance.h>
 
 #ifdef __cplusplus
@@ -67,6 +68,66 @@ void *otHeapCAlloc(size_t aCount, size_t aSize);
  */
 void otHeapFree(void *aPointer);
 
+/**
+ * Represents the usage statistics of the OpenThread internal heap.
+ *
+ */
+typedef struct otHeapStats
+{
+    uint32_t mCapacity;         ///< The capacity of the heap in bytes.
+    uint32_t mFreeSize;         ///< The number of free bytes.
+    uint32_t mPeakUsedSize;     ///< The peak number of used bytes (since init or `otHeapResetPeakUsage()`).
+    uint32_t mLargestFreeBlock; ///< The size of the largest free block, i.e., the largest possible allocation.
+    uint16_t mNumFreeBlocks;    ///< The number of free blocks.
+    uint8_t  mFragmentation;    ///< The percentage of free bytes not in the largest free block.
+    uint32_t mNumAllocFailures; ///< The number of failed allocations.
+} otHeapStats;
+
+/**
+ * Represents the usage statistics of a size class of the OpenThread internal heap slab allocator.
+ *
+ */
+typedef struct otHeapSlabStats
+{
+    uint16_t mObjectSize;       ///< The size of the objects in this class in bytes.
+    uint16_t mNumPages;         ///< The number of pages allocated by this class.
+    uint16_t mNumObjectsInUse;  ///< The number of objects currently in use.
+    uint16_t mPeakObjectsInUse; ///< The peak number of objects in use (since init or `otHeapResetPeakUsage()`).
+    uint32_t mNumAllocs;        ///< The number of allocations served by this class.
+} otHeapSlabStats;
+
+/**
+ * Gets the usage statistics of the OpenThread internal heap.
+ *
+ * @param[out] aStats  A pointer to return the heap statistics.
+ *
+ * @retval OT_ERROR_NONE             Successfully retrieved the statistics.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  The internal heap is not used (external heap or RCP build).
+ *
+ */
+otError otHeapGetStats(otHeapStats *aStats);
+
+/**
+ * Gets the usage statistics of a size class of the OpenThread internal heap slab allocator.
+ *
+ * Requires `OPENTHREAD_CONFIG_HEAP_SLAB_ENABLE`.
+ *
+ * @param[in]  aIndex  The index of the size class, starting from zero for the smallest size.
+ * @param[out] aStats  A pointer to return the size class statistics.
+ *
+ * @retval OT_ERROR_NONE             Successfully retrieved the statistics.
+ * @retval OT_ERROR_NOT_FOUND        There is no size class with index @p aIndex.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  The slab allocator is not enabled.
+ *
+ */
+otError otHeapGetSlabStats(uint8_t aIndex, otHeapSlabStats *aStats);
+
+/**
+ * Resets the peak usage of the OpenThread internal heap (and of its slab size classes) to the current usage.
+ *
+ */
+void otHeapResetPeakUsage(void);
+
 /**
  * @}
  *
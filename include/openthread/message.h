@@ -305,8 +305,61 @@ typedef struct otBufferInfo
     otMessageQueueInfo mCoapQueue;            ///< Info about CoAP/TMF send queue.
     otMessageQueueInfo mCoapSecureQueue;      ///< Info about CoAP secure send queue.
     otMessageQueueInfo mApplicationCoapQueue; ///< Info about application CoAP send queue.
+
+    /**
+     * The number of buffers that cloned messages shared with their original message instead of copying, since OT
+     * stack initialization or last call to `otMessageResetBufferInfo()`.
+     *
+     * Always zero unless `OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE` is set.
+     *
+     */
+    uint32_t mSharedBuffers;
+
+    /**
+     * The number of shared buffers that were later copied because a message sharing them was modified, since OT
+     * stack initialization or last call to `otMessageResetBufferInfo()`.
+     *
+     * The number of buffers saved by sharing is `mSharedBuffers - mCopyOnWriteBuffers`.
+     *
+     */
+    uint32_t mCopyOnWriteBuffers;
 } otBufferInfo;
 
+/**
+ * Represents the OpenThread subsystem that allocated a message.
+ *
+ */
+typedef enum otMessageOrigin
+{
+    OT_MESSAGE_ORIGIN_OTHER      = 0, ///< Any other subsystem.
+    OT_MESSAGE_ORIGIN_HOST       = 1, ///< Public API, e.g., the NCP or the host network interface.
+    OT_MESSAGE_ORIGIN_LOWPAN     = 2, ///< Received or forwarded 6LoWPAN frames (MAC and mesh forwarding).
+    OT_MESSAGE_ORIGIN_REASSEMBLY = 3, ///< 6LoWPAN reassembly.
+    OT_MESSAGE_ORIGIN_MPL        = 4, ///< MPL buffered messages.
+    OT_MESSAGE_ORIGIN_MLE        = 5, ///< MLE.
+    OT_MESSAGE_ORIGIN_COAP       = 6, ///< CoAP (TMF, secure and application CoAP, including cached responses).
+    OT_MESSAGE_ORIGIN_DNS        = 7, ///< DNS client and DNS-SD server.
+    OT_MESSAGE_ORIGIN_SRP        = 8, ///< SRP client and server.
+} otMessageOrigin;
+
+#define OT_MESSAGE_NUM_ORIGINS 9 ///< Number of `otMessageOrigin` values.
+
+/**
+ * Represents the message buffer usage of a subsystem (see `otMessageOrigin`).
+ *
+ */
+typedef struct otMessageBufferUsage
+{
+    uint16_t mNumBuffers; ///< Number of buffers used by messages currently allocated by the subsystem.
+
+    /**
+     * The maximum number of buffers used at the same time by messages allocated by the subsystem, since OT stack
+     * initialization or last call to `otMessageResetBufferInfo()`.
+     *
+     */
+    uint16_t mMaxBuffers;
+} otMessageBufferUsage;
+
 /**
  * Initialize the message queue.
  *
@@ -380,13 +433,42 @@ void otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo);
 /**
  * Reset the Message Buffer information counter tracking the maximum number buffers in use at the same time.
  *
- * This resets `mMaxUsedBuffers` in `otBufferInfo`.
+ * This resets `mMaxUsedBuffers`, `mSharedBuffers` and `mCopyOnWriteBuffers` in `otBufferInfo`, and `mMaxBuffers` in
+ * `otMessageBufferUsage` of all subsystems.
  *
  * @param[in]   aInstance    A pointer to the OpenThread instance.
  *
  */
 void otMessageResetBufferInfo(otInstance *aInstance);
 
+/**
+ * Get the message buffer usage of a given subsystem.
+ *
+ * Requires `OPENTHREAD_CONFIG_MESSAGE_BUFFER_USAGE_ENABLE`.
+ *
+ * Each message is accounted to the subsystem which allocated it. Buffers shared between a cloned message and its
+ * original (`OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE`) are accounted for each of the messages.
+ *
+ * @param[in]   aInstance    A pointer to the OpenThread instance.
+ * @param[in]   aOrigin      The subsystem.
+ * @param[out]  aUsage       A pointer to return the buffer usage.
+ *
+ * @retval OT_ERROR_NONE          Successfully retrieved the buffer usage.
+ * @retval OT_ERROR_INVALID_ARGS  @p aOrigin is not valid.
+ *
+ */
+otError otMessageGetBufferUsage(otInstance *aInstance, otMessageOrigin aOrigin, otMessageBufferUsage *aUsage);
+
+/**
+ * Converts a given message origin to a human-readable string.
+ *
+ * @param[in]  aOrigin   The message origin.
+ *
+ * @returns The string representation of @p aOrigin, or "invalid" if @p aOrigin is not a valid origin.
+ *
+ */
+const char *otMessageOriginToString(otMessageOrigin aOrigin);
+
 /**
  * @}
  *
@@ -173,6 +173,8 @@ typedef struct otNat64AddressMapping
 
     otIp4Address mIp4;             ///< The IPv4 address of the mapping.
     otIp6Address mIp6;             ///< The IPv6 address of the mapping.
+    uint16_t     mIp4Port;         ///< The IPv4 port (or ICMP echo identifier), zero if port translation is disabled.
+    uint16_t     mIp6Port;         ///< The IPv6 port (or ICMP echo identifier), zero if port translation is disabled.
     uint32_t     mRemainingTimeMs; ///< Remaining time before expiry in milliseconds.
 
     otNat64ProtocolCounters mCounters;
@@ -106,6 +106,8 @@ void otPlatMessagePoolFree(otInstance *aInstance, otMessageBuffer *aBuffer);
  *
  * @param[in]  aInstance  A pointer to the OpenThread instance.
  *
+ * A pool which allocates buffers on demand should also count the buffers it is still able to allocate.
+ *
  * @returns The number of buffers currently free and available to OpenThread.
  *
  */
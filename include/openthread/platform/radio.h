@@ -996,6 +996,43 @@ void otPlatRadioClearSrcMatchShortEntries(otInstance *aInstance);
  */
 void otPlatRadioClearSrcMatchExtEntries(otInstance *aInstance);
 
+/**
+ * Begins a batch of source address match updates.
+ *
+ * Until `otPlatRadioCommitSrcMatchUpdate()` is called, the radio driver may defer applying the source address match
+ * table changes and the enabling/disabling of the source address match feature, so that they are all applied at once
+ * (e.g., in a single transaction with a radio co-processor). The final state after the commit must be the same as if
+ * the changes were applied one by one.
+ *
+ * While a batch is in progress, `otPlatRadioAddSrcMatchShortEntry()` and `otPlatRadioAddSrcMatchExtEntry()` may
+ * return `OT_ERROR_NONE` for an entry that can not be added to the radio, the error is then reported by
+ * `otPlatRadioCommitSrcMatchUpdate()`.
+ *
+ * This function is optional. The default implementation does nothing, i.e., the changes are applied immediately.
+ *
+ * @param[in]  aInstance   The OpenThread instance structure.
+ *
+ */
+void otPlatRadioBeginSrcMatchUpdate(otInstance *aInstance);
+
+/**
+ * Commits the source address match updates made since `otPlatRadioBeginSrcMatchUpdate()`.
+ *
+ * If the commit fails, the radio may have applied only part of the updates. OpenThread then disables the source
+ * address match and rebuilds the table outside of a batch, relying on `otPlatRadioAddSrcMatchShortEntry()` and
+ * `otPlatRadioAddSrcMatchExtEntry()` to report whether each entry was added.
+ *
+ * This function is optional. The default implementation does nothing and returns `OT_ERROR_NONE`.
+ *
+ * @param[in]  aInstance   The OpenThread instance structure.
+ *
+ * @retval OT_ERROR_NONE     Successfully applied all the updates.
+ * @retval OT_ERROR_NO_BUFS  No available entry in the source match table for some of the added addresses.
+ * @retval OT_ERROR_FAILED   Failed to apply the updates.
+ *
+ */
+otError otPlatRadioCommitSrcMatchUpdate(otInstance *aInstance);
+
 /**
  * Get the radio supported channel mask that the device is allowed to be on.
  *
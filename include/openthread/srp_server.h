@@ -203,6 +203,23 @@ typedef struct otSrpServerResponseCounters
     uint32_t mOther;         ///< The number of other responses.
 } otSrpServerResponseCounters;
 
+/**
+ * Includes the statistics of SRP server lease expirations.
+ *
+ * Service counters count every expired service entry, i.e., a service instance and each of its sub-types.
+ *
+ */
+typedef struct otSrpServerLeaseCounters
+{
+    uint32_t mHostLeaseExpirations;       ///< The number of hosts whose lease expired.
+    uint32_t mHostKeyLeaseExpirations;    ///< The number of hosts whose key lease expired.
+    uint32_t mServiceLeaseExpirations;    ///< The number of services whose lease expired.
+    uint32_t mServiceKeyLeaseExpirations; ///< The number of services whose key lease expired.
+    uint32_t mLeaseTimerRuns;             ///< The number of times the lease timer was handled.
+    uint32_t mLastRunExpirations;         ///< The number of lease/key lease expirations in the last timer run.
+    uint32_t mMaxRunExpirations;          ///< The max number of lease/key lease expirations in a single timer run.
+} otSrpServerLeaseCounters;
+
 /**
  * Returns the domain authorized to the SRP server.
  *
@@ -482,6 +499,19 @@ const otSrpServerHost *otSrpServerGetNextHost(otInstance *aInstance, const otSrp
  */
 const otSrpServerResponseCounters *otSrpServerGetResponseCounters(otInstance *aInstance);
 
+/**
+ * Returns the lease expiry counters of the SRP server.
+ *
+ * The counters track the host and service leases and key leases expired by the SRP server, and how many of them
+ * were handled in each run of the lease timer.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns  A pointer to the lease expiry counters of the SRP server.
+ *
+ */
+const otSrpServerLeaseCounters *otSrpServerGetLeaseCounters(otInstance *aInstance);
+
 /**
  * Tells if the SRP service host has been deleted.
  *
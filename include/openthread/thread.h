@@ -163,6 +163,20 @@ typedef struct otIpCounters
     uint32_t mRxFailure; ///< The number of IPv6 packets failed to receive.
 } otIpCounters;
 
+/**
+ * Represents the 6LoWPAN reassembly counters.
+ *
+ */
+typedef struct otReassemblyCounters
+{
+    uint16_t mCurrentDatagrams;   ///< Number of datagrams currently being reassembled.
+    uint16_t mMaxDatagrams;       ///< Maximum number of datagrams being reassembled at the same time.
+    uint32_t mTimeouts;           ///< Number of datagrams dropped on reassembly timeout.
+    uint32_t mDroppedDatagrams;   ///< Number of datagrams dropped before completion for other reasons.
+    uint32_t mDroppedFragments;   ///< Number of received fragments dropped (e.g., with no matching datagram).
+    uint32_t mForwardedDatagrams; ///< Number of datagrams forwarded fragment by fragment without reassembly.
+} otReassemblyCounters;
+
 /**
  * Represents the Thread MLE counters.
  *
@@ -902,6 +916,26 @@ const otIpCounters *otThreadGetIp6Counters(otInstance *aInstance);
  */
 void otThreadResetIp6Counters(otInstance *aInstance);
 
+/**
+ * Gets the 6LoWPAN reassembly counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the 6LoWPAN reassembly counters.
+ *
+ */
+const otReassemblyCounters *otThreadGetReassemblyCounters(otInstance *aInstance);
+
+/**
+ * Resets the 6LoWPAN reassembly counters.
+ *
+ * The number of datagrams currently being reassembled is kept, and the maximum is set to it.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otThreadResetReassemblyCounters(otInstance *aInstance);
+
 /**
  * Gets the Thread MLE counters.
  *
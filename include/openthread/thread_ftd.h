@@ -123,6 +123,17 @@ typedef struct otCacheEntryIterator
     const void *mData[2]; ///< Opaque data used by the core implementation. Should not be changed by user.
 } otCacheEntryIterator;
 
+/**
+ * Represents the EID cache counters.
+ *
+ */
+typedef struct otCacheCounters
+{
+    uint32_t mHits;      ///< Number of EID lookups resolved from a cached or snooped entry.
+    uint32_t mMisses;    ///< Number of EID lookups with no resolved entry (including ongoing or failed queries).
+    uint32_t mEvictions; ///< Number of entries evicted to make room for a new entry.
+} otCacheCounters;
+
 /**
  * Gets the maximum number of children currently allowed.
  *
@@ -644,6 +655,52 @@ otError otThreadGetRouterInfo(otInstance *aInstance, uint16_t aRouterId, otRoute
  */
 otError otThreadGetNextCacheEntry(otInstance *aInstance, otCacheEntryInfo *aEntryInfo, otCacheEntryIterator *aIterator);
 
+/**
+ * Gets the EID cache counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the EID cache counters.
+ *
+ */
+const otCacheCounters *otThreadGetCacheCounters(otInstance *aInstance);
+
+/**
+ * Resets the EID cache counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otThreadResetCacheCounters(otInstance *aInstance);
+
+/**
+ * Gets the number of entries in the EID cache.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns The number of EID cache entries.
+ *
+ */
+uint16_t otThreadGetCacheSize(otInstance *aInstance);
+
+/**
+ * Sets the number of entries in the EID cache.
+ *
+ * Requires `OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_DYNAMIC_SIZE_ENABLE`. The EID cache entries are allocated from the
+ * heap, and all existing entries are removed. Can only be called when the Thread protocol is disabled.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[in]  aSize      The number of EID cache entries.
+ *
+ * @retval OT_ERROR_NONE             Successfully set the number of entries.
+ * @retval OT_ERROR_INVALID_STATE    The Thread protocol is enabled.
+ * @retval OT_ERROR_INVALID_ARGS     @p aSize is zero or too large.
+ * @retval OT_ERROR_NO_BUFS          Could not allocate the entries.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  `OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_DYNAMIC_SIZE_ENABLE` is not enabled.
+ *
+ */
+otError otThreadSetCacheSize(otInstance *aInstance, uint16_t aSize);
+
 /**
  * Get the Thread PSKc
  *
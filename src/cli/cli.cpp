@@ -1034,6 +1034,10 @@ exit:
  * *   The first number shows number messages in the queue.
  * *   The second number shows number of buffers used by all messages in the queue.
  * *   The third number shows total number of bytes of all messages in the queue.
+ * @par
+ * When `OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE` is set, `shared` finally displays the number of buffers
+ * that cloned messages shared instead of copying, and `copy-on-write` the number of shared buffers that were later
+ * copied because a message was modified (both since OT stack initialization or last `bufferinfo reset`).
  * @sa otMessageGetBufferInfo
  */
 template <> otError Interpreter::Process<Cmd("bufferinfo")>(Arg aArgs[])
@@ -1072,6 +1076,11 @@ template <> otError Interpreter::Process<Cmd("bufferinfo")>(Arg aArgs[])
             OutputLine("%s: %u %u %lu", info.mName, (bufferInfo.*info.mQueuePtr).mNumMessages,
                        (bufferInfo.*info.mQueuePtr).mNumBuffers, ToUlong((bufferInfo.*info.mQueuePtr).mTotalBytes));
         }
+
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+        OutputLine("shared: %lu", ToUlong(bufferInfo.mSharedBuffers));
+        OutputLine("copy-on-write: %lu", ToUlong(bufferInfo.mCopyOnWriteBuffers));
+#endif
     }
     /**
      * @cli bufferinfo reset
@@ -1086,6 +1095,40 @@ template <> otError Interpreter::Process<Cmd("bufferinfo")>(Arg aArgs[])
     {
         otMessageResetBufferInfo(GetInstancePtr());
     }
+#if OPENTHREAD_CONFIG_MESSAGE_BUFFER_USAGE_ENABLE
+    /**
+     * @cli bufferinfo usage
+     * @code
+     * bufferinfo usage
+     * other: 0 1
+     * host: 0 3
+     * 6lo: 2 4
+     * 6lo reas: 0 0
+     * mpl: 0 0
+     * mle: 1 2
+     * coap: 0 1
+     * dns: 0 0
+     * srp: 0 2
+     * Done
+     * @endcode
+     * @par
+     * Gets the message buffer usage per allocating subsystem. Each line shows the number of buffers currently
+     * held by messages allocated by the subsystem, followed by the peak since OT stack initialization or last
+     * `bufferinfo reset`.
+     * @sa otMessageGetBufferUsage
+     */
+    else if (aArgs[0] == "usage")
+    {
+        for (uint8_t origin = 0; origin < OT_MESSAGE_NUM_ORIGINS; origin++)
+        {
+            otMessageBufferUsage usage;
+
+            IgnoreError(otMessageGetBufferUsage(GetInstancePtr(), static_cast<otMessageOrigin>(origin), &usage));
+            OutputLine("%s: %u %u", otMessageOriginToString(static_cast<otMessageOrigin>(origin)), usage.mNumBuffers,
+                       usage.mMaxBuffers);
+        }
+    }
+#endif
     else
     {
         error = OT_ERROR_INVALID_ARGS;
@@ -106,6 +106,110 @@ exit:
 
 #if OPENTHREAD_CONFIG_DNS_CLIENT_ENABLE
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
+template <> otError Dns::Process<Cmd("cache")>(Arg aArgs[])
+{
+    static const char *const kEntryTypeStrings[] = {
+        "ip6",         // (0) OT_DNS_CACHE_ENTRY_IP6_ADDRESS
+        "ip4",         // (1) OT_DNS_CACHE_ENTRY_IP4_ADDRESS
+        "browse",      // (2) OT_DNS_CACHE_ENTRY_BROWSE
+        "service",     // (3) OT_DNS_CACHE_ENTRY_SERVICE
+        "service_srv", // (4) OT_DNS_CACHE_ENTRY_SERVICE_SRV
+        "service_txt", // (5) OT_DNS_CACHE_ENTRY_SERVICE_TXT
+    };
+
+    static_assert(0 == OT_DNS_CACHE_ENTRY_IP6_ADDRESS, "OT_DNS_CACHE_ENTRY_IP6_ADDRESS value is incorrect");
+    static_assert(1 == OT_DNS_CACHE_ENTRY_IP4_ADDRESS, "OT_DNS_CACHE_ENTRY_IP4_ADDRESS value is incorrect");
+    static_assert(2 == OT_DNS_CACHE_ENTRY_BROWSE, "OT_DNS_CACHE_ENTRY_BROWSE value is incorrect");
+    static_assert(3 == OT_DNS_CACHE_ENTRY_SERVICE, "OT_DNS_CACHE_ENTRY_SERVICE value is incorrect");
+    static_assert(4 == OT_DNS_CACHE_ENTRY_SERVICE_SRV, "OT_DNS_CACHE_ENTRY_SERVICE_SRV value is incorrect");
+    static_assert(5 == OT_DNS_CACHE_ENTRY_SERVICE_TXT, "OT_DNS_CACHE_ENTRY_SERVICE_TXT value is incorrect");
+
+    otError error = OT_ERROR_NONE;
+
+    /**
+     * @cli dns cache
+     * @code
+     * dns cache
+     * ip6 host.default.service.arpa. ttl:118 server:[fd00:0:0:0:0:0:0:1]:53
+     * browse _test._udp.default.service.arpa. ttl:25 negative server:[fd00:0:0:0:0:0:0:1]:53
+     * Done
+     * @endcode
+     * @par
+     * Lists the cached DNS responses from the least to the most recently used, with the remaining
+     * TTL in seconds and whether the entry is a negative (name error or no data) response.
+     * `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE` is required.
+     * @sa otDnsClientGetNextCacheEntry
+     */
+    if (aArgs[0].IsEmpty())
+    {
+        otDnsCacheIterator  iterator = 0;
+        otDnsCacheEntryInfo entryInfo;
+
+        while (otDnsClientGetNextCacheEntry(GetInstancePtr(), &iterator, &entryInfo) == OT_ERROR_NONE)
+        {
+            OutputFormat("%s %s ttl:%lu%s server:", Stringify(entryInfo.mType, kEntryTypeStrings), entryInfo.mName,
+                         ToUlong(entryInfo.mTtl), entryInfo.mIsNegative ? " negative" : "");
+            OutputSockAddrLine(entryInfo.mServerSockAddr);
+        }
+    }
+    /**
+     * @cli dns cache flush
+     * @code
+     * dns cache flush
+     * Done
+     * @endcode
+     * @par api_copy
+     * #otDnsClientFlushCache
+     */
+    else if (aArgs[0] == "flush")
+    {
+        otDnsClientFlushCache(GetInstancePtr());
+    }
+    /**
+     * @cli dns cache size
+     * @code
+     * dns cache size
+     * 8
+     * Done
+     * @endcode
+     * @code
+     * dns cache size 4
+     * Done
+     * @endcode
+     * @cparam dns cache size [@ca{size}]
+     * @par
+     * Gets or sets the maximum number of cached responses. Zero disables the cache.
+     * @sa otDnsClientGetCacheSize
+     * @sa otDnsClientSetCacheSize
+     */
+    else if (aArgs[0] == "size")
+    {
+        if (aArgs[1].IsEmpty())
+        {
+            OutputLine("%u", otDnsClientGetCacheSize(GetInstancePtr()));
+        }
+        else
+        {
+            uint16_t size;
+
+            VerifyOrExit(aArgs[2].IsEmpty(), error = OT_ERROR_INVALID_ARGS);
+            SuccessOrExit(error = aArgs[1].ParseAsUint16(size));
+            error = otDnsClientSetCacheSize(GetInstancePtr(), size);
+        }
+    }
+    else
+    {
+        error = OT_ERROR_INVALID_COMMAND;
+    }
+
+exit:
+    return error;
+}
+
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
 template <> otError Dns::Process<Cmd("config")>(Arg aArgs[])
 {
     otError error = OT_ERROR_NONE;
@@ -706,6 +810,9 @@ otError Dns::Process(Arg aArgs[])
 #if OPENTHREAD_CONFIG_DNS_CLIENT_ENABLE && OPENTHREAD_CONFIG_DNS_CLIENT_SERVICE_DISCOVERY_ENABLE
         CmdEntry("browse"),
 #endif
+#if OPENTHREAD_CONFIG_DNS_CLIENT_ENABLE && OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+        CmdEntry("cache"),
+#endif
 #if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
         CmdEntry("compression"),
 #endif
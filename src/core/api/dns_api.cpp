@@ -255,4 +255,30 @@ otError otDnsServiceResponseGetHostAddress(const otDnsServiceResponse *aResponse
 
 #endif // OPENTHREAD_CONFIG_DNS_CLIENT_SERVICE_DISCOVERY_ENABLE
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
+uint16_t otDnsClientGetCacheSize(otInstance *aInstance)
+{
+    return AsCoreType(aInstance).Get<Dns::Client>().GetCacheSize();
+}
+
+otError otDnsClientSetCacheSize(otInstance *aInstance, uint16_t aSize)
+{
+    return AsCoreType(aInstance).Get<Dns::Client>().SetCacheSize(aSize);
+}
+
+void otDnsClientFlushCache(otInstance *aInstance) { AsCoreType(aInstance).Get<Dns::Client>().FlushCache(); }
+
+otError otDnsClientGetNextCacheEntry(otInstance          *aInstance,
+                                     otDnsCacheIterator  *aIterator,
+                                     otDnsCacheEntryInfo *aEntryInfo)
+{
+    AssertPointerIsNotNull(aIterator);
+    AssertPointerIsNotNull(aEntryInfo);
+
+    return AsCoreType(aInstance).Get<Dns::Client>().GetNextCacheEntry(*aIterator, *aEntryInfo);
+}
+
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
 #endif // OPENTHREAD_CONFIG_DNS_CLIENT_ENABLE
@@ -36,6 +36,9 @@
 #include <openthread/heap.h>
 
 #include "common/heap.hpp"
+#include "common/instance.hpp"
+
+using namespace ot;
 
 #if OPENTHREAD_RADIO
 
@@ -64,3 +67,51 @@ void *otHeapCAlloc(size_t aCount, size_t aSize) { return ot::Heap::CAlloc(aCount
 
 void otHeapFree(void *aPointer) { ot::Heap::Free(aPointer); }
 #endif // OPENTHREAD_RADIO
+
+#if !OPENTHREAD_RADIO && !OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
+
+otError otHeapGetStats(otHeapStats *aStats)
+{
+    AssertPointerIsNotNull(aStats);
+
+    Instance::GetHeap().GetStats(*static_cast<Utils::Heap::Stats *>(aStats));
+
+    return kErrorNone;
+}
+
+otError otHeapGetSlabStats(uint8_t aIndex, otHeapSlabStats *aStats)
+{
+#if OPENTHREAD_CONFIG_HEAP_SLAB_ENABLE
+    AssertPointerIsNotNull(aStats);
+
+    return Instance::GetHeap().GetSlabStats(aIndex, *static_cast<Utils::Heap::SlabStats *>(aStats));
+#else
+    OT_UNUSED_VARIABLE(aIndex);
+    OT_UNUSED_VARIABLE(aStats);
+
+    return kErrorNotImplemented;
+#endif
+}
+
+void otHeapResetPeakUsage(void) { Instance::GetHeap().ResetPeakUsage(); }
+
+#else // !OPENTHREAD_RADIO && !OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
+
+otError otHeapGetStats(otHeapStats *aStats)
+{
+    OT_UNUSED_VARIABLE(aStats);
+
+    return kErrorNotImplemented;
+}
+
+otError otHeapGetSlabStats(uint8_t aIndex, otHeapSlabStats *aStats)
+{
+    OT_UNUSED_VARIABLE(aIndex);
+    OT_UNUSED_VARIABLE(aStats);
+
+    return kErrorNotImplemented;
+}
+
+void otHeapResetPeakUsage(void) {}
+
+#endif // !OPENTHREAD_RADIO && !OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
@@ -138,7 +138,14 @@ otError otIp6Send(otInstance *aInstance, otMessage *aMessage)
 
 otMessage *otIp6NewMessage(otInstance *aInstance, const otMessageSettings *aSettings)
 {
-    return AsCoreType(aInstance).Get<Ip6::Ip6>().NewMessage(0, Message::Settings::From(aSettings));
+    Message *message = AsCoreType(aInstance).Get<Ip6::Ip6>().NewMessage(0, Message::Settings::From(aSettings));
+
+    if (message != nullptr)
+    {
+        message->SetOrigin(Message::kOriginHost);
+    }
+
+    return message;
 }
 
 otMessage *otIp6NewMessageFromBuffer(otInstance              *aInstance,
@@ -146,8 +153,15 @@ otMessage *otIp6NewMessageFromBuffer(otInstance              *aInstance,
                                      uint16_t                 aDataLength,
                                      const otMessageSettings *aSettings)
 {
-    return AsCoreType(aInstance).Get<Ip6::Ip6>().NewMessageFromData(aData, aDataLength,
-                                                                    Message::Settings::From(aSettings));
+    Message *message = AsCoreType(aInstance).Get<Ip6::Ip6>().NewMessageFromData(aData, aDataLength,
+                                                                                Message::Settings::From(aSettings));
+
+    if (message != nullptr)
+    {
+        message->SetOrigin(Message::kOriginHost);
+    }
+
+    return message;
 }
 
 otError otIp6AddUnsecurePort(otInstance *aInstance, uint16_t aPort)
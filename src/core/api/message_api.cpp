@@ -64,6 +64,11 @@ void otMessageSetDirectTransmission(otMessage *aMessage, bool aEnabled)
     }
 }
 
+const char *otMessageOriginToString(otMessageOrigin aOrigin)
+{
+    return Message::OriginToString(static_cast<Message::Origin>(aOrigin));
+}
+
 int8_t otMessageGetRss(const otMessage *aMessage) { return AsCoreType(aMessage).GetAverageRss(); }
 
 otError otMessageAppend(otMessage *aMessage, const void *aBuf, uint16_t aLength)
@@ -133,4 +138,19 @@ void otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo)
 }
 
 void otMessageResetBufferInfo(otInstance *aInstance) { AsCoreType(aInstance).ResetBufferInfo(); }
+
+#if OPENTHREAD_CONFIG_MESSAGE_BUFFER_USAGE_ENABLE
+otError otMessageGetBufferUsage(otInstance *aInstance, otMessageOrigin aOrigin, otMessageBufferUsage *aUsage)
+{
+    Error error = kErrorNone;
+
+    AssertPointerIsNotNull(aUsage);
+    VerifyOrExit(aOrigin < Message::kNumOrigins, error = kErrorInvalidArgs);
+
+    *aUsage = AsCoreType(aInstance).Get<MessagePool>().GetBufferUsage(static_cast<Message::Origin>(aOrigin));
+
+exit:
+    return error;
+}
+#endif
 #endif // OPENTHREAD_MTD || OPENTHREAD_FTD
@@ -60,7 +60,14 @@ otError otNat64SetIp4Cidr(otInstance *aInstance, const otIp4Cidr *aCidr)
 
 otMessage *otIp4NewMessage(otInstance *aInstance, const otMessageSettings *aSettings)
 {
-    return AsCoreType(aInstance).Get<Nat64::Translator>().NewIp4Message(Message::Settings::From(aSettings));
+    Message *message = AsCoreType(aInstance).Get<Nat64::Translator>().NewIp4Message(Message::Settings::From(aSettings));
+
+    if (message != nullptr)
+    {
+        message->SetOrigin(Message::kOriginHost);
+    }
+
+    return message;
 }
 
 otError otNat64Send(otInstance *aInstance, otMessage *aMessage)
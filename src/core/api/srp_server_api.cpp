@@ -135,6 +135,11 @@ const otSrpServerResponseCounters *otSrpServerGetResponseCounters(otInstance *aI
     return AsCoreType(aInstance).Get<Srp::Server>().GetResponseCounters();
 }
 
+const otSrpServerLeaseCounters *otSrpServerGetLeaseCounters(otInstance *aInstance)
+{
+    return AsCoreType(aInstance).Get<Srp::Server>().GetLeaseCounters();
+}
+
 bool otSrpServerHostIsDeleted(const otSrpServerHost *aHost) { return AsCoreType(aHost).IsDeleted(); }
 
 const char *otSrpServerHostGetFullName(const otSrpServerHost *aHost) { return AsCoreType(aHost).GetFullName(); }
@@ -430,6 +430,16 @@ const otIpCounters *otThreadGetIp6Counters(otInstance *aInstance)
 
 void otThreadResetIp6Counters(otInstance *aInstance) { AsCoreType(aInstance).Get<MeshForwarder>().ResetCounters(); }
 
+const otReassemblyCounters *otThreadGetReassemblyCounters(otInstance *aInstance)
+{
+    return &AsCoreType(aInstance).Get<MeshForwarder>().GetReassemblyCounters();
+}
+
+void otThreadResetReassemblyCounters(otInstance *aInstance)
+{
+    AsCoreType(aInstance).Get<MeshForwarder>().ResetReassemblyCounters();
+}
+
 const otMleCounters *otThreadGetMleCounters(otInstance *aInstance)
 {
     return &AsCoreType(aInstance).Get<Mle::MleRouter>().GetCounters();
@@ -286,6 +286,30 @@ otError otThreadGetNextCacheEntry(otInstance *aInstance, otCacheEntryInfo *aEntr
                                                                           AsCoreType(aIterator));
 }
 
+const otCacheCounters *otThreadGetCacheCounters(otInstance *aInstance)
+{
+    return &AsCoreType(aInstance).Get<AddressResolver>().GetCounters();
+}
+
+void otThreadResetCacheCounters(otInstance *aInstance) { AsCoreType(aInstance).Get<AddressResolver>().ResetCounters(); }
+
+uint16_t otThreadGetCacheSize(otInstance *aInstance)
+{
+    return AsCoreType(aInstance).Get<AddressResolver>().GetCacheSize();
+}
+
+otError otThreadSetCacheSize(otInstance *aInstance, uint16_t aSize)
+{
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_DYNAMIC_SIZE_ENABLE
+    return AsCoreType(aInstance).Get<AddressResolver>().SetCacheSize(aSize);
+#else
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aSize);
+
+    return kErrorNotImplemented;
+#endif
+}
+
 #if OPENTHREAD_CONFIG_MLE_STEERING_DATA_SET_OOB_ENABLE
 void otThreadSetSteeringData(otInstance *aInstance, const otExtAddress *aExtAddress)
 {
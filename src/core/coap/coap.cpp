@@ -110,6 +110,7 @@ Message *CoapBase::NewMessage(const Message::Settings &aSettings)
 
     VerifyOrExit((message = AsCoapMessagePtr(Get<Ip6::Udp>().NewMessage(0, aSettings))) != nullptr);
     message->SetOffset(0);
+    message->SetOrigin(Message::kOriginCoap);
 
 exit:
     return message;
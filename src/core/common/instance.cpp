@@ -412,6 +412,10 @@ void Instance::GetBufferInfo(BufferInfo &aInfo)
     aInfo.mTotalBuffers   = Get<MessagePool>().GetTotalBufferCount();
     aInfo.mFreeBuffers    = Get<MessagePool>().GetFreeBufferCount();
     aInfo.mMaxUsedBuffers = Get<MessagePool>().GetMaxUsedBufferCount();
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+    aInfo.mSharedBuffers      = Get<MessagePool>().GetSharedBufferCount();
+    aInfo.mCopyOnWriteBuffers = Get<MessagePool>().GetCopyOnWriteBufferCount();
+#endif
 
     Get<MeshForwarder>().GetSendQueue().GetInfo(aInfo.m6loSendQueue);
     Get<MeshForwarder>().GetReassemblyQueue().GetInfo(aInfo.m6loReassemblyQueue);
@@ -437,7 +441,16 @@ void Instance::GetBufferInfo(BufferInfo &aInfo)
 #endif
 }
 
-void Instance::ResetBufferInfo(void) { Get<MessagePool>().ResetMaxUsedBufferCount(); }
+void Instance::ResetBufferInfo(void)
+{
+    Get<MessagePool>().ResetMaxUsedBufferCount();
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+    Get<MessagePool>().ResetSharedBufferCounters();
+#endif
+#if OPENTHREAD_CONFIG_MESSAGE_BUFFER_USAGE_ENABLE
+    Get<MessagePool>().ResetMaxBufferUsages();
+#endif
+}
 
 #endif // OPENTHREAD_MTD || OPENTHREAD_FTD
 
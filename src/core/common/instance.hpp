@@ -362,7 +362,8 @@ public:
      * Resets the Message Buffer information counter tracking maximum number buffers in use at the same
      * time.
      *
-     * Resets `mMaxUsedBuffers` in `BufferInfo`.
+     * Resets `mMaxUsedBuffers`, `mSharedBuffers` and `mCopyOnWriteBuffers` in `BufferInfo`, and the maximum buffer
+     * usage of all subsystems.
      *
      */
     void ResetBufferInfo(void);
@@ -0,0 +1,105 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for `LinearProbing` (slot handling of open-addressing hash tables).
+ */
+
+#ifndef LINEAR_PROBING_HPP_
+#define LINEAR_PROBING_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stdint.h>
+
+namespace ot {
+
+/**
+ * Provides the slot handling shared by open-addressing hash tables which use linear probing.
+ *
+ * Users of this class should follow CRTP-style inheritance, i.e., the `IndexType` class itself should publicly
+ * inherit from `LinearProbing<IndexType>`, declare it as a friend, and provide the following methods:
+ *
+ *  - `uint16_t GetNumSlots(void) const` which returns the number of slots in the table.
+ *  - `bool IsSlotEmpty(uint16_t aSlot) const` which indicates whether a slot is empty.
+ *  - `uint16_t GetHomeSlotOf(uint16_t aSlot) const` which returns the home slot of the entry in a non-empty slot.
+ *  - `void MoveSlot(uint16_t aFromSlot, uint16_t aToSlot)` which moves the entry in `aFromSlot` to the empty
+ *    `aToSlot` and leaves `aFromSlot` empty.
+ *
+ * @tparam IndexType   The hash table type.
+ *
+ */
+template <typename IndexType> class LinearProbing
+{
+protected:
+    /**
+     * Returns the slot following a given slot (wrapping around at the end of the table).
+     *
+     * @param[in] aSlot  The slot.
+     *
+     * @returns The next slot.
+     *
+     */
+    uint16_t GetNextSlot(uint16_t aSlot) const
+    {
+        return (aSlot + 1 < static_cast<const IndexType *>(this)->GetNumSlots()) ? aSlot + 1 : 0;
+    }
+
+    /**
+     * Shifts back the entries following a slot which was just emptied.
+     *
+     * Any later entry in the same probe run which can no longer be reached from its home slot is moved back, so no
+     * "deleted" markers are needed.
+     *
+     * @param[in] aEmptySlot  The slot which was emptied.
+     *
+     */
+    void ShiftBackFrom(uint16_t aEmptySlot)
+    {
+        IndexType *index = static_cast<IndexType *>(this);
+
+        for (uint16_t next = GetNextSlot(aEmptySlot); !index->IsSlotEmpty(next); next = GetNextSlot(next))
+        {
+            uint16_t home = index->GetHomeSlotOf(next);
+
+            // Check whether `home` is cyclically outside `(aEmptySlot, next]`.
+
+            if ((aEmptySlot <= next) ? ((home <= aEmptySlot) || (home > next))
+                                     : ((home <= aEmptySlot) && (home > next)))
+            {
+                index->MoveSlot(next, aEmptySlot);
+                aEmptySlot = next;
+            }
+        }
+    }
+};
+
+} // namespace ot
+
+#endif // LINEAR_PROBING_HPP_
@@ -33,6 +33,7 @@
 
 #include "message.hpp"
 
+#include "common/array.hpp"
 #include "common/as_core_type.hpp"
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
@@ -51,6 +52,11 @@
 #error "OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE conflicts with OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT."
 #endif
 
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE && \
+    (OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE || OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT)
+#error "OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE requires the OpenThread message buffer pool."
+#endif
+
 namespace ot {
 
 RegisterLogModule("Message");
@@ -60,12 +66,23 @@ RegisterLogModule("Message");
 
 MessagePool::MessagePool(Instance &aInstance)
     : InstanceLocator(aInstance)
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+    , mNumCopyOnWriteReserved(0)
+    , mNumSharedBuffers(0)
+    , mNumCopyOnWriteBuffers(0)
+#endif
     , mNumAllocated(0)
     , mMaxAllocated(0)
 {
 #if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
     otPlatMessagePoolInit(&GetInstance(), kNumBuffers, sizeof(Buffer));
 #endif
+#if OPENTHREAD_CONFIG_MESSAGE_BUFFER_USAGE_ENABLE
+    for (BufferUsage &usage : mBufferUsages)
+    {
+        usage.Clear();
+    }
+#endif
 }
 
 Message *MessagePool::Allocate(Message::Type aType, uint16_t aReserveHeader, const Message::Settings &aSettings)
@@ -77,6 +94,9 @@ Message *MessagePool::Allocate(Message::Type aType, uint16_t aReserveHeader, con
 
     memset(message, 0, sizeof(*message));
     message->SetMessagePool(this);
+#if OPENTHREAD_CONFIG_MESSAGE_BUFFER_USAGE_ENABLE
+    AddBufferUsage(message->GetOrigin(), 1);
+#endif
     message->SetType(aType);
     message->SetReserved(aReserveHeader);
     message->SetLinkSecurityEnabled(aSettings.IsLinkSecurityEnabled());
@@ -105,18 +125,144 @@ void MessagePool::Free(Message *aMessage)
 {
     OT_ASSERT(aMessage->Next() == nullptr && aMessage->Prev() == nullptr);
 
+#if OPENTHREAD_CONFIG_MESSAGE_BUFFER_USAGE_ENABLE
+    RemoveBufferUsage(aMessage->GetOrigin(), aMessage->GetBufferCount());
+#endif
+
     FreeBuffers(static_cast<Buffer *>(aMessage));
 }
 
+#if OPENTHREAD_CONFIG_MESSAGE_BUFFER_USAGE_ENABLE
+
+void MessagePool::AddBufferUsage(Message::Origin aOrigin, uint16_t aNumBuffers)
+{
+    BufferUsage &usage = mBufferUsages[aOrigin];
+
+    usage.mNumBuffers += aNumBuffers;
+    usage.mMaxBuffers = Max(usage.mMaxBuffers, usage.mNumBuffers);
+}
+
+void MessagePool::RemoveBufferUsage(Message::Origin aOrigin, uint16_t aNumBuffers)
+{
+    BufferUsage &usage = mBufferUsages[aOrigin];
+
+    OT_ASSERT(usage.mNumBuffers >= aNumBuffers);
+    usage.mNumBuffers -= aNumBuffers;
+}
+
+void MessagePool::ResetMaxBufferUsages(void)
+{
+    for (BufferUsage &usage : mBufferUsages)
+    {
+        usage.mMaxBuffers = usage.mNumBuffers;
+    }
+}
+
+#endif // OPENTHREAD_CONFIG_MESSAGE_BUFFER_USAGE_ENABLE
+
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+
+Buffer *MessagePool::AllocatePoolBuffer(void)
+{
+    // The free buffers which may be needed to copy the shared buffers
+    // (`mNumCopyOnWriteReserved`) are only handed out for copy-on-write
+    // by `NewCopyOnWriteBuffer()`.
+
+    Buffer *buffer = nullptr;
+
+    VerifyOrExit(GetFreeBufferCount() > mNumCopyOnWriteReserved);
+
+    buffer = mBufferPool.Allocate();
+    VerifyOrExit(buffer != nullptr);
+
+    mRefCounts[mBufferPool.GetIndexOf(*buffer)] = 1;
+
+exit:
+    return buffer;
+}
+
+Buffer *MessagePool::NewCopyOnWriteBuffer(void)
+{
+    // Every shared buffer has a free buffer held back for its copy, so
+    // unlike `NewBuffer()` this never needs to reclaim buffers (which
+    // could evict the message being written).
+
+    Buffer *buffer = nullptr;
+
+    VerifyOrExit(mNumCopyOnWriteReserved > 0);
+
+    buffer = mBufferPool.Allocate();
+    VerifyOrExit(buffer != nullptr);
+
+    mRefCounts[mBufferPool.GetIndexOf(*buffer)] = 1;
+    mNumAllocated++;
+    mMaxAllocated = Max(mMaxAllocated, mNumAllocated);
+
+exit:
+    return buffer;
+}
+
+bool MessagePool::CanShareBuffers(const Buffer &aBuffer) const
+{
+    // Sharing `aBuffer` holds back a free buffer for each of the
+    // buffers reachable from it, on top of the ones already held back.
+    // The buffers are only shared if `kSharedBuffersReserve` free
+    // buffers are still left for regular allocations.
+
+    return (GetRefCount(aBuffer) < kMaxRefCount) &&
+           (GetFreeBufferCount() >= mNumCopyOnWriteReserved + CountBuffers(aBuffer) + kSharedBuffersReserve);
+}
+
+uint16_t MessagePool::CountBuffers(const Buffer &aBuffer)
+{
+    uint16_t count = 0;
+
+    for (const Buffer *buffer = &aBuffer; buffer != nullptr; buffer = buffer->GetNextBuffer())
+    {
+        count++;
+    }
+
+    return count;
+}
+
+void MessagePool::RefBuffer(const Buffer &aBuffer)
+{
+    uint8_t &refCount = mRefCounts[mBufferPool.GetIndexOf(aBuffer)];
+
+    OT_ASSERT(refCount < kMaxRefCount);
+    refCount++;
+    mNumCopyOnWriteReserved += CountBuffers(aBuffer);
+}
+
+void MessagePool::UnrefBuffer(const Buffer &aBuffer)
+{
+    uint8_t &refCount = mRefCounts[mBufferPool.GetIndexOf(aBuffer)];
+
+    OT_ASSERT(refCount > 1);
+    refCount--;
+    mNumCopyOnWriteReserved -= CountBuffers(aBuffer);
+}
+
+#endif // OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+
 Buffer *MessagePool::NewBuffer(Message::Priority aPriority)
 {
     Buffer *buffer = nullptr;
 
+#if OPENTHREAD_CONFIG_MESSAGE_PRIORITY_RESERVE
+    while (IsInPriorityReserve(aPriority))
+    {
+        SuccessOrExit(ReclaimBuffers(aPriority));
+    }
+#endif
+
     while ((
 #if OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
                buffer = static_cast<Buffer *>(Heap::CAlloc(1, sizeof(Buffer)))
 #elif OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
                buffer = static_cast<Buffer *>(otPlatMessagePoolNew(&GetInstance()))
+#elif OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+               buffer = AllocatePoolBuffer()
 #else
                buffer = mBufferPool.Allocate()
 #endif
@@ -144,6 +290,17 @@ void MessagePool::FreeBuffers(Buffer *aBuffer)
     while (aBuffer != nullptr)
     {
         Buffer *next = aBuffer->GetNextBuffer();
+
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+        if (IsBufferShared(*aBuffer))
+        {
+            // The rest of the chain is still linked from another
+            // message, so only drop our link to it.
+            UnrefBuffer(*aBuffer);
+            break;
+        }
+#endif
+
 #if OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
         Heap::Free(aBuffer);
 #elif OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
@@ -159,6 +316,16 @@ void MessagePool::FreeBuffers(Buffer *aBuffer)
 
 Error MessagePool::ReclaimBuffers(Message::Priority aPriority) { return Get<MeshForwarder>().EvictMessage(aPriority); }
 
+#if OPENTHREAD_CONFIG_MESSAGE_PRIORITY_RESERVE
+bool MessagePool::IsInPriorityReserve(Message::Priority aPriority) const
+{
+    // The last `kPriorityReserve` free buffers are kept for high
+    // and network control priority messages.
+
+    return (aPriority < Message::kPriorityHigh) && (GetFreeBufferCount() <= kPriorityReserve);
+}
+#endif
+
 uint16_t MessagePool::GetFreeBufferCount(void) const
 {
     uint16_t rval;
@@ -188,6 +355,9 @@ uint16_t MessagePool::GetTotalBufferCount(void) const
 #else
     rval = NumericLimits<uint16_t>::kMax;
 #endif
+#elif OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
+    // A platform pool may grow and shrink at run-time.
+    rval = static_cast<uint16_t>(Min<uint32_t>(GetFreeBufferCount() + mNumAllocated, NumericLimits<uint16_t>::kMax));
 #else
     rval = OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS;
 #endif
@@ -237,8 +407,23 @@ Error Message::ResizeMessage(uint16_t aLength)
     {
         if (curBuffer->GetNextBuffer() == nullptr)
         {
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+            if (GetMetadata().mMayShareBuffers && HasSharedBufferUpTo(*curBuffer))
+            {
+                // Appending changes the last buffer, so the whole
+                // chain must be private. Start over afterwards
+                // since the buffers may have been replaced.
+                SuccessOrExit(error = UnshareBuffers(curLength));
+                curBuffer = this;
+                curLength = kHeadBufferDataSize;
+                continue;
+            }
+#endif
             curBuffer->SetNextBuffer(GetMessagePool()->NewBuffer(GetPriority()));
             VerifyOrExit(curBuffer->GetNextBuffer() != nullptr, error = kErrorNoBufs);
+#if OPENTHREAD_CONFIG_MESSAGE_BUFFER_USAGE_ENABLE
+            GetMessagePool()->AddBufferUsage(GetOrigin(), 1);
+#endif
         }
 
         curBuffer = curBuffer->GetNextBuffer();
@@ -247,8 +432,22 @@ Error Message::ResizeMessage(uint16_t aLength)
 
     lastBuffer = curBuffer;
     curBuffer  = curBuffer->GetNextBuffer();
+
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+    // If the last needed buffer is shared, keep the unused trailing
+    // buffers until the message is freed rather than copying.
+    VerifyOrExit(!GetMetadata().mMayShareBuffers || (curBuffer == nullptr) || !HasSharedBufferUpTo(*lastBuffer));
+#endif
+
     lastBuffer->SetNextBuffer(nullptr);
 
+#if OPENTHREAD_CONFIG_MESSAGE_BUFFER_USAGE_ENABLE
+    for (const Buffer *buffer = curBuffer; buffer != nullptr; buffer = buffer->GetNextBuffer())
+    {
+        GetMessagePool()->RemoveBufferUsage(GetOrigin(), 1);
+    }
+#endif
+
     GetMessagePool()->FreeBuffers(curBuffer);
 
 exit:
@@ -398,6 +597,47 @@ const char *Message::PriorityToString(Priority aPriority)
     return kPriorityStrings[aPriority];
 }
 
+void Message::SetOrigin(Origin aOrigin)
+{
+#if OPENTHREAD_CONFIG_MESSAGE_BUFFER_USAGE_ENABLE
+    uint8_t numBuffers = GetBufferCount();
+
+    GetMessagePool()->RemoveBufferUsage(GetOrigin(), numBuffers);
+    GetMessagePool()->AddBufferUsage(aOrigin, numBuffers);
+#endif
+
+    GetMetadata().mOrigin = aOrigin;
+}
+
+const char *Message::OriginToString(Origin aOrigin)
+{
+    static const char *const kOriginStrings[] = {
+        "other",    // (0) kOriginOther
+        "host",     // (1) kOriginHost
+        "6lo",      // (2) kOriginLowpan
+        "6lo reas", // (3) kOriginReassembly
+        "mpl",      // (4) kOriginMpl
+        "mle",      // (5) kOriginMle
+        "coap",     // (6) kOriginCoap
+        "dns",      // (7) kOriginDns
+        "srp",      // (8) kOriginSrp
+    };
+
+    static_assert(kOriginOther == 0, "kOriginOther value is incorrect");
+    static_assert(kOriginHost == 1, "kOriginHost value is incorrect");
+    static_assert(kOriginLowpan == 2, "kOriginLowpan value is incorrect");
+    static_assert(kOriginReassembly == 3, "kOriginReassembly value is incorrect");
+    static_assert(kOriginMpl == 4, "kOriginMpl value is incorrect");
+    static_assert(kOriginMle == 5, "kOriginMle value is incorrect");
+    static_assert(kOriginCoap == 6, "kOriginCoap value is incorrect");
+    static_assert(kOriginDns == 7, "kOriginDns value is incorrect");
+    static_assert(kOriginSrp == 8, "kOriginSrp value is incorrect");
+    static_assert(GetArrayLength(kOriginStrings) == kNumOrigins, "kOriginStrings is missing an origin");
+    static_assert(kNumOrigins <= 16, "`Metadata::mOrigin` as a 4-bit field cannot fit all `Origin` values");
+
+    return (aOrigin < GetArrayLength(kOriginStrings)) ? kOriginStrings[aOrigin] : "invalid";
+}
+
 Error Message::AppendBytes(const void *aBuf, uint16_t aLength)
 {
     Error    error     = kErrorNone;
@@ -440,6 +680,9 @@ Error Message::PrependBytes(const void *aBuf, uint16_t aLength)
     while (aLength > GetReserved())
     {
         VerifyOrExit((newBuffer = GetMessagePool()->NewBuffer(GetPriority())) != nullptr, error = kErrorNoBufs);
+#if OPENTHREAD_CONFIG_MESSAGE_BUFFER_USAGE_ENABLE
+        GetMessagePool()->AddBufferUsage(GetOrigin(), 1);
+#endif
 
         newBuffer->SetNextBuffer(GetNextBuffer());
         SetNextBuffer(newBuffer);
@@ -822,13 +1065,20 @@ Message *Message::Clone(uint16_t aLength) const
     aLength     = Min(GetLength(), aLength);
     messageCopy = GetMessagePool()->Allocate(GetType(), GetReserved(), settings);
     VerifyOrExit(messageCopy != nullptr, error = kErrorNoBufs);
-    SuccessOrExit(error = messageCopy->AppendBytesFromMessage(*this, 0, aLength));
+
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+    if (!messageCopy->ShareBuffersWith(*this, aLength))
+#endif
+    {
+        SuccessOrExit(error = messageCopy->AppendBytesFromMessage(*this, 0, aLength));
+    }
 
     // Copy selected message information.
     offset = Min(GetOffset(), aLength);
     messageCopy->SetOffset(offset);
 
     messageCopy->SetSubType(GetSubType());
+    messageCopy->SetOrigin(GetOrigin());
 #if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
     messageCopy->SetTimeSync(IsTimeSync());
 #endif
@@ -838,6 +1088,153 @@ exit:
     return messageCopy;
 }
 
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+
+bool Message::ShareBuffersWith(const Message &aMessage, uint16_t aLength)
+{
+    // This method makes this (newly allocated and empty) message a
+    // copy of the first `aLength` bytes of `aMessage`, which has the
+    // same reserved header length. The head buffer is copied and all
+    // following buffers are shared by linking to the first of them.
+    // Returns `false` if buffers cannot be shared, in which case the
+    // message is left unchanged.
+
+    bool         shared = false;
+    MessagePool *pool   = GetMessagePool();
+    Buffer      *next   = AsNonConst(aMessage).GetNextBuffer();
+    uint16_t     endOffset;
+
+    OT_ASSERT((GetLength() == 0) && (GetReserved() == aMessage.GetReserved()));
+
+    endOffset = GetReserved() + aLength;
+
+    VerifyOrExit((next != nullptr) && (endOffset > kHeadBufferDataSize));
+    VerifyOrExit(pool->CanShareBuffers(*next));
+
+#if OPENTHREAD_CONFIG_MESSAGE_BUFFER_USAGE_ENABLE
+    pool->RemoveBufferUsage(GetOrigin(), GetBufferCount() - 1);
+#endif
+    pool->FreeBuffers(GetNextBuffer());
+    SetNextBuffer(next);
+    pool->RefBuffer(*next);
+#if OPENTHREAD_CONFIG_MESSAGE_BUFFER_USAGE_ENABLE
+    pool->AddBufferUsage(GetOrigin(), GetBufferCount() - 1);
+#endif
+    pool->mNumSharedBuffers += 1 + (endOffset - kHeadBufferDataSize - 1) / kBufferDataSize;
+
+    memcpy(GetFirstData(), aMessage.GetFirstData(), kHeadBufferDataSize);
+    GetMetadata().mLength = aLength;
+
+    GetMetadata().mMayShareBuffers                      = true;
+    AsNonConst(aMessage).GetMetadata().mMayShareBuffers = true;
+
+    shared = true;
+
+exit:
+    return shared;
+}
+
+bool Message::HasSharedBufferUpTo(const Buffer &aBuffer) const
+{
+    // Indicates whether any buffer after the head up to and including
+    // `aBuffer` is shared. Once a buffer is shared, all buffers after
+    // it are reachable from another message as well.
+
+    bool hasShared = false;
+
+    for (const Buffer *buffer = this; buffer != &aBuffer;)
+    {
+        buffer = buffer->GetNextBuffer();
+        OT_ASSERT(buffer != nullptr);
+
+        if (GetMessagePool()->IsBufferShared(*buffer))
+        {
+            hasShared = true;
+            break;
+        }
+    }
+
+    return hasShared;
+}
+
+Error Message::UnshareBuffers(uint16_t aEndOffset)
+{
+    // This method replaces every shared buffer holding data before
+    // `aEndOffset` (which includes the reserved header bytes) with a
+    // private copy. Once a shared buffer is found, all following
+    // buffers are copied as well since they are reachable from the
+    // other message through the shared one. The last copy links to
+    // the remaining (still shared) buffers of the original chain.
+    //
+    // Reference counts are updated after each copy, so if a buffer
+    // allocation fails the chain is still consistent.
+
+    Error        error     = kErrorNone;
+    MessagePool *pool      = GetMessagePool();
+    Buffer      *prev      = this;
+    Buffer      *curBuffer = GetNextBuffer();
+    uint16_t     curOffset = kHeadBufferDataSize;
+    bool         isShared  = false;
+
+    while ((curBuffer != nullptr) && (curOffset < aEndOffset))
+    {
+        isShared = isShared || pool->IsBufferShared(*curBuffer);
+
+        if (isShared)
+        {
+            Buffer *copy = pool->NewCopyOnWriteBuffer();
+
+            VerifyOrExit(copy != nullptr, error = kErrorNoBufs);
+
+            memcpy(copy->GetData(), curBuffer->GetData(), kBufferDataSize);
+            copy->SetNextBuffer(curBuffer->GetNextBuffer());
+
+            if (copy->GetNextBuffer() != nullptr)
+            {
+                pool->RefBuffer(*copy->GetNextBuffer());
+            }
+
+            prev->SetNextBuffer(copy);
+            pool->UnrefBuffer(*curBuffer);
+            pool->mNumCopyOnWriteBuffers++;
+
+            curBuffer = copy;
+        }
+
+        prev      = curBuffer;
+        curBuffer = curBuffer->GetNextBuffer();
+
+        curOffset += kBufferDataSize;
+    }
+
+    if (curBuffer == nullptr)
+    {
+        GetMetadata().mMayShareBuffers = false;
+    }
+
+exit:
+    return error;
+}
+
+void Message::PrepareWrite(uint16_t aOffset, uint16_t aLength)
+{
+    uint32_t endOffset;
+
+    VerifyOrExit(GetMetadata().mMayShareBuffers && (aOffset < GetLength()));
+
+    endOffset = Min<uint32_t>(static_cast<uint32_t>(aOffset) + aLength, GetLength()) + GetReserved();
+
+    // The pool holds back a free buffer for each buffer that may need
+    // to be copied, and `Clone()` copies the buffers instead of sharing
+    // them when it cannot, so this never runs out of buffers.
+    SuccessOrAssert(UnshareBuffers(static_cast<uint16_t>(endOffset)));
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+
 #if OPENTHREAD_FTD
 bool Message::GetChildMask(uint16_t aChildIndex) const { return GetMetadata().mChildMask.Get(aChildIndex); }
 
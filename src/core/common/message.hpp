@@ -52,6 +52,7 @@
 #include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
+#include "common/numeric_limits.hpp"
 #include "common/pool.hpp"
 #include "common/timer.hpp"
 #include "common/type_traits.hpp"
@@ -217,6 +218,10 @@ protected:
         bool    mDoNotEvict : 1;       // Whether this message may be evicted.
         bool    mMulticastLoop : 1;    // Whether this multicast message may be looped back.
         bool    mResolvingAddress : 1; // Whether the message is pending an address query resolution.
+        uint8_t mOrigin : 4;           // The subsystem which allocated the message.
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+        bool mMayShareBuffers : 1; // Whether the message may share buffers with another message.
+#endif
 #if OPENTHREAD_CONFIG_MULTI_RADIO
         uint8_t mRadioType : 2;      // The radio link type the message was received on, or should be sent on.
         bool    mIsRadioTypeSet : 1; // Whether the radio type is set.
@@ -317,6 +322,25 @@ public:
 
     static constexpr uint8_t kNumPriorities = 4; ///< Number of priority levels.
 
+    /**
+     * Represents the subsystem which allocated the message.
+     *
+     */
+    enum Origin : uint8_t
+    {
+        kOriginOther      = OT_MESSAGE_ORIGIN_OTHER,      ///< Any other subsystem.
+        kOriginHost       = OT_MESSAGE_ORIGIN_HOST,       ///< Public API (NCP, host network interface).
+        kOriginLowpan     = OT_MESSAGE_ORIGIN_LOWPAN,     ///< Received or forwarded 6LoWPAN frames.
+        kOriginReassembly = OT_MESSAGE_ORIGIN_REASSEMBLY, ///< 6LoWPAN reassembly.
+        kOriginMpl        = OT_MESSAGE_ORIGIN_MPL,        ///< MPL buffered messages.
+        kOriginMle        = OT_MESSAGE_ORIGIN_MLE,        ///< MLE.
+        kOriginCoap       = OT_MESSAGE_ORIGIN_COAP,       ///< CoAP.
+        kOriginDns        = OT_MESSAGE_ORIGIN_DNS,        ///< DNS client and DNS-SD server.
+        kOriginSrp        = OT_MESSAGE_ORIGIN_SRP,        ///< SRP client and server.
+    };
+
+    static constexpr uint8_t kNumOrigins = OT_MESSAGE_NUM_ORIGINS; ///< Number of origins.
+
     /**
      * Represents the link security mode (used by `Settings` constructor).
      *
@@ -518,6 +542,36 @@ public:
      */
     void SetSubType(SubType aSubType) { GetMetadata().mSubType = aSubType; }
 
+    /**
+     * Returns the subsystem which allocated the message.
+     *
+     * @returns The message origin.
+     *
+     */
+    Origin GetOrigin(void) const { return static_cast<Origin>(GetMetadata().mOrigin); }
+
+    /**
+     * Sets the subsystem which allocated the message.
+     *
+     * Newly allocated messages use `kOriginOther` and clones use the origin of the original message. The subsystem
+     * allocating a message is expected to set its origin right after allocation. The buffers of the message are
+     * accounted to the new origin (see `MessagePool::GetBufferUsage()`).
+     *
+     * @param[in] aOrigin  The message origin.
+     *
+     */
+    void SetOrigin(Origin aOrigin);
+
+    /**
+     * Converts a given message origin to a human-readable string.
+     *
+     * @param[in] aOrigin  The message origin.
+     *
+     * @returns The string representation of @p aOrigin, or "invalid" if @p aOrigin is not a valid origin.
+     *
+     */
+    static const char *OriginToString(Origin aOrigin);
+
     /**
      * Returns whether or not the message is of MLE subtype.
      *
@@ -1438,6 +1492,9 @@ private:
 
     void GetFirstChunk(uint16_t aOffset, uint16_t &aLength, MutableChunk &aChunk)
     {
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+        PrepareWrite(aOffset, aLength);
+#endif
         AsConst(this)->GetFirstChunk(aOffset, aLength, static_cast<Chunk &>(aChunk));
     }
 
@@ -1461,6 +1518,13 @@ private:
     static const Message *NextOf(const Message *aMessage) { return (aMessage != nullptr) ? aMessage->Next() : nullptr; }
 
     Error ResizeMessage(uint16_t aLength);
+
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+    bool  ShareBuffersWith(const Message &aMessage, uint16_t aLength);
+    bool  HasSharedBufferUpTo(const Buffer &aBuffer) const;
+    Error UnshareBuffers(uint16_t aEndOffset);
+    void  PrepareWrite(uint16_t aOffset, uint16_t aLength);
+#endif
 };
 
 /**
@@ -1815,13 +1879,106 @@ public:
      */
     void ResetMaxUsedBufferCount(void) { mMaxAllocated = mNumAllocated; }
 
+#if OPENTHREAD_CONFIG_MESSAGE_BUFFER_USAGE_ENABLE
+    /**
+     * Represents the buffer usage of a subsystem.
+     *
+     */
+    class BufferUsage : public otMessageBufferUsage, public Clearable<BufferUsage>
+    {
+    };
+
+    /**
+     * Returns the buffer usage of messages allocated by a given subsystem.
+     *
+     * Buffers shared between a cloned message and its original are accounted for each of the messages.
+     *
+     * @param[in] aOrigin  The subsystem.
+     *
+     * @returns The buffer usage of @p aOrigin.
+     *
+     */
+    const BufferUsage &GetBufferUsage(Message::Origin aOrigin) const { return mBufferUsages[aOrigin]; }
+
+    /**
+     * Resets the tracked maximum number of buffers in use for all subsystems.
+     *
+     */
+    void ResetMaxBufferUsages(void);
+#endif
+
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+    /**
+     * Returns the number of buffers that cloned messages shared with their original message instead of copying.
+     *
+     * @returns The number of shared buffers since OT stack initialization or last `ResetSharedBufferCounters()`.
+     *
+     */
+    uint32_t GetSharedBufferCount(void) const { return mNumSharedBuffers; }
+
+    /**
+     * Returns the number of shared buffers that were copied because a message sharing them was modified.
+     *
+     * @returns The number of copied buffers since OT stack initialization or last `ResetSharedBufferCounters()`.
+     *
+     */
+    uint32_t GetCopyOnWriteBufferCount(void) const { return mNumCopyOnWriteBuffers; }
+
+    /**
+     * Resets the shared and copy-on-write buffer counters.
+     *
+     */
+    void ResetSharedBufferCounters(void)
+    {
+        mNumSharedBuffers      = 0;
+        mNumCopyOnWriteBuffers = 0;
+    }
+#endif
+
 private:
     Buffer *NewBuffer(Message::Priority aPriority);
     void    FreeBuffers(Buffer *aBuffer);
     Error   ReclaimBuffers(Message::Priority aPriority);
 
+#if OPENTHREAD_CONFIG_MESSAGE_BUFFER_USAGE_ENABLE
+    void AddBufferUsage(Message::Origin aOrigin, uint16_t aNumBuffers);
+    void RemoveBufferUsage(Message::Origin aOrigin, uint16_t aNumBuffers);
+#endif
+
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+    static constexpr uint16_t kSharedBuffersReserve = OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_RESERVE;
+    static constexpr uint8_t  kMaxRefCount          = NumericLimits<uint8_t>::kMax;
+
+    static_assert(kSharedBuffersReserve < kNumBuffers, "SHARED_BUFFERS_RESERVE must be less than NUM_MESSAGE_BUFFERS");
+
+    static uint16_t CountBuffers(const Buffer &aBuffer);
+
+    Buffer *AllocatePoolBuffer(void);
+    Buffer *NewCopyOnWriteBuffer(void);
+    bool    CanShareBuffers(const Buffer &aBuffer) const;
+    uint8_t GetRefCount(const Buffer &aBuffer) const { return mRefCounts[mBufferPool.GetIndexOf(aBuffer)]; }
+    bool    IsBufferShared(const Buffer &aBuffer) const { return GetRefCount(aBuffer) > 1; }
+    void    RefBuffer(const Buffer &aBuffer);
+    void    UnrefBuffer(const Buffer &aBuffer);
+#endif
+
+#if OPENTHREAD_CONFIG_MESSAGE_PRIORITY_RESERVE
+    static constexpr uint16_t kPriorityReserve = OPENTHREAD_CONFIG_MESSAGE_PRIORITY_RESERVE;
+
+    bool IsInPriorityReserve(Message::Priority aPriority) const;
+#endif
+
 #if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
     Pool<Buffer, kNumBuffers> mBufferPool;
+#endif
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+    uint8_t  mRefCounts[kNumBuffers]; // Number of links (from a message or a buffer) to each buffer in the pool.
+    uint16_t mNumCopyOnWriteReserved; // Number of free buffers held back to copy the shared buffers.
+    uint32_t mNumSharedBuffers;
+    uint32_t mNumCopyOnWriteBuffers;
+#endif
+#if OPENTHREAD_CONFIG_MESSAGE_BUFFER_USAGE_ENABLE
+    BufferUsage mBufferUsages[Message::kNumOrigins];
 #endif
     uint16_t mNumAllocated;
     uint16_t mMaxAllocated;
@@ -1838,6 +1995,9 @@ DefineCoreType(otMessageBuffer, Buffer);
 DefineCoreType(otMessageSettings, Message::Settings);
 DefineCoreType(otMessage, Message);
 DefineCoreType(otMessageQueue, MessageQueue);
+#if OPENTHREAD_CONFIG_MESSAGE_BUFFER_USAGE_ENABLE
+DefineCoreType(otMessageBufferUsage, MessagePool::BufferUsage);
+#endif
 
 } // namespace ot
 
@@ -169,7 +169,8 @@ const char *SettingsBase::KeyToString(Key aKey)
         "",                  // (14) Removed (previously NAT64 prefix)
         "BrUlaPrefix",       // (15) kKeyBrUlaPrefix
         "BrOnLinkPrefixes",  // (16) kKeyBrOnLinkPrefixes
-        "BorderAgentId"      // (17) kKeyBorderAgentId
+        "BorderAgentId",     // (17) kKeyBorderAgentId
+        "SrpServerHosts",    // (18) kKeySrpServerHosts
     };
 
     static_assert(1 == kKeyActiveDataset, "kKeyActiveDataset value is incorrect");
@@ -185,8 +186,9 @@ const char *SettingsBase::KeyToString(Key aKey)
     static_assert(15 == kKeyBrUlaPrefix, "kKeyBrUlaPrefix value is incorrect");
     static_assert(16 == kKeyBrOnLinkPrefixes, "kKeyBrOnLinkPrefixes is incorrect");
     static_assert(17 == kKeyBorderAgentId, "kKeyBorderAgentId is incorrect");
+    static_assert(18 == kKeySrpServerHosts, "kKeySrpServerHosts is incorrect");
 
-    static_assert(kLastKey == kKeyBorderAgentId, "kLastKey is not valid");
+    static_assert(kLastKey == kKeySrpServerHosts, "kLastKey is not valid");
 
     OT_ASSERT(aKey <= kLastKey);
 
@@ -392,6 +394,22 @@ void Settings::BrOnLinkPrefix::Log(const char *aActionText) const
 
 #endif // OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE && OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+
+Error Settings::AddSrpServerHostRecord(const void *aRecord, uint16_t aLength)
+{
+    return Get<SettingsDriver>().Add(kKeySrpServerHosts, aRecord, aLength);
+}
+
+Error Settings::ReadSrpServerHostRecord(int aIndex, void *aRecord, uint16_t &aLength) const
+{
+    return Get<SettingsDriver>().Get(kKeySrpServerHosts, aIndex, aRecord, &aLength);
+}
+
+Error Settings::DeleteAllSrpServerHostRecords(void) { return Get<SettingsDriver>().Delete(kKeySrpServerHosts); }
+
+#endif // OPENTHREAD_CONFIG_SRP_SERVER_ENABLE && OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+
 Error Settings::ReadEntry(Key aKey, void *aValue, uint16_t aMaxLength) const
 {
     Error    error;
@@ -122,9 +122,10 @@ public:
         kKeyBrUlaPrefix       = OT_SETTINGS_KEY_BR_ULA_PREFIX,
         kKeyBrOnLinkPrefixes  = OT_SETTINGS_KEY_BR_ON_LINK_PREFIXES,
         kKeyBorderAgentId     = OT_SETTINGS_KEY_BORDER_AGENT_ID,
+        kKeySrpServerHosts    = OT_SETTINGS_KEY_SRP_SERVER_HOSTS,
     };
 
-    static constexpr Key kLastKey = kKeyBorderAgentId; ///< The last (numerically) enumerator value in `Key`.
+    static constexpr Key kLastKey = kKeySrpServerHosts; ///< The last (numerically) enumerator value in `Key`.
 
     static_assert(static_cast<uint16_t>(kLastKey) < static_cast<uint16_t>(OT_SETTINGS_KEY_VENDOR_RESERVED_MIN),
                   "Core settings keys overlap with vendor reserved keys");
@@ -1228,6 +1229,46 @@ public:
 
 #endif // OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE && OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+    /**
+     * Appends an SRP server host record to the settings.
+     *
+     * The records are opaque to `Settings` and are kept in the order they are added.
+     *
+     * @param[in] aRecord   A pointer to the record.
+     * @param[in] aLength   The record length (number of bytes).
+     *
+     * @retval kErrorNone             Successfully added the record.
+     * @retval kErrorNoBufs           No space remaining to store the record.
+     * @retval kErrorNotImplemented   The platform does not implement settings functionality.
+     *
+     */
+    Error AddSrpServerHostRecord(const void *aRecord, uint16_t aLength);
+
+    /**
+     * Reads an SRP server host record at a given index.
+     *
+     * @param[in]     aIndex    The index of the record to read.
+     * @param[out]    aRecord   A buffer to output the record. Can be `nullptr` to get the record length only.
+     * @param[in,out] aLength   On entry, the size of @p aRecord buffer. On exit, the record length.
+     *
+     * @retval kErrorNone             Successfully read the record.
+     * @retval kErrorNotFound         No record at @p aIndex.
+     * @retval kErrorNotImplemented   The platform does not implement settings functionality.
+     *
+     */
+    Error ReadSrpServerHostRecord(int aIndex, void *aRecord, uint16_t &aLength) const;
+
+    /**
+     * Deletes all SRP server host records from the settings.
+     *
+     * @retval kErrorNone            Successfully deleted the records.
+     * @retval kErrorNotImplemented  The platform does not implement settings functionality.
+     *
+     */
+    Error DeleteAllSrpServerHostRecords(void);
+#endif
+
 private:
 #if OPENTHREAD_FTD
     class ChildInfoIteratorBuilder : public InstanceLocator
@@ -49,29 +49,34 @@ const Timer::Scheduler::AlarmApi TimerMilli::Scheduler::sAlarmMilliApi = {
 
 bool Timer::DoesFireBefore(const Timer &aSecondTimer, Time aNow) const
 {
-    // Indicates whether the fire time of this timer is strictly
-    // before the fire time of a second given timer.
+    return IsBefore(GetFireTime(), aSecondTimer.GetFireTime(), aNow);
+}
+
+bool Timer::IsBefore(Time aFirstTime, Time aSecondTime, Time aNow)
+{
+    // Indicates whether the first fire time is strictly before the
+    // second fire time.
 
     bool retval;
-    bool isBeforeNow = (GetFireTime() < aNow);
+    bool isBeforeNow = (aFirstTime < aNow);
 
-    // Check if one timer is before `now` and the other one is not.
-    if ((aSecondTimer.GetFireTime() < aNow) != isBeforeNow)
+    // Check if one time is before `now` and the other one is not.
+    if ((aSecondTime < aNow) != isBeforeNow)
     {
-        // One timer is before `now` and the other one is not, so if
-        // this timer's fire time is before `now` then the second fire
-        // time would be after `now` and this timer would fire before
-        // the second timer.
+        // One time is before `now` and the other one is not, so if
+        // the first time is before `now` then the second time would
+        // be after `now` and the first time would be before the
+        // second time.
 
         retval = isBeforeNow;
     }
     else
     {
-        // Both timers are before `now` or both are after `now`. Either
+        // Both times are before `now` or both are after `now`. Either
         // way the difference is guaranteed to be less than `kMaxDt` so
         // we can safely compare the fire times directly.
 
-        retval = GetFireTime() < aSecondTimer.GetFireTime();
+        retval = aFirstTime < aSecondTime;
     }
 
     return retval;
@@ -87,8 +92,7 @@ void TimerMilli::StartAt(TimeMilli aStartTime, uint32_t aDelay)
 
 void TimerMilli::FireAt(TimeMilli aFireTime)
 {
-    mFireTime = aFireTime;
-    Get<Scheduler>().Add(*this);
+    Get<Scheduler>().Add(*this, aFireTime);
 }
 
 void TimerMilli::FireAtIfEarlier(TimeMilli aFireTime)
@@ -103,12 +107,123 @@ void TimerMilli::Stop(void) { Get<Scheduler>().Remove(*this); }
 
 void TimerMilli::RemoveAll(Instance &aInstance) { aInstance.Get<Scheduler>().RemoveAll(); }
 
-void Timer::Scheduler::Add(Timer &aTimer, const AlarmApi &aAlarmApi)
+#if OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+
+void Timer::Scheduler::Add(Timer &aTimer, Time aFireTime, const AlarmApi &aAlarmApi)
+{
+    Time now(aAlarmApi.AlarmGetNow());
+    bool wasAlarmTimer = false;
+
+    if (aTimer.IsRunning())
+    {
+        wasAlarmTimer = mAlarmStarted && (aTimer.mFireTime == mAlarmFireTime);
+        mTimerWheel.Remove(aTimer);
+    }
+
+    aTimer.mFireTime = aFireTime;
+    mTimerWheel.Add(aTimer, now);
+
+    // Restart the alarm only if the new timer fires before the
+    // current alarm, or if the timer was the one the alarm was
+    // started for.
+
+    if (!mAlarmStarted || IsBefore(aFireTime, mAlarmFireTime, now))
+    {
+        StartAlarm(aFireTime, aAlarmApi);
+    }
+    else if (wasAlarmTimer)
+    {
+        SetAlarm(aAlarmApi);
+    }
+}
+
+void Timer::Scheduler::Remove(Timer &aTimer, const AlarmApi &aAlarmApi)
+{
+    VerifyOrExit(aTimer.IsRunning());
+
+    mTimerWheel.Remove(aTimer);
+    aTimer.SetNext(&aTimer);
+
+    if (!mAlarmStarted || (aTimer.mFireTime == mAlarmFireTime))
+    {
+        SetAlarm(aAlarmApi);
+    }
+
+exit:
+    return;
+}
+
+void Timer::Scheduler::SetAlarm(const AlarmApi &aAlarmApi)
+{
+    Time fireTime;
+
+    if (mTimerWheel.FindEarliestFireTime(fireTime))
+    {
+        StartAlarm(fireTime, aAlarmApi);
+    }
+    else
+    {
+        aAlarmApi.AlarmStop(&GetInstance());
+        mAlarmStarted = false;
+    }
+}
+
+void Timer::Scheduler::StartAlarm(Time aFireTime, const AlarmApi &aAlarmApi)
+{
+    Time     now(aAlarmApi.AlarmGetNow());
+    uint32_t remaining;
+
+    remaining = (now < aFireTime) ? (aFireTime - now) : 0;
+
+    aAlarmApi.AlarmStartAt(&GetInstance(), now.GetValue(), remaining);
+
+    mAlarmStarted  = true;
+    mAlarmFireTime = aFireTime;
+}
+
+void Timer::Scheduler::ProcessTimers(const AlarmApi &aAlarmApi)
+{
+    Timer *timer;
+
+    mAlarmStarted = false;
+
+    mTimerWheel.Advance(Time(aAlarmApi.AlarmGetNow()));
+    timer = mTimerWheel.GetNextExpired();
+
+    if (timer != nullptr)
+    {
+        Remove(*timer, aAlarmApi); // `Remove()` will `SetAlarm` for next timer if there is any.
+        timer->Fired();
+        ExitNow();
+    }
+
+    SetAlarm(aAlarmApi);
+
+exit:
+    return;
+}
+
+void Timer::Scheduler::RemoveAll(const AlarmApi &aAlarmApi)
+{
+    Timer *timer;
+
+    while ((timer = mTimerWheel.Pop()) != nullptr)
+    {
+        timer->SetNext(timer);
+    }
+
+    SetAlarm(aAlarmApi);
+}
+
+#else // OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+
+void Timer::Scheduler::Add(Timer &aTimer, Time aFireTime, const AlarmApi &aAlarmApi)
 {
     Timer *prev = nullptr;
     Time   now(aAlarmApi.AlarmGetNow());
 
     Remove(aTimer, aAlarmApi);
+    aTimer.mFireTime = aFireTime;
 
     for (Timer &cur : mTimerList)
     {
@@ -203,6 +318,8 @@ void Timer::Scheduler::RemoveAll(const AlarmApi &aAlarmApi)
     SetAlarm(aAlarmApi);
 }
 
+#endif // OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+
 extern "C" void otPlatAlarmMilliFired(otInstance *aInstance)
 {
     VerifyOrExit(otInstanceIsInitialized(aInstance));
@@ -229,8 +346,7 @@ void TimerMicro::StartAt(TimeMicro aStartTime, uint32_t aDelay)
 
 void TimerMicro::FireAt(TimeMicro aFireTime)
 {
-    mFireTime = aFireTime;
-    Get<Scheduler>().Add(*this);
+    Get<Scheduler>().Add(*this, aFireTime);
 }
 
 void TimerMicro::Stop(void) { Get<Scheduler>().Remove(*this); }
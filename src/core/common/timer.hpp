@@ -48,6 +48,7 @@
 #include "common/non_copyable.hpp"
 #include "common/tasklet.hpp"
 #include "common/time.hpp"
+#include "common/timer_wheel.hpp"
 
 namespace ot {
 
@@ -68,6 +69,9 @@ namespace ot {
 class Timer : public InstanceLocator, public LinkedListEntry<Timer>
 {
     friend class LinkedListEntry<Timer>;
+#if OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+    friend class TimerWheel<Timer>;
+#endif
 
 public:
     /**
@@ -116,31 +120,54 @@ protected:
 
         explicit Scheduler(Instance &aInstance)
             : InstanceLocator(aInstance)
+#if OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+            , mAlarmStarted(false)
+#endif
         {
         }
 
-        void Add(Timer &aTimer, const AlarmApi &aAlarmApi);
+        void Add(Timer &aTimer, Time aFireTime, const AlarmApi &aAlarmApi);
         void Remove(Timer &aTimer, const AlarmApi &aAlarmApi);
         void RemoveAll(const AlarmApi &aAlarmApi);
         void ProcessTimers(const AlarmApi &aAlarmApi);
         void SetAlarm(const AlarmApi &aAlarmApi);
 
+#if OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+        void StartAlarm(Time aFireTime, const AlarmApi &aAlarmApi);
+
+        TimerWheel<Timer> mTimerWheel;
+        Time              mAlarmFireTime;
+        bool              mAlarmStarted;
+#else
         LinkedList<Timer> mTimerList;
+#endif
     };
 
     Timer(Instance &aInstance, Handler aHandler)
         : InstanceLocator(aInstance)
         , mHandler(aHandler)
         , mNext(this)
+#if OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+        , mPrev(nullptr)
+#endif
     {
     }
 
-    bool DoesFireBefore(const Timer &aSecondTimer, Time aNow) const;
-    void Fired(void) { mHandler(*this); }
+    bool        DoesFireBefore(const Timer &aSecondTimer, Time aNow) const;
+    static bool IsBefore(Time aFirstTime, Time aSecondTime, Time aNow);
+    void        Fired(void) { mHandler(*this); }
+
+#if OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+    Timer *GetPrev(void) { return mPrev; }
+    void   SetPrev(Timer *aPrev) { mPrev = aPrev; }
+#endif
 
     Handler mHandler;
     Time    mFireTime;
     Timer  *mNext;
+#if OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+    Timer *mPrev;
+#endif
 };
 
 extern "C" void otPlatAlarmMilliFired(otInstance *aInstance);
@@ -174,7 +201,7 @@ public:
         }
 
     private:
-        void Add(TimerMilli &aTimer) { Timer::Scheduler::Add(aTimer, sAlarmMilliApi); }
+        void Add(TimerMilli &aTimer, TimeMilli aFireTime) { Timer::Scheduler::Add(aTimer, aFireTime, sAlarmMilliApi); }
         void Remove(TimerMilli &aTimer) { Timer::Scheduler::Remove(aTimer, sAlarmMilliApi); }
         void RemoveAll(void) { Timer::Scheduler::RemoveAll(sAlarmMilliApi); }
         void ProcessTimers(void) { Timer::Scheduler::ProcessTimers(sAlarmMilliApi); }
@@ -344,7 +371,7 @@ public:
         }
 
     private:
-        void Add(TimerMicro &aTimer) { Timer::Scheduler::Add(aTimer, sAlarmMicroApi); }
+        void Add(TimerMicro &aTimer, TimeMicro aFireTime) { Timer::Scheduler::Add(aTimer, aFireTime, sAlarmMicroApi); }
         void Remove(TimerMicro &aTimer) { Timer::Scheduler::Remove(aTimer, sAlarmMicroApi); }
         void RemoveAll(void) { Timer::Scheduler::RemoveAll(sAlarmMicroApi); }
         void ProcessTimers(void) { Timer::Scheduler::ProcessTimers(sAlarmMicroApi); }
@@ -0,0 +1,429 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for a generic hierarchical timing wheel.
+ */
+
+#ifndef TIMER_WHEEL_HPP_
+#define TIMER_WHEEL_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stdint.h>
+
+#include "common/code_utils.hpp"
+#include "common/non_copyable.hpp"
+#include "common/time.hpp"
+
+namespace ot {
+
+/**
+ * @addtogroup core-timer
+ *
+ * @{
+ *
+ */
+
+/**
+ * Implements a hierarchical timing wheel.
+ *
+ * The wheel keeps entries in `kNumLevels` levels of `kNumSlots` buckets. An entry is placed on the lowest level at
+ * which its fire time and the wheel's base time differ, so that adding and removing an entry are O(1) operations.
+ * As the base time advances, entries on a higher level bucket are cascaded down to lower levels, with each entry
+ * moving at most `kNumLevels` times over its lifetime. Entries whose fire time is at or before the base time are
+ * kept on a separate expired list.
+ *
+ * The template type `Type` must provide `GetNext()`, `SetNext()`, `GetPrev()`, `SetPrev()`, and `GetFireTime()`
+ * methods. The fire time of an entry MUST NOT be changed while the entry is in the wheel.
+ *
+ * @tparam Type   The entry type.
+ *
+ */
+template <typename Type> class TimerWheel : private NonCopyable
+{
+public:
+    /**
+     * Initializes the `TimerWheel` as empty.
+     *
+     */
+    TimerWheel(void) { Clear(); }
+
+    /**
+     * Indicates whether or not the wheel is empty.
+     *
+     * @retval TRUE   The wheel is empty.
+     * @retval FALSE  The wheel is not empty.
+     *
+     */
+    bool IsEmpty(void) const
+    {
+        bool isEmpty = (mExpiredList == nullptr);
+
+        for (uint8_t level = 0; isEmpty && (level < kNumLevels); level++)
+        {
+            isEmpty = (mOccupied[level] == 0);
+        }
+
+        return isEmpty;
+    }
+
+    /**
+     * Removes all entries from the wheel.
+     *
+     * The `next` and `prev` pointers of the entries are not updated.
+     *
+     */
+    void Clear(void)
+    {
+        mExpiredList = nullptr;
+
+        for (uint8_t level = 0; level < kNumLevels; level++)
+        {
+            mOccupied[level] = 0;
+
+            for (Type *&head : mSlots[level])
+            {
+                head = nullptr;
+            }
+        }
+    }
+
+    /**
+     * Advances the base time of the wheel to a given time and adds an entry to the wheel.
+     *
+     * @param[in] aEntry  The entry to add. It MUST NOT already be in the wheel.
+     * @param[in] aNow    The current time.
+     *
+     */
+    void Add(Type &aEntry, Time aNow)
+    {
+        Advance(aNow);
+        Place(aEntry);
+    }
+
+    /**
+     * Removes an entry from the wheel.
+     *
+     * @param[in] aEntry  The entry to remove. It MUST be in the wheel.
+     *
+     */
+    void Remove(Type &aEntry)
+    {
+        uint8_t level = 0;
+        uint8_t index = 0;
+        Type   *prev = aEntry.GetPrev();
+        Type   *next = aEntry.GetNext();
+        Type  **head = FindList(aEntry.GetFireTime(), level, index);
+
+        if (prev != nullptr)
+        {
+            prev->SetNext(next);
+        }
+        else
+        {
+            *head = next;
+        }
+
+        if (next != nullptr)
+        {
+            next->SetPrev(prev);
+        }
+
+        if ((head != &mExpiredList) && (*head == nullptr))
+        {
+            mOccupied[level] &= ~(static_cast<uint64_t>(1) << index);
+        }
+    }
+
+    /**
+     * Removes and returns an arbitrary entry from the wheel.
+     *
+     * @returns A pointer to the removed entry, or `nullptr` if the wheel is empty.
+     *
+     */
+    Type *Pop(void)
+    {
+        Type *entry = mExpiredList;
+
+        for (uint8_t level = 0; (entry == nullptr) && (level < kNumLevels); level++)
+        {
+            if (mOccupied[level] != 0)
+            {
+                entry = mSlots[level][FindFirstSlot(mOccupied[level])];
+            }
+        }
+
+        if (entry != nullptr)
+        {
+            Remove(*entry);
+        }
+
+        return entry;
+    }
+
+    /**
+     * Advances the base time of the wheel, cascading entries whose bucket has been reached.
+     *
+     * After this call, all entries with a fire time at or before @p aNow are on the expired list.
+     *
+     * @param[in] aNow   The current time. It MUST NOT be before the base time of a non-empty wheel.
+     *
+     */
+    void Advance(Time aNow)
+    {
+        uint32_t oldBase = mBase.GetValue();
+        uint32_t newBase = aNow.GetValue();
+
+        if (IsEmpty())
+        {
+            mBase = aNow;
+            ExitNow();
+        }
+
+        VerifyOrExit(mBase < aNow);
+        mBase = aNow;
+
+        for (uint8_t level = 0; level < kNumLevels; level++)
+        {
+            uint8_t  shift = level * kBitsPerLevel;
+            uint32_t mask  = (kMaxTimeValue >> shift);
+            uint32_t steps = ((newBase >> shift) - (oldBase >> shift)) & mask;
+
+            if (steps == 0)
+            {
+                break;
+            }
+
+            if (steps > kNumSlots)
+            {
+                steps = kNumSlots;
+            }
+
+            for (uint32_t step = 1; step <= steps; step++)
+            {
+                Cascade(level, static_cast<uint8_t>(((oldBase >> shift) + step) & mask & kSlotMask));
+            }
+        }
+
+    exit:
+        return;
+    }
+
+    /**
+     * Returns the expired entry with the earliest fire time.
+     *
+     * The `Advance()` method should be called before this to move all expired entries to the expired list.
+     *
+     * @returns A pointer to the earliest expired entry, or `nullptr` if there is none.
+     *
+     */
+    Type *GetNextExpired(void) const { return FindEarliest(mExpiredList); }
+
+    /**
+     * Finds the earliest fire time among all entries in the wheel.
+     *
+     * @param[out] aFireTime   A reference to return the earliest fire time.
+     *
+     * @retval TRUE   Found the earliest fire time and updated @p aFireTime.
+     * @retval FALSE  The wheel is empty.
+     *
+     */
+    bool FindEarliestFireTime(Time &aFireTime) const
+    {
+        Type *entry = FindEarliest(mExpiredList);
+
+        // Entries on a level all fire after entries on any lower
+        // level, and within a level, buckets are ordered (wrapping
+        // only on the top level). So the earliest entry is in the
+        // first occupied bucket of the lowest occupied level.
+
+        for (uint8_t level = 0; (entry == nullptr) && (level < kNumLevels); level++)
+        {
+            uint64_t occupied = mOccupied[level];
+            uint8_t  shift    = level * kBitsPerLevel;
+            uint8_t  baseIndex;
+            uint64_t laterMask;
+
+            if (occupied == 0)
+            {
+                continue;
+            }
+
+            baseIndex = static_cast<uint8_t>((mBase.GetValue() >> shift) & kSlotMask);
+            laterMask = ~((static_cast<uint64_t>(2) << baseIndex) - 1);
+
+            if ((occupied & laterMask) != 0)
+            {
+                occupied &= laterMask;
+            }
+
+            entry = FindEarliest(mSlots[level][FindFirstSlot(occupied)]);
+        }
+
+        if (entry != nullptr)
+        {
+            aFireTime = entry->GetFireTime();
+        }
+
+        return (entry != nullptr);
+    }
+
+private:
+    static constexpr uint8_t  kBitsPerLevel = 6;
+    static constexpr uint8_t  kNumLevels    = 6; // Enough levels to cover all bits of a 32-bit time.
+    static constexpr uint8_t  kNumSlots     = (1U << kBitsPerLevel);
+    static constexpr uint8_t  kSlotMask     = kNumSlots - 1;
+    static constexpr uint32_t kMaxTimeValue = 0xffffffff;
+
+    static_assert(kNumSlots <= 64, "Slot occupancy of a level must fit in a `uint64_t` bitmap");
+    static_assert(kNumLevels * kBitsPerLevel >= 32, "Timer wheel levels must cover 32-bit time");
+
+    static uint8_t FindFirstSlot(uint64_t aOccupied)
+    {
+        uint8_t index = 0;
+
+        while ((aOccupied & 1) == 0)
+        {
+            aOccupied >>= 1;
+            index++;
+        }
+
+        return index;
+    }
+
+    static Type *FindEarliest(Type *aList)
+    {
+        Type *earliest = aList;
+
+        for (Type *entry = aList; entry != nullptr; entry = entry->GetNext())
+        {
+            // Entries are pushed at the head, so on equal fire times
+            // prefer the later one in the list (added first).
+
+            if (!(earliest->GetFireTime() < entry->GetFireTime()))
+            {
+                earliest = entry;
+            }
+        }
+
+        return earliest;
+    }
+
+    Type **FindList(Time aFireTime, uint8_t &aLevel, uint8_t &aIndex)
+    {
+        Type   **head;
+        uint32_t diff;
+
+        if (!(mBase < aFireTime))
+        {
+            ExitNow(head = &mExpiredList);
+        }
+
+        aLevel = 0;
+        diff   = (aFireTime.GetValue() ^ mBase.GetValue()) >> kBitsPerLevel;
+
+        while (diff != 0)
+        {
+            aLevel++;
+            diff >>= kBitsPerLevel;
+        }
+
+        aIndex = static_cast<uint8_t>((aFireTime.GetValue() >> (aLevel * kBitsPerLevel)) & kSlotMask);
+        head   = &mSlots[aLevel][aIndex];
+
+    exit:
+        return head;
+    }
+
+    void Place(Type &aEntry)
+    {
+        uint8_t level = 0;
+        uint8_t index = 0;
+        Type  **head = FindList(aEntry.GetFireTime(), level, index);
+
+        aEntry.SetPrev(nullptr);
+        aEntry.SetNext(*head);
+
+        if (*head != nullptr)
+        {
+            (*head)->SetPrev(&aEntry);
+        }
+
+        *head = &aEntry;
+
+        if (head != &mExpiredList)
+        {
+            mOccupied[level] |= (static_cast<uint64_t>(1) << index);
+        }
+    }
+
+    void Cascade(uint8_t aLevel, uint8_t aIndex)
+    {
+        Type *entry;
+        Type *prev;
+
+        VerifyOrExit(mOccupied[aLevel] & (static_cast<uint64_t>(1) << aIndex));
+
+        entry = mSlots[aLevel][aIndex];
+        mSlots[aLevel][aIndex] = nullptr;
+        mOccupied[aLevel] &= ~(static_cast<uint64_t>(1) << aIndex);
+
+        // Entries are placed starting from the tail (added first), so
+        // that entries with the same fire time keep their order.
+
+        while (entry->GetNext() != nullptr)
+        {
+            entry = entry->GetNext();
+        }
+
+        for (; entry != nullptr; entry = prev)
+        {
+            prev = entry->GetPrev();
+            Place(*entry);
+        }
+
+    exit:
+        return;
+    }
+
+    Time     mBase;
+    Type    *mExpiredList;
+    Type    *mSlots[kNumLevels][kNumSlots];
+    uint64_t mOccupied[kNumLevels];
+};
+
+/**
+ * @}
+ *
+ */
+
+} // namespace ot
+
+#endif // TIMER_WHEEL_HPP_
@@ -181,4 +181,70 @@
 #define OPENTHREAD_CONFIG_DNS_CLIENT_OVER_TCP_QUERY_MAX_SIZE 1024
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+ *
+ * Define to 1 to enable the DNS client response cache.
+ *
+ * When enabled, DNS client keeps received responses (including negative responses) for the duration of their TTL
+ * and answers repeated queries locally without sending them to the server.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES
+ *
+ * Specifies the maximum number of cached responses in the DNS client cache. This is also the default cache size.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_NEGATIVE_TTL
+ *
+ * Specifies the TTL (in seconds) to use for a cached negative response (name error or no data) which does not include
+ * an SOA record in its authority section (RFC 2308).
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_NEGATIVE_TTL
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_NEGATIVE_TTL 30
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_TTL
+ *
+ * Specifies the maximum time (in seconds) a response is kept in the DNS client cache, regardless of the TTLs of its
+ * records.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_TTL
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_TTL 600
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MIN_FREE_BUFFERS
+ *
+ * Specifies the minimum number of free message buffers to keep while caching responses in the DNS client.
+ *
+ * When the number of free message buffers falls below this value (or a buffer cannot be allocated for a new cache
+ * entry), the least recently used cache entries are removed.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MIN_FREE_BUFFERS
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MIN_FREE_BUFFERS 8
+#endif
+
 #endif // CONFIG_DNS_CLIENT_H_
@@ -86,4 +86,58 @@
 #define OPENTHREAD_CONFIG_DNS_UPSTREAM_QUERY_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_DNS_NAME_COMPRESSOR_NUM_ENTRIES
+ *
+ * Define the number of label entries in the name compression dictionary used when building a DNS response.
+ *
+ * Each distinct name suffix written into a response uses one entry. When the dictionary is full, names are still
+ * encoded correctly but new suffixes are no longer remembered for later compression. Must be less than 254.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_NAME_COMPRESSOR_NUM_ENTRIES
+#define OPENTHREAD_CONFIG_DNS_NAME_COMPRESSOR_NUM_ENTRIES 96
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+ *
+ * Define to 1 to enable caching of the DNS-SD server responses built from SRP server registrations.
+ *
+ * A cached response is reused for later queries with the same question until a change of a related SRP host or
+ * service invalidates it. Requires `OPENTHREAD_CONFIG_SRP_SERVER_ENABLE`.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_SIZE
+ *
+ * Define the maximum number of responses in the DNS-SD server answer cache.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE` is enabled. Each cached response keeps a
+ * message allocated from the message pool.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_SIZE
+#define OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_SIZE 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_MIN_FREE_BUFFERS
+ *
+ * Define the minimum number of free message buffers to keep while caching DNS-SD server responses.
+ *
+ * When the number of free message buffers falls below this value, the whole answer cache is flushed and no new
+ * response is cached.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_MIN_FREE_BUFFERS
+#define OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_MIN_FREE_BUFFERS 8
+#endif
+
 #endif // CONFIG_DNSSD_SERVER_H_
@@ -202,4 +202,26 @@
 #define OPENTHREAD_CONFIG_IP6_BR_COUNTERS_ENABLE OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_ENABLE
+ *
+ * Define as 1 to enable an index of open UDP sockets sorted by local port, used to find the destination socket of a
+ * received UDP datagram without searching the full list of sockets.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE
+ *
+ * The maximum number of open UDP sockets in the socket index. When more sockets are open, the full list of sockets is
+ * searched instead.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE
+#define OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE 64
+#endif
+
 #endif // CONFIG_IP6_H_
@@ -60,6 +60,60 @@
 #define OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_TIMEOUT 2
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_ENABLE
+ *
+ * Define as 1 to enable a hash index of the 6LoWPAN reassembly list, keyed on the MAC source address, datagram tag and
+ * datagram size.
+ *
+ * With the index, matching a received "next fragment" to its datagram does not depend on the number of datagrams
+ * being reassembled, and fragments from different senders using the same datagram tag and size are never mixed.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_SIZE
+ *
+ * The maximum number of datagrams being reassembled at the same time when the reassembly index is enabled.
+ *
+ * When the index is full, the datagram that has been waiting longest for its next fragment is dropped to make room for
+ * a new one.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_SIZE
+#define OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_SIZE 16
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_6LOWPAN_FRAGMENT_FORWARDING_ENABLE
+ *
+ * Define as 1 to enable per-fragment forwarding of fragmented datagrams on routers (FTD only).
+ *
+ * When a router receives the first fragment of a datagram that is to be forwarded to another Thread node, the IPv6
+ * header is decompressed and re-compressed under a Mesh Header and each fragment is forwarded as it is received,
+ * instead of reassembling the whole datagram and fragmenting it again. Datagrams delivered to the router itself or to
+ * one of its children, and datagrams whose route is not yet known, are still reassembled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_6LOWPAN_FRAGMENT_FORWARDING_ENABLE
+#define OPENTHREAD_CONFIG_6LOWPAN_FRAGMENT_FORWARDING_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_6LOWPAN_FRAGMENT_FORWARDING_ENTRIES
+ *
+ * The maximum number of datagrams being forwarded fragment by fragment at the same time.
+ *
+ * When all entries are in use, the datagram is reassembled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_6LOWPAN_FRAGMENT_FORWARDING_ENTRIES
+#define OPENTHREAD_CONFIG_6LOWPAN_FRAGMENT_FORWARDING_ENTRIES 4
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_NUM_FRAGMENT_PRIORITY_ENTRIES
  *
@@ -148,4 +202,31 @@
 #endif
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_INDIRECT_SENDER_MESSAGE_INDEX_ENABLE
+ *
+ * Define as 1 to keep a per-child index of messages queued for indirect transmission.
+ *
+ * With the index, finding the next indirect message for a sleepy child (e.g., on a data poll) or clearing all its
+ * messages is proportional to the number of messages queued for that child rather than to the length of the send
+ * queue. This is intended for devices supporting a large number of sleepy children.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_INDIRECT_SENDER_MESSAGE_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_INDIRECT_SENDER_MESSAGE_INDEX_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_INDIRECT_SENDER_MESSAGE_INDEX_ENTRIES
+ *
+ * The number of (message, child) entries in the indirect message index.
+ *
+ * A multicast message queued for N sleepy children uses N entries. When the entries run out, a child falls back to
+ * scanning the send queue until all its queued messages are cleared.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_INDIRECT_SENDER_MESSAGE_INDEX_ENTRIES
+#define OPENTHREAD_CONFIG_INDIRECT_SENDER_MESSAGE_INDEX_ENTRIES (2 * OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS)
+#endif
+
 #endif // CONFIG_MESH_FORWARDER_H_
@@ -202,6 +202,65 @@
 #define OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE (sizeof(void *) * 32)
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+ *
+ * Define to 1 to let cloned messages share the data buffers of the original message (copy-on-write).
+ *
+ * A cloned message gets its own first (head) buffer, which holds the message metadata and the start of the message
+ * (typically the IPv6 header), and shares all remaining buffers with the original. A shared buffer is copied only
+ * when one of the messages sharing it writes into it or changes its length.
+ *
+ * @note This is only supported with the OpenThread message buffer pool, i.e., it cannot be used along with
+ *       OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE or OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+#define OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_RESERVE
+ *
+ * The number of free message buffers which must be left for regular allocations for a cloned message to share buffers.
+ *
+ * While buffers are shared, the message pool holds back a free buffer for each buffer that a write may need to copy.
+ * `Clone()` only shares the buffers if this many free buffers are left on top of the held back ones, otherwise it
+ * copies them.
+ *
+ * Applicable when OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE is set.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_RESERVE
+#define OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_RESERVE 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_BUFFER_USAGE_ENABLE
+ *
+ * Define to 1 to track the number of message buffers (current and maximum) used by each subsystem.
+ *
+ * Every message is tagged with the subsystem which allocated it (`otMessageOrigin`) and the usage is available from
+ * `otMessageGetBufferUsage()`.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_BUFFER_USAGE_ENABLE
+#define OPENTHREAD_CONFIG_MESSAGE_BUFFER_USAGE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_PRIORITY_RESERVE
+ *
+ * The number of free message buffers reserved for messages with high or network control priority (e.g., MLE).
+ *
+ * Once the number of free buffers drops to this value, buffers for lower priority messages are only allocated after
+ * lower priority messages are evicted from the send queue. Zero disables the reservation.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_PRIORITY_RESERVE
+#define OPENTHREAD_CONFIG_MESSAGE_PRIORITY_RESERVE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_DEFAULT_TRANSMIT_POWER
  *
@@ -303,6 +362,30 @@
 #endif
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_HEAP_SLAB_ENABLE
+ *
+ * Define as 1 to serve small allocations (up to 256 bytes) of the internal heap from slabs of eight size classes.
+ *
+ * The slabs are pages of same-sized objects carved from the heap, which limits the fragmentation caused by long
+ * running churn of small allocations (e.g., SRP server hosts and services, DNS names). Requires a heap large enough
+ * for a few pages of each size class, the largest being about 2 KB.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_HEAP_SLAB_ENABLE
+#define OPENTHREAD_CONFIG_HEAP_SLAB_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_HEAP_SLAB_OBJECTS_PER_PAGE
+ *
+ * The number of objects in each slab page when `OPENTHREAD_CONFIG_HEAP_SLAB_ENABLE` is set.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_HEAP_SLAB_OBJECTS_PER_PAGE
+#define OPENTHREAD_CONFIG_HEAP_SLAB_OBJECTS_PER_PAGE 8
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
  *
@@ -554,4 +637,18 @@
 #define OPENTHREAD_CONFIG_GENERIC_TASKLET_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+ *
+ * Define as 1 to use a hierarchical timing wheel for `TimerMilli` and `TimerMicro` schedulers.
+ *
+ * The timing wheel provides O(1) timer start and stop, at the cost of an additional pointer per timer and a fixed
+ * table of 384 list heads per scheduler. It is intended for devices running a large number of timers (e.g. a
+ * border router with many children). When disabled, a sorted linked list is used.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+#define OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE 0
+#endif
+
 #endif // CONFIG_MISC_H_
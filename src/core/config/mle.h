@@ -78,6 +78,20 @@
 #define OPENTHREAD_CONFIG_MLE_IP_ADDRS_PER_CHILD 4
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+ *
+ * Define as 1 to enable lookup indexes in the child table (by RLOC16, extended address and registered IPv6 address).
+ *
+ * The indexes make child lookups on the receive and forwarding paths independent of the number of children, at the
+ * cost of RAM proportional to `OPENTHREAD_CONFIG_MLE_MAX_CHILDREN` and `OPENTHREAD_CONFIG_MLE_IP_ADDRS_PER_CHILD`.
+ * They are updated incrementally whenever a child's state, RLOC16, extended address or registered addresses change.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MLE_IP_ADDRS_TO_REGISTER
  *
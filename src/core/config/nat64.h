@@ -65,6 +65,20 @@
 #define OPENTHREAD_CONFIG_NAT64_IDLE_TIMEOUT_SECONDS 7200
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+ *
+ * Define to 1 to enable port translation (NAPT) in the NAT64 translator.
+ *
+ * When enabled, a mapping is created for each protocol and port (or ICMP echo identifier) used by a host, and many
+ * hosts share the addresses of the IPv4 CIDR. Otherwise, each host is mapped to its own IPv4 address. When all the
+ * OPENTHREAD_CONFIG_NAT64_MAX_MAPPINGS mappings are in use, a new flow evicts the least recently used mapping.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+#define OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_NAT64_BORDER_ROUTING_ENABLE
  *
@@ -109,4 +109,51 @@
 #define OPENTHREAD_CONFIG_SRP_SERVER_SERVICE_UPDATE_TIMEOUT ((4 * 250u) + 250u)
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+ *
+ * Define to 1 to enable SRP server feature to save the registered hosts and services in non-volatile settings.
+ *
+ * When enabled, the SRP server appends records to the settings whenever hosts (along with their services) are
+ * registered, updated, removed or their leases expire. The changed hosts are saved together, see
+ * `OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_SAVE_DELAY`. The records are reloaded when the server starts (e.g., after a
+ * device reset), so the registered services can be discovered right away without waiting for the SRP clients to
+ * register again. The time while the device is off is not known, so the reloaded hosts and services get the remaining
+ * lease from when they were saved. If the server is stopped and started again without a device reset, the time while
+ * it was stopped is counted and any leases which ended meanwhile are expired before the hosts are reloaded.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+#define OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_MAX_ENTRIES
+ *
+ * Specifies the maximum number of settings entries (each up to 255 bytes) used to save the SRP server hosts.
+ *
+ * The saved records are compacted (rewritten with a single record per host) whenever their number of entries exceeds
+ * twice the number after the last compaction plus a quarter of this limit, or when a record does not fit. Hosts which
+ * still do not fit within this limit are not saved. If the last compaction left less than a quarter of this limit
+ * free, records which do not fit are not saved (rather than compacting again) until a host is removed. Applicable
+ * when `SRP_SERVER_PERSISTENCE_ENABLE` is set.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_MAX_ENTRIES
+#define OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_MAX_ENTRIES 16
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_SAVE_DELAY
+ *
+ * Specifies the delay (in msec) after a host changes before the SRP server saves all changed hosts in the settings.
+ *
+ * The hosts changed within this delay are saved together (each host once). The hosts changed by expired leases are
+ * saved at the end of the lease timer run instead. Applicable when `SRP_SERVER_PERSISTENCE_ENABLE` is set.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_SAVE_DELAY
+#define OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_SAVE_DELAY 1000
+#endif
+
 #endif // CONFIG_SRP_SERVER_H_
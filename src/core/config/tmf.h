@@ -51,6 +51,29 @@
 #endif
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_INDEX_ENABLE
+ *
+ * Define as 1 to enable a hash index of EID-to-RLOC cache entries keyed by EID, so that looking up an EID does not
+ * search all cache entries.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_INDEX_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_DYNAMIC_SIZE_ENABLE
+ *
+ * Define as 1 to allocate the EID-to-RLOC cache entries from the heap, allowing the number of entries to be changed
+ * at run-time (`otThreadSetCacheSize()`). `OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES` then specifies the initial
+ * number of entries.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_DYNAMIC_SIZE_ENABLE
+#define OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_DYNAMIC_SIZE_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_MAX_SNOOP_ENTRIES
  *
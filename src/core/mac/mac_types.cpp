@@ -90,6 +90,29 @@ void ExtAddress::CopyAddress(uint8_t *aDst, const uint8_t *aSrc, CopyByteOrder a
     }
 }
 
+bool Address::operator==(const Address &aOther) const
+{
+    bool isEqual = false;
+
+    VerifyOrExit(mType == aOther.mType);
+
+    switch (mType)
+    {
+    case kTypeNone:
+        isEqual = true;
+        break;
+    case kTypeShort:
+        isEqual = (GetShort() == aOther.GetShort());
+        break;
+    case kTypeExtended:
+        isEqual = (GetExtended() == aOther.GetExtended());
+        break;
+    }
+
+exit:
+    return isEqual;
+}
+
 Address::InfoString Address::ToString(void) const
 {
     InfoString string;
@@ -234,7 +234,7 @@ private:
  * Represents an IEEE 802.15.4 Short or Extended Address.
  *
  */
-class Address
+class Address : public Unequatable<Address>
 {
 public:
     /**
@@ -393,6 +393,19 @@ public:
      */
     bool IsShortAddrInvalid(void) const { return ((mType == kTypeShort) && (GetShort() == kShortAddrInvalid)); }
 
+    /**
+     * Overloads operator `==` to evaluate whether or not two `Address` instances are equal.
+     *
+     * Two addresses are equal if they have the same type and the same short or extended address.
+     *
+     * @param[in]  aOther  The other `Address` instance to compare with.
+     *
+     * @retval TRUE   If the two `Address` instances are equal.
+     * @retval FALSE  If the two `Address` instances are not equal.
+     *
+     */
+    bool operator==(const Address &aOther) const;
+
     /**
      * Converts an address to a null-terminated string
      *
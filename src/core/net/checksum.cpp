@@ -33,6 +33,8 @@
 
 #include "checksum.hpp"
 
+#include <string.h>
+
 #include "common/code_utils.hpp"
 #include "common/message.hpp"
 #include "net/icmp6.hpp"
@@ -70,10 +72,55 @@ void Checksum::AddUint16(uint16_t aUint16)
 
 void Checksum::AddData(const uint8_t *aBuffer, uint16_t aLength)
 {
-    for (uint16_t i = 0; i < aLength; i++)
+    // The data is summed as 32-bit words read in host byte order into
+    // a 64-bit accumulator, which cannot overflow for a `uint16_t`
+    // length. The one's complement sum does not depend on the byte
+    // order (RFC 1071), so the folded 16-bit sum only needs to be
+    // converted to big-endian before it is added.
+
+    uint64_t sum = 0;
+
+    VerifyOrExit(aLength > 0);
+
+    if (mAtOddIndex)
+    {
+        AddUint8(*aBuffer++);
+        aLength--;
+    }
+
+    for (; aLength >= sizeof(uint32_t); aLength -= sizeof(uint32_t))
     {
-        AddUint8(aBuffer[i]);
+        uint32_t word;
+
+        memcpy(&word, aBuffer, sizeof(word));
+        sum += word;
+        aBuffer += sizeof(uint32_t);
     }
+
+    if (aLength >= sizeof(uint16_t))
+    {
+        uint16_t word;
+
+        memcpy(&word, aBuffer, sizeof(word));
+        sum += word;
+        aBuffer += sizeof(uint16_t);
+        aLength -= sizeof(uint16_t);
+    }
+
+    while (sum >> 16)
+    {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+
+    AddUint16(Encoding::BigEndian::HostSwap16(static_cast<uint16_t>(sum)));
+
+    if (aLength > 0)
+    {
+        AddUint8(*aBuffer);
+    }
+
+exit:
+    return;
 }
 
 void Checksum::WriteToMessage(uint16_t aOffset, Message &aMessage) const
@@ -90,6 +137,32 @@ void Checksum::WriteToMessage(uint16_t aOffset, Message &aMessage) const
     aMessage.Write(aOffset, checksum);
 }
 
+void Checksum::AddPseudoHeader(const Ip6::Address &aSource,
+                               const Ip6::Address &aDestination,
+                               uint8_t             aIpProto,
+                               uint16_t            aLength)
+{
+    // Pseudo-header for checksum calculation (RFC-2460).
+
+    AddData(aSource.GetBytes(), sizeof(Ip6::Address));
+    AddData(aDestination.GetBytes(), sizeof(Ip6::Address));
+    AddUint16(aLength);
+    AddUint16(static_cast<uint16_t>(aIpProto));
+}
+
+void Checksum::AddPseudoHeader(const Ip4::Address &aSource,
+                               const Ip4::Address &aDestination,
+                               uint8_t             aIpProto,
+                               uint16_t            aLength)
+{
+    // Pseudo-header for checksum calculation (RFC-768/793).
+
+    AddData(aSource.GetBytes(), sizeof(Ip4::Address));
+    AddData(aDestination.GetBytes(), sizeof(Ip4::Address));
+    AddUint16(static_cast<uint16_t>(aIpProto));
+    AddUint16(aLength);
+}
+
 void Checksum::Calculate(const Ip6::Address &aSource,
                          const Ip6::Address &aDestination,
                          uint8_t             aIpProto,
@@ -98,12 +171,7 @@ void Checksum::Calculate(const Ip6::Address &aSource,
     Message::Chunk chunk;
     uint16_t       length = aMessage.GetLength() - aMessage.GetOffset();
 
-    // Pseudo-header for checksum calculation (RFC-2460).
-
-    AddData(aSource.GetBytes(), sizeof(Ip6::Address));
-    AddData(aDestination.GetBytes(), sizeof(Ip6::Address));
-    AddUint16(length);
-    AddUint16(static_cast<uint16_t>(aIpProto));
+    AddPseudoHeader(aSource, aDestination, aIpProto, length);
 
     // Add message content (from offset to the end) to checksum.
 
@@ -124,14 +192,10 @@ void Checksum::Calculate(const Ip4::Address &aSource,
     Message::Chunk chunk;
     uint16_t       length = aMessage.GetLength() - aMessage.GetOffset();
 
-    // Pseudo-header for checksum calculation (RFC-768/792/793).
     // Note: ICMP checksum won't count the pseudo header like TCP and UDP.
     if (aIpProto != Ip4::kProtoIcmp)
     {
-        AddData(aSource.GetBytes(), sizeof(Ip4::Address));
-        AddData(aDestination.GetBytes(), sizeof(Ip4::Address));
-        AddUint16(static_cast<uint16_t>(aIpProto));
-        AddUint16(length);
+        AddPseudoHeader(aSource, aDestination, aIpProto, length);
     }
 
     // Add message content (from offset to the end) to checksum.
@@ -233,4 +297,117 @@ void Checksum::UpdateIp4HeaderChecksum(Ip4::Header &aHeader)
     aHeader.SetChecksum(~checksum.GetValue());
 }
 
+void Checksum::UpdateTranslatedMessageChecksum(Message            &aMessage,
+                                               const Ip6::Address &aIp6Source,
+                                               const Ip6::Address &aIp6Destination,
+                                               const Ip4::Address &aSource,
+                                               const Ip4::Address &aDestination,
+                                               uint8_t             aIpProto)
+{
+    uint16_t length = aMessage.GetLength() - aMessage.GetOffset();
+    uint16_t headerOffset;
+    Checksum oldPseudoHeader;
+    Checksum newPseudoHeader;
+
+    switch (aIpProto)
+    {
+    case Ip4::kProtoTcp:
+        headerOffset = Ip4::Tcp::Header::kChecksumFieldOffset;
+        break;
+
+    case Ip4::kProtoUdp:
+        headerOffset = Ip4::Udp::Header::kChecksumFieldOffset;
+        break;
+
+    default:
+        UpdateMessageChecksum(aMessage, aSource, aDestination, aIpProto);
+        ExitNow();
+    }
+
+    oldPseudoHeader.AddPseudoHeader(aIp6Source, aIp6Destination, aIpProto, length);
+    newPseudoHeader.AddPseudoHeader(aSource, aDestination, aIpProto, length);
+
+    UpdateChecksumField(aMessage, aMessage.GetOffset() + headerOffset, oldPseudoHeader.GetValue(),
+                        newPseudoHeader.GetValue());
+
+exit:
+    return;
+}
+
+void Checksum::UpdateTranslatedMessageChecksum(Message            &aMessage,
+                                               const Ip4::Address &aIp4Source,
+                                               const Ip4::Address &aIp4Destination,
+                                               const Ip6::Address &aSource,
+                                               const Ip6::Address &aDestination,
+                                               uint8_t             aIpProto)
+{
+    uint16_t length = aMessage.GetLength() - aMessage.GetOffset();
+    uint16_t headerOffset;
+    uint16_t checksum;
+    Checksum oldPseudoHeader;
+    Checksum newPseudoHeader;
+
+    switch (aIpProto)
+    {
+    case Ip6::kProtoTcp:
+        headerOffset = Ip6::Tcp::Header::kChecksumFieldOffset;
+        break;
+
+    case Ip6::kProtoUdp:
+        headerOffset = Ip6::Udp::Header::kChecksumFieldOffset;
+
+        // A zero UDP checksum indicates that the IPv4 datagram has
+        // no checksum, but it is mandatory for IPv6.
+
+        if ((aMessage.Read(aMessage.GetOffset() + headerOffset, checksum) != kErrorNone) || (checksum == 0))
+        {
+            UpdateMessageChecksum(aMessage, aSource, aDestination, aIpProto);
+            ExitNow();
+        }
+
+        break;
+
+    default:
+        UpdateMessageChecksum(aMessage, aSource, aDestination, aIpProto);
+        ExitNow();
+    }
+
+    oldPseudoHeader.AddPseudoHeader(aIp4Source, aIp4Destination, aIpProto, length);
+    newPseudoHeader.AddPseudoHeader(aSource, aDestination, aIpProto, length);
+
+    UpdateChecksumField(aMessage, aMessage.GetOffset() + headerOffset, oldPseudoHeader.GetValue(),
+                        newPseudoHeader.GetValue());
+
+exit:
+    return;
+}
+
+uint16_t Checksum::UpdateChecksumField(uint16_t aChecksum, uint16_t aOldSum, uint16_t aNewSum)
+{
+    // RFC 1624 (eqn. 3): HC' = ~(~HC + ~m + m')
+
+    Checksum checksum;
+
+    checksum.AddUint16(static_cast<uint16_t>(~aChecksum));
+    checksum.AddUint16(static_cast<uint16_t>(~aOldSum));
+    checksum.AddUint16(aNewSum);
+
+    // Same as `WriteToMessage()`, a zero sum is written as 0xffff.
+
+    return (checksum.GetValue() == 0xffff) ? checksum.GetValue() : static_cast<uint16_t>(~checksum.GetValue());
+}
+
+void Checksum::UpdateChecksumField(Message &aMessage, uint16_t aOffset, uint16_t aOldSum, uint16_t aNewSum)
+{
+    uint16_t checksum;
+
+    SuccessOrExit(aMessage.Read(aOffset, checksum));
+
+    checksum = UpdateChecksumField(Encoding::BigEndian::HostSwap16(checksum), aOldSum, aNewSum);
+    aMessage.Write(aOffset, Encoding::BigEndian::HostSwap16(checksum));
+
+exit:
+    return;
+}
+
 } // namespace ot
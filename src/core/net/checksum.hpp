@@ -109,6 +109,68 @@ public:
      */
     static void UpdateIp4HeaderChecksum(Ip4::Header &aHeader);
 
+    /**
+     * Updates the checksum in a given message translated from IPv6 to IPv4 (if TCP/UDP/ICMP(v4)).
+     *
+     * For TCP and UDP the checksum is updated incrementally (RFC 1624) by replacing the IPv6 pseudo-header with the
+     * IPv4 one, so the payload is not summed again. The ICMP(v4) checksum is calculated over the whole message.
+     *
+     * @param[in,out] aMessage         The message to update the checksum in. The `aMessage.GetOffset()` should point
+     *                                 to start of the TCP/UDP/ICMP(v4) header, which must contain the checksum of the
+     *                                 original IPv6 datagram (except for ICMP(v4)).
+     * @param[in] aIp6Source           The source address of the original IPv6 datagram.
+     * @param[in] aIp6Destination      The destination address of the original IPv6 datagram.
+     * @param[in] aSource              The IPv4 source address.
+     * @param[in] aDestination         The IPv4 destination address.
+     * @param[in] aIpProto             The IPv4 Internet Protocol value.
+     *
+     */
+    static void UpdateTranslatedMessageChecksum(Message            &aMessage,
+                                                const Ip6::Address &aIp6Source,
+                                                const Ip6::Address &aIp6Destination,
+                                                const Ip4::Address &aSource,
+                                                const Ip4::Address &aDestination,
+                                                uint8_t             aIpProto);
+
+    /**
+     * Updates the checksum in a given message translated from IPv4 to IPv6 (if TCP/UDP/ICMPv6).
+     *
+     * For TCP and UDP the checksum is updated incrementally (RFC 1624) by replacing the IPv4 pseudo-header with the
+     * IPv6 one, so the payload is not summed again. The ICMPv6 checksum, and the UDP checksum when the IPv4 datagram
+     * has none, are calculated over the whole message.
+     *
+     * @param[in,out] aMessage         The message to update the checksum in. The `aMessage.GetOffset()` should point
+     *                                 to start of the TCP/UDP/ICMPv6 header, which must contain the checksum of the
+     *                                 original IPv4 datagram (except for ICMPv6).
+     * @param[in] aIp4Source           The source address of the original IPv4 datagram.
+     * @param[in] aIp4Destination      The destination address of the original IPv4 datagram.
+     * @param[in] aSource              The IPv6 source address.
+     * @param[in] aDestination         The IPv6 destination address.
+     * @param[in] aIpProto             The IPv6 Internet Protocol value.
+     *
+     */
+    static void UpdateTranslatedMessageChecksum(Message            &aMessage,
+                                                const Ip4::Address &aIp4Source,
+                                                const Ip4::Address &aIp4Destination,
+                                                const Ip6::Address &aSource,
+                                                const Ip6::Address &aDestination,
+                                                uint8_t             aIpProto);
+
+    /**
+     * Incrementally updates a checksum field value for a change of the data covered by the checksum (RFC 1624).
+     *
+     * The change is given as the one's complement sums of the old and new data, which for a single 16-bit word are
+     * the old and new word values. The checksum field is updated as `HC' = ~(~HC + ~m + m')`.
+     *
+     * @param[in] aChecksum  The current checksum field value.
+     * @param[in] aOldSum    The one's complement sum of the old data (or the old 16-bit word).
+     * @param[in] aNewSum    The one's complement sum of the new data (or the new 16-bit word).
+     *
+     * @returns The updated checksum field value.
+     *
+     */
+    static uint16_t UpdateChecksumField(uint16_t aChecksum, uint16_t aOldSum, uint16_t aNewSum);
+
 private:
     Checksum(void)
         : mValue(0)
@@ -121,6 +183,14 @@ private:
     void     AddUint16(uint16_t aUint16);
     void     AddData(const uint8_t *aBuffer, uint16_t aLength);
     void     WriteToMessage(uint16_t aOffset, Message &aMessage) const;
+    void     AddPseudoHeader(const Ip6::Address &aSource,
+                             const Ip6::Address &aDestination,
+                             uint8_t             aIpProto,
+                             uint16_t            aLength);
+    void     AddPseudoHeader(const Ip4::Address &aSource,
+                             const Ip4::Address &aDestination,
+                             uint8_t             aIpProto,
+                             uint16_t            aLength);
     void     Calculate(const Ip6::Address &aSource,
                        const Ip6::Address &aDestination,
                        uint8_t             aIpProto,
@@ -130,6 +200,8 @@ private:
                        uint8_t             aIpProto,
                        const Message      &aMessage);
 
+    static void UpdateChecksumField(Message &aMessage, uint16_t aOffset, uint16_t aOldSum, uint16_t aNewSum);
+
     static constexpr uint16_t kValidRxChecksum = 0xffff;
 
     uint16_t mValue;
@@ -34,9 +34,11 @@
 #include "common/as_core_type.hpp"
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
+#include "common/encoding.hpp"
 #include "common/instance.hpp"
 #include "common/locator_getters.hpp"
 #include "common/log.hpp"
+#include "common/numeric_limits.hpp"
 #include "net/udp6.hpp"
 #include "thread/network_data_types.hpp"
 #include "thread/thread_netif.hpp"
@@ -743,6 +745,11 @@ Client::Client(Instance &aInstance)
 #if OPENTHREAD_CONFIG_DNS_CLIENT_DEFAULT_SERVER_ADDRESS_AUTO_SET_ENABLE
     , mUserDidSetDefaultAddress(false)
 #endif
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    , mCacheSize(kCacheMaxEntries)
+    , mCacheTimer(aInstance)
+    , mCacheReplayTask(aInstance)
+#endif
 {
     static_assert(kIp6AddressQuery == 0, "kIp6AddressQuery value is not correct");
 #if OPENTHREAD_CONFIG_DNS_CLIENT_NAT64_ENABLE
@@ -781,6 +788,11 @@ void Client::Stop(void)
         FinalizeQuery(*query, kErrorAbort);
     }
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    mCacheReplays.DequeueAndFreeAll();
+    FlushCache();
+#endif
+
     IgnoreError(mSocket.Close());
 #if OPENTHREAD_CONFIG_DNS_CLIENT_OVER_TCP_ENABLE
     if (mTcpState != kTcpUninitialized)
@@ -818,6 +830,9 @@ exit:
 void Client::SetDefaultConfig(const QueryConfig &aQueryConfig)
 {
     QueryConfig startingDefault(QueryConfig::kInitFromDefaults);
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    Ip6::SockAddr oldServerSockAddr = mDefaultConfig.GetServerSockAddr();
+#endif
 
     mDefaultConfig.SetFrom(&aQueryConfig, startingDefault);
 
@@ -825,16 +840,34 @@ void Client::SetDefaultConfig(const QueryConfig &aQueryConfig)
     mUserDidSetDefaultAddress = !aQueryConfig.GetServerSockAddr().GetAddress().IsUnspecified();
     UpdateDefaultConfigAddress();
 #endif
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    if (mDefaultConfig.GetServerSockAddr() != oldServerSockAddr)
+    {
+        FlushCache();
+    }
+#endif
 }
 
 void Client::ResetDefaultConfig(void)
 {
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    Ip6::SockAddr oldServerSockAddr = mDefaultConfig.GetServerSockAddr();
+#endif
+
     mDefaultConfig = QueryConfig(QueryConfig::kInitFromDefaults);
 
 #if OPENTHREAD_CONFIG_DNS_CLIENT_DEFAULT_SERVER_ADDRESS_AUTO_SET_ENABLE
     mUserDidSetDefaultAddress = false;
     UpdateDefaultConfigAddress();
 #endif
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    if (mDefaultConfig.GetServerSockAddr() != oldServerSockAddr)
+    {
+        FlushCache();
+    }
+#endif
 }
 
 #if OPENTHREAD_CONFIG_DNS_CLIENT_DEFAULT_SERVER_ADDRESS_AUTO_SET_ENABLE
@@ -845,6 +878,12 @@ void Client::UpdateDefaultConfigAddress(void)
     if (!mUserDidSetDefaultAddress && Get<Srp::Client>().IsServerSelectedByAutoStart() &&
         !srpServerAddr.IsUnspecified())
     {
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+        if (mDefaultConfig.GetServerSockAddr().GetAddress() != srpServerAddr)
+        {
+            FlushCache();
+        }
+#endif
         mDefaultConfig.GetServerSockAddr().SetAddress(srpServerAddr);
     }
 }
@@ -1035,6 +1074,7 @@ Error Client::AllocateQuery(const QueryInfo &aInfo, const char *aLabel, const ch
 
     aQuery = Get<MessagePool>().Allocate(Message::kTypeOther);
     VerifyOrExit(aQuery != nullptr, error = kErrorNoBufs);
+    aQuery->SetOrigin(Message::kOriginDns);
 
     SuccessOrExit(error = aQuery->Append(aInfo));
 
@@ -1106,6 +1146,16 @@ Error Client::SendQuery(Query &aQuery, QueryInfo &aInfo, bool aUpdateTimer)
         header.SetMessageId(aInfo.mMessageId);
     }
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    // On the first transmission, check whether a cached response
+    // can be used instead of sending the query to the server.
+
+    if ((aInfo.mTransmissionCount == 1) && (ReplayCachedResponse(aQuery, aInfo) == kErrorNone))
+    {
+        ExitNow();
+    }
+#endif
+
     header.SetType(Header::kTypeQuery);
     header.SetQueryType(Header::kQueryTypeStandard);
 
@@ -1118,6 +1168,7 @@ Error Client::SendQuery(Query &aQuery, QueryInfo &aInfo, bool aUpdateTimer)
 
     message = mSocket.NewMessage();
     VerifyOrExit(message != nullptr, error = kErrorNoBufs);
+    message->SetOrigin(Message::kOriginDns);
 
     SuccessOrExit(error = message->Append(header));
 
@@ -1305,13 +1356,22 @@ void Client::HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessa
     static_cast<Client *>(aContext)->ProcessResponse(AsCoreType(aMessage));
 }
 
-void Client::ProcessResponse(const Message &aResponseMessage)
+void Client::ProcessResponse(const Message &aResponseMessage, bool aFromCache)
 {
     Error  responseError;
     Query *query;
 
     SuccessOrExit(ParseResponse(aResponseMessage, query, responseError));
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    if (!aFromCache)
+    {
+        AddToCache(*query, aResponseMessage, responseError);
+    }
+#else
+    OT_UNUSED_VARIABLE(aFromCache);
+#endif
+
     if (responseError != kErrorNone)
     {
         // Received an error from server, check if we can replace
@@ -1664,6 +1724,405 @@ exit:
 
 #endif // OPENTHREAD_CONFIG_DNS_CLIENT_SERVICE_DISCOVERY_ENABLE
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
+Error Client::SetCacheSize(uint16_t aSize)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(aSize <= kCacheMaxEntries, error = kErrorInvalidArgs);
+
+    mCacheSize = aSize;
+
+    while (GetCacheEntryCount() > mCacheSize)
+    {
+        RemoveCacheEntry(*mCache.GetHead());
+    }
+
+exit:
+    return error;
+}
+
+void Client::FlushCache(void)
+{
+    mCache.DequeueAndFreeAll();
+    mCacheTimer.Stop();
+}
+
+Error Client::GetNextCacheEntry(CacheIterator &aIterator, CacheEntryInfo &aEntryInfo) const
+{
+    Error     error = kErrorNotFound;
+    TimeMilli now   = TimerMilli::GetNow();
+    uint16_t  index = 0;
+    CacheInfo cacheInfo;
+
+    for (const CacheEntry &entry : mCache)
+    {
+        uint16_t offset = kNameOffsetInCacheEntry;
+
+        if (index++ < aIterator)
+        {
+            continue;
+        }
+
+        cacheInfo.ReadFrom(entry);
+
+        memset(&aEntryInfo, 0, sizeof(aEntryInfo));
+        SuccessOrExit(error = Name::ReadName(entry, offset, aEntryInfo.mName, sizeof(aEntryInfo.mName)));
+
+        switch (cacheInfo.mQueryType)
+        {
+        case kIp6AddressQuery:
+            aEntryInfo.mType = OT_DNS_CACHE_ENTRY_IP6_ADDRESS;
+            break;
+#if OPENTHREAD_CONFIG_DNS_CLIENT_NAT64_ENABLE
+        case kIp4AddressQuery:
+            aEntryInfo.mType = OT_DNS_CACHE_ENTRY_IP4_ADDRESS;
+            break;
+#endif
+#if OPENTHREAD_CONFIG_DNS_CLIENT_SERVICE_DISCOVERY_ENABLE
+        case kBrowseQuery:
+            aEntryInfo.mType = OT_DNS_CACHE_ENTRY_BROWSE;
+            break;
+        case kServiceQuerySrvTxt:
+            aEntryInfo.mType = OT_DNS_CACHE_ENTRY_SERVICE;
+            break;
+        case kServiceQuerySrv:
+            aEntryInfo.mType = OT_DNS_CACHE_ENTRY_SERVICE_SRV;
+            break;
+        case kServiceQueryTxt:
+            aEntryInfo.mType = OT_DNS_CACHE_ENTRY_SERVICE_TXT;
+            break;
+#endif
+        case kNoQuery:
+            break;
+        }
+
+        AsCoreType(&aEntryInfo.mServerSockAddr) = cacheInfo.mServerSockAddr;
+        aEntryInfo.mTtl        = (cacheInfo.mExpireTime > now) ? Time::MsecToSec(cacheInfo.mExpireTime - now) : 0;
+        aEntryInfo.mIsNegative = cacheInfo.mIsNegative;
+
+        aIterator = index;
+        ExitNow();
+    }
+
+exit:
+    return error;
+}
+
+void Client::HandleNotifierEvents(Events aEvents)
+{
+    // Network Data changes may change the servers (e.g., SRP/DNS
+    // server) and the records they provide, so cached responses
+    // are discarded.
+
+    if (aEvents.Contains(kEventThreadNetdataChanged))
+    {
+        FlushCache();
+    }
+}
+
+void Client::AddToCache(const Query &aQuery, const Message &aResponseMessage, Error aResponseError)
+{
+    // Saves a copy of a received response in the cache. Successful
+    // responses and negative ones (name error or no data) are
+    // cached. The entry lifetime is the smallest TTL among all the
+    // records in the response (RFC 2308 for negative responses),
+    // or `kCacheNegativeTtl` for a negative response without an SOA
+    // record, and is at most `kCacheMaxTtl`.
+
+    Error       error = kErrorNone;
+    CacheEntry *entry = nullptr;
+    CacheEntry *oldEntry;
+    QueryInfo   info;
+    CacheInfo   cacheInfo;
+    Header      header;
+    uint32_t    ttl;
+    bool        hasSoa;
+
+    VerifyOrExit(mCacheSize > 0);
+    VerifyOrExit((aResponseError == kErrorNone) || (aResponseError == kErrorNotFound));
+    SuccessOrExit(error = aResponseMessage.Read(aResponseMessage.GetOffset(), header));
+
+    info.ReadFrom(aQuery);
+
+    cacheInfo.Clear();
+    cacheInfo.mQueryType      = info.mQueryType;
+    cacheInfo.mIsNegative     = (aResponseError == kErrorNotFound) || (header.GetAnswerCount() == 0);
+    cacheInfo.mServerSockAddr = info.mConfig.GetServerSockAddr();
+    cacheInfo.mAddedTime      = TimerMilli::GetNow();
+
+    entry = Get<MessagePool>().Allocate(Message::kTypeOther);
+    VerifyOrExit(entry != nullptr, error = kErrorNoBufs);
+    entry->SetOrigin(Message::kOriginDns);
+
+    SuccessOrExit(error = entry->Append(cacheInfo));
+    SuccessOrExit(error = entry->AppendBytesFromMessage(aQuery, kNameOffsetInQuery,
+                                                        aQuery.GetLength() - kNameOffsetInQuery));
+    entry->SetOffset(entry->GetLength());
+    SuccessOrExit(error = entry->AppendBytesFromMessage(aResponseMessage, aResponseMessage.GetOffset(),
+                                                        aResponseMessage.GetLength() - aResponseMessage.GetOffset()));
+
+    SuccessOrExit(error = UpdateCachedRecordTtls(*entry, /* aElapsed */ 0, ttl, &hasSoa));
+
+    if (cacheInfo.mIsNegative && !hasSoa)
+    {
+        ttl = Min(ttl, kCacheNegativeTtl);
+    }
+
+    ttl = Min(ttl, kCacheMaxTtl);
+    VerifyOrExit(ttl > 0, error = kErrorDrop);
+
+    cacheInfo.mExpireTime = cacheInfo.mAddedTime + Time::SecToMsec(ttl);
+    entry->Write(0, cacheInfo);
+
+    oldEntry = FindCacheEntry(info, aQuery);
+
+    if (oldEntry != nullptr)
+    {
+        RemoveCacheEntry(*oldEntry);
+    }
+
+    while (GetCacheEntryCount() >= mCacheSize)
+    {
+        RemoveCacheEntry(*mCache.GetHead());
+    }
+
+    mCache.Enqueue(*entry);
+    mCacheTimer.FireAtIfEarlier(cacheInfo.mExpireTime);
+
+    ShrinkCacheOnLowBuffers();
+
+exit:
+    FreeMessageOnError(entry, error);
+
+    if ((error == kErrorNoBufs) && (mCache.GetHead() != nullptr))
+    {
+        // Make room for later responses by dropping the least
+        // recently used entry.
+
+        RemoveCacheEntry(*mCache.GetHead());
+    }
+}
+
+Client::CacheEntry *Client::FindCacheEntry(const QueryInfo &aInfo, const Query &aQuery)
+{
+    CacheEntry *matchedEntry = nullptr;
+    CacheInfo   cacheInfo;
+
+    for (CacheEntry &entry : mCache)
+    {
+        uint16_t offset = kNameOffsetInCacheEntry;
+
+        cacheInfo.ReadFrom(entry);
+
+        if ((cacheInfo.mQueryType == aInfo.mQueryType) &&
+            (cacheInfo.mServerSockAddr == aInfo.mConfig.GetServerSockAddr()) &&
+            (Name::CompareName(entry, offset, aQuery, kNameOffsetInQuery) == kErrorNone))
+        {
+            matchedEntry = &entry;
+            break;
+        }
+    }
+
+    return matchedEntry;
+}
+
+Error Client::ReplayCachedResponse(const Query &aQuery, const QueryInfo &aInfo)
+{
+    // Looks up a cached response for `aQuery` and if found, prepares
+    // a copy of it (with the query message ID and the TTLs reduced
+    // by the time spent in the cache) to be processed from a tasklet
+    // as if it was received from the server.
+
+    Error       error    = kErrorNone;
+    TimeMilli   now      = TimerMilli::GetNow();
+    Message    *response = nullptr;
+    CacheEntry *entry;
+    CacheInfo   cacheInfo;
+    Header      header;
+    uint32_t    minTtl;
+
+    entry = FindCacheEntry(aInfo, aQuery);
+    VerifyOrExit(entry != nullptr, error = kErrorNotFound);
+
+    cacheInfo.ReadFrom(*entry);
+
+    if (now >= cacheInfo.mExpireTime)
+    {
+        RemoveCacheEntry(*entry);
+        ExitNow(error = kErrorNotFound);
+    }
+
+    mCache.Dequeue(*entry);
+    mCache.Enqueue(*entry);
+
+    response = entry->Clone();
+    VerifyOrExit(response != nullptr, error = kErrorNoBufs);
+
+    SuccessOrExit(error = response->Read(response->GetOffset(), header));
+    header.SetMessageId(aInfo.mMessageId);
+    response->Write(response->GetOffset(), header);
+
+    SuccessOrExit(error = UpdateCachedRecordTtls(*response, Time::MsecToSec(now - cacheInfo.mAddedTime), minTtl));
+
+    LogInfo("Answering query 0x%04x from cache", aInfo.mMessageId);
+
+    mCacheReplays.Enqueue(*response);
+    mCacheReplayTask.Post();
+
+exit:
+    FreeMessageOnError(response, error);
+    return error;
+}
+
+void Client::RemoveCacheEntry(CacheEntry &aEntry) { mCache.DequeueAndFree(aEntry); }
+
+void Client::ShrinkCacheOnLowBuffers(void)
+{
+    // Removes the least recently used entries while the number of
+    // free message buffers is below `kCacheMinFreeBuffers`, so the
+    // cache does not starve the rest of the stack.
+
+    while ((mCache.GetHead() != nullptr) && (Get<MessagePool>().GetFreeBufferCount() < kCacheMinFreeBuffers))
+    {
+        RemoveCacheEntry(*mCache.GetHead());
+    }
+}
+
+uint16_t Client::GetCacheEntryCount(void) const
+{
+    uint16_t count = 0;
+
+    for (const CacheEntry &entry : mCache)
+    {
+        OT_UNUSED_VARIABLE(entry);
+        count++;
+    }
+
+    return count;
+}
+
+void Client::HandleCacheTimer(void)
+{
+    TimeMilli   now      = TimerMilli::GetNow();
+    TimeMilli   nextTime = now.GetDistantFuture();
+    CacheEntry *nextEntry;
+    CacheInfo   cacheInfo;
+
+    for (CacheEntry *entry = mCache.GetHead(); entry != nullptr; entry = nextEntry)
+    {
+        nextEntry = entry->GetNext();
+
+        cacheInfo.ReadFrom(*entry);
+
+        if (now >= cacheInfo.mExpireTime)
+        {
+            RemoveCacheEntry(*entry);
+            continue;
+        }
+
+        nextTime = Min(nextTime, cacheInfo.mExpireTime);
+    }
+
+    if (nextTime < now.GetDistantFuture())
+    {
+        mCacheTimer.FireAt(nextTime);
+    }
+}
+
+void Client::HandleCacheReplayTask(void)
+{
+    Message *response;
+
+    while ((response = mCacheReplays.GetHead()) != nullptr)
+    {
+        mCacheReplays.Dequeue(*response);
+        ProcessResponse(*response, /* aFromCache */ true);
+        response->Free();
+    }
+}
+
+Error Client::UpdateCachedRecordTtls(Message  &aResponseMessage,
+                                     uint32_t  aElapsed,
+                                     uint32_t &aMinTtl,
+                                     bool     *aHasSoa)
+{
+    // Goes through all the records in `aResponseMessage` and
+    // determines the smallest TTL. For an SOA record, its MINIMUM
+    // field is also considered. If `aElapsed` is non-zero, the TTL
+    // of every record is reduced by `aElapsed` seconds. `aHasSoa`
+    // (if not `nullptr`) indicates whether an SOA record was seen.
+
+    Error    error  = kErrorNone;
+    uint16_t offset = aResponseMessage.GetOffset();
+    uint32_t numRecords;
+    Header   header;
+
+    aMinTtl = NumericLimits<uint32_t>::kMax;
+
+    if (aHasSoa != nullptr)
+    {
+        *aHasSoa = false;
+    }
+
+    SuccessOrExit(error = aResponseMessage.Read(offset, header));
+    offset += sizeof(Header);
+
+    for (uint16_t num = 0; num < header.GetQuestionCount(); num++)
+    {
+        SuccessOrExit(error = Name::ParseName(aResponseMessage, offset));
+        offset += sizeof(Question);
+    }
+
+    numRecords = static_cast<uint32_t>(header.GetAnswerCount()) + header.GetAuthorityRecordCount() +
+                 header.GetAdditionalRecordCount();
+
+    for (uint32_t num = 0; num < numRecords; num++)
+    {
+        ResourceRecord record;
+        uint32_t       ttl;
+
+        SuccessOrExit(error = Name::ParseName(aResponseMessage, offset));
+        SuccessOrExit(error = aResponseMessage.Read(offset, record));
+
+        if (record.GetType() != ResourceRecord::kTypeOpt)
+        {
+            ttl = record.GetTtl();
+
+            if (aElapsed != 0)
+            {
+                ttl = (ttl > aElapsed) ? (ttl - aElapsed) : 0;
+                record.SetTtl(ttl);
+                aResponseMessage.Write(offset, record);
+            }
+
+            aMinTtl = Min(aMinTtl, ttl);
+
+            if ((record.GetType() == ResourceRecord::kTypeSoa) && (record.GetLength() >= sizeof(uint32_t)))
+            {
+                uint32_t minimum;
+
+                SuccessOrExit(error = aResponseMessage.Read(
+                                  offset + static_cast<uint16_t>(record.GetSize()) - sizeof(uint32_t), minimum));
+                aMinTtl = Min(aMinTtl, Encoding::BigEndian::HostSwap32(minimum));
+
+                if (aHasSoa != nullptr)
+                {
+                    *aHasSoa = true;
+                }
+            }
+        }
+
+        offset += static_cast<uint16_t>(record.GetSize());
+    }
+
+exit:
+    return error;
+}
+
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
 #if OPENTHREAD_CONFIG_DNS_CLIENT_OVER_TCP_ENABLE
 void Client::PrepareTcpMessage(Message &aMessage)
 {
@@ -1771,6 +2230,7 @@ void Client::HandleTcpReceiveAvailable(otTcpEndpoint *aEndpoint,
 
     message = mSocket.NewMessage();
     VerifyOrExit(message != nullptr);
+    message->SetOrigin(Message::kOriginDns);
 
     while (aBytesAvailable > totalRead)
     {
@@ -39,6 +39,8 @@
 #include "common/clearable.hpp"
 #include "common/message.hpp"
 #include "common/non_copyable.hpp"
+#include "common/notifier.hpp"
+#include "common/tasklet.hpp"
 #include "common/timer.hpp"
 #include "net/dns_types.hpp"
 #include "net/ip6.hpp"
@@ -113,6 +115,9 @@ class Client : public InstanceLocator, private NonCopyable
 {
     friend class ot::Srp::Client;
     friend class ServiceDiscovery::MdnsServer;
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    friend class ot::Notifier;
+#endif
 
     typedef Message Query; // `Message` is used to save `Query` related info.
 
@@ -775,6 +780,61 @@ public:
 
 #endif // OPENTHREAD_CONFIG_DNS_CLIENT_SERVICE_DISCOVERY_ENABLE
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
+    /**
+     * Represents information about a cache entry.
+     *
+     */
+    typedef otDnsCacheEntryInfo CacheEntryInfo;
+
+    /**
+     * Represents an iterator to go over the cache entries.
+     *
+     */
+    typedef otDnsCacheIterator CacheIterator;
+
+    /**
+     * Gets the cache size (the maximum number of cached responses).
+     *
+     * @returns The current cache size. Zero indicates that the cache is disabled.
+     *
+     */
+    uint16_t GetCacheSize(void) const { return mCacheSize; }
+
+    /**
+     * Sets the cache size (the maximum number of cached responses).
+     *
+     * If the new size is smaller than the number of cached responses, the least recently used entries are removed.
+     *
+     * @param[in] aSize   The new cache size. Zero disables the cache.
+     *
+     * @retval kErrorNone          The cache size was updated.
+     * @retval kErrorInvalidArgs   @p aSize is larger than `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES`.
+     *
+     */
+    Error SetCacheSize(uint16_t aSize);
+
+    /**
+     * Removes all entries from the cache.
+     *
+     */
+    void FlushCache(void);
+
+    /**
+     * Gets the next entry in the cache (from the least to the most recently used).
+     *
+     * @param[in,out] aIterator    The iterator. MUST be set to zero to get the first entry.
+     * @param[out]    aEntryInfo   A reference to a `CacheEntryInfo` to output the entry info.
+     *
+     * @retval kErrorNone       Found the next entry. @p aEntryInfo and @p aIterator are updated.
+     * @retval kErrorNotFound   No more entries in the cache.
+     *
+     */
+    Error GetNextCacheEntry(CacheIterator &aIterator, CacheEntryInfo &aEntryInfo) const;
+
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
     enum QueryType : uint8_t
     {
         kIp6AddressQuery, // IPv6 Address resolution.
@@ -833,6 +893,31 @@ private:
 
     static constexpr uint16_t kNameOffsetInQuery = sizeof(QueryInfo);
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    typedef Message CacheEntry; // `Message` is used to save a cached response.
+
+    struct CacheInfo : public Clearable<CacheInfo> // Cache entry related info
+    {
+        void ReadFrom(const CacheEntry &aEntry) { IgnoreError(aEntry.Read(0, *this)); }
+
+        QueryType     mQueryType;
+        bool          mIsNegative;
+        Ip6::SockAddr mServerSockAddr;
+        TimeMilli     mAddedTime;
+        TimeMilli     mExpireTime;
+        // Followed by the query name encoded as a `Dns::Name` and
+        // then by the response (starting at the message offset).
+    };
+
+    static constexpr uint16_t kNameOffsetInCacheEntry = sizeof(CacheInfo);
+    static constexpr uint16_t kCacheMaxEntries        = OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES;
+    static constexpr uint32_t kCacheNegativeTtl       = OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_NEGATIVE_TTL;
+    static constexpr uint32_t kCacheMaxTtl            = OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_TTL;
+    static constexpr uint16_t kCacheMinFreeBuffers    = OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MIN_FREE_BUFFERS;
+
+    static_assert(kCacheMaxTtl <= Time::MsecToSec(TimerMilli::kMaxDelay), "DNS_CLIENT_CACHE_MAX_TTL is too large");
+#endif
+
     Error       StartQuery(QueryInfo &aInfo, const char *aLabel, const char *aName, QueryType aSecondType = kNoQuery);
     Error       AllocateQuery(const QueryInfo &aInfo, const char *aLabel, const char *aName, Query *&aQuery);
     void        FreeQuery(Query &aQuery);
@@ -845,7 +930,7 @@ private:
     Error       AppendNameFromQuery(const Query &aQuery, Message &aMessage);
     Query      *FindQueryById(uint16_t aMessageId);
     static void HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMsgInfo);
-    void        ProcessResponse(const Message &aResponseMessage);
+    void        ProcessResponse(const Message &aResponseMessage, bool aFromCache = false);
     Error       ParseResponse(const Message &aResponseMessage, Query *&aQuery, Error &aResponseError);
     bool        CanFinalizeQuery(Query &aQuery);
     void        SaveQueryResponse(Query &aQuery, const Message &aResponseMessage);
@@ -871,6 +956,22 @@ private:
     void UpdateDefaultConfigAddress(void);
 #endif
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    void         HandleNotifierEvents(Events aEvents);
+    void         AddToCache(const Query &aQuery, const Message &aResponseMessage, Error aResponseError);
+    CacheEntry  *FindCacheEntry(const QueryInfo &aInfo, const Query &aQuery);
+    Error        ReplayCachedResponse(const Query &aQuery, const QueryInfo &aInfo);
+    void         RemoveCacheEntry(CacheEntry &aEntry);
+    void         ShrinkCacheOnLowBuffers(void);
+    uint16_t     GetCacheEntryCount(void) const;
+    void         HandleCacheTimer(void);
+    void         HandleCacheReplayTask(void);
+    static Error UpdateCachedRecordTtls(Message  &aResponseMessage,
+                                        uint32_t  aElapsed,
+                                        uint32_t &aMinTtl,
+                                        bool     *aHasSoa = nullptr);
+#endif
+
 #if OPENTHREAD_CONFIG_DNS_CLIENT_OVER_TCP_ENABLE
     static void HandleTcpEstablishedCallback(otTcpEndpoint *aEndpoint);
     static void HandleTcpSendDoneCallback(otTcpEndpoint *aEndpoint, otLinkedBuffer *aData);
@@ -910,6 +1011,10 @@ private:
     static constexpr uint16_t kUdpQueryMaxSize = 512;
 
     using RetryTimer = TimerMilliIn<Client, &Client::HandleTimer>;
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    using CacheTimer      = TimerMilliIn<Client, &Client::HandleCacheTimer>;
+    using CacheReplayTask = TaskletIn<Client, &Client::HandleCacheReplayTask>;
+#endif
 
     Ip6::Udp::Socket mSocket;
 
@@ -929,6 +1034,13 @@ private:
 #if OPENTHREAD_CONFIG_DNS_CLIENT_DEFAULT_SERVER_ADDRESS_AUTO_SET_ENABLE
     bool mUserDidSetDefaultAddress;
 #endif
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    MessageQueue    mCache; // Ordered from least to most recently used.
+    MessageQueue    mCacheReplays;
+    uint16_t        mCacheSize;
+    CacheTimer      mCacheTimer;
+    CacheReplayTask mCacheReplayTask;
+#endif
 };
 
 } // namespace Dns
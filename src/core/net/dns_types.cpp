@@ -692,6 +692,238 @@ bool Name::IsSameDomain(const char *aDomain1, const char *aDomain2)
     return IsSubDomainOf(aDomain1, aDomain2) && IsSubDomainOf(aDomain2, aDomain1);
 }
 
+Error NameCompressor::AppendName(const char *aFirstLabel, const char *aName, Message &aMessage)
+{
+    // Labels of `aName` are walked from right to left. `suffixStart`
+    // is the index in `aName` of the first char of the longest suffix
+    // already present in the dictionary, and `parent` is the entry of
+    // that suffix. Since labels are encoded with their length byte in
+    // place of the preceding dot, a label starting at index `i` in
+    // `aName` is encoded at offset `i` from the start of the name.
+
+    Error    error       = kErrorNone;
+    uint16_t nameLength  = (aName == nullptr) ? 0 : StringLength(aName, Name::kMaxEncodedLength);
+    uint8_t  firstLength = 0;
+    uint8_t  parent      = kRootIndex;
+    bool     matching    = true;
+    uint16_t suffixStart;
+    uint16_t nameOffset;
+    uint16_t labelStart;
+
+    if ((nameLength > 0) && (aName[nameLength - 1] == Name::kLabelSeparatorChar))
+    {
+        nameLength--;
+    }
+
+    suffixStart = (nameLength == 0) ? 0 : nameLength + 1;
+
+    for (uint16_t labelEnd = suffixStart; labelEnd > 0; labelEnd = labelStart)
+    {
+        uint8_t index;
+
+        labelEnd--;
+        labelStart = labelEnd;
+
+        while ((labelStart > 0) && (aName[labelStart - 1] != Name::kLabelSeparatorChar))
+        {
+            labelStart--;
+        }
+
+        VerifyOrExit((labelEnd > labelStart) && (labelEnd - labelStart <= Name::kMaxLabelLength),
+                     error = kErrorInvalidArgs);
+
+        if (!matching)
+        {
+            continue;
+        }
+
+        index = FindEntry(aMessage, &aName[labelStart], static_cast<uint8_t>(labelEnd - labelStart), parent);
+
+        if (index == kNotFound)
+        {
+            matching = false;
+        }
+        else
+        {
+            parent      = index;
+            suffixStart = labelStart;
+        }
+    }
+
+    nameOffset = aMessage.GetLength() - aMessage.GetOffset();
+
+    if (aFirstLabel != nullptr)
+    {
+        uint8_t index = kNotFound;
+
+        firstLength = static_cast<uint8_t>(StringLength(aFirstLabel, Name::kMaxLabelSize));
+
+        if (suffixStart == 0)
+        {
+            index = FindEntry(aMessage, aFirstLabel, firstLength, parent);
+        }
+
+        if (index != kNotFound)
+        {
+            parent      = index;
+            aFirstLabel = nullptr;
+        }
+        else
+        {
+            SuccessOrExit(error = Name::AppendLabel(aFirstLabel, firstLength, aMessage));
+            nameOffset += firstLength + sizeof(uint8_t);
+        }
+    }
+
+    if (suffixStart > 0)
+    {
+        SuccessOrExit(error = Name::AppendMultipleLabels(aName, static_cast<uint8_t>(suffixStart - 1), aMessage));
+    }
+
+    if (parent == kRootIndex)
+    {
+        SuccessOrExit(error = Name::AppendTerminator(aMessage));
+    }
+    else
+    {
+        SuccessOrExit(error = Name::AppendPointerLabel(mEntries[parent].mOffset, aMessage));
+    }
+
+    // Add the newly written suffixes, right to left so that each
+    // label can refer to the entry of the suffix following it.
+
+    for (uint16_t labelEnd = suffixStart; (labelEnd > 0) && (parent != kNotFound); labelEnd = labelStart)
+    {
+        labelEnd--;
+        labelStart = labelEnd;
+
+        while ((labelStart > 0) && (aName[labelStart - 1] != Name::kLabelSeparatorChar))
+        {
+            labelStart--;
+        }
+
+        parent = AddEntry(&aName[labelStart], static_cast<uint8_t>(labelEnd - labelStart), parent,
+                          nameOffset + labelStart);
+    }
+
+    if ((aFirstLabel != nullptr) && (parent != kNotFound))
+    {
+        IgnoreReturnValue(AddEntry(aFirstLabel, firstLength, parent, nameOffset - firstLength - sizeof(uint8_t)));
+    }
+
+exit:
+    return error;
+}
+
+Error NameCompressor::AddName(const Message &aMessage, uint16_t aOffset)
+{
+    Error               error;
+    Name::LabelIterator iterator(aMessage, aOffset);
+    uint16_t            labelOffsets[Name::kMaxEncodedLength / 2];
+    uint8_t             numLabels = 0;
+    uint8_t             parent    = kRootIndex;
+
+    while ((error = iterator.GetNextLabel()) == kErrorNone)
+    {
+        VerifyOrExit(numLabels < GetArrayLength(labelOffsets), error = kErrorParse);
+        labelOffsets[numLabels++] = iterator.mLabelStartOffset - sizeof(uint8_t);
+    }
+
+    VerifyOrExit(error == kErrorNotFound);
+    error = kErrorNone;
+
+    while ((numLabels > 0) && (parent != kNotFound))
+    {
+        uint16_t offset = labelOffsets[--numLabels];
+        char     label[Name::kMaxLabelSize];
+        uint8_t  length;
+        uint8_t  index;
+
+        SuccessOrExit(error = aMessage.Read(offset, length));
+        SuccessOrExit(error = aMessage.Read(offset + sizeof(uint8_t), label, length));
+
+        index  = FindEntry(aMessage, label, length, parent);
+        parent = (index != kNotFound) ? index : AddEntry(label, length, parent, offset - aMessage.GetOffset());
+    }
+
+exit:
+    return error;
+}
+
+uint16_t NameCompressor::CalculateHash(const char *aLabel, uint8_t aLength, uint8_t aParent)
+{
+    uint16_t hash = static_cast<uint16_t>(aParent) + 1;
+
+    for (uint8_t i = 0; i < aLength; i++)
+    {
+        hash = static_cast<uint16_t>(hash * 31 + static_cast<uint8_t>(ToLowercase(aLabel[i])));
+    }
+
+    return hash;
+}
+
+bool NameCompressor::MatchLabel(const Message &aMessage, uint16_t aOffset, const char *aLabel, uint8_t aLength)
+{
+    uint16_t offset = aMessage.GetOffset() + aOffset;
+    uint8_t  length;
+
+    return (aMessage.Read(offset, length) == kErrorNone) && (length == aLength) &&
+           aMessage.CompareBytes(offset + sizeof(uint8_t), aLabel, aLength, Name::LabelIterator::CaseInsensitiveMatch);
+}
+
+uint8_t NameCompressor::FindEntry(const Message &aMessage, const char *aLabel, uint8_t aLength, uint8_t aParent) const
+{
+    uint16_t hash  = CalculateHash(aLabel, aLength, aParent);
+    uint16_t index = hash % kNumEntries;
+    uint8_t  found = kNotFound;
+
+    for (uint16_t probes = 0; probes < kNumEntries; probes++)
+    {
+        const Entry &entry = mEntries[index];
+
+        VerifyOrExit(entry.mOffset != kUnusedEntry);
+
+        if ((entry.mHash == hash) && (entry.mParent == aParent) &&
+            MatchLabel(aMessage, entry.mOffset, aLabel, aLength))
+        {
+            ExitNow(found = static_cast<uint8_t>(index));
+        }
+
+        index = (index + 1) % kNumEntries;
+    }
+
+exit:
+    return found;
+}
+
+uint8_t NameCompressor::AddEntry(const char *aLabel, uint8_t aLength, uint8_t aParent, uint16_t aOffset)
+{
+    uint16_t hash  = CalculateHash(aLabel, aLength, aParent);
+    uint16_t index = hash % kNumEntries;
+    uint8_t  added = kNotFound;
+
+    // A pointer label can only refer to the first 14-bit worth of
+    // offsets. When the dictionary is full, the name is left out and
+    // later names are simply not compressed against it.
+
+    VerifyOrExit(mNumEntries < kNumEntries);
+    VerifyOrExit((aOffset != kUnusedEntry) && (aOffset <= Name::kPointerLabelOffsetMask));
+
+    while (mEntries[index].mOffset != kUnusedEntry)
+    {
+        index = (index + 1) % kNumEntries;
+    }
+
+    mEntries[index].mOffset = aOffset;
+    mEntries[index].mHash   = hash;
+    mEntries[index].mParent = aParent;
+    mNumEntries++;
+    added = static_cast<uint8_t>(index);
+
+exit:
+    return added;
+}
+
 Error ResourceRecord::ParseRecords(const Message &aMessage, uint16_t &aOffset, uint16_t aNumRecords)
 {
     Error error = kErrorNone;
@@ -489,6 +489,8 @@ public:
  */
 class Name : public Clearable<Name>
 {
+    friend class NameCompressor;
+
 public:
     /**
      * Max size (number of chars) in a name string array (includes null char at the end of string).
@@ -1061,6 +1063,109 @@ private:
     uint16_t       mOffset;  // Offset in `mMessage` to the start of name (used when name is from `mMessage`).
 };
 
+/**
+ * Implements a name compression dictionary used when building a DNS message.
+ *
+ * The dictionary remembers every name suffix written into (or added from) one message, indexed by a small hash table
+ * keyed on the (case-insensitive) label and the entry of the suffix that follows it. Appending a name looks up its
+ * longest previously written suffix and replaces it with a single pointer label, so names are compressed optimally in
+ * a single pass over the message.
+ *
+ * A `NameCompressor` is bound to a single message. It MUST be cleared before it is used with another message.
+ *
+ */
+class NameCompressor : public Clearable<NameCompressor>
+{
+public:
+    /**
+     * Initializes the `NameCompressor` as empty.
+     *
+     */
+    NameCompressor(void) { Clear(); }
+
+    /**
+     * Encodes and appends a full name to a message, compressing it against names previously written.
+     *
+     * The @p aName follows the same format as in `Name::AppendName()`.
+     *
+     * @param[in]  aName              A name string. Can be `nullptr` (then treated as "." or root).
+     * @param[in]  aMessage           The message to append to.
+     *
+     * @retval kErrorNone         Successfully encoded and appended the name to @p aMessage.
+     * @retval kErrorInvalidArgs  Name @p aName is not valid.
+     * @retval kErrorNoBufs       Insufficient available buffers to grow the message.
+     *
+     */
+    Error AppendName(const char *aName, Message &aMessage) { return AppendName(nullptr, aName, aMessage); }
+
+    /**
+     * Encodes and appends a name made of a single first label followed by a multi-label name to a message,
+     * compressing it against names previously written.
+     *
+     * This is intended for "Service Instance Names" where the first label (`<Instance>` portion) is a user-friendly
+     * string that can contain dot characters.
+     *
+     * @param[in]  aFirstLabel        The first label string. Can be `nullptr` (then only @p aName is appended).
+     * @param[in]  aName              The name string following @p aFirstLabel.
+     * @param[in]  aMessage           The message to append to.
+     *
+     * @retval kErrorNone         Successfully encoded and appended the name to @p aMessage.
+     * @retval kErrorInvalidArgs  @p aFirstLabel or @p aName is not valid.
+     * @retval kErrorNoBufs       Insufficient available buffers to grow the message.
+     *
+     */
+    Error AppendName(const char *aFirstLabel, const char *aName, Message &aMessage);
+
+    /**
+     * Adds a name already present in a message to the dictionary.
+     *
+     * This allows names written without the dictionary (e.g., a question section copied from a request) to be used as
+     * compression targets by later names.
+     *
+     * @param[in]  aMessage           The message containing the name. `aMessage.GetOffset()` MUST point to the start
+     *                                of DNS header.
+     * @param[in]  aOffset            The offset in @p aMessage to the start of the name field.
+     *
+     * @retval kErrorNone         Successfully parsed the name and added its suffixes.
+     * @retval kErrorParse        Name could not be parsed (invalid format).
+     *
+     */
+    Error AddName(const Message &aMessage, uint16_t aOffset);
+
+    /**
+     * Returns the number of name suffixes currently in the dictionary.
+     *
+     * @returns The number of entries in use.
+     *
+     */
+    uint16_t GetNumEntries(void) const { return mNumEntries; }
+
+private:
+    static constexpr uint16_t kNumEntries  = OPENTHREAD_CONFIG_DNS_NAME_COMPRESSOR_NUM_ENTRIES;
+    static constexpr uint8_t  kRootIndex   = 0xff; // Parent index of a last label (followed by root).
+    static constexpr uint8_t  kNotFound    = 0xfe; // Returned when no entry is found or can be added.
+    static constexpr uint16_t kUnusedEntry = 0;    // `mOffset` of an unused entry (offset zero is the DNS header).
+
+    static_assert((kNumEntries > 0) && (kNumEntries < kNotFound),
+                  "OPENTHREAD_CONFIG_DNS_NAME_COMPRESSOR_NUM_ENTRIES must be between 1 and 253");
+
+    struct Entry
+    {
+        uint16_t mOffset; // Offset (from the start of DNS header) of the label length byte.
+        uint16_t mHash;   // Hash of the lowercase label and `mParent`.
+        uint8_t  mParent; // Index of the entry for the suffix following the label, or `kRootIndex`.
+    };
+
+    static uint16_t CalculateHash(const char *aLabel, uint8_t aLength, uint8_t aParent);
+    static bool     MatchLabel(const Message &aMessage, uint16_t aOffset, const char *aLabel, uint8_t aLength);
+
+    uint8_t FindEntry(const Message &aMessage, const char *aLabel, uint8_t aLength, uint8_t aParent) const;
+    uint8_t AddEntry(const char *aLabel, uint8_t aLength, uint8_t aParent, uint16_t aOffset);
+
+    Entry    mEntries[kNumEntries];
+    uint16_t mNumEntries;
+};
+
 /**
  * Represents a TXT record entry representing a key/value pair (RFC 6763 - section 6.3).
  *
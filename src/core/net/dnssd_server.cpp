@@ -44,6 +44,8 @@
 #include "common/instance.hpp"
 #include "common/locator_getters.hpp"
 #include "common/log.hpp"
+#include "common/num_utils.hpp"
+#include "common/numeric_limits.hpp"
 #include "common/string.hpp"
 #include "net/srp_server.hpp"
 #include "net/udp6.hpp"
@@ -75,8 +77,18 @@ Server::Server(Instance &aInstance)
 #endif
     , mTimer(aInstance)
     , mTestMode(kTestModeDisabled)
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+    , mAnswerCacheTimer(aInstance)
+#endif
 {
     mCounters.Clear();
+
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+    for (CachedAnswer &entry : mAnswerCache)
+    {
+        entry.mResponse = nullptr;
+    }
+#endif
 }
 
 Error Server::Start(void)
@@ -126,6 +138,10 @@ void Server::Stop(void)
 
     mTimer.Stop();
 
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+    ClearAnswerCache();
+#endif
+
     IgnoreError(mSocket.Close());
     LogInfo("stopped");
 
@@ -134,6 +150,15 @@ void Server::Stop(void)
 #endif
 }
 
+void Server::SetTestMode(uint8_t aTestMode)
+{
+    mTestMode = aTestMode;
+
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+    ClearAnswerCache();
+#endif
+}
+
 void Server::HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
 {
     static_cast<Server *>(aContext)->HandleUdpReceive(AsCoreType(aMessage), AsCoreType(aMessageInfo));
@@ -165,7 +190,7 @@ void Server::ProcessQuery(const Header &aRequestHeader, Message &aRequestMessage
     Error            error           = kErrorNone;
     Message         *responseMessage = nullptr;
     Header           responseHeader;
-    NameCompressInfo compressInfo(kDefaultDomainName);
+    NameCompressInfo compressInfo(mNameCompressor, kDefaultDomainName);
     Header::Response response           = Header::kResponseSuccess;
     bool             shouldSendResponse = true;
 
@@ -185,6 +210,7 @@ void Server::ProcessQuery(const Header &aRequestHeader, Message &aRequestMessage
 
     responseMessage = mSocket.NewMessage();
     VerifyOrExit(responseMessage != nullptr, error = kErrorNoBufs);
+    responseMessage->SetOrigin(Message::kOriginDns);
 
     // Allocate space for DNS header
     SuccessOrExit(error = responseMessage->SetLength(sizeof(Header)));
@@ -217,8 +243,24 @@ void Server::ProcessQuery(const Header &aRequestHeader, Message &aRequestMessage
     VerifyOrExit(response == Header::kResponseSuccess);
 
 #if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
-    // Answer the questions
-    response = ResolveBySrp(responseHeader, *responseMessage, compressInfo);
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+    if (AnswerFromCache(responseHeader, *responseMessage) == kErrorNone)
+    {
+        ++mCounters.mResolvedByCache;
+    }
+    else
+#endif
+    {
+        // Answer the questions
+        response = ResolveBySrp(responseHeader, *responseMessage, compressInfo);
+
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+        if ((response == Header::kResponseSuccess) && (responseHeader.GetAnswerCount() > 0))
+        {
+            AddToAnswerCache(responseHeader, *responseMessage);
+        }
+#endif
+    }
 #endif
     if (responseHeader.GetAnswerCount() == 0)
     {
@@ -369,6 +411,26 @@ exit:
     return error;
 }
 
+Error Server::AddQuestionNames(const Header &aHeader, const Message &aMessage, NameCompressInfo &aCompressInfo)
+{
+    // Adds the names from the question section of an already
+    // prepared response so that the answer records appended later
+    // can be compressed against them.
+
+    Error    error  = kErrorNone;
+    uint16_t offset = sizeof(Header);
+
+    for (uint16_t i = 0; i < aHeader.GetQuestionCount(); i++)
+    {
+        SuccessOrExit(error = aCompressInfo.GetCompressor().AddName(aMessage, offset));
+        SuccessOrExit(error = Name::ParseName(aMessage, offset));
+        offset += sizeof(Question);
+    }
+
+exit:
+    return error;
+}
+
 Error Server ::ConvertDomainName(char *aName, char *aHostName, NameCompressInfo &aCompressInfo)
 {
     const char              *currentDomainNamePtr;
@@ -550,93 +612,26 @@ exit:
 
 Error Server::AppendServiceName(Message &aMessage, const char *aName, NameCompressInfo &aCompressInfo)
 {
-    Error       error;
-    uint16_t    serviceCompressOffset = aCompressInfo.GetServiceNameOffset(aMessage, aName);
-    const char *serviceName;
-
-    // Check whether `aName` is a sub-type service name.
-    serviceName = StringFind(aName, kDnssdSubTypeLabel, kStringCaseInsensitiveMatch);
-
-    if (serviceName != nullptr)
-    {
-        uint8_t subTypeLabelLength = static_cast<uint8_t>(serviceName - aName) + sizeof(kDnssdSubTypeLabel) - 1;
-
-        SuccessOrExit(error = Name::AppendMultipleLabels(aName, subTypeLabelLength, aMessage));
-
-        // Skip over the "._sub." label to get to the root service name.
-        serviceName += sizeof(kDnssdSubTypeLabel) - 1;
-    }
-    else
-    {
-        serviceName = aName;
-    }
-
-    if (serviceCompressOffset != NameCompressInfo::kUnknownOffset)
-    {
-        error = Name::AppendPointerLabel(serviceCompressOffset, aMessage);
-    }
-    else
-    {
-        uint8_t  domainStart          = static_cast<uint8_t>(StringLength(serviceName, Name::kMaxNameSize - 1) -
-                                                   StringLength(aCompressInfo.GetDomainName(), Name::kMaxNameSize - 1));
-        uint16_t domainCompressOffset = aCompressInfo.GetDomainNameOffset();
-
-        serviceCompressOffset = aMessage.GetLength();
-        aCompressInfo.SetServiceNameOffset(serviceCompressOffset);
-
-        if (domainCompressOffset == NameCompressInfo::kUnknownOffset)
-        {
-            aCompressInfo.SetDomainNameOffset(serviceCompressOffset + domainStart);
-            error = Name::AppendName(serviceName, aMessage);
-        }
-        else
-        {
-            SuccessOrExit(error = Name::AppendMultipleLabels(serviceName, domainStart, aMessage));
-            error = Name::AppendPointerLabel(domainCompressOffset, aMessage);
-        }
-    }
-
-exit:
-    return error;
+    return aCompressInfo.GetCompressor().AppendName(aName, aMessage);
 }
 
 Error Server::AppendInstanceName(Message &aMessage, const char *aName, NameCompressInfo &aCompressInfo)
 {
-    Error    error;
-    uint16_t instanceCompressOffset = aCompressInfo.GetInstanceNameOffset(aMessage, aName);
-
-    if (instanceCompressOffset != NameCompressInfo::kUnknownOffset)
-    {
-        error = Name::AppendPointerLabel(instanceCompressOffset, aMessage);
-    }
-    else
-    {
-        NameComponentsOffsetInfo nameComponentsInfo;
-
-        IgnoreError(FindNameComponents(aName, aCompressInfo.GetDomainName(), nameComponentsInfo));
-        OT_ASSERT(nameComponentsInfo.IsServiceInstanceName());
-        VerifyOrExit(nameComponentsInfo.IsServiceInstanceName(), error = kErrorFailed);
+    Error                    error;
+    NameComponentsOffsetInfo nameComponentsInfo;
+    char                     instanceLabel[Name::kMaxLabelSize];
 
-        aCompressInfo.SetInstanceNameOffset(aMessage.GetLength());
+    IgnoreError(FindNameComponents(aName, aCompressInfo.GetDomainName(), nameComponentsInfo));
+    OT_ASSERT(nameComponentsInfo.IsServiceInstanceName());
+    VerifyOrExit(nameComponentsInfo.IsServiceInstanceName(), error = kErrorFailed);
+    VerifyOrExit(nameComponentsInfo.mServiceOffset <= sizeof(instanceLabel), error = kErrorInvalidArgs);
 
-        // Append the instance name as one label
-        SuccessOrExit(error = Name::AppendLabel(aName, nameComponentsInfo.mServiceOffset - 1, aMessage));
+    // The instance name is appended as one label (it can contain dots).
+    memcpy(instanceLabel, aName, nameComponentsInfo.mServiceOffset - 1);
+    instanceLabel[nameComponentsInfo.mServiceOffset - 1] = kNullChar;
 
-        {
-            const char *serviceName           = aName + nameComponentsInfo.mServiceOffset;
-            uint16_t    serviceCompressOffset = aCompressInfo.GetServiceNameOffset(aMessage, serviceName);
-
-            if (serviceCompressOffset != NameCompressInfo::kUnknownOffset)
-            {
-                error = Name::AppendPointerLabel(serviceCompressOffset, aMessage);
-            }
-            else
-            {
-                aCompressInfo.SetServiceNameOffset(aMessage.GetLength());
-                error = Name::AppendName(serviceName, aMessage);
-            }
-        }
-    }
+    error = aCompressInfo.GetCompressor().AppendName(instanceLabel, aName + nameComponentsInfo.mServiceOffset,
+                                                     aMessage);
 
 exit:
     return error;
@@ -694,36 +689,7 @@ exit:
 
 Error Server::AppendHostName(Message &aMessage, const char *aName, NameCompressInfo &aCompressInfo)
 {
-    Error    error;
-    uint16_t hostCompressOffset = aCompressInfo.GetHostNameOffset(aMessage, aName);
-
-    if (hostCompressOffset != NameCompressInfo::kUnknownOffset)
-    {
-        error = Name::AppendPointerLabel(hostCompressOffset, aMessage);
-    }
-    else
-    {
-        uint8_t  domainStart          = static_cast<uint8_t>(StringLength(aName, Name::kMaxNameLength) -
-                                                   StringLength(aCompressInfo.GetDomainName(), Name::kMaxNameSize - 1));
-        uint16_t domainCompressOffset = aCompressInfo.GetDomainNameOffset();
-
-        hostCompressOffset = aMessage.GetLength();
-        aCompressInfo.SetHostNameOffset(hostCompressOffset);
-
-        if (domainCompressOffset == NameCompressInfo::kUnknownOffset)
-        {
-            aCompressInfo.SetDomainNameOffset(hostCompressOffset + domainStart);
-            error = Name::AppendName(aName, aMessage);
-        }
-        else
-        {
-            SuccessOrExit(error = Name::AppendMultipleLabels(aName, domainStart, aMessage));
-            error = Name::AppendPointerLabel(domainCompressOffset, aMessage);
-        }
-    }
-
-exit:
-    return error;
+    return aCompressInfo.GetCompressor().AppendName(aName, aMessage);
 }
 
 void Server::IncResourceRecordCount(Header &aHeader, bool aAdditional)
@@ -830,6 +796,7 @@ Header::Response Server::ResolveBySrp(Header                   &aResponseHeader,
     Question         question;
     uint16_t         readOffset = sizeof(Header);
     Header::Response response   = Header::kResponseSuccess;
+    SrpHostArray     appendedHosts;
     char             name[Name::kMaxNameSize];
 
     for (uint16_t i = 0; i < aResponseHeader.GetQuestionCount(); i++)
@@ -839,7 +806,7 @@ Header::Response Server::ResolveBySrp(Header                   &aResponseHeader,
         readOffset += sizeof(question);
 
         response = ResolveQuestionBySrp(name, question, aResponseHeader, aResponseMessage, aCompressInfo,
-                                        /* aAdditional */ false);
+                                        appendedHosts, /* aAdditional */ false);
 
         LogInfo("ANSWER: TRANSACTION=0x%04x, QUESTION=[%s %d %d], RCODE=%d", aResponseHeader.GetMessageId(), name,
                 question.GetClass(), question.GetType(), response);
@@ -859,7 +826,7 @@ Header::Response Server::ResolveBySrp(Header                   &aResponseHeader,
 
             VerifyOrExit(Header::kResponseServerFailure != ResolveQuestionBySrp(name, question, aResponseHeader,
                                                                                 aResponseMessage, aCompressInfo,
-                                                                                /* aAdditional */ true),
+                                                                                appendedHosts, /* aAdditional */ true),
                          response = Header::kResponseServerFailure);
 
             LogInfo("ADDITIONAL: TRANSACTION=0x%04x, QUESTION=[%s %d %d], RCODE=%d", aResponseHeader.GetMessageId(),
@@ -875,90 +842,123 @@ Header::Response Server::ResolveQuestionBySrp(const char       *aName,
                                               Header           &aResponseHeader,
                                               Message          &aResponseMessage,
                                               NameCompressInfo &aCompressInfo,
+                                              SrpHostArray     &aAppendedHosts,
                                               bool              aAdditional)
 {
-    Error                    error    = kErrorNone;
-    const Srp::Server::Host *host     = nullptr;
-    TimeMilli                now      = TimerMilli::GetNow();
-    uint16_t                 qtype    = aQuestion.GetType();
-    Header::Response         response = Header::kResponseNameError;
+    static constexpr Srp::Server::Service::Flags kBaseTypeActiveFlags =
+        Srp::Server::Service::kFlagBaseType | Srp::Server::Service::kFlagActive;
 
-    while ((host = GetNextSrpHost(host)) != nullptr)
-    {
-        bool        needAdditionalAaaaRecord = false;
-        const char *hostName                 = host->GetFullName();
+    Error                       error    = kErrorNone;
+    const Srp::Server          &srp      = Get<Srp::Server>();
+    const Srp::Server::Service *service  = nullptr;
+    const Srp::Server::Host    *host     = nullptr;
+    TimeMilli                   now      = TimerMilli::GetNow();
+    uint16_t                    qtype    = aQuestion.GetType();
+    Header::Response            response = Header::kResponseNameError;
+
+    // Handle PTR/ANY query by looking up the services with `aName`
+    // as their service name (base or sub-type).
 
-        // Handle PTR/SRV/TXT/ANY query
-        if (qtype == ResourceRecord::kTypePtr || qtype == ResourceRecord::kTypeSrv ||
-            qtype == ResourceRecord::kTypeTxt || qtype == ResourceRecord::kTypeAny)
+    if (qtype == ResourceRecord::kTypePtr || qtype == ResourceRecord::kTypeAny)
+    {
+        while ((service = srp.FindNextService(service, Srp::Server::kFlagsAnyTypeActiveService, aName,
+                                              /* aInstanceName */ nullptr)) != nullptr)
         {
-            const Srp::Server::Service *service = nullptr;
+            uint32_t    instanceTtl  = TimeMilli::MsecToSec(service->GetExpireTime() - now);
+            const char *instanceName = service->GetInstanceName();
 
-            while ((service = GetNextSrpService(*host, service)) != nullptr)
+            if (!aAdditional)
             {
-                uint32_t    instanceTtl         = TimeMilli::MsecToSec(service->GetExpireTime() - TimerMilli::GetNow());
-                const char *instanceName        = service->GetInstanceName();
-                bool        serviceNameMatched  = service->MatchesServiceName(aName);
-                bool        instanceNameMatched = (!service->IsSubType() && service->MatchesInstanceName(aName));
-                bool        ptrQueryMatched =
-                    (qtype == ResourceRecord::kTypePtr || qtype == ResourceRecord::kTypeAny) && serviceNameMatched;
-                bool srvQueryMatched =
-                    (qtype == ResourceRecord::kTypeSrv || qtype == ResourceRecord::kTypeAny) && instanceNameMatched;
-                bool txtQueryMatched =
-                    (qtype == ResourceRecord::kTypeTxt || qtype == ResourceRecord::kTypeAny) && instanceNameMatched;
-
-                if (ptrQueryMatched || srvQueryMatched)
-                {
-                    needAdditionalAaaaRecord = true;
-                }
+                SuccessOrExit(error =
+                                  AppendPtrRecord(aResponseMessage, aName, instanceName, instanceTtl, aCompressInfo));
+                IncResourceRecordCount(aResponseHeader, aAdditional);
+                response = Header::kResponseSuccess;
+                continue;
+            }
 
-                if (!aAdditional && ptrQueryMatched)
-                {
-                    SuccessOrExit(
-                        error = AppendPtrRecord(aResponseMessage, aName, instanceName, instanceTtl, aCompressInfo));
-                    IncResourceRecordCount(aResponseHeader, aAdditional);
-                    response = Header::kResponseSuccess;
-                }
+            if (!HasQuestion(aResponseHeader, aResponseMessage, instanceName, ResourceRecord::kTypeSrv))
+            {
+                SuccessOrExit(error = AppendSrvRecord(aResponseMessage, instanceName, service->GetHost().GetFullName(),
+                                                      instanceTtl, service->GetPriority(), service->GetWeight(),
+                                                      service->GetPort(), aCompressInfo));
+                IncResourceRecordCount(aResponseHeader, aAdditional);
+                response = Header::kResponseSuccess;
+            }
 
-                if ((!aAdditional && srvQueryMatched) ||
-                    (aAdditional && ptrQueryMatched &&
-                     !HasQuestion(aResponseHeader, aResponseMessage, instanceName, ResourceRecord::kTypeSrv)))
-                {
-                    SuccessOrExit(error = AppendSrvRecord(aResponseMessage, instanceName, hostName, instanceTtl,
-                                                          service->GetPriority(), service->GetWeight(),
-                                                          service->GetPort(), aCompressInfo));
-                    IncResourceRecordCount(aResponseHeader, aAdditional);
-                    response = Header::kResponseSuccess;
-                }
+            if (!HasQuestion(aResponseHeader, aResponseMessage, instanceName, ResourceRecord::kTypeTxt))
+            {
+                SuccessOrExit(error = AppendTxtRecord(aResponseMessage, instanceName, service->GetTxtData(),
+                                                      service->GetTxtDataLength(), instanceTtl, aCompressInfo));
+                IncResourceRecordCount(aResponseHeader, aAdditional);
+                response = Header::kResponseSuccess;
+            }
 
-                if ((!aAdditional && txtQueryMatched) ||
-                    (aAdditional && ptrQueryMatched &&
-                     !HasQuestion(aResponseHeader, aResponseMessage, instanceName, ResourceRecord::kTypeTxt)))
-                {
-                    SuccessOrExit(error = AppendTxtRecord(aResponseMessage, instanceName, service->GetTxtData(),
-                                                          service->GetTxtDataLength(), instanceTtl, aCompressInfo));
-                    IncResourceRecordCount(aResponseHeader, aAdditional);
-                    response = Header::kResponseSuccess;
-                }
+            if (!IsSrpHostAppended(*service, Srp::Server::kFlagsAnyTypeActiveService, aName,
+                                   /* aInstanceName */ nullptr, aAppendedHosts))
+            {
+                SuccessOrExit(error = AppendSrpHostAddresses(service->GetHost(), aResponseHeader, aResponseMessage,
+                                                             aCompressInfo, aAdditional));
             }
         }
+    }
+
+    // Handle SRV/TXT/ANY query by looking up the base type services
+    // with `aName` as their service instance name.
+
+    if (qtype == ResourceRecord::kTypeSrv || qtype == ResourceRecord::kTypeTxt || qtype == ResourceRecord::kTypeAny)
+    {
+        bool srvQuery = (qtype == ResourceRecord::kTypeSrv || qtype == ResourceRecord::kTypeAny);
+        bool txtQuery = (qtype == ResourceRecord::kTypeTxt || qtype == ResourceRecord::kTypeAny);
 
-        // Handle AAAA query
-        if ((!aAdditional && (qtype == ResourceRecord::kTypeAaaa || qtype == ResourceRecord::kTypeAny) &&
-             host->Matches(aName)) ||
-            (aAdditional && needAdditionalAaaaRecord &&
-             !HasQuestion(aResponseHeader, aResponseMessage, hostName, ResourceRecord::kTypeAaaa)))
+        service = nullptr;
+
+        while ((service = srp.FindNextService(service, kBaseTypeActiveFlags, /* aServiceName */ nullptr, aName)) !=
+               nullptr)
         {
-            uint8_t             addrNum;
-            const Ip6::Address *addrs   = host->GetAddresses(addrNum);
-            uint32_t            hostTtl = TimeMilli::MsecToSec(host->GetExpireTime() - now);
+            uint32_t    instanceTtl  = TimeMilli::MsecToSec(service->GetExpireTime() - now);
+            const char *instanceName = service->GetInstanceName();
+
+            if (aAdditional)
+            {
+                if (srvQuery && !IsSrpHostAppended(*service, kBaseTypeActiveFlags, /* aServiceName */ nullptr, aName,
+                                                   aAppendedHosts))
+                {
+                    SuccessOrExit(error = AppendSrpHostAddresses(service->GetHost(), aResponseHeader,
+                                                                 aResponseMessage, aCompressInfo, aAdditional));
+                }
+
+                continue;
+            }
+
+            if (srvQuery)
+            {
+                SuccessOrExit(error = AppendSrvRecord(aResponseMessage, instanceName, service->GetHost().GetFullName(),
+                                                      instanceTtl, service->GetPriority(), service->GetWeight(),
+                                                      service->GetPort(), aCompressInfo));
+                IncResourceRecordCount(aResponseHeader, aAdditional);
+                response = Header::kResponseSuccess;
+            }
 
-            for (uint8_t i = 0; i < addrNum; i++)
+            if (txtQuery)
             {
-                SuccessOrExit(error = AppendAaaaRecord(aResponseMessage, hostName, addrs[i], hostTtl, aCompressInfo));
+                SuccessOrExit(error = AppendTxtRecord(aResponseMessage, instanceName, service->GetTxtData(),
+                                                      service->GetTxtDataLength(), instanceTtl, aCompressInfo));
                 IncResourceRecordCount(aResponseHeader, aAdditional);
+                response = Header::kResponseSuccess;
             }
+        }
+    }
+
+    // Handle AAAA/ANY query by looking up the host by name.
 
+    if (!aAdditional && (qtype == ResourceRecord::kTypeAaaa || qtype == ResourceRecord::kTypeAny))
+    {
+        host = srp.FindHost(aName);
+
+        if ((host != nullptr) && !host->IsDeleted())
+        {
+            SuccessOrExit(
+                error = AppendSrpHostAddresses(*host, aResponseHeader, aResponseMessage, aCompressInfo, aAdditional));
             response = Header::kResponseSuccess;
         }
     }
@@ -967,6 +967,31 @@ exit:
     return error == kErrorNone ? response : Header::kResponseServerFailure;
 }
 
+Error Server::AppendSrpHostAddresses(const Srp::Server::Host &aHost,
+                                     Header                  &aResponseHeader,
+                                     Message                 &aResponseMessage,
+                                     NameCompressInfo        &aCompressInfo,
+                                     bool                     aAdditional)
+{
+    Error               error    = kErrorNone;
+    const char         *hostName = aHost.GetFullName();
+    uint32_t            hostTtl  = TimeMilli::MsecToSec(aHost.GetExpireTime() - TimerMilli::GetNow());
+    uint8_t             addrNum;
+    const Ip6::Address *addrs = aHost.GetAddresses(addrNum);
+
+    VerifyOrExit(!aAdditional ||
+                 !HasQuestion(aResponseHeader, aResponseMessage, hostName, ResourceRecord::kTypeAaaa));
+
+    for (uint8_t i = 0; i < addrNum; i++)
+    {
+        SuccessOrExit(error = AppendAaaaRecord(aResponseMessage, hostName, addrs[i], hostTtl, aCompressInfo));
+        IncResourceRecordCount(aResponseHeader, aAdditional);
+    }
+
+exit:
+    return error;
+}
+
 const Srp::Server::Host *Server::GetNextSrpHost(const Srp::Server::Host *aHost)
 {
     const Srp::Server::Host *host = Get<Srp::Server>().GetNextHost(aHost);
@@ -984,8 +1009,357 @@ const Srp::Server::Service *Server::GetNextSrpService(const Srp::Server::Host
 {
     return aHost.FindNextService(aService, Srp::Server::kFlagsAnyTypeActiveService);
 }
+
+bool Server::IsSrpHostAppended(const Srp::Server::Service &aService,
+                               Srp::Server::Service::Flags aFlags,
+                               const char                 *aServiceName,
+                               const char                 *aInstanceName,
+                               SrpHostArray               &aAppendedHosts) const
+{
+    // Indicates whether the addresses of the host of `aService` were
+    // already appended to the additional section, and otherwise
+    // records the host as appended. The hosts are tracked in
+    // `aAppendedHosts` so that a browse stays linear in the number
+    // of services. Once the array is full, it falls back to checking
+    // whether a service on the same host precedes `aService` when
+    // iterating with the same flags and names.
+
+    bool                     isAppended = true;
+    const Srp::Server::Host *host       = &aService.GetHost();
+
+    VerifyOrExit(!aAppendedHosts.Contains(host));
+
+    if (aAppendedHosts.PushBack(host) == kErrorNone)
+    {
+        ExitNow(isAppended = false);
+    }
+
+    isAppended = HasPrecedingSrpServiceOnHost(aService, aFlags, aServiceName, aInstanceName);
+
+exit:
+    return isAppended;
+}
+
+bool Server::HasPrecedingSrpServiceOnHost(const Srp::Server::Service &aService,
+                                          Srp::Server::Service::Flags aFlags,
+                                          const char                 *aServiceName,
+                                          const char                 *aInstanceName) const
+{
+    // Indicates whether a service on the same host as `aService`
+    // precedes it when iterating over the services matching the
+    // given flags and names.
+
+    bool                        hasPreceding = false;
+    const Srp::Server::Service *service      = nullptr;
+
+    while ((service = Get<Srp::Server>().FindNextService(service, aFlags, aServiceName, aInstanceName)) != &aService)
+    {
+        if (&service->GetHost() == &aService.GetHost())
+        {
+            ExitNow(hasPreceding = true);
+        }
+    }
+
+exit:
+    return hasPreceding;
+}
 #endif // OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
 
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+
+Error Server::AnswerFromCache(Header &aResponseHeader, Message &aResponseMessage)
+{
+    // Appends the answer and additional records of a cached response
+    // to `aResponseMessage` (which contains the header and question).
+    // Since the question is the same, the compressed names in the
+    // cached records refer to the same offsets in the new response.
+    // Only the TTLs are updated to account for the time elapsed
+    // since the cached response was built.
+
+    Error         error        = kErrorNotFound;
+    uint16_t      answerOffset = 0;
+    uint16_t      questionEnd  = aResponseMessage.GetLength();
+    TimeMilli     now          = TimerMilli::GetNow();
+    CachedAnswer *entry        = FindCachedAnswer(aResponseHeader, aResponseMessage, answerOffset);
+    Header        cachedHeader;
+    uint32_t      elapsed;
+    uint32_t      minTtl;
+
+    VerifyOrExit(entry != nullptr);
+
+    elapsed = Time::MsecToSec(now - entry->mCreatedTime);
+
+    if (elapsed >= entry->mMinTtl)
+    {
+        RemoveCachedAnswer(*entry);
+        ExitNow();
+    }
+
+    SuccessOrExit(error = entry->mResponse->Read(0, cachedHeader));
+    SuccessOrExit(error = aResponseMessage.AppendBytesFromMessage(
+                      *entry->mResponse, answerOffset, entry->mResponse->GetLength() - answerOffset));
+    SuccessOrExit(error = UpdateRecordTtls(aResponseMessage, questionEnd,
+                                           cachedHeader.GetAnswerCount() + cachedHeader.GetAdditionalRecordCount(),
+                                           elapsed, minTtl));
+
+    aResponseHeader.SetAnswerCount(cachedHeader.GetAnswerCount());
+    aResponseHeader.SetAdditionalRecordCount(cachedHeader.GetAdditionalRecordCount());
+    entry->mLastUsedTime = now;
+
+    LogInfo("ANSWER: TRANSACTION=0x%04x, from cache", aResponseHeader.GetMessageId());
+
+exit:
+    if ((error != kErrorNone) && (aResponseMessage.GetLength() != questionEnd))
+    {
+        IgnoreError(aResponseMessage.SetLength(questionEnd));
+    }
+
+    return error;
+}
+
+void Server::AddToAnswerCache(const Header &aResponseHeader, const Message &aResponseMessage)
+{
+    CachedAnswer *entry        = nullptr;
+    uint16_t      answerOffset = 0;
+    Message      *response     = nullptr;
+    uint32_t      minTtl;
+
+    VerifyOrExit(aResponseHeader.GetQuestionCount() == 1);
+
+    if (Get<MessagePool>().GetFreeBufferCount() < kAnswerCacheMinFreeBuffers)
+    {
+        // Release the cached responses so the rest of the stack
+        // does not run out of message buffers.
+
+        ClearAnswerCache();
+        ExitNow();
+    }
+
+    entry = FindCachedAnswer(aResponseHeader, aResponseMessage, answerOffset);
+    VerifyOrExit(answerOffset != 0);
+
+    if (entry != nullptr)
+    {
+        RemoveCachedAnswer(*entry);
+    }
+
+    // Use an unused entry, or replace the least recently used one.
+
+    for (CachedAnswer &cachedAnswer : mAnswerCache)
+    {
+        if (cachedAnswer.mResponse == nullptr)
+        {
+            entry = &cachedAnswer;
+            break;
+        }
+
+        if ((entry == nullptr) || (cachedAnswer.mLastUsedTime < entry->mLastUsedTime))
+        {
+            entry = &cachedAnswer;
+        }
+    }
+
+    response = aResponseMessage.Clone();
+
+    if (response == nullptr)
+    {
+        ClearAnswerCache();
+        ExitNow();
+    }
+
+    response->Write(0, aResponseHeader);
+
+    SuccessOrExit(UpdateRecordTtls(*response, answerOffset,
+                                   aResponseHeader.GetAnswerCount() + aResponseHeader.GetAdditionalRecordCount(),
+                                   /* aElapsed */ 0, minTtl));
+    VerifyOrExit(minTtl > 0);
+
+    if (entry->mResponse != nullptr)
+    {
+        RemoveCachedAnswer(*entry);
+    }
+
+    entry->mResponse     = response;
+    entry->mCreatedTime  = TimerMilli::GetNow();
+    entry->mLastUsedTime = entry->mCreatedTime;
+    entry->mMinTtl       = Min(minTtl, kAnswerCacheMaxTtl);
+    response             = nullptr;
+
+    mAnswerCacheTimer.FireAtIfEarlier(entry->GetExpireTime());
+
+exit:
+    FreeMessage(response);
+}
+
+Server::CachedAnswer *Server::FindCachedAnswer(const Header  &aResponseHeader,
+                                               const Message &aResponseMessage,
+                                               uint16_t      &aAnswerOffset)
+{
+    // Finds the cached response with the same single question as the
+    // one in `aResponseMessage`. If the question is parsed successfully
+    // `aAnswerOffset` is set to the end of the question, which is also
+    // the offset of the first record in a matching cached response.
+
+    CachedAnswer *matchedEntry = nullptr;
+    uint16_t      offset       = sizeof(Header);
+    Question      question;
+
+    VerifyOrExit(aResponseHeader.GetQuestionCount() == 1);
+    SuccessOrExit(Name::ParseName(aResponseMessage, offset));
+    SuccessOrExit(aResponseMessage.Read(offset, question));
+    aAnswerOffset = offset + sizeof(Question);
+
+    for (CachedAnswer &entry : mAnswerCache)
+    {
+        Question cachedQuestion;
+
+        offset = sizeof(Header);
+
+        if ((entry.mResponse == nullptr) ||
+            (Name::CompareName(*entry.mResponse, offset, aResponseMessage, sizeof(Header)) != kErrorNone) ||
+            (entry.mResponse->Read(offset, cachedQuestion) != kErrorNone) ||
+            (cachedQuestion.GetType() != question.GetType()) || (cachedQuestion.GetClass() != question.GetClass()))
+        {
+            continue;
+        }
+
+        matchedEntry = &entry;
+        break;
+    }
+
+exit:
+    return matchedEntry;
+}
+
+void Server::RemoveCachedAnswer(CachedAnswer &aEntry)
+{
+    FreeMessage(aEntry.mResponse);
+    aEntry.mResponse = nullptr;
+}
+
+void Server::ClearAnswerCache(void)
+{
+    for (CachedAnswer &entry : mAnswerCache)
+    {
+        RemoveCachedAnswer(entry);
+    }
+
+    mAnswerCacheTimer.Stop();
+}
+
+void Server::HandleAnswerCacheTimer(void)
+{
+    // Frees the cached responses whose records have expired, so
+    // their messages are not held until the next matching query.
+
+    TimeMilli now      = TimerMilli::GetNow();
+    TimeMilli nextTime = now.GetDistantFuture();
+
+    for (CachedAnswer &entry : mAnswerCache)
+    {
+        if (entry.mResponse == nullptr)
+        {
+            continue;
+        }
+
+        if (now >= entry.GetExpireTime())
+        {
+            RemoveCachedAnswer(entry);
+            continue;
+        }
+
+        nextTime = Min(nextTime, entry.GetExpireTime());
+    }
+
+    if (nextTime < now.GetDistantFuture())
+    {
+        mAnswerCacheTimer.FireAt(nextTime);
+    }
+}
+
+void Server::HandleSrpHostChange(const Srp::Server::Host &aHost)
+{
+    // Called by `Srp::Server` before a host or any of its services is
+    // added, updated or removed. Removes every cached response whose
+    // question name is the host name, or a service or an instance
+    // name of one of the host's services. This covers the responses
+    // whose answer or additional records may include the host.
+
+    for (CachedAnswer &entry : mAnswerCache)
+    {
+        uint16_t offset = sizeof(Header);
+        char     name[Name::kMaxNameSize];
+        bool     matches;
+
+        if (entry.mResponse == nullptr)
+        {
+            continue;
+        }
+
+        matches = (Name::ReadName(*entry.mResponse, offset, name, sizeof(name)) != kErrorNone) || aHost.Matches(name);
+
+        if (!matches)
+        {
+            for (const Srp::Server::Service &service : aHost.GetServices())
+            {
+                if (service.MatchesServiceName(name) || service.MatchesInstanceName(name))
+                {
+                    matches = true;
+                    break;
+                }
+            }
+        }
+
+        if (matches)
+        {
+            LogInfo("Remove cached answer for %s", name);
+            RemoveCachedAnswer(entry);
+        }
+    }
+}
+
+Error Server::UpdateRecordTtls(Message  &aMessage,
+                               uint16_t  aOffset,
+                               uint16_t  aNumRecords,
+                               uint32_t  aElapsed,
+                               uint32_t &aMinTtl)
+{
+    // Goes through `aNumRecords` records in `aMessage` starting at
+    // `aOffset` and determines the smallest TTL. If `aElapsed` is
+    // non-zero, the TTL of every record is reduced by `aElapsed`
+    // seconds.
+
+    Error error = kErrorNone;
+
+    aMinTtl = NumericLimits<uint32_t>::kMax;
+
+    for (uint16_t num = 0; num < aNumRecords; num++)
+    {
+        ResourceRecord record;
+        uint32_t       ttl;
+
+        SuccessOrExit(error = Name::ParseName(aMessage, aOffset));
+        SuccessOrExit(error = aMessage.Read(aOffset, record));
+
+        ttl = record.GetTtl();
+
+        if (aElapsed != 0)
+        {
+            ttl = (ttl > aElapsed) ? (ttl - aElapsed) : 0;
+            record.SetTtl(ttl);
+            aMessage.Write(aOffset, record);
+        }
+
+        aMinTtl = Min(aMinTtl, ttl);
+        aOffset += static_cast<uint16_t>(record.GetSize());
+    }
+
+exit:
+    return error;
+}
+
+#endif // OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+
 Error Server::ResolveByQueryCallbacks(Header                 &aResponseHeader,
                                       Message                &aResponseMessage,
                                       NameCompressInfo       &aCompressInfo,
@@ -1163,10 +1537,12 @@ void Server::AnswerQuery(QueryTransaction                 &aQuery,
                          const char                       *aServiceFullName,
                          const otDnssdServiceInstanceInfo &aInstanceInfo)
 {
-    Header           &responseHeader  = aQuery.GetResponseHeader();
-    Message          &responseMessage = aQuery.GetResponseMessage();
-    Error             error           = kErrorNone;
-    NameCompressInfo &compressInfo    = aQuery.GetNameCompressInfo();
+    Header          &responseHeader  = aQuery.GetResponseHeader();
+    Message         &responseMessage = aQuery.GetResponseMessage();
+    Error            error           = kErrorNone;
+    NameCompressInfo compressInfo(mNameCompressor, aQuery.GetDomainName());
+
+    SuccessOrExit(error = AddQuestionNames(responseHeader, responseMessage, compressInfo));
 
     if (HasQuestion(aQuery.GetResponseHeader(), aQuery.GetResponseMessage(), aServiceFullName,
                     ResourceRecord::kTypePtr))
@@ -1224,10 +1600,12 @@ exit:
 
 void Server::AnswerQuery(QueryTransaction &aQuery, const char *aHostFullName, const otDnssdHostInfo &aHostInfo)
 {
-    Header           &responseHeader  = aQuery.GetResponseHeader();
-    Message          &responseMessage = aQuery.GetResponseMessage();
-    Error             error           = kErrorNone;
-    NameCompressInfo &compressInfo    = aQuery.GetNameCompressInfo();
+    Header          &responseHeader  = aQuery.GetResponseHeader();
+    Message         &responseMessage = aQuery.GetResponseMessage();
+    Error            error           = kErrorNone;
+    NameCompressInfo compressInfo(mNameCompressor, aQuery.GetDomainName());
+
+    SuccessOrExit(error = AddQuestionNames(responseHeader, responseMessage, compressInfo));
 
     if (HasQuestion(aQuery.GetResponseHeader(), aQuery.GetResponseMessage(), aHostFullName, ResourceRecord::kTypeAaaa))
     {
@@ -1494,7 +1872,7 @@ void Server::QueryTransaction::Init(const Header           &aResponseHeader,
     InstanceLocatorInit::Init(aInstance);
     mResponseHeader  = aResponseHeader;
     mResponseMessage = &aResponseMessage;
-    mCompressInfo    = aCompressInfo;
+    mDomainName      = aCompressInfo.GetDomainName();
     mMessageInfo     = aMessageInfo;
     mStartTime       = TimerMilli::GetNow();
 }
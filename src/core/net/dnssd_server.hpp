@@ -35,6 +35,7 @@
 
 #include <openthread/dnssd_server.h>
 
+#include "common/array.hpp"
 #include "common/as_core_type.hpp"
 #include "common/message.hpp"
 #include "common/non_copyable.hpp"
@@ -49,6 +50,10 @@
  *   This file includes definitions for the DNS-SD server.
  */
 
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE && !OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
+#error "OPENTHREAD_CONFIG_SRP_SERVER_ENABLE is required for OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE"
+#endif
+
 struct otPlatDnsUpstreamQuery
 {
 };
@@ -284,85 +289,30 @@ public:
      * @param[in] aTestMode   The new test mode (combination of `TestModeFlags`).
      *
      */
-    void SetTestMode(uint8_t aTestMode) { mTestMode = aTestMode; }
+    void SetTestMode(uint8_t aTestMode);
 
 private:
-    class NameCompressInfo : public Clearable<NameCompressInfo>
+    class NameCompressInfo
     {
     public:
-        explicit NameCompressInfo(void) = default;
+        // The `NameCompressor` is owned by `Server` (to keep it off
+        // the stack) and is cleared here, so only one response
+        // message can be built at a time.
 
-        explicit NameCompressInfo(const char *aDomainName)
+        NameCompressInfo(NameCompressor &aCompressor, const char *aDomainName)
             : mDomainName(aDomainName)
-            , mDomainNameOffset(kUnknownOffset)
-            , mServiceNameOffset(kUnknownOffset)
-            , mInstanceNameOffset(kUnknownOffset)
-            , mHostNameOffset(kUnknownOffset)
+            , mCompressor(aCompressor)
         {
+            mCompressor.Clear();
         }
 
-        static constexpr uint16_t kUnknownOffset = 0; // Unknown offset value (used when offset is not yet set).
-
-        uint16_t GetDomainNameOffset(void) const { return mDomainNameOffset; }
-
-        void SetDomainNameOffset(uint16_t aOffset) { mDomainNameOffset = aOffset; }
-
         const char *GetDomainName(void) const { return mDomainName; }
 
-        uint16_t GetServiceNameOffset(const Message &aMessage, const char *aServiceName) const
-        {
-            return MatchCompressedName(aMessage, mServiceNameOffset, aServiceName)
-                       ? mServiceNameOffset
-                       : static_cast<uint16_t>(kUnknownOffset);
-        };
-
-        void SetServiceNameOffset(uint16_t aOffset)
-        {
-            if (mServiceNameOffset == kUnknownOffset)
-            {
-                mServiceNameOffset = aOffset;
-            }
-        }
-
-        uint16_t GetInstanceNameOffset(const Message &aMessage, const char *aName) const
-        {
-            return MatchCompressedName(aMessage, mInstanceNameOffset, aName) ? mInstanceNameOffset
-                                                                             : static_cast<uint16_t>(kUnknownOffset);
-        }
-
-        void SetInstanceNameOffset(uint16_t aOffset)
-        {
-            if (mInstanceNameOffset == kUnknownOffset)
-            {
-                mInstanceNameOffset = aOffset;
-            }
-        }
-
-        uint16_t GetHostNameOffset(const Message &aMessage, const char *aName) const
-        {
-            return MatchCompressedName(aMessage, mHostNameOffset, aName) ? mHostNameOffset
-                                                                         : static_cast<uint16_t>(kUnknownOffset);
-        }
-
-        void SetHostNameOffset(uint16_t aOffset)
-        {
-            if (mHostNameOffset == kUnknownOffset)
-            {
-                mHostNameOffset = aOffset;
-            }
-        }
+        NameCompressor &GetCompressor(void) { return mCompressor; }
 
     private:
-        static bool MatchCompressedName(const Message &aMessage, uint16_t aOffset, const char *aName)
-        {
-            return aOffset != kUnknownOffset && Name::CompareName(aMessage, aOffset, aName) == kErrorNone;
-        }
-
-        const char *mDomainName;         // The serialized domain name.
-        uint16_t    mDomainNameOffset;   // Offset of domain name serialization into the response message.
-        uint16_t    mServiceNameOffset;  // Offset of service name serialization into the response message.
-        uint16_t    mInstanceNameOffset; // Offset of instance name serialization into the response message.
-        uint16_t    mHostNameOffset;     // Offset of host name serialization into the response message.
+        const char     *mDomainName; // The serialized domain name.
+        NameCompressor &mCompressor; // Dictionary of the names serialized into the response message.
     };
 
     static constexpr bool     kBindUnspecifiedNetif         = OPENTHREAD_CONFIG_DNSSD_SERVER_BIND_UNSPECIFIED_NETIF;
@@ -370,6 +320,17 @@ private:
     static constexpr uint8_t  kSubTypeLabelLength           = 4;
     static constexpr uint16_t kMaxConcurrentQueries         = 32;
     static constexpr uint16_t kMaxConcurrentUpstreamQueries = 32;
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+    static constexpr uint16_t kAnswerCacheSize           = OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_SIZE;
+    static constexpr uint16_t kAnswerCacheMinFreeBuffers = OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_MIN_FREE_BUFFERS;
+    static constexpr uint32_t kAnswerCacheMaxTtl         = Time::MsecToSec(TimerMilli::kMaxDelay);
+#endif
+#if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
+    static constexpr uint8_t kMaxTrackedSrpHosts = 16; // Max hosts tracked per response to append addresses once.
+
+    // The SRP hosts whose addresses were appended to the additional section of a response.
+    typedef Array<const Srp::Server::Host *, kMaxTrackedSrpHosts> SrpHostArray;
+#endif
 
     // This structure represents the splitting information of a full name.
     struct NameComponentsOffsetInfo
@@ -425,12 +386,12 @@ private:
         const Message          &GetResponseMessage(void) const { return *mResponseMessage; }
         Message                &GetResponseMessage(void) { return const_cast<Message &>(*mResponseMessage); }
         TimeMilli               GetStartTime(void) const { return mStartTime; }
-        NameCompressInfo       &GetNameCompressInfo(void) { return mCompressInfo; };
+        const char             *GetDomainName(void) const { return mDomainName; }
         void                    Finalize(Header::Response aResponseMessage, Ip6::Udp::Socket &aSocket);
 
         Header           mResponseHeader;
         Message         *mResponseMessage;
-        NameCompressInfo mCompressInfo;
+        const char      *mDomainName;
         Ip6::MessageInfo mMessageInfo;
         TimeMilli        mStartTime;
     };
@@ -448,6 +409,7 @@ private:
                                          Header           &aResponseHeader,
                                          Message          &aResponseMessage,
                                          NameCompressInfo &aCompressInfo);
+    static Error AddQuestionNames(const Header &aHeader, const Message &aMessage, NameCompressInfo &aCompressInfo);
     static Error            AppendQuestion(const char       *aName,
                                            const Question   &aQuestion,
                                            Message          &aMessage,
@@ -499,10 +461,52 @@ private:
                                                             Header           &aResponseHeader,
                                                             Message          &aResponseMessage,
                                                             NameCompressInfo &aCompressInfo,
+                                                            SrpHostArray     &aAppendedHosts,
                                                             bool              aAdditional);
     const Srp::Server::Host           *GetNextSrpHost(const Srp::Server::Host *aHost);
     static const Srp::Server::Service *GetNextSrpService(const Srp::Server::Host    &aHost,
                                                          const Srp::Server::Service *aService);
+    static Error                       AppendSrpHostAddresses(const Srp::Server::Host &aHost,
+                                                              Header                  &aResponseHeader,
+                                                              Message                 &aResponseMessage,
+                                                              NameCompressInfo        &aCompressInfo,
+                                                              bool                     aAdditional);
+    bool                               IsSrpHostAppended(const Srp::Server::Service &aService,
+                                                         Srp::Server::Service::Flags aFlags,
+                                                         const char                 *aServiceName,
+                                                         const char                 *aInstanceName,
+                                                         SrpHostArray               &aAppendedHosts) const;
+    bool                               HasPrecedingSrpServiceOnHost(const Srp::Server::Service &aService,
+                                                                    Srp::Server::Service::Flags aFlags,
+                                                                    const char                 *aServiceName,
+                                                                    const char                 *aInstanceName) const;
+#endif
+
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+    struct CachedAnswer
+    {
+        Message  *mResponse;     // Response with question and answers, or `nullptr` if entry is unused.
+        TimeMilli mCreatedTime;  // Time when the response was built.
+        TimeMilli mLastUsedTime; // Time when the entry was last used to answer a query.
+        uint32_t  mMinTtl;       // Smallest TTL (in seconds) of the records when the response was built.
+
+        TimeMilli GetExpireTime(void) const { return mCreatedTime + Time::SecToMsec(mMinTtl); }
+    };
+
+    Error         AnswerFromCache(Header &aResponseHeader, Message &aResponseMessage);
+    void          AddToAnswerCache(const Header &aResponseHeader, const Message &aResponseMessage);
+    CachedAnswer *FindCachedAnswer(const Header  &aResponseHeader,
+                                   const Message &aResponseMessage,
+                                   uint16_t      &aAnswerOffset);
+    void          RemoveCachedAnswer(CachedAnswer &aEntry);
+    void          ClearAnswerCache(void);
+    void          HandleAnswerCacheTimer(void);
+    void          HandleSrpHostChange(const Srp::Server::Host &aHost);
+    static Error  UpdateRecordTtls(Message  &aMessage,
+                                   uint16_t  aOffset,
+                                   uint16_t  aNumRecords,
+                                   uint32_t  aElapsed,
+                                   uint32_t &aMinTtl);
 #endif
 
 #if OPENTHREAD_CONFIG_DNS_UPSTREAM_QUERY_ENABLE
@@ -540,6 +544,9 @@ private:
     void UpdateResponseCounters(Header::Response aResponseCode);
 
     using ServerTimer = TimerMilliIn<Server, &Server::HandleTimer>;
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+    using AnswerCacheTimer = TimerMilliIn<Server, &Server::HandleAnswerCacheTimer>;
+#endif
 
     static const char kDnssdProtocolUdp[];
     static const char kDnssdProtocolTcp[];
@@ -560,9 +567,14 @@ private:
     UpstreamQueryTransaction mUpstreamQueryTransactions[kMaxConcurrentUpstreamQueries];
 #endif
 
-    ServerTimer mTimer;
-    Counters    mCounters;
-    uint8_t     mTestMode;
+    ServerTimer    mTimer;
+    Counters       mCounters;
+    uint8_t        mTestMode;
+    NameCompressor mNameCompressor;
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+    CachedAnswer     mAnswerCache[kAnswerCacheSize];
+    AnswerCacheTimer mAnswerCacheTimer;
+#endif
 };
 
 } // namespace ServiceDiscovery
@@ -1253,18 +1253,9 @@ start:
         if (nextHeader == kProtoIcmp6)
         {
             uint8_t icmpType;
-            bool    isAllowedType = false;
 
             SuccessOrExit(error = aMessage.Read(aMessage.GetOffset(), icmpType));
-            for (IcmpType type : sForwardICMPTypes)
-            {
-                if (icmpType == type)
-                {
-                    isAllowedType = true;
-                    break;
-                }
-            }
-            VerifyOrExit(isAllowedType, error = kErrorDrop);
+            VerifyOrExit(IsForwardableIcmpType(icmpType), error = kErrorDrop);
         }
 
 #if !OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
@@ -1442,6 +1433,22 @@ exit:
     return isOnLink;
 }
 
+bool Ip6::IsForwardableIcmpType(uint8_t aIcmpType)
+{
+    bool isForwardable = false;
+
+    for (IcmpType type : sForwardICMPTypes)
+    {
+        if (aIcmpType == type)
+        {
+            isForwardable = true;
+            break;
+        }
+    }
+
+    return isForwardable;
+}
+
 Error Ip6::RouteLookup(const Address &aSource, const Address &aDestination) const
 {
     Error    error;
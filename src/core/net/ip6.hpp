@@ -192,6 +192,17 @@ public:
      */
     static Message::Priority DscpToPriority(uint8_t aDscp);
 
+    /**
+     * Indicates whether an ICMPv6 message of a given type is forwarded by a router.
+     *
+     * @param[in]  aIcmpType  The ICMPv6 type.
+     *
+     * @retval TRUE   ICMPv6 messages of type @p aIcmpType are forwarded.
+     * @retval FALSE  ICMPv6 messages of type @p aIcmpType are not forwarded.
+     *
+     */
+    static bool IsForwardableIcmpType(uint8_t aIcmpType);
+
     /**
      * Sends an IPv6 datagram.
      *
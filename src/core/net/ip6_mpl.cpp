@@ -350,6 +350,7 @@ void Mpl::AddBufferedMessage(Message &aMessage, uint16_t aSeedId, uint8_t aSeque
 
     VerifyOrExit(GetTimerExpirations() > 0);
     VerifyOrExit((messageCopy = aMessage.Clone()) != nullptr, error = kErrorNoBufs);
+    messageCopy->SetOrigin(Message::kOriginMpl);
 
     if (!aIsOutbound)
     {
@@ -396,7 +397,15 @@ void Mpl::HandleRetransmissionTimer(void)
 
             if (metadata.mTransmissionCount < timerExpirations)
             {
-                Message *messageCopy = message.Clone(message.GetLength() - sizeof(Metadata));
+                Message *messageCopy;
+
+                // Update the metadata before cloning so that the
+                // buffered message is not written to while it may
+                // share buffers with the copy.
+                metadata.GenerateNextTransmissionTime(now, kDataMessageInterval);
+                metadata.UpdateIn(message);
+
+                messageCopy = message.Clone(message.GetLength() - sizeof(Metadata));
 
                 if (messageCopy != nullptr)
                 {
@@ -408,9 +417,6 @@ void Mpl::HandleRetransmissionTimer(void)
                     Get<Ip6>().EnqueueDatagram(*messageCopy);
                 }
 
-                metadata.GenerateNextTransmissionTime(now, kDataMessageInterval);
-                metadata.UpdateIn(message);
-
                 nextTime = Min(nextTime, metadata.mTransmissionTime);
             }
             else
@@ -41,6 +41,7 @@
 #include "common/code_utils.hpp"
 #include "common/locator_getters.hpp"
 #include "common/log.hpp"
+#include "common/numeric_limits.hpp"
 #include "net/checksum.hpp"
 #include "net/ip4_types.hpp"
 #include "net/ip6.hpp"
@@ -70,13 +71,16 @@ const char *StateToString(State aState)
 Translator::Translator(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mState(State::kStateDisabled)
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    , mNextPort(kMinDynamicPort)
+#endif
     , mMappingExpirerTimer(aInstance)
 {
     Random::NonCrypto::Fill(mNextMappingId);
 
     mNat64Prefix.Clear();
     mIp4Cidr.Clear();
-    mMappingExpirerTimer.Start(kAddressMappingIdleTimeoutMsec);
+    ClearMappings();
 }
 
 Message *Translator::NewIp4Message(const Message::Settings &aSettings)
@@ -117,7 +121,9 @@ Translator::Result Translator::TranslateFromIp6(Message &aMessage)
     ErrorCounters::Reason dropReason = ErrorCounters::kUnknown;
     Ip6::Header           ip6Header;
     Ip4::Header           ip4Header;
-    AddressMapping       *mapping = nullptr;
+    AddressMapping       *mapping  = nullptr;
+    uint8_t               protocol = 0;
+    uint16_t              port     = 0;
 
     if (mIp4Cidr.mLength == 0 || !mNat64Prefix.IsValidNat64())
     {
@@ -137,48 +143,68 @@ Translator::Result Translator::TranslateFromIp6(Message &aMessage)
         ExitNow(res = kNotTranslated);
     }
 
-    mapping = FindOrAllocateMapping(ip6Header.GetSource());
-    if (mapping == nullptr)
-    {
-        LogWarn("failed to get a mapping for %s (mapping pool full?)", ip6Header.GetSource().ToString().AsCString());
-        dropReason = ErrorCounters::Reason::kNoMapping;
-        ExitNow(res = kDrop);
-    }
-
-    aMessage.RemoveHeader(sizeof(Ip6::Header));
-
     ip4Header.Clear();
-    ip4Header.InitVersionIhl();
-    ip4Header.SetSource(mapping->mIp4);
-    ip4Header.GetDestination().ExtractFromIp6Address(mNat64Prefix.mLength, ip6Header.GetDestination());
-    ip4Header.SetTtl(ip6Header.GetHopLimit());
-    ip4Header.SetIdentification(0);
 
     switch (ip6Header.GetNextHeader())
     {
     case Ip6::kProtoUdp:
         ip4Header.SetProtocol(Ip4::kProtoUdp);
-        res = kForward;
         break;
     case Ip6::kProtoTcp:
         ip4Header.SetProtocol(Ip4::kProtoTcp);
-        res = kForward;
         break;
     case Ip6::kProtoIcmp6:
         ip4Header.SetProtocol(Ip4::kProtoIcmp);
-        SuccessOrExit(TranslateIcmp6(aMessage));
-        res = kForward;
         break;
     default:
         dropReason = ErrorCounters::Reason::kUnsupportedProto;
         ExitNow(res = kDrop);
     }
 
-    // res here must be kForward based on the switch above.
+    aMessage.RemoveHeader(sizeof(Ip6::Header));
+
+    // Unsupported ICMPv6 messages are dropped before a mapping is allocated for them.
+    if (ip4Header.GetProtocol() == Ip4::kProtoIcmp)
+    {
+        SuccessOrExit(TranslateIcmp6(aMessage));
+    }
+
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    protocol = ip4Header.GetProtocol();
+
+    if (ReadPort(aMessage, protocol, /* aIsSource */ true, port) != kErrorNone)
+    {
+        LogWarn("outgoing datagram has no valid transport header, drop");
+        dropReason = ErrorCounters::Reason::kIllegalPacket;
+        ExitNow(res = kDrop);
+    }
+#endif
+
+    mapping = FindOrAllocateMapping(ip6Header.GetSource(), protocol, port);
+    if (mapping == nullptr)
+    {
+        LogWarn("failed to get a mapping for %s (mapping pool full?)", ip6Header.GetSource().ToString().AsCString());
+        dropReason = ErrorCounters::Reason::kNoMapping;
+        ExitNow(res = kDrop);
+    }
+
+    ip4Header.InitVersionIhl();
+    ip4Header.SetSource(mapping->mIp4);
+    ip4Header.GetDestination().ExtractFromIp6Address(mNat64Prefix.mLength, ip6Header.GetDestination());
+    ip4Header.SetTtl(ip6Header.GetHopLimit());
+    ip4Header.SetIdentification(0);
+
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    RewritePort(aMessage, protocol, /* aIsSource */ true, mapping->mIp6Port, mapping->mIp4Port);
+#endif
+
+    res = kForward;
+
     // TODO: Implement the logic for replying ICMP messages.
     ip4Header.SetTotalLength(sizeof(Ip4::Header) + aMessage.GetLength() - aMessage.GetOffset());
-    Checksum::UpdateMessageChecksum(aMessage, ip4Header.GetSource(), ip4Header.GetDestination(),
-                                    ip4Header.GetProtocol());
+    Checksum::UpdateTranslatedMessageChecksum(aMessage, ip6Header.GetSource(), ip6Header.GetDestination(),
+                                              ip4Header.GetSource(), ip4Header.GetDestination(),
+                                              ip4Header.GetProtocol());
     Checksum::UpdateIp4HeaderChecksum(ip4Header);
     if (aMessage.Prepend(ip4Header) != kErrorNone)
     {
@@ -204,7 +230,9 @@ Translator::Result Translator::TranslateToIp6(Message &aMessage)
     ErrorCounters::Reason dropReason = ErrorCounters::kUnknown;
     Ip6::Header           ip6Header;
     Ip4::Header           ip4Header;
-    AddressMapping       *mapping = nullptr;
+    AddressMapping       *mapping  = nullptr;
+    uint8_t               protocol = 0;
+    uint16_t              port     = 0;
 
     // Ip6::Header::ParseFrom may return an error value when the incoming message is an IPv4 datagram.
     // If the message is already an IPv6 datagram, forward it directly.
@@ -230,50 +258,72 @@ Translator::Result Translator::TranslateToIp6(Message &aMessage)
         ExitNow(res = kDrop);
     }
 
-    mapping = FindMapping(ip4Header.GetDestination());
-    if (mapping == nullptr)
-    {
-        LogWarn("no mapping found for the IPv4 address");
-        dropReason = ErrorCounters::Reason::kNoMapping;
-        ExitNow(res = kDrop);
-    }
-
-    aMessage.RemoveHeader(sizeof(Ip4::Header));
-
-    ip6Header.Clear();
-    ip6Header.InitVersionTrafficClassFlow();
-    ip6Header.GetSource().SynthesizeFromIp4Address(mNat64Prefix, ip4Header.GetSource());
-    ip6Header.SetDestination(mapping->mIp6);
-    ip6Header.SetFlow(0);
-    ip6Header.SetHopLimit(ip4Header.GetTtl());
-
     // Note: TCP and UDP are the same for both IPv4 and IPv6 except for the checksum calculation, we will update the
     // checksum in the payload later. However, we need to translate ICMPv6 messages to ICMP messages in IPv4.
+    ip6Header.Clear();
+
     switch (ip4Header.GetProtocol())
     {
     case Ip4::kProtoUdp:
         ip6Header.SetNextHeader(Ip6::kProtoUdp);
-        res = kForward;
         break;
     case Ip4::kProtoTcp:
         ip6Header.SetNextHeader(Ip6::kProtoTcp);
-        res = kForward;
         break;
     case Ip4::kProtoIcmp:
         ip6Header.SetNextHeader(Ip6::kProtoIcmp6);
-        SuccessOrExit(TranslateIcmp4(aMessage));
-        res = kForward;
         break;
     default:
         dropReason = ErrorCounters::Reason::kUnsupportedProto;
         ExitNow(res = kDrop);
     }
 
-    // res here must be kForward based on the switch above.
+    aMessage.RemoveHeader(sizeof(Ip4::Header));
+
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    protocol = ip4Header.GetProtocol();
+
+    if (ReadPort(aMessage, protocol, /* aIsSource */ false, port) != kErrorNone)
+    {
+        LogWarn("incoming datagram has no valid transport header, drop");
+        dropReason = ErrorCounters::Reason::kIllegalPacket;
+        ExitNow(res = kDrop);
+    }
+#endif
+
+    mapping = FindMapping(ip4Header.GetDestination(), protocol, port);
+    if (mapping == nullptr)
+    {
+        LogWarn("no mapping found for the IPv4 address");
+        dropReason = ErrorCounters::Reason::kNoMapping;
+        ExitNow(res = kDrop);
+    }
+
+    ip6Header.InitVersionTrafficClassFlow();
+    ip6Header.GetSource().SynthesizeFromIp4Address(mNat64Prefix, ip4Header.GetSource());
+    ip6Header.SetDestination(mapping->mIp6);
+    ip6Header.SetFlow(0);
+    ip6Header.SetHopLimit(ip4Header.GetTtl());
+
+    if (ip4Header.GetProtocol() == Ip4::kProtoIcmp)
+    {
+        SuccessOrExit(TranslateIcmp4(aMessage));
+    }
+
+    // The mapping is kept alive only by accepted datagrams.
+    TouchMapping(*mapping);
+
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    RewritePort(aMessage, protocol, /* aIsSource */ false, mapping->mIp4Port, mapping->mIp6Port);
+#endif
+
+    res = kForward;
+
     // TODO: Implement the logic for replying ICMP datagrams.
     ip6Header.SetPayloadLength(aMessage.GetLength() - aMessage.GetOffset());
-    Checksum::UpdateMessageChecksum(aMessage, ip6Header.GetSource(), ip6Header.GetDestination(),
-                                    ip6Header.GetNextHeader());
+    Checksum::UpdateTranslatedMessageChecksum(aMessage, ip4Header.GetSource(), ip4Header.GetDestination(),
+                                              ip6Header.GetSource(), ip6Header.GetDestination(),
+                                              ip6Header.GetNextHeader());
     if (aMessage.Prepend(ip6Header) != kErrorNone)
     {
         // This might happen when the platform failed to reserve enough space before the original IPv4 datagram.
@@ -297,7 +347,11 @@ Translator::AddressMapping::InfoString Translator::AddressMapping::ToString(void
 {
     InfoString string;
 
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    string.Append("[%s]:%u -> %s:%u", mIp6.ToString().AsCString(), mIp6Port, mIp4.ToString().AsCString(), mIp4Port);
+#else
     string.Append("%s -> %s", mIp6.ToString().AsCString(), mIp4.ToString().AsCString());
+#endif
 
     return string;
 }
@@ -307,9 +361,11 @@ void Translator::AddressMapping::CopyTo(otNat64AddressMapping &aMapping, TimeMil
     aMapping.mId       = mId;
     aMapping.mIp4      = mIp4;
     aMapping.mIp6      = mIp6;
+    aMapping.mIp4Port  = mIp4Port;
+    aMapping.mIp6Port  = mIp6Port;
     aMapping.mCounters = mCounters;
 
-    // We are removing expired mappings lazily, and an expired mapping might become active again before actually
+    // The expirer timer may fire a bit late, and an expired mapping might become active again before actually
     // removed. Report the mapping to be "just expired" to avoid confusion.
     if (mExpiry < aNow)
     {
@@ -321,39 +377,205 @@ void Translator::AddressMapping::CopyTo(otNat64AddressMapping &aMapping, TimeMil
     }
 }
 
+uint32_t Translator::CalculateHash(const uint8_t *aBytes, uint16_t aLength, uint8_t aProtocol, uint16_t aPort)
+{
+    uint32_t hash = 0;
+
+    for (; aLength != 0; aLength--, aBytes++)
+    {
+        hash = (hash ^ *aBytes) * 0x9e3779b1;
+    }
+
+    hash = (hash ^ (static_cast<uint32_t>(aProtocol) << 16) ^ aPort) * 0x9e3779b1;
+    hash ^= (hash >> 16);
+
+    return hash;
+}
+
+Translator::AddressMapping *&Translator::GetIp6Bucket(const Ip6::Address &aIp6Addr, uint8_t aProtocol, uint16_t aPort)
+{
+    return mIp6Index[CalculateHash(aIp6Addr.GetBytes(), sizeof(Ip6::Address), aProtocol, aPort) % kNumIndexBuckets];
+}
+
+Translator::AddressMapping *&Translator::GetIp4Bucket(const Ip4::Address &aIp4Addr, uint8_t aProtocol, uint16_t aPort)
+{
+    return mIp4Index[CalculateHash(aIp4Addr.GetBytes(), sizeof(Ip4::Address), aProtocol, aPort) % kNumIndexBuckets];
+}
+
+void Translator::AddToIndexes(AddressMapping &aMapping)
+{
+    AddressMapping *&ip6Bucket = GetIp6Bucket(aMapping.mIp6, aMapping.mProtocol, aMapping.mIp6Port);
+    AddressMapping *&ip4Bucket = GetIp4Bucket(aMapping.mIp4, aMapping.mProtocol, aMapping.mIp4Port);
+
+    aMapping.mNextInIp6Index = ip6Bucket;
+    ip6Bucket                = &aMapping;
+
+    aMapping.mNextInIp4Index = ip4Bucket;
+    ip4Bucket                = &aMapping;
+}
+
+void Translator::RemoveFromIndexes(AddressMapping &aMapping)
+{
+    for (AddressMapping **link = &GetIp6Bucket(aMapping.mIp6, aMapping.mProtocol, aMapping.mIp6Port); *link != nullptr;
+         link                  = &(*link)->mNextInIp6Index)
+    {
+        if (*link == &aMapping)
+        {
+            *link = aMapping.mNextInIp6Index;
+            break;
+        }
+    }
+
+    for (AddressMapping **link = &GetIp4Bucket(aMapping.mIp4, aMapping.mProtocol, aMapping.mIp4Port); *link != nullptr;
+         link                  = &(*link)->mNextInIp4Index)
+    {
+        if (*link == &aMapping)
+        {
+            *link = aMapping.mNextInIp4Index;
+            break;
+        }
+    }
+}
+
+void Translator::AppendToActiveMappings(AddressMapping &aMapping)
+{
+    aMapping.mPrev = mActiveMappingsTail;
+    aMapping.SetNext(nullptr);
+
+    if (mActiveMappingsTail != nullptr)
+    {
+        mActiveMappingsTail->SetNext(&aMapping);
+    }
+    else
+    {
+        mActiveMappingsHead = &aMapping;
+    }
+
+    mActiveMappingsTail = &aMapping;
+}
+
+void Translator::RemoveFromActiveMappings(AddressMapping &aMapping)
+{
+    AddressMapping *next = aMapping.GetNext();
+
+    if (aMapping.mPrev != nullptr)
+    {
+        aMapping.mPrev->SetNext(next);
+    }
+    else
+    {
+        mActiveMappingsHead = next;
+    }
+
+    if (next != nullptr)
+    {
+        next->mPrev = aMapping.mPrev;
+    }
+    else
+    {
+        mActiveMappingsTail = aMapping.mPrev;
+    }
+}
+
+void Translator::TouchMapping(AddressMapping &aMapping)
+{
+    // Moving the mapping to the tail keeps the list ordered by expiry. The timer is not updated: if it was set for
+    // this mapping, it fires early and is restarted for the new head.
+
+    aMapping.Touch(TimerMilli::GetNow());
+
+    if (&aMapping != mActiveMappingsTail)
+    {
+        RemoveFromActiveMappings(aMapping);
+        AppendToActiveMappings(aMapping);
+    }
+}
+
+void Translator::ClearMappings(void)
+{
+    mAddressMappingPool.FreeAll();
+    mActiveMappingsHead = nullptr;
+    mActiveMappingsTail = nullptr;
+
+    for (uint16_t i = 0; i < kNumIndexBuckets; i++)
+    {
+        mIp6Index[i] = nullptr;
+        mIp4Index[i] = nullptr;
+    }
+
+    mMappingExpirerTimer.Stop();
+}
+
 void Translator::ReleaseMapping(AddressMapping &aMapping)
 {
+    RemoveFromActiveMappings(aMapping);
+    RemoveFromIndexes(aMapping);
+#if !OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
     IgnoreError(mIp4AddressPool.PushBack(aMapping.mIp4));
+#endif
     mAddressMappingPool.Free(aMapping);
     LogInfo("mapping removed: %s", aMapping.ToString().AsCString());
 }
 
-uint16_t Translator::ReleaseMappings(LinkedList<AddressMapping> &aMappings)
+uint16_t Translator::ReleaseMappings(void)
 {
     uint16_t numRemoved = 0;
 
-    for (AddressMapping *mapping = aMappings.Pop(); mapping != nullptr; mapping = aMappings.Pop())
+    while (mActiveMappingsHead != nullptr)
     {
         numRemoved++;
-        ReleaseMapping(*mapping);
+        ReleaseMapping(*mActiveMappingsHead);
     }
 
+    mMappingExpirerTimer.Stop();
+
     return numRemoved;
 }
 
 uint16_t Translator::ReleaseExpiredMappings(void)
 {
-    LinkedList<AddressMapping> idleMappings;
+    TimeMilli now        = TimerMilli::GetNow();
+    uint16_t  numRemoved = 0;
 
-    mActiveAddressMappings.RemoveAllMatching(TimerMilli::GetNow(), idleMappings);
+    while ((mActiveMappingsHead != nullptr) && (mActiveMappingsHead->mExpiry <= now))
+    {
+        numRemoved++;
+        ReleaseMapping(*mActiveMappingsHead);
+    }
 
-    return ReleaseMappings(idleMappings);
+    return numRemoved;
 }
 
-Translator::AddressMapping *Translator::AllocateMapping(const Ip6::Address &aIp6Addr)
+Translator::AddressMapping *Translator::AllocateMapping(const Ip6::Address &aIp6Addr, uint8_t aProtocol, uint16_t aPort)
 {
     AddressMapping *mapping = nullptr;
 
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    VerifyOrExit(!mIp4AddressPool.IsEmpty());
+
+    mapping = mAddressMappingPool.Allocate();
+
+    if (mapping == nullptr)
+    {
+        // Every flow takes its own mapping, so the pool can fill up long before the mappings expire. When no mapping
+        // has expired, the least recently used one (at the head of the active list) is evicted for the new flow.
+        if (ReleaseExpiredMappings() == 0)
+        {
+            VerifyOrExit(mActiveMappingsHead != nullptr);
+            LogInfo("mapping pool full, evicting least recently used mapping");
+            ReleaseMapping(*mActiveMappingsHead);
+        }
+
+        mapping = mAddressMappingPool.Allocate();
+        VerifyOrExit(mapping != nullptr);
+    }
+
+    // A host always uses the same IPv4 address, selected by the hash of its IPv6 address, so that all its sessions
+    // appear from the same address (RFC 4787, REQ-2).
+    mapping->mIp4 = mIp4AddressPool[CalculateHash(aIp6Addr.GetBytes(), sizeof(Ip6::Address), 0, 0) %
+                                    mIp4AddressPool.GetLength()];
+    mapping->mIp4Port = AllocatePort(mapping->mIp4, aProtocol, aPort);
+#else
     // The address pool will be no larger than the mapping pool, so checking the address pool is enough.
     if (mIp4AddressPool.IsEmpty())
     {
@@ -366,42 +588,147 @@ Translator::AddressMapping *Translator::AllocateMapping(const Ip6::Address &aIp6
     // empty.
     VerifyOrExit(mapping != nullptr);
 
-    mActiveAddressMappings.Push(*mapping);
-    mapping->mId  = ++mNextMappingId;
-    mapping->mIp6 = aIp6Addr;
     // PopBack must return a valid address since it is not empty.
-    mapping->mIp4 = *mIp4AddressPool.PopBack();
+    mapping->mIp4     = *mIp4AddressPool.PopBack();
+    mapping->mIp4Port = aPort;
+#endif
+
+    mapping->mId       = ++mNextMappingId;
+    mapping->mIp6      = aIp6Addr;
+    mapping->mProtocol = aProtocol;
+    mapping->mIp6Port  = aPort;
+    mapping->mCounters.Clear();
     mapping->Touch(TimerMilli::GetNow());
+
+    AppendToActiveMappings(*mapping);
+    AddToIndexes(*mapping);
+    mMappingExpirerTimer.FireAtIfEarlier(mapping->mExpiry);
     LogInfo("mapping created: %s", mapping->ToString().AsCString());
 
 exit:
     return mapping;
 }
 
-Translator::AddressMapping *Translator::FindOrAllocateMapping(const Ip6::Address &aIp6Addr)
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+uint16_t Translator::AllocatePort(const Ip4::Address &aIp4Addr, uint8_t aProtocol, uint16_t aPort)
 {
-    AddressMapping *mapping = mActiveAddressMappings.FindMatching(aIp6Addr);
+    uint16_t port = aPort;
 
-    // Exit if we found a valid mapping.
-    VerifyOrExit(mapping == nullptr);
+    // Keep the port of the host when it is not used by another mapping on the same address, otherwise take the next
+    // free one from the dynamic port range. The number of mappings is smaller than the range, so this ends.
 
-    mapping = AllocateMapping(aIp6Addr);
+    while (FindMapping(aIp4Addr, aProtocol, port) != nullptr)
+    {
+        port      = mNextPort;
+        mNextPort = (mNextPort == NumericLimits<uint16_t>::kMax) ? kMinDynamicPort : mNextPort + 1;
+    }
+
+    return port;
+}
+#endif
+
+Translator::AddressMapping *Translator::FindOrAllocateMapping(const Ip6::Address &aIp6Addr,
+                                                              uint8_t             aProtocol,
+                                                              uint16_t            aPort)
+{
+    AddressMapping *mapping = GetIp6Bucket(aIp6Addr, aProtocol, aPort);
+
+    for (; mapping != nullptr; mapping = mapping->mNextInIp6Index)
+    {
+        if (mapping->MatchesIp6(aIp6Addr, aProtocol, aPort))
+        {
+            TouchMapping(*mapping);
+            ExitNow();
+        }
+    }
+
+    mapping = AllocateMapping(aIp6Addr, aProtocol, aPort);
 
 exit:
     return mapping;
 }
 
-Translator::AddressMapping *Translator::FindMapping(const Ip4::Address &aIp4Addr)
+Translator::AddressMapping *Translator::FindMapping(const Ip4::Address &aIp4Addr, uint8_t aProtocol, uint16_t aPort)
 {
-    AddressMapping *mapping = mActiveAddressMappings.FindMatching(aIp4Addr);
+    AddressMapping *mapping = GetIp4Bucket(aIp4Addr, aProtocol, aPort);
 
-    if (mapping != nullptr)
+    for (; mapping != nullptr; mapping = mapping->mNextInIp4Index)
     {
-        mapping->Touch(TimerMilli::GetNow());
+        if (mapping->MatchesIp4(aIp4Addr, aProtocol, aPort))
+        {
+            break;
+        }
     }
+
     return mapping;
 }
 
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+uint16_t Translator::GetPortOffset(uint8_t aIp4Protocol, bool aIsSource)
+{
+    // TCP and UDP headers both start with the source port followed by the destination port. ICMP echo messages carry
+    // the same identifier in both directions.
+
+    static constexpr uint16_t kSourcePortOffset      = 0;
+    static constexpr uint16_t kDestinationPortOffset = 2;
+    static constexpr uint16_t kEchoIdentifierOffset  = 4;
+
+    return (aIp4Protocol == Ip4::kProtoIcmp) ? kEchoIdentifierOffset
+                                             : (aIsSource ? kSourcePortOffset : kDestinationPortOffset);
+}
+
+Error Translator::ReadPort(const Message &aMessage, uint8_t aIp4Protocol, bool aIsSource, uint16_t &aPort)
+{
+    Error error;
+
+    // Note: The caller consumed the IP header, so the transport header is at offset 0.
+    SuccessOrExit(error = aMessage.Read(GetPortOffset(aIp4Protocol, aIsSource), aPort));
+    aPort = Encoding::BigEndian::HostSwap16(aPort);
+
+exit:
+    return error;
+}
+
+void Translator::RewritePort(Message &aMessage,
+                             uint8_t  aIp4Protocol,
+                             bool     aIsSource,
+                             uint16_t aOldPort,
+                             uint16_t aNewPort)
+{
+    uint16_t checksumOffset;
+    uint16_t checksum;
+
+    VerifyOrExit(aOldPort != aNewPort);
+
+    aMessage.Write(GetPortOffset(aIp4Protocol, aIsSource), Encoding::BigEndian::HostSwap16(aNewPort));
+
+    switch (aIp4Protocol)
+    {
+    case Ip4::kProtoUdp:
+        checksumOffset = Ip6::Udp::Header::kChecksumFieldOffset;
+        break;
+    case Ip4::kProtoTcp:
+        checksumOffset = Ip6::Tcp::Header::kChecksumFieldOffset;
+        break;
+    default:
+        // The ICMP checksum is calculated over the whole translated message.
+        ExitNow();
+    }
+
+    // The checksum is updated for the new port incrementally (RFC 1624), a zero UDP checksum means the IPv4 datagram
+    // has none and is calculated over the whole message when it is translated to IPv6.
+    SuccessOrExit(aMessage.Read(checksumOffset, checksum));
+    checksum = Encoding::BigEndian::HostSwap16(checksum);
+    VerifyOrExit((checksum != 0) || (aIp4Protocol != Ip4::kProtoUdp));
+
+    checksum = Checksum::UpdateChecksumField(checksum, aOldPort, aNewPort);
+    aMessage.Write(checksumOffset, Encoding::BigEndian::HostSwap16(checksum));
+
+exit:
+    return;
+}
+#endif // OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+
 Error Translator::TranslateIcmp4(Message &aMessage)
 {
     Error             err = kErrorNone;
@@ -492,8 +819,7 @@ Error Translator::SetIp4Cidr(const Ip4::Cidr &aCidr)
     }
     numberOfHosts = OT_MIN(numberOfHosts, kAddressMappingPoolSize);
 
-    mAddressMappingPool.FreeAll();
-    mActiveAddressMappings.Clear();
+    ClearMappings();
     mIp4AddressPool.Clear();
 
     for (uint32_t i = 0; i < numberOfHosts; i++)
@@ -543,13 +869,22 @@ exit:
 
 void Translator::HandleMappingExpirerTimer(void)
 {
-    LogInfo("Released %d expired mappings", ReleaseExpiredMappings());
-    mMappingExpirerTimer.Start(kAddressMappingIdleTimeoutMsec);
+    uint16_t numRemoved = ReleaseExpiredMappings();
+
+    if (numRemoved > 0)
+    {
+        LogInfo("Released %u expired mappings", numRemoved);
+    }
+
+    if (mActiveMappingsHead != nullptr)
+    {
+        mMappingExpirerTimer.FireAt(mActiveMappingsHead->mExpiry);
+    }
 }
 
 void Translator::InitAddressMappingIterator(AddressMappingIterator &aIterator)
 {
-    aIterator.mPtr = mActiveAddressMappings.GetHead();
+    aIterator.mPtr = mActiveMappingsHead;
 }
 
 Error Translator::GetNextAddressMapping(AddressMappingIterator &aIterator, otNat64AddressMapping &aMapping)
@@ -675,7 +1010,7 @@ void Translator::SetEnabled(bool aEnabled)
 
     if (!aEnabled)
     {
-        ReleaseMappings(mActiveAddressMappings);
+        ReleaseMappings();
     }
 
     UpdateState();
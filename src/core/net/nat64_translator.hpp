@@ -338,43 +338,91 @@ public:
     Error GetIp6Prefix(Ip6::Prefix &aPrefix);
 
 private:
+    // The number of buckets of each mapping index, giving an average of two mappings per bucket with a full pool.
+    static constexpr uint16_t kNumIndexBuckets = (kAddressMappingPoolSize + 1) / 2;
+
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    static constexpr uint16_t kMinDynamicPort = 49152; // Start of the dynamic port range (RFC 6335).
+
+    // Every mapping can hold a different port, so a free dynamic port is always found within the pool size probes.
+    static_assert(kAddressMappingPoolSize < 0x10000 - kMinDynamicPort, "NAT64 mapping pool is larger than port range");
+#endif
+
     class AddressMapping : public LinkedListEntry<AddressMapping>
     {
     public:
         friend class LinkedListEntry<AddressMapping>;
         friend class LinkedList<AddressMapping>;
 
-        typedef String<Ip6::Address::kInfoStringSize + Ip4::Address::kAddressStringSize + 4> InfoString;
+        typedef String<Ip6::Address::kInfoStringSize + Ip4::Address::kAddressStringSize + 18> InfoString;
 
         void       Touch(TimeMilli aNow) { mExpiry = aNow + kAddressMappingIdleTimeoutMsec; }
         InfoString ToString(void) const;
         void       CopyTo(otNat64AddressMapping &aMapping, TimeMilli aNow) const;
 
+        bool MatchesIp6(const Ip6::Address &aIp6, uint8_t aProtocol, uint16_t aPort) const
+        {
+            return (mIp6 == aIp6) && (mProtocol == aProtocol) && (mIp6Port == aPort);
+        }
+
+        bool MatchesIp4(const Ip4::Address &aIp4, uint8_t aProtocol, uint16_t aPort) const
+        {
+            return (mIp4 == aIp4) && (mProtocol == aProtocol) && (mIp4Port == aPort);
+        }
+
         uint64_t mId; // The unique id for a mapping session.
 
         Ip4::Address mIp4;
         Ip6::Address mIp6;
         TimeMilli    mExpiry; // The timestamp when this mapping expires, in milliseconds.
 
+        // The IPv4 protocol and the ports (or ICMP echo identifiers) of the mapping on each side. All zero when port
+        // translation is disabled, in which case a mapping covers all the traffic of an address.
+        uint8_t  mProtocol;
+        uint16_t mIp6Port;
+        uint16_t mIp4Port;
+
         ProtocolCounters mCounters;
 
-    private:
-        bool Matches(const Ip4::Address &aIp4) const { return mIp4 == aIp4; }
-        bool Matches(const Ip6::Address &aIp6) const { return mIp6 == aIp6; }
-        bool Matches(const TimeMilli aNow) const { return mExpiry < aNow; }
+        AddressMapping *mPrev; // The previous entry in the list of active mappings.
+        AddressMapping *mNextInIp6Index;
+        AddressMapping *mNextInIp4Index;
 
-        AddressMapping *mNext;
+    private:
+        AddressMapping *mNext; // The next entry in the list of active mappings or in the free list of the pool.
     };
 
     Error TranslateIcmp4(Message &aMessage);
     Error TranslateIcmp6(Message &aMessage);
 
-    uint16_t        ReleaseMappings(LinkedList<AddressMapping> &aMappings);
+    static uint32_t CalculateHash(const uint8_t *aBytes, uint16_t aLength, uint8_t aProtocol, uint16_t aPort);
+
+    AddressMapping *&GetIp6Bucket(const Ip6::Address &aIp6Addr, uint8_t aProtocol, uint16_t aPort);
+    AddressMapping *&GetIp4Bucket(const Ip4::Address &aIp4Addr, uint8_t aProtocol, uint16_t aPort);
+    void             AddToIndexes(AddressMapping &aMapping);
+    void             RemoveFromIndexes(AddressMapping &aMapping);
+    void             AppendToActiveMappings(AddressMapping &aMapping);
+    void             RemoveFromActiveMappings(AddressMapping &aMapping);
+    void             TouchMapping(AddressMapping &aMapping);
+
+    void            ClearMappings(void);
+    uint16_t        ReleaseMappings(void);
     void            ReleaseMapping(AddressMapping &aMapping);
     uint16_t        ReleaseExpiredMappings(void);
-    AddressMapping *AllocateMapping(const Ip6::Address &aIp6Addr);
-    AddressMapping *FindOrAllocateMapping(const Ip6::Address &aIp6Addr);
-    AddressMapping *FindMapping(const Ip4::Address &aIp4Addr);
+    AddressMapping *AllocateMapping(const Ip6::Address &aIp6Addr, uint8_t aProtocol, uint16_t aPort);
+    AddressMapping *FindOrAllocateMapping(const Ip6::Address &aIp6Addr, uint8_t aProtocol, uint16_t aPort);
+    AddressMapping *FindMapping(const Ip4::Address &aIp4Addr, uint8_t aProtocol, uint16_t aPort);
+
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    static uint16_t GetPortOffset(uint8_t aIp4Protocol, bool aIsSource);
+    static Error    ReadPort(const Message &aMessage, uint8_t aIp4Protocol, bool aIsSource, uint16_t &aPort);
+    static void     RewritePort(Message &aMessage,
+                                uint8_t  aIp4Protocol,
+                                bool     aIsSource,
+                                uint16_t aOldPort,
+                                uint16_t aNewPort);
+    uint16_t        AllocatePort(const Ip4::Address &aIp4Addr, uint8_t aProtocol, uint16_t aPort);
+#endif
 
     void HandleMappingExpirerTimer(void);
 
@@ -386,10 +434,22 @@ private:
     State mState;
 
     uint64_t mNextMappingId;
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    uint16_t mNextPort;
+#endif
 
+    // In port translation mode, `mIp4AddressPool` holds all the addresses shared by the mappings. Otherwise it holds
+    // the addresses not yet assigned to a mapping.
     Array<Ip4::Address, kAddressMappingPoolSize>  mIp4AddressPool;
     Pool<AddressMapping, kAddressMappingPoolSize> mAddressMappingPool;
-    LinkedList<AddressMapping>                    mActiveAddressMappings;
+
+    // Active mappings are kept in the order they were last used. The idle timeout is the same for all of them, so
+    // this is also the order of their expiry and the mappings to expire are always at the head of the list.
+    AddressMapping *mActiveMappingsHead;
+    AddressMapping *mActiveMappingsTail;
+
+    AddressMapping *mIp6Index[kNumIndexBuckets];
+    AddressMapping *mIp4Index[kNumIndexBuckets];
 
     Ip6::Prefix mNat64Prefix;
     Ip4::Cidr   mIp4Cidr;
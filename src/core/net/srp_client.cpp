@@ -748,6 +748,7 @@ void Client::SendUpdate(void)
     uint32_t length;
 
     VerifyOrExit(message != nullptr, error = kErrorNoBufs);
+    message->SetOrigin(Message::kOriginSrp);
     SuccessOrExit(error = PrepareUpdateMessage(*message));
 
     length = message->GetLength() + sizeof(Ip6::Udp::Header) + sizeof(Ip6::Header);
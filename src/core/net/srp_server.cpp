@@ -37,6 +37,7 @@
 
 #include "common/as_core_type.hpp"
 #include "common/const_cast.hpp"
+#include "common/encoding.hpp"
 #include "common/instance.hpp"
 #include "common/locator_getters.hpp"
 #include "common/log.hpp"
@@ -98,7 +99,16 @@ Server::Server(Instance &aInstance)
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
     , mAutoEnable(false)
 #endif
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+    , mNumRecordEntries(0)
+    , mNumCompactedEntries(0)
+    , mRecordsAtLimit(false)
+    , mShouldCompactRecords(false)
+    , mHasStopTime(false)
+    , mSaveTimer(aInstance)
+#endif
 {
+    memset(&mLeaseCounters, 0, sizeof(mLeaseCounters));
     IgnoreError(SetDomain(kDefaultDomain));
 }
 
@@ -174,6 +184,12 @@ exit:
 void Server::Disable(void)
 {
     VerifyOrExit(mState != kStateDisabled);
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+    // Unlike `Stop()`, disabling the server drops the saved hosts.
+    DeleteHostRecords();
+#endif
+
     Get<NetworkData::Publisher>().UnpublishDnsSrpService();
     Stop();
     mState = kStateDisabled;
@@ -308,30 +324,139 @@ const Server::Host *Server::GetNextHost(const Server::Host *aHost)
     return (aHost == nullptr) ? mHosts.GetHead() : aHost->GetNext();
 }
 
+const Server::Host *Server::FindHost(const char *aFullName) const { return mHostNameIndex.FindFirst(aFullName); }
+
+const Server::Service *Server::FindNextService(const Service *aPrevService,
+                                               Service::Flags aFlags,
+                                               const char    *aServiceName,
+                                               const char    *aInstanceName) const
+{
+    const Service *service = nullptr;
+
+    if (aInstanceName != nullptr)
+    {
+        service = (aPrevService == nullptr) ? mInstanceNameIndex.FindFirst(aInstanceName)
+                                            : mInstanceNameIndex.FindNext(*aPrevService, aInstanceName);
+
+        while ((service != nullptr) && (!service->MatchesFlags(aFlags) ||
+                                        ((aServiceName != nullptr) && !service->MatchesServiceName(aServiceName))))
+        {
+            service = mInstanceNameIndex.FindNext(*service, aInstanceName);
+        }
+    }
+    else if (aServiceName != nullptr)
+    {
+        service = (aPrevService == nullptr) ? mServiceNameIndex.FindFirst(aServiceName)
+                                            : mServiceNameIndex.FindNext(*aPrevService, aServiceName);
+
+        while ((service != nullptr) && !service->MatchesFlags(aFlags))
+        {
+            service = mServiceNameIndex.FindNext(*service, aServiceName);
+        }
+    }
+
+    return service;
+}
+
+// The indexes cover the hosts (and their services) in `mHosts`, i.e.,
+// the name indexes and the lease expiry queues.
+
+void Server::AddToIndexes(Host &aHost)
+{
+    mHostNameIndex.Add(aHost);
+    mHostExpiryQueue.Update(aHost, aHost.GetNextExpireTime());
+
+    for (Service &service : aHost.mServices)
+    {
+        AddToIndexes(service);
+    }
+
+    aHost.mIsIndexed = true;
+}
+
+void Server::RemoveFromIndexes(Host &aHost)
+{
+    VerifyOrExit(aHost.mIsIndexed);
+
+    mHostNameIndex.Remove(aHost);
+    mHostExpiryQueue.Remove(aHost);
+
+    for (Service &service : aHost.mServices)
+    {
+        RemoveFromIndexes(service);
+    }
+
+    aHost.mIsIndexed = false;
+
+exit:
+    return;
+}
+
+void Server::AddToIndexes(Service &aService)
+{
+    mInstanceNameIndex.Add(aService);
+    mServiceNameIndex.Add(aService);
+    mServiceExpiryQueue.Update(aService, aService.GetNextExpireTime());
+}
+
+void Server::RemoveFromIndexes(Service &aService)
+{
+    mInstanceNameIndex.Remove(aService);
+    mServiceNameIndex.Remove(aService);
+    mServiceExpiryQueue.Remove(aService);
+}
+
+void Server::UpdateLeaseExpiry(Host &aHost)
+{
+    // Must be called whenever the lease, key lease, update time
+    // or the deleted state of an indexed host is changed.
+
+    VerifyOrExit(aHost.IsQueued());
+    mHostExpiryQueue.Update(aHost, aHost.GetNextExpireTime());
+
+exit:
+    return;
+}
+
+void Server::UpdateLeaseExpiry(Service &aService)
+{
+    VerifyOrExit(aService.IsQueued());
+    mServiceExpiryQueue.Update(aService, aService.GetNextExpireTime());
+
+exit:
+    return;
+}
+
 // This method adds a SRP service host and takes ownership of it.
 // The caller MUST make sure that there is no existing host with the same hostname.
 void Server::AddHost(Host &aHost)
 {
     LogInfo("Add new host %s", aHost.GetFullName());
 
-    OT_ASSERT(mHosts.FindMatching(aHost.GetFullName()) == nullptr);
+    OT_ASSERT(FindHost(aHost.GetFullName()) == nullptr);
     IgnoreError(mHosts.Add(aHost));
+    AddToIndexes(aHost);
 }
+
 void Server::RemoveHost(Host *aHost, RetainName aRetainName, NotifyMode aNotifyServiceHandler)
 {
     VerifyOrExit(aHost != nullptr);
 
+    InvalidateDnssdAnswers(*aHost);
+
     aHost->mLease = 0;
     aHost->ClearResources();
 
     if (aRetainName)
     {
         LogInfo("Remove host %s (but retain its name)", aHost->GetFullName());
+        UpdateLeaseExpiry(*aHost);
     }
     else
     {
         aHost->mKeyLease = 0;
         IgnoreError(mHosts.Remove(*aHost));
+        RemoveFromIndexes(*aHost);
         LogInfo("Fully remove host %s", aHost->GetFullName());
     }
 
@@ -360,7 +485,7 @@ exit:
 bool Server::HasNameConflictsWith(Host &aHost) const
 {
     bool        hasConflicts = false;
-    const Host *existingHost = mHosts.FindMatching(aHost.GetFullName());
+    const Host *existingHost = FindHost(aHost.GetFullName());
 
     if (existingHost != nullptr && aHost.GetKeyRecord()->GetKey() != existingHost->GetKeyRecord()->GetKey())
     {
@@ -374,10 +499,12 @@ bool Server::HasNameConflictsWith(Host &aHost) const
         // instance name and if found, verify that it has the same
         // key.
 
-        for (const Host &host : mHosts)
+        const Service *existingService = nullptr;
+
+        while ((existingService = FindNextService(existingService, kFlagsAnyService, /* aServiceName */ nullptr,
+                                                  service.GetInstanceName())) != nullptr)
         {
-            if (host.HasServiceInstance(service.GetInstanceName()) &&
-                aHost.GetKeyRecord()->GetKey() != host.GetKeyRecord()->GetKey())
+            if (aHost.GetKeyRecord()->GetKey() != existingService->GetHost().GetKeyRecord()->GetKey())
             {
                 LogWarn("Name conflict: service name %s has already been allocated", service.GetInstanceName());
                 ExitNow(hasConflicts = true);
@@ -469,13 +596,26 @@ void Server::CommitSrpUpdate(Error                    aError,
         service.mDescription->mTtl      = grantedTtl;
     }
 
-    existingHost = mHosts.FindMatching(aHost.GetFullName());
+    existingHost = FindHost(aHost.GetFullName());
+
+    InvalidateDnssdAnswers(aHost);
+
+    if (existingHost != nullptr)
+    {
+        InvalidateDnssdAnswers(*existingHost);
+    }
 
     if (aHost.GetLease() == 0)
     {
         if (aHost.GetKeyLease() == 0)
         {
             LogInfo("Remove key of host %s", aHost.GetFullName());
+
+            if (existingHost != nullptr)
+            {
+                SaveHostRemoval(*existingHost);
+            }
+
             RemoveHost(existingHost, kDeleteName, kDoNotNotifyServiceHandler);
         }
         else if (existingHost != nullptr)
@@ -487,15 +627,31 @@ void Server::CommitSrpUpdate(Error                    aError,
             {
                 existingHost->RemoveService(&service, kRetainName, kDoNotNotifyServiceHandler);
             }
+
+            SaveHost(*existingHost);
         }
     }
     else if (existingHost != nullptr)
     {
-        SuccessOrExit(aError = existingHost->MergeServicesAndResourcesFrom(aHost));
+        aError = existingHost->MergeServicesAndResourcesFrom(aHost);
+
+        // The merge updates the leases of the host and its services,
+        // even if it fails part way through.
+
+        UpdateLeaseExpiry(*existingHost);
+
+        for (Service &service : existingHost->mServices)
+        {
+            UpdateLeaseExpiry(service);
+        }
+
+        VerifyOrExit(aError == kErrorNone, ScheduleLeaseTimer());
+        SaveHost(*existingHost);
     }
     else
     {
         AddHost(aHost);
+        SaveHost(aHost);
         shouldFreeHost = false;
 
         for (Service &service : aHost.GetServices())
@@ -516,8 +672,7 @@ void Server::CommitSrpUpdate(Error                    aError,
 #endif
     }
 
-    // Re-schedule the lease timer.
-    HandleLeaseTimer();
+    ScheduleLeaseTimer();
 
 exit:
     if (aMessageInfo != nullptr)
@@ -568,6 +723,10 @@ void Server::Start(void)
     PrepareSocket();
     LogInfo("Start listening on port %u", mPort);
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+    RestoreHosts();
+#endif
+
 exit:
     return;
 }
@@ -652,12 +811,40 @@ exit:
 
 #endif // OPENTHREAD_CONFIG_DNSSD_SERVER_ENABLE
 
+void Server::InvalidateDnssdAnswers(const Host &aHost)
+{
+    // This is called before a host or any of its services is added,
+    // updated or removed, so that `Dns::ServiceDiscovery::Server`
+    // can drop the cached responses which may include them.
+
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ENABLE && OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+    Get<Dns::ServiceDiscovery::Server>().HandleSrpHostChange(aHost);
+#else
+    OT_UNUSED_VARIABLE(aHost);
+#endif
+}
+
 void Server::Stop(void)
 {
     VerifyOrExit(mState == kStateRunning);
 
     mState = kStateStopped;
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+    // Refresh the saved records (unless deleted on `Disable()`) so
+    // that the hosts are restored with their current remaining lease
+    // on next `Start()`. The stop time is remembered so that the time
+    // while stopped is also counted if the server is started again
+    // without a reset (e.g., auto-enable mode handover).
+    if ((mNumRecordEntries > 0) || mSaveTimer.IsRunning())
+    {
+        CompactHostRecords();
+    }
+
+    mHasStopTime = true;
+    mStopTime    = TimerMilli::GetNow();
+#endif
+
     while (!mHosts.IsEmpty())
     {
         RemoveHost(mHosts.GetHead(), kDeleteName, kNotifyServiceHandler);
@@ -1210,6 +1397,7 @@ Error Server::VerifySignature(const Dns::Ecdsa256KeyRecord &aKeyRecord,
     // verification. See https://tools.ietf.org/html/rfc2931#section-3.1 for details.
     signerNameMessage = Get<Ip6::Udp>().NewMessage();
     VerifyOrExit(signerNameMessage != nullptr, error = kErrorNoBufs);
+    signerNameMessage->SetOrigin(Message::kOriginSrp);
     SuccessOrExit(error = Dns::Name::AppendName(aSignerName, *signerNameMessage));
     sha256.Update(*signerNameMessage, signerNameMessage->GetOffset(), signerNameMessage->GetLength());
 
@@ -1272,7 +1460,7 @@ Error Server::ValidateServiceSubTypes(Host &aHost, const MessageMetadata &aMetad
     // message, we add any previously registered service sub-type that
     // does not appear in new Update message as "deleted".
 
-    existingHost = mHosts.FindMatching(aHost.GetFullName());
+    existingHost = FindHost(aHost.GetFullName());
     VerifyOrExit(existingHost != nullptr);
 
     for (const Service &baseService : existingHost->GetServices())
@@ -1308,7 +1496,7 @@ void Server::HandleUpdate(Host &aHost, const MessageMetadata &aMetadata)
 
     aHost.ClearResources();
 
-    existingHost = mHosts.FindMatching(aHost.GetFullName());
+    existingHost = FindHost(aHost.GetFullName());
     VerifyOrExit(existingHost != nullptr);
 
     // The client may not include all services it has registered before
@@ -1407,6 +1595,7 @@ void Server::SendResponse(const Dns::UpdateHeader    &aHeader,
 
     response = GetSocket().NewMessage();
     VerifyOrExit(response != nullptr, error = kErrorNoBufs);
+    response->SetOrigin(Message::kOriginSrp);
 
     header.SetMessageId(aHeader.GetMessageId());
     header.SetType(Dns::UpdateHeader::kTypeResponse);
@@ -1450,6 +1639,7 @@ void Server::SendResponse(const Dns::UpdateHeader &aHeader,
 
     response = GetSocket().NewMessage();
     VerifyOrExit(response != nullptr, error = kErrorNoBufs);
+    response->SetOrigin(Message::kOriginSrp);
 
     header.SetMessageId(aHeader.GetMessageId());
     header.SetType(Dns::UpdateHeader::kTypeResponse);
@@ -1543,118 +1733,705 @@ exit:
 
 void Server::HandleLeaseTimer(void)
 {
-    TimeMilli now                = TimerMilli::GetNow();
-    TimeMilli earliestExpireTime = now.GetDistantFuture();
-    Host     *nextHost;
+    // The hosts changed by the expired leases are saved once at the
+    // end of the run (rather than on each expiry).
+
+    ExpireLeases(kNotifyServiceHandler);
+    SavePendingHostRecords();
+}
+
+void Server::ExpireLeases(NotifyMode aNotifyServiceHandler)
+{
+    // Only the hosts and services whose deadline in the expiry queues
+    // is reached are visited. Handling an entry either removes it or
+    // moves it to its next deadline (e.g., from its lease to its key
+    // lease expiry).
+    //
+    // Hosts are handled first, so that an expired host removes its
+    // services (notifying the service handler once for the host)
+    // before any of its services is handled on its own.
+
+    TimeMilli                now            = TimerMilli::GetNow();
+    uint32_t                 numExpirations = 0;
+    LeaseExpiryQueue::Entry *entry;
 
-    for (Host *host = mHosts.GetHead(); host != nullptr; host = nextHost)
+    while (((entry = mHostExpiryQueue.GetTop()) != nullptr) && (entry->GetDeadline() <= now))
     {
-        nextHost = host->GetNext();
+        Host &host = *static_cast<Host *>(entry);
 
-        if (host->GetKeyExpireTime() <= now)
+        if (host.GetKeyExpireTime() <= now)
         {
-            LogInfo("KEY LEASE of host %s expired", host->GetFullName());
+            LogInfo("KEY LEASE of host %s expired", host.GetFullName());
+            mLeaseCounters.mHostKeyLeaseExpirations++;
+            numExpirations++;
 
             // Removes the whole host and all services if the KEY RR expired.
-            RemoveHost(host, kDeleteName, kNotifyServiceHandler);
+            SaveHostRemoval(host);
+            RemoveHost(&host, kDeleteName, aNotifyServiceHandler);
         }
-        else if (host->IsDeleted())
+        else if (!host.IsDeleted() && (host.GetExpireTime() <= now))
         {
-            // The host has been deleted, but the hostname & service instance names retain.
+            LogInfo("LEASE of host %s expired", host.GetFullName());
+            mLeaseCounters.mHostLeaseExpirations++;
+            numExpirations++;
 
-            Service *next;
-
-            earliestExpireTime = Min(earliestExpireTime, host->GetKeyExpireTime());
-
-            // Check if any service instance name expired.
-            for (Service *service = host->mServices.GetHead(); service != nullptr; service = next)
+            // If the host expired, delete all resources of this host and its services.
+            for (Service &service : host.mServices)
             {
-                next = service->GetNext();
-
-                OT_ASSERT(service->mIsDeleted);
-
-                if (service->GetKeyExpireTime() <= now)
-                {
-                    service->Log(Service::kKeyLeaseExpired);
-                    host->RemoveService(service, kDeleteName, kNotifyServiceHandler);
-                }
-                else
-                {
-                    earliestExpireTime = Min(earliestExpireTime, service->GetKeyExpireTime());
-                }
+                // Don't need to notify the service handler as `RemoveHost` at below will do.
+                host.RemoveService(&service, kRetainName, kDoNotNotifyServiceHandler);
             }
+
+            RemoveHost(&host, kRetainName, aNotifyServiceHandler);
+            SaveHost(host);
         }
-        else if (host->GetExpireTime() <= now)
+        else
         {
-            LogInfo("LEASE of host %s expired", host->GetFullName());
+            UpdateLeaseExpiry(host);
+        }
+    }
 
-            // If the host expired, delete all resources of this host and its services.
-            for (Service &service : host->mServices)
-            {
-                // Don't need to notify the service handler as `RemoveHost` at below will do.
-                host->RemoveService(&service, kRetainName, kDoNotNotifyServiceHandler);
-            }
+    while (((entry = mServiceExpiryQueue.GetTop()) != nullptr) && (entry->GetDeadline() <= now))
+    {
+        Service &service = *static_cast<Service *>(entry);
+        Host    &host    = *service.mDescription->mHost;
+
+        if (service.GetKeyExpireTime() <= now)
+        {
+            service.Log(Service::kKeyLeaseExpired);
+            mLeaseCounters.mServiceKeyLeaseExpirations++;
+            numExpirations++;
 
-            RemoveHost(host, kRetainName, kNotifyServiceHandler);
+            host.RemoveService(&service, kDeleteName, aNotifyServiceHandler);
+            SaveHost(host);
+        }
+        else if (!service.mIsDeleted && (service.GetExpireTime() <= now))
+        {
+            service.Log(Service::kLeaseExpired);
+            mLeaseCounters.mServiceLeaseExpirations++;
+            numExpirations++;
 
-            earliestExpireTime = Min(earliestExpireTime, host->GetKeyExpireTime());
+            // The service is expired, delete it (but retain its name).
+            host.RemoveService(&service, kRetainName, aNotifyServiceHandler);
+            SaveHost(host);
         }
         else
         {
-            // The host doesn't expire, check if any service expired or is explicitly removed.
+            UpdateLeaseExpiry(service);
+        }
+    }
+
+    mLeaseCounters.mLeaseTimerRuns++;
+    mLeaseCounters.mLastRunExpirations = numExpirations;
+    mLeaseCounters.mMaxRunExpirations  = Max(mLeaseCounters.mMaxRunExpirations, numExpirations);
+
+    ScheduleLeaseTimer();
+}
+
+void Server::ScheduleLeaseTimer(void)
+{
+    const LeaseExpiryQueue::Entry *hostEntry    = mHostExpiryQueue.GetTop();
+    const LeaseExpiryQueue::Entry *serviceEntry = mServiceExpiryQueue.GetTop();
+    TimeMilli                      now          = TimerMilli::GetNow();
+    TimeMilli                      fireTime;
+
+    if ((hostEntry == nullptr) && (serviceEntry == nullptr))
+    {
+        if (mLeaseTimer.IsRunning())
+        {
+            LogInfo("Lease timer is stopped");
+            mLeaseTimer.Stop();
+        }
+
+        ExitNow();
+    }
+
+    if (hostEntry == nullptr)
+    {
+        fireTime = serviceEntry->GetDeadline();
+    }
+    else if (serviceEntry == nullptr)
+    {
+        fireTime = hostEntry->GetDeadline();
+    }
+    else
+    {
+        fireTime = Min(hostEntry->GetDeadline(), serviceEntry->GetDeadline());
+    }
+
+    VerifyOrExit(!mLeaseTimer.IsRunning() || (mLeaseTimer.GetFireTime() != fireTime));
+
+    LogInfo("Lease timer is scheduled for %lu seconds",
+            ToUlong(Time::MsecToSec((fireTime > now) ? (fireTime - now) : 0)));
+    mLeaseTimer.FireAt(fireTime);
+
+exit:
+    OT_UNUSED_VARIABLE(now);
+}
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+
+// The registered hosts are saved in `Settings` as an append-only log
+// of records: whenever hosts are committed, removed, or any of their
+// leases expires, a new record is added for each changed host along
+// with a single record listing the removed hosts. The changes are
+// batched by the save timer (or saved at the end of a lease timer
+// run) so that a burst of changes saves each host once. When the
+// records are restored, a newer record of a host replaces the older
+// ones. The log is compacted (rewritten with a single record per
+// host) after it is restored, when the server stops, whenever it
+// grows beyond twice its compacted size, and whenever a record fails
+// to be saved, unless the last compaction already left the log at
+// its limit.
+
+void Server::SaveHost(Host &aHost)
+{
+    aHost.mIsSavePending = true;
+
+    if (!mSaveTimer.IsRunning())
+    {
+        mSaveTimer.Start(kSaveDelay);
+    }
+}
+
+void Server::SaveHostRemoval(const Host &aHost)
+{
+    // The host is freed before the records are saved, so its name is
+    // kept. If it cannot be kept, the records are compacted instead
+    // (which drops the saved record of the removed host).
+
+    Heap::String *name = mRemovedHostNames.PushBack();
+
+    if (name == nullptr)
+    {
+        mShouldCompactRecords = true;
+    }
+    else if (name->Set(aHost.GetFullName()) != kErrorNone)
+    {
+        mRemovedHostNames.PopBack();
+        mShouldCompactRecords = true;
+    }
+
+    // Removing a host may make room for the other hosts.
+    mRecordsAtLimit = false;
+
+    if (!mSaveTimer.IsRunning())
+    {
+        mSaveTimer.Start(kSaveDelay);
+    }
+}
+
+void Server::HandleSaveTimer(void) { SavePendingHostRecords(); }
+
+void Server::SavePendingHostRecords(void)
+{
+    bool saved = true;
+
+    mSaveTimer.Stop();
+
+    if (mRemovedHostNames.GetLength() > 0)
+    {
+        Error error = AddRemovedHostsRecord();
+
+        if (error != kErrorNone)
+        {
+            LogWarn("Failed to save %u removed hosts: %s", mRemovedHostNames.GetLength(), ErrorToString(error));
+            saved = false;
+        }
+
+        mRemovedHostNames.Free();
+    }
+
+    for (Host &host : mHosts)
+    {
+        Error error;
+
+        if (!host.mIsSavePending)
+        {
+            continue;
+        }
+
+        host.mIsSavePending = false;
+        error               = AddHostRecord(host);
+
+        if (error != kErrorNone)
+        {
+            LogWarn("Failed to save host %s: %s", host.GetFullName(), ErrorToString(error));
+            saved = false;
+        }
+    }
+
+    // Compacting rewrites the records from the current hosts, which
+    // also drops a partially saved record or makes room for a failed
+    // one if there are outdated entries. If the last compaction
+    // already left the log at its limit, compacting again would only
+    // rewrite the same hosts, so the records which do not fit are
+    // not saved until a host is removed.
+
+    if (saved && !mShouldCompactRecords && (mNumRecordEntries <= 2 * mNumCompactedEntries + kMinEntriesToCompact))
+    {
+        ExitNow();
+    }
+
+    if (!saved && !mShouldCompactRecords && mRecordsAtLimit)
+    {
+        LogWarn("Saved hosts are at the limit of %u entries, changed hosts are not saved", kMaxRecordEntries);
+        ExitNow();
+    }
+
+    CompactHostRecords();
+
+exit:
+    return;
+}
+
+Error Server::AddHostRecord(const Host &aHost)
+{
+    Error    error   = kErrorNone;
+    Message *message = Get<MessagePool>().Allocate(Message::kTypeOther);
+
+    VerifyOrExit(message != nullptr, error = kErrorNoBufs);
+    SuccessOrExit(error = AppendHostRecord(*message, aHost));
+    error = AddRecordEntries(*message);
+
+exit:
+    FreeMessage(message);
+    return error;
+}
+
+Error Server::AddRemovedHostsRecord(void)
+{
+    // Removed hosts record format:
+    //
+    //  uint8     Record type (`kRecordTypeRemovedHost`).
+    //  string    Host full name, repeated for each removed host.
+
+    Error    error   = kErrorNone;
+    Message *message = Get<MessagePool>().Allocate(Message::kTypeOther);
+
+    VerifyOrExit(message != nullptr, error = kErrorNoBufs);
+    SuccessOrExit(error = message->Append<uint8_t>(kRecordTypeRemovedHost));
+
+    for (const Heap::String &name : mRemovedHostNames)
+    {
+        SuccessOrExit(error = AppendRecordString(*message, name.AsCString()));
+    }
+
+    error = AddRecordEntries(*message);
+
+exit:
+    FreeMessage(message);
+    return error;
+}
+
+Error Server::AddRecordEntries(const Message &aMessage)
+{
+    static constexpr uint16_t kEntryDataSize = kMaxRecordEntrySize - sizeof(uint8_t);
+
+    Error    error = kErrorNone;
+    uint8_t  entry[kMaxRecordEntrySize];
+    uint16_t numEntries;
+    uint16_t length;
+
+    // The record is split into entries, each prefixed with a flags
+    // byte. The record is not saved if it exceeds the entries limit.
+
+    numEntries = (aMessage.GetLength() + kEntryDataSize - 1) / kEntryDataSize;
+    VerifyOrExit(mNumRecordEntries + numEntries <= kMaxRecordEntries, error = kErrorNoBufs);
+
+    for (uint16_t offset = 0; offset < aMessage.GetLength(); offset += length)
+    {
+        length = Min<uint16_t>(aMessage.GetLength() - offset, kEntryDataSize);
+
+        entry[0] = (offset + length < aMessage.GetLength()) ? kRecordEntryFlagMore : 0;
+        aMessage.ReadBytes(offset, &entry[1], length);
+
+        SuccessOrExit(error = Get<Settings>().AddSrpServerHostRecord(entry, length + sizeof(uint8_t)));
+        mNumRecordEntries++;
+    }
+
+exit:
+    return error;
+}
+
+Error Server::AppendHostRecord(Message &aMessage, const Host &aHost) const
+{
+    // Host record format (multi-byte values in big-endian):
+    //
+    //  uint8     Record type (`kRecordTypeHost`).
+    //  string    Host full name (uint8 length followed by the chars).
+    //  uint8     Host flags (`kHostFlagShortLeaseOption`).
+    //  uint32    TTL, LEASE and KEY-LEASE (in seconds).
+    //  uint32    Age (msec since the host was last updated).
+    //  bytes     KEY record (`Dns::Ecdsa256KeyRecord`).
+    //  uint16    Number of addresses, followed by the IPv6 addresses.
+    //  uint16    Number of services, followed by each service:
+    //    uint8     Service flags (`kServiceFlagSubType/Deleted`).
+    //    string    Service name, instance name and instance label.
+    //    uint32    Age (msec since the service was last updated).
+    //    For a base type service, followed by its description:
+    //      uint32    TTL, LEASE and KEY-LEASE (in seconds).
+    //      uint16    Priority, weight and port.
+    //      uint16    TXT data length, followed by the TXT data.
+
+    Error     error;
+    TimeMilli now         = TimerMilli::GetNow();
+    uint16_t  numServices = 0;
+
+    SuccessOrExit(error = aMessage.Append<uint8_t>(kRecordTypeHost));
+    SuccessOrExit(error = AppendRecordString(aMessage, aHost.GetFullName()));
+    SuccessOrExit(error = aMessage.Append<uint8_t>(aHost.mUseShortLeaseOption ? kHostFlagShortLeaseOption : 0));
+    SuccessOrExit(error = aMessage.Append(Encoding::BigEndian::HostSwap32(aHost.mTtl)));
+    SuccessOrExit(error = aMessage.Append(Encoding::BigEndian::HostSwap32(aHost.mLease)));
+    SuccessOrExit(error = aMessage.Append(Encoding::BigEndian::HostSwap32(aHost.mKeyLease)));
+    SuccessOrExit(error = aMessage.Append(Encoding::BigEndian::HostSwap32(now - aHost.mUpdateTime)));
+    SuccessOrExit(error = aMessage.Append(aHost.mKeyRecord));
+
+    SuccessOrExit(error = aMessage.Append(Encoding::BigEndian::HostSwap16(aHost.mAddresses.GetLength())));
+
+    for (const Ip6::Address &address : aHost.mAddresses)
+    {
+        SuccessOrExit(error = aMessage.Append(address));
+    }
+
+    for (const Service &service : aHost.mServices)
+    {
+        OT_UNUSED_VARIABLE(service);
+        numServices++;
+    }
+
+    SuccessOrExit(error = aMessage.Append(Encoding::BigEndian::HostSwap16(numServices)));
+
+    for (const Service &service : aHost.mServices)
+    {
+        const Service::Description &desc  = *service.mDescription;
+        uint8_t                     flags = 0;
+
+        if (service.mIsSubType)
+        {
+            flags |= kServiceFlagSubType;
+        }
+
+        if (service.mIsDeleted)
+        {
+            flags |= kServiceFlagDeleted;
+        }
+
+        SuccessOrExit(error = aMessage.Append<uint8_t>(flags));
+        SuccessOrExit(error = AppendRecordString(aMessage, service.GetServiceName()));
+        SuccessOrExit(error = AppendRecordString(aMessage, service.GetInstanceName()));
+        SuccessOrExit(error = AppendRecordString(aMessage, service.GetInstanceLabel()));
+        SuccessOrExit(error = aMessage.Append(Encoding::BigEndian::HostSwap32(now - service.mUpdateTime)));
+
+        if (service.mIsSubType)
+        {
+            continue;
+        }
+
+        SuccessOrExit(error = aMessage.Append(Encoding::BigEndian::HostSwap32(desc.mTtl)));
+        SuccessOrExit(error = aMessage.Append(Encoding::BigEndian::HostSwap32(desc.mLease)));
+        SuccessOrExit(error = aMessage.Append(Encoding::BigEndian::HostSwap32(desc.mKeyLease)));
+        SuccessOrExit(error = aMessage.Append(Encoding::BigEndian::HostSwap16(desc.mPriority)));
+        SuccessOrExit(error = aMessage.Append(Encoding::BigEndian::HostSwap16(desc.mWeight)));
+        SuccessOrExit(error = aMessage.Append(Encoding::BigEndian::HostSwap16(desc.mPort)));
+        SuccessOrExit(error = aMessage.Append(Encoding::BigEndian::HostSwap16(desc.mTxtData.GetLength())));
+        SuccessOrExit(error = desc.mTxtData.CopyBytesTo(aMessage));
+    }
+
+exit:
+    return error;
+}
+
+void Server::CompactHostRecords(void)
+{
+    bool saved = true;
+
+    DeleteHostRecords();
+
+    for (Host &host : mHosts)
+    {
+        Error error;
+
+        host.mIsSavePending = false;
+        error               = AddHostRecord(host);
+
+        if (error != kErrorNone)
+        {
+            LogWarn("Failed to save host %s: %s", host.GetFullName(), ErrorToString(error));
+            saved = false;
+        }
+    }
+
+    mNumCompactedEntries = mNumRecordEntries;
+    mRecordsAtLimit      = !saved || (mNumRecordEntries + kMinEntriesToCompact > kMaxRecordEntries);
+
+    LogInfo("Compacted saved hosts, %u entries", mNumRecordEntries);
+}
+
+void Server::DeleteHostRecords(void)
+{
+    IgnoreError(Get<Settings>().DeleteAllSrpServerHostRecords());
+    mSaveTimer.Stop();
+    mRemovedHostNames.Free();
+    mNumRecordEntries     = 0;
+    mNumCompactedEntries  = 0;
+    mRecordsAtLimit       = false;
+    mShouldCompactRecords = false;
+}
+
+void Server::RestoreHosts(void)
+{
+    // The saved ages are relative to when the records were saved. If
+    // the server was stopped (and so the records were compacted)
+    // without a reset, the time since then is known and is included.
+    // Otherwise the time while the device was off is not counted.
+
+    Error     error;
+    uint16_t  index    = 0;
+    TimeMilli saveTime = mHasStopTime ? mStopTime : TimerMilli::GetNow();
+
+    while (true)
+    {
+        error = RestoreHost(index, saveTime);
+
+        if (error == kErrorNotFound)
+        {
+            break;
+        }
 
-            Service *next;
+        if (error != kErrorNone)
+        {
+            LogWarn("Failed to restore saved host record: %s", ErrorToString(error));
+        }
+    }
 
-            OT_ASSERT(!host->IsDeleted());
+    VerifyOrExit(index > 0);
 
-            earliestExpireTime = Min(earliestExpireTime, host->GetExpireTime());
+    LogInfo("Restored %lu hosts from %u saved entries", ToUlong(mHostNameIndex.GetNumEntries()), index);
 
-            for (Service *service = host->mServices.GetHead(); service != nullptr; service = next)
+    // Leases which ended while stopped are expired before the service
+    // handler learns about the restored hosts. This also schedules
+    // the lease timer.
+
+    ExpireLeases(kDoNotNotifyServiceHandler);
+    CompactHostRecords();
+
+    if (mServiceUpdateHandler.IsSet())
+    {
+        // The service handler is notified of each restored host (e.g.
+        // so that an advertising proxy can publish it again) but, as
+        // with removed hosts, we do not wait for the result.
+
+        for (Host &host : mHosts)
+        {
+            uint32_t updateId;
+
+            if (host.IsDeleted())
             {
-                next = service->GetNext();
-
-                if (service->GetKeyExpireTime() <= now)
-                {
-                    service->Log(Service::kKeyLeaseExpired);
-                    host->RemoveService(service, kDeleteName, kNotifyServiceHandler);
-                }
-                else if (service->mIsDeleted)
-                {
-                    // The service has been deleted but the name retains.
-                    earliestExpireTime = Min(earliestExpireTime, service->GetKeyExpireTime());
-                }
-                else if (service->GetExpireTime() <= now)
-                {
-                    service->Log(Service::kLeaseExpired);
-
-                    // The service is expired, delete it.
-                    host->RemoveService(service, kRetainName, kNotifyServiceHandler);
-                    earliestExpireTime = Min(earliestExpireTime, service->GetKeyExpireTime());
-                }
-                else
-                {
-                    earliestExpireTime = Min(earliestExpireTime, service->GetExpireTime());
-                }
+                continue;
             }
+
+            updateId = AllocateId();
+
+            LogInfo("SRP update handler is notified (updatedId = %lu)", ToUlong(updateId));
+            mServiceUpdateHandler.Invoke(updateId, &host, static_cast<uint32_t>(kDefaultEventsHandlerTimeout));
         }
     }
 
-    if (earliestExpireTime != now.GetDistantFuture())
+exit:
+    return;
+}
+
+Error Server::RestoreHost(uint16_t &aEntryIndex, TimeMilli aSaveTime)
+{
+    // Reads the record starting at entry `aEntryIndex` (updating it
+    // to the entry after the record) and restores its host. Returns
+    // `kErrorNotFound` if there is no entry at `aEntryIndex`.
+
+    Error      error   = kErrorNone;
+    Message   *message = nullptr;
+    Host      *host    = nullptr;
+    uint8_t    entry[kMaxRecordEntrySize];
+    uint16_t   length;
+    uint8_t    type;
+    char       name[Dns::Name::kMaxNameSize];
+    Heap::Data record;
+    FrameData  frameData;
+
+    do
     {
-        OT_ASSERT(earliestExpireTime >= now);
-        if (!mLeaseTimer.IsRunning() || earliestExpireTime <= mLeaseTimer.GetFireTime())
+        length = sizeof(entry);
+
+        if (Get<Settings>().ReadSrpServerHostRecord(aEntryIndex, entry, length) != kErrorNone)
+        {
+            // A missing entry in the middle of a record (e.g., power
+            // loss while saving it) is reported as parse error.
+            ExitNow(error = (message == nullptr) ? kErrorNotFound : kErrorParse);
+        }
+
+        aEntryIndex++;
+        VerifyOrExit(length > sizeof(uint8_t), error = kErrorParse);
+
+        if (message == nullptr)
         {
-            LogInfo("Lease timer is scheduled for %lu seconds", ToUlong(Time::MsecToSec(earliestExpireTime - now)));
-            mLeaseTimer.StartAt(earliestExpireTime, 0);
+            message = Get<MessagePool>().Allocate(Message::kTypeOther);
+            VerifyOrExit(message != nullptr, error = kErrorNoBufs);
         }
+
+        SuccessOrExit(error = message->AppendBytes(&entry[1], length - sizeof(uint8_t)));
+
+    } while (entry[0] & kRecordEntryFlagMore);
+
+    SuccessOrExit(error = record.SetFrom(*message));
+    frameData.Init(record.GetBytes(), record.GetLength());
+    SuccessOrExit(error = frameData.ReadUint8(type));
+    VerifyOrExit((type == kRecordTypeHost) || (type == kRecordTypeRemovedHost), error = kErrorParse);
+
+    // A newer record replaces the hosts restored from older ones. A
+    // removed hosts record lists the names of one or more hosts.
+    do
+    {
+        SuccessOrExit(error = ReadRecordString(frameData, name, sizeof(name)));
+        RemoveHost(FindHost(name), kDeleteName, kDoNotNotifyServiceHandler);
+    } while ((type == kRecordTypeRemovedHost) && (frameData.GetLength() > 0));
+
+    VerifyOrExit(type == kRecordTypeHost);
+
+    host = Host::Allocate(GetInstance(), TimerMilli::GetNow());
+    VerifyOrExit(host != nullptr, error = kErrorNoBufs);
+    SuccessOrExit(error = host->SetFullName(name));
+    SuccessOrExit(error = ReadHostRecord(frameData, aSaveTime, *host));
+
+    AddHost(*host);
+    host = nullptr;
+
+exit:
+    if (host != nullptr)
+    {
+        host->Free();
     }
-    else
+
+    FreeMessage(message);
+    return error;
+}
+
+Error Server::ReadHostRecord(FrameData &aFrameData, TimeMilli aSaveTime, Host &aHost) const
+{
+    // Reads the rest of a host record (after its full name), see
+    // `AppendHostRecord()` for the format. The saved ages are
+    // relative to `aSaveTime`.
+
+    Error                  error;
+    uint8_t                flags;
+    uint32_t               age;
+    uint16_t               count;
+    Dns::Ecdsa256KeyRecord keyRecord;
+
+    SuccessOrExit(error = aFrameData.ReadUint8(flags));
+    SuccessOrExit(error = aFrameData.ReadBigEndianUint32(aHost.mTtl));
+    SuccessOrExit(error = aFrameData.ReadBigEndianUint32(aHost.mLease));
+    SuccessOrExit(error = aFrameData.ReadBigEndianUint32(aHost.mKeyLease));
+    SuccessOrExit(error = aFrameData.ReadBigEndianUint32(age));
+    SuccessOrExit(error = aFrameData.Read(keyRecord));
+    VerifyOrExit(keyRecord.IsValid(), error = kErrorParse);
+
+    aHost.SetKeyRecord(keyRecord);
+    aHost.mUseShortLeaseOption = ((flags & kHostFlagShortLeaseOption) != 0);
+    aHost.mUpdateTime          = aSaveTime - age;
+
+    SuccessOrExit(error = aFrameData.ReadBigEndianUint16(count));
+
+    for (; count > 0; count--)
     {
-        LogInfo("Lease timer is stopped");
-        mLeaseTimer.Stop();
+        Ip6::Address address;
+
+        SuccessOrExit(error = aFrameData.Read(address));
+        VerifyOrExit(aHost.AddIp6Address(address) != kErrorNoBufs, error = kErrorNoBufs);
     }
+
+    SuccessOrExit(error = aFrameData.ReadBigEndianUint16(count));
+
+    for (; count > 0; count--)
+    {
+        char     serviceName[Dns::Name::kMaxNameSize];
+        char     instanceName[Dns::Name::kMaxNameSize];
+        char     instanceLabel[Dns::Name::kMaxLabelSize];
+        uint16_t txtLength;
+        Service *service;
+
+        SuccessOrExit(error = aFrameData.ReadUint8(flags));
+        SuccessOrExit(error = ReadRecordString(aFrameData, serviceName, sizeof(serviceName)));
+        SuccessOrExit(error = ReadRecordString(aFrameData, instanceName, sizeof(instanceName)));
+        SuccessOrExit(error = ReadRecordString(aFrameData, instanceLabel, sizeof(instanceLabel)));
+        SuccessOrExit(error = aFrameData.ReadBigEndianUint32(age));
+
+        service = aHost.AddNewService(serviceName, instanceName, instanceLabel, ((flags & kServiceFlagSubType) != 0),
+                                      aSaveTime - age);
+        VerifyOrExit(service != nullptr, error = kErrorNoBufs);
+
+        service->mIsDeleted   = ((flags & kServiceFlagDeleted) != 0);
+        service->mIsCommitted = true;
+
+        if (service->mIsSubType)
+        {
+            continue;
+        }
+
+        {
+            Service::Description &desc = *service->mDescription;
+
+            SuccessOrExit(error = aFrameData.ReadBigEndianUint32(desc.mTtl));
+            SuccessOrExit(error = aFrameData.ReadBigEndianUint32(desc.mLease));
+            SuccessOrExit(error = aFrameData.ReadBigEndianUint32(desc.mKeyLease));
+            SuccessOrExit(error = aFrameData.ReadBigEndianUint16(desc.mPriority));
+            SuccessOrExit(error = aFrameData.ReadBigEndianUint16(desc.mWeight));
+            SuccessOrExit(error = aFrameData.ReadBigEndianUint16(desc.mPort));
+            SuccessOrExit(error = aFrameData.ReadBigEndianUint16(txtLength));
+            VerifyOrExit(aFrameData.CanRead(txtLength), error = kErrorParse);
+
+            if (txtLength > 0)
+            {
+                SuccessOrExit(error = desc.mTxtData.SetFrom(aFrameData.GetBytes(), txtLength));
+                aFrameData.SkipOver(txtLength);
+            }
+
+            desc.mUpdateTime = aSaveTime - age;
+        }
+    }
+
+exit:
+    return error;
+}
+
+Error Server::AppendRecordString(Message &aMessage, const char *aString)
+{
+    Error    error;
+    uint16_t length = StringLength(aString, Dns::Name::kMaxNameSize);
+
+    VerifyOrExit(length < Dns::Name::kMaxNameSize, error = kErrorInvalidArgs);
+    SuccessOrExit(error = aMessage.Append<uint8_t>(static_cast<uint8_t>(length)));
+    error = aMessage.AppendBytes(aString, length);
+
+exit:
+    return error;
+}
+
+Error Server::ReadRecordString(FrameData &aFrameData, char *aString, uint16_t aSize)
+{
+    Error   error;
+    uint8_t length;
+
+    SuccessOrExit(error = aFrameData.ReadUint8(length));
+    VerifyOrExit(length < aSize, error = kErrorParse);
+    SuccessOrExit(error = aFrameData.ReadBytes(aString, length));
+    aString[length] = kNullChar;
+
+exit:
+    return error;
 }
 
+#endif // OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+
 void Server::HandleOutstandingUpdatesTimer(void)
 {
     while (!mOutstandingUpdates.IsEmpty() && mOutstandingUpdates.GetTail()->GetExpireTime() <= TimerMilli::GetNow())
@@ -1708,11 +2485,13 @@ void Server::UpdateResponseCounters(Dns::UpdateHeader::Response aResponseCode)
 Error Server::Service::Init(const char *aServiceName, Description &aDescription, bool aIsSubType, TimeMilli aUpdateTime)
 {
     mDescription.Reset(&aDescription);
-    mNext        = nullptr;
-    mUpdateTime  = aUpdateTime;
-    mIsDeleted   = false;
-    mIsSubType   = aIsSubType;
-    mIsCommitted = false;
+    mNext                    = nullptr;
+    mNextInInstanceNameIndex = nullptr;
+    mNextInServiceNameIndex  = nullptr;
+    mUpdateTime              = aUpdateTime;
+    mIsDeleted               = false;
+    mIsSubType               = aIsSubType;
+    mIsCommitted             = false;
 
     return mServiceName.Set(aServiceName);
 }
@@ -1760,6 +2539,11 @@ TimeMilli Server::Service::GetKeyExpireTime(void) const
     return mUpdateTime + Time::SecToMsec(mDescription->mKeyLease);
 }
 
+TimeMilli Server::Service::GetNextExpireTime(void) const
+{
+    return (mIsDeleted || GetHost().IsDeleted()) ? GetKeyExpireTime() : GetExpireTime();
+}
+
 void Server::Service::GetLeaseInfo(LeaseInfo &aLeaseInfo) const
 {
     TimeMilli now           = TimerMilli::GetNow();
@@ -1930,10 +2714,15 @@ exit:
 Server::Host::Host(Instance &aInstance, TimeMilli aUpdateTime)
     : InstanceLocator(aInstance)
     , mNext(nullptr)
+    , mNextInNameIndex(nullptr)
     , mTtl(0)
     , mLease(0)
     , mKeyLease(0)
     , mUpdateTime(aUpdateTime)
+    , mIsIndexed(false)
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+    , mIsSavePending(false)
+#endif
 {
     mKeyRecord.Clear();
 }
@@ -1981,6 +2770,8 @@ TimeMilli Server::Host::GetExpireTime(void) const
 
 TimeMilli Server::Host::GetKeyExpireTime(void) const { return mUpdateTime + Time::SecToMsec(mKeyLease); }
 
+TimeMilli Server::Host::GetNextExpireTime(void) const { return IsDeleted() ? GetKeyExpireTime() : GetExpireTime(); }
+
 void Server::Host::GetLeaseInfo(LeaseInfo &aLeaseInfo) const
 {
     TimeMilli now           = TimerMilli::GetNow();
@@ -2027,7 +2818,24 @@ const Server::Service *Server::Host::FindNextService(const Service *aPrevService
                                                      const char    *aServiceName,
                                                      const char    *aInstanceName) const
 {
-    const Service *service = (aPrevService == nullptr) ? GetServices().GetHead() : aPrevService->GetNext();
+    const Service *service;
+
+    if (mIsIndexed && (aInstanceName != nullptr))
+    {
+        // Use the server instance name index, skipping over the
+        // services with the same instance name on other hosts.
+
+        service = aPrevService;
+
+        do
+        {
+            service = Get<Server>().FindNextService(service, aFlags, aServiceName, aInstanceName);
+        } while ((service != nullptr) && (&service->GetHost() != this));
+
+        ExitNow();
+    }
+
+    service = (aPrevService == nullptr) ? GetServices().GetHead() : aPrevService->GetNext();
 
     for (; service != nullptr; service = service->GetNext())
     {
@@ -2049,6 +2857,7 @@ const Server::Service *Server::Host::FindNextService(const Service *aPrevService
         break;
     }
 
+exit:
     return service;
 }
 
@@ -2072,6 +2881,11 @@ Server::Service *Server::Host::AddNewService(const char *aServiceName,
 
     mServices.Push(*service);
 
+    if (mIsIndexed)
+    {
+        Get<Server>().AddToIndexes(*service);
+    }
+
 exit:
     return service;
 }
@@ -2088,10 +2902,17 @@ void Server::Host::RemoveService(Service *aService, RetainName aRetainName, Noti
 
     VerifyOrExit(aService != nullptr);
 
+    server.InvalidateDnssdAnswers(*this);
+
     aService->mIsDeleted = true;
 
     aService->Log(aRetainName ? Service::kRemoveButRetainName : Service::kFullyRemove);
 
+    if (aRetainName)
+    {
+        server.UpdateLeaseExpiry(*aService);
+    }
+
     if (aNotifyServiceHandler && server.mServiceUpdateHandler.IsSet())
     {
         uint32_t updateId = server.AllocateId();
@@ -2107,6 +2928,11 @@ void Server::Host::RemoveService(Service *aService, RetainName aRetainName, Noti
 
     if (!aRetainName)
     {
+        if (mIsIndexed)
+        {
+            server.RemoveFromIndexes(*aService);
+        }
+
         IgnoreError(mServices.Remove(*aService));
         aService->Free();
     }
@@ -2204,18 +3030,10 @@ bool Server::Host::HasServiceInstance(const char *aInstanceName) const
 
 const RetainPtr<Server::Service::Description> Server::Host::FindServiceDescription(const char *aInstanceName) const
 {
-    const Service::Description *desc = nullptr;
+    const Service *service = FindNextService(/* aPrevService */ nullptr, kFlagsAnyService, /* aServiceName */ nullptr,
+                                             aInstanceName);
 
-    for (const Service &service : mServices)
-    {
-        if (service.mDescription->Matches(aInstanceName))
-        {
-            desc = service.mDescription.Get();
-            break;
-        }
-    }
-
-    return RetainPtr<Service::Description>(AsNonConst(desc));
+    return RetainPtr<Service::Description>((service != nullptr) ? AsNonConst(service->mDescription.Get()) : nullptr);
 }
 
 RetainPtr<Server::Service::Description> Server::Host::FindServiceDescription(const char *aInstanceName)
@@ -2289,6 +3107,142 @@ Server::UpdateMetadata::UpdateMetadata(Instance &aInstance, Host &aHost, const M
     }
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+// LeaseExpiryQueue
+
+void LeaseExpiryQueue::Update(Entry &aEntry, TimeMilli aDeadline)
+{
+    VerifyOrExit(!aEntry.mIsQueued || (aEntry.mDeadline != aDeadline));
+
+    Remove(aEntry);
+
+    aEntry.mDeadline = aDeadline;
+    aEntry.mIsQueued = true;
+    mRoot            = Meld(mRoot, &aEntry);
+    mNumEntries++;
+
+exit:
+    return;
+}
+
+void LeaseExpiryQueue::Remove(Entry &aEntry)
+{
+    VerifyOrExit(aEntry.mIsQueued);
+
+    if (&aEntry == mRoot)
+    {
+        mRoot = MergePairs(aEntry.mChild);
+    }
+    else
+    {
+        // Detach `aEntry` (with its sub-heap) from its parent or
+        // previous sibling, then meld its children back into the heap.
+
+        if (aEntry.mPrev->mChild == &aEntry)
+        {
+            aEntry.mPrev->mChild = aEntry.mSibling;
+        }
+        else
+        {
+            aEntry.mPrev->mSibling = aEntry.mSibling;
+        }
+
+        if (aEntry.mSibling != nullptr)
+        {
+            aEntry.mSibling->mPrev = aEntry.mPrev;
+        }
+
+        mRoot = Meld(mRoot, MergePairs(aEntry.mChild));
+    }
+
+    aEntry.mChild    = nullptr;
+    aEntry.mSibling  = nullptr;
+    aEntry.mPrev     = nullptr;
+    aEntry.mIsQueued = false;
+    mNumEntries--;
+
+exit:
+    return;
+}
+
+LeaseExpiryQueue::Entry *LeaseExpiryQueue::Meld(Entry *aFirst, Entry *aSecond)
+{
+    // Melds two heaps given their roots (which must have no siblings)
+    // by making the root with the later deadline the leftmost child
+    // of the other one.
+
+    Entry *root  = aFirst;
+    Entry *child = aSecond;
+
+    VerifyOrExit(aFirst != nullptr, root = aSecond);
+    VerifyOrExit(aSecond != nullptr);
+
+    if (aSecond->mDeadline < aFirst->mDeadline)
+    {
+        root  = aSecond;
+        child = aFirst;
+    }
+
+    child->mPrev    = root;
+    child->mSibling = root->mChild;
+
+    if (root->mChild != nullptr)
+    {
+        root->mChild->mPrev = child;
+    }
+
+    root->mChild = child;
+
+exit:
+    return root;
+}
+
+LeaseExpiryQueue::Entry *LeaseExpiryQueue::MergePairs(Entry *aFirst)
+{
+    // Melds a list of sibling heaps into a single heap (standard
+    // two-pass pairing): first meld the siblings in pairs from left
+    // to right, then meld the resulting heaps from right to left.
+
+    Entry *pairs = nullptr;
+    Entry *root  = nullptr;
+
+    while (aFirst != nullptr)
+    {
+        Entry *first  = aFirst;
+        Entry *second = first->mSibling;
+        Entry *melded;
+
+        aFirst = (second != nullptr) ? second->mSibling : nullptr;
+
+        first->mSibling = nullptr;
+        first->mPrev    = nullptr;
+
+        if (second != nullptr)
+        {
+            second->mSibling = nullptr;
+            second->mPrev    = nullptr;
+        }
+
+        // The melded pairs are linked in reverse order through
+        // `mSibling` for the second pass.
+
+        melded           = Meld(first, second);
+        melded->mSibling = pairs;
+        pairs            = melded;
+    }
+
+    while (pairs != nullptr)
+    {
+        Entry *next = pairs->mSibling;
+
+        pairs->mSibling = nullptr;
+        root            = Meld(root, pairs);
+        pairs           = next;
+    }
+
+    return root;
+}
+
 } // namespace Srp
 } // namespace ot
 
@@ -57,6 +57,8 @@
 #include "common/as_core_type.hpp"
 #include "common/callback.hpp"
 #include "common/clearable.hpp"
+#include "common/code_utils.hpp"
+#include "common/frame_data.hpp"
 #include "common/heap.hpp"
 #include "common/heap_allocatable.hpp"
 #include "common/heap_array.hpp"
@@ -69,6 +71,7 @@
 #include "common/num_utils.hpp"
 #include "common/numeric_limits.hpp"
 #include "common/retain_ptr.hpp"
+#include "common/string.hpp"
 #include "common/timer.hpp"
 #include "crypto/ecdsa.hpp"
 #include "net/dns_types.hpp"
@@ -102,6 +105,125 @@ class RoutingManager;
 
 namespace Srp {
 
+/**
+ * Implements a priority queue of lease expiry deadlines.
+ *
+ * The queue is an intrusive pairing heap: each queued object derives from `LeaseExpiryQueue::Entry` which holds its
+ * deadline and the links into the heap, so no memory is allocated when adding, updating or removing entries. Getting
+ * the entry with the earliest deadline is O(1), and adding, updating or removing an entry is O(log n) amortized.
+ *
+ */
+class LeaseExpiryQueue : private NonCopyable
+{
+public:
+    /**
+     * Represents an entry in a `LeaseExpiryQueue`.
+     *
+     */
+    class Entry
+    {
+        friend class LeaseExpiryQueue;
+
+    public:
+        /**
+         * Initializes the `Entry` as not queued.
+         *
+         */
+        Entry(void)
+            : mChild(nullptr)
+            , mSibling(nullptr)
+            , mPrev(nullptr)
+            , mIsQueued(false)
+        {
+        }
+
+        /**
+         * Returns the deadline of the entry.
+         *
+         * @returns The deadline of the entry (only valid when the entry is queued).
+         *
+         */
+        TimeMilli GetDeadline(void) const { return mDeadline; }
+
+        /**
+         * Indicates whether or not the entry is in a queue.
+         *
+         * @retval TRUE   The entry is in a queue.
+         * @retval FALSE  The entry is not in a queue.
+         *
+         */
+        bool IsQueued(void) const { return mIsQueued; }
+
+    private:
+        TimeMilli mDeadline;
+        Entry    *mChild;   // First (leftmost) child.
+        Entry    *mSibling; // Next sibling (to the right).
+        Entry    *mPrev;    // Previous sibling, or the parent if this is the leftmost child.
+        bool      mIsQueued;
+    };
+
+    /**
+     * Initializes the `LeaseExpiryQueue` as empty.
+     *
+     */
+    LeaseExpiryQueue(void)
+        : mRoot(nullptr)
+        , mNumEntries(0)
+    {
+    }
+
+    /**
+     * Indicates whether or not the queue is empty.
+     *
+     * @retval TRUE   The queue is empty.
+     * @retval FALSE  The queue is not empty.
+     *
+     */
+    bool IsEmpty(void) const { return (mRoot == nullptr); }
+
+    /**
+     * Returns the number of entries in the queue.
+     *
+     * @returns The number of entries in the queue.
+     *
+     */
+    uint32_t GetNumEntries(void) const { return mNumEntries; }
+
+    /**
+     * Returns the entry with the earliest deadline.
+     *
+     * @returns A pointer to the entry with the earliest deadline, or `nullptr` if the queue is empty.
+     *
+     */
+    Entry *GetTop(void) const { return mRoot; }
+
+    /**
+     * Adds an entry to the queue or, if it is already queued, moves it to a new deadline.
+     *
+     * @param[in] aEntry     The entry to add or update.
+     * @param[in] aDeadline  The new deadline of @p aEntry.
+     *
+     */
+    void Update(Entry &aEntry, TimeMilli aDeadline);
+
+    /**
+     * Removes an entry from the queue.
+     *
+     * Does nothing if @p aEntry is not queued.
+     *
+     * @param[in] aEntry  The entry to remove.
+     *
+     */
+    void Remove(Entry &aEntry);
+
+private:
+    static Entry *Meld(Entry *aFirst, Entry *aSecond);
+    static Entry *MergePairs(Entry *aFirst);
+
+    Entry   *mRoot;
+    uint32_t mNumEntries;
+};
+
 /**
  * Implements the SRP server.
  *
@@ -181,6 +303,7 @@ public:
     class Service : public otSrpServerService,
                     public LinkedListEntry<Service>,
                     public Heap::Allocatable<Service>,
+                    private LeaseExpiryQueue::Entry,
                     private NonCopyable
     {
         friend class Server;
@@ -445,11 +568,14 @@ public:
         Error Init(const char *aServiceName, Description &aDescription, bool aIsSubType, TimeMilli aUpdateTime);
         bool  MatchesFlags(Flags aFlags) const;
         const TimeMilli &GetUpdateTime(void) const { return mUpdateTime; }
+        TimeMilli        GetNextExpireTime(void) const;
         void             Log(Action aAction) const;
 
         Heap::String           mServiceName;
         RetainPtr<Description> mDescription;
         Service               *mNext;
+        Service               *mNextInInstanceNameIndex;
+        Service               *mNextInServiceNameIndex;
         TimeMilli              mUpdateTime;
         bool                   mIsDeleted : 1;
         bool                   mIsSubType : 1;
@@ -464,6 +590,7 @@ public:
                  public InstanceLocator,
                  public LinkedListEntry<Host>,
                  public Heap::Allocatable<Host>,
+                 private LeaseExpiryQueue::Entry,
                  private NonCopyable
     {
         friend class Server;
@@ -611,6 +738,8 @@ public:
         bool  ShouldUseShortLeaseOption(void) const { return mUseShortLeaseOption; }
         Error ProcessTtl(uint32_t aTtl);
 
+        TimeMilli GetNextExpireTime(void) const;
+
         LinkedList<Service> &GetServices(void) { return mServices; }
         Service             *AddNewService(const char *aServiceName,
                                            const char *aInstanceName,
@@ -633,6 +762,7 @@ public:
         const Service                        *FindBaseService(const char *aInstanceName) const;
 
         Host                     *mNext;
+        Host                     *mNextInNameIndex;
         Heap::String              mFullName;
         Heap::Array<Ip6::Address> mAddresses;
 
@@ -645,6 +775,10 @@ public:
         TimeMilli              mUpdateTime;
         LinkedList<Service>    mServices;
         bool                   mUseShortLeaseOption; // Use short lease option (lease only - 4 byte) when responding.
+        bool                   mIsIndexed;           // Host and its services are in the server name indexes.
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+        bool mIsSavePending; // Host has changes not yet saved in settings.
+#endif
     };
 
     /**
@@ -915,6 +1049,51 @@ public:
      */
     const Host *GetNextHost(const Host *aHost);
 
+    /**
+     * Finds a registered SRP host by its full name.
+     *
+     * The returned host may be deleted (its name is retained), use `Host::IsDeleted()` to check.
+     *
+     * @param[in]  aFullName  The full host name.
+     *
+     * @returns  A pointer to the SRP host or `nullptr` if no host with @p aFullName is registered.
+     *
+     */
+    const Host *FindHost(const char *aFullName) const;
+
+    /**
+     * Finds a registered SRP host by its full name.
+     *
+     * The returned host may be deleted (its name is retained), use `Host::IsDeleted()` to check.
+     *
+     * @param[in]  aFullName  The full host name.
+     *
+     * @returns  A pointer to the SRP host or `nullptr` if no host with @p aFullName is registered.
+     *
+     */
+    Host *FindHost(const char *aFullName) { return AsNonConst(AsConst(this)->FindHost(aFullName)); }
+
+    /**
+     * Finds the next matching service across all registered SRP hosts.
+     *
+     * The services are looked up using the server name indexes: by @p aInstanceName if not `nullptr`, otherwise by
+     * @p aServiceName. So the cost depends on the number of matching services and not on the total number of
+     * registered services. The same names and flags MUST be used when iterating over the matching services.
+     *
+     * @param[in] aPrevService   A pointer to the previous service or `nullptr` to start from the first one.
+     * @param[in] aFlags         Flags indicating which services to include (base/sub-type, active/deleted).
+     * @param[in] aServiceName   The service name to match. Set to `nullptr` to accept any name.
+     * @param[in] aInstanceName  The service instance name to match. Set to `nullptr` to accept any name.
+     *
+     * @returns  A pointer to the next matching service or `nullptr` if no matching service could be found (or if
+     *           both @p aServiceName and @p aInstanceName are `nullptr`).
+     *
+     */
+    const Service *FindNextService(const Service *aPrevService,
+                                   Service::Flags aFlags,
+                                   const char    *aServiceName,
+                                   const char    *aInstanceName) const;
+
     /**
      * Returns the response counters of the SRP server.
      *
@@ -923,6 +1102,14 @@ public:
      */
     const otSrpServerResponseCounters *GetResponseCounters(void) const { return &mResponseCounters; }
 
+    /**
+     * Returns the lease expiry counters of the SRP server.
+     *
+     * @returns  A pointer to the lease expiry counters of the SRP server.
+     *
+     */
+    const otSrpServerLeaseCounters *GetLeaseCounters(void) const { return &mLeaseCounters; }
+
     /**
      * Receives the service update result from service handler set by
      * SetServiceHandler.
@@ -949,6 +1136,37 @@ private:
 
     static constexpr uint16_t kAnycastAddressModePort = 53;
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+    // Host records saved in `Settings` (see `AppendHostRecord()`).
+    enum RecordType : uint8_t
+    {
+        kRecordTypeHost        = 1, // Host with all its services.
+        kRecordTypeRemovedHost = 2, // Hosts fully removed (only their names are saved).
+    };
+
+    static constexpr uint8_t kHostFlagShortLeaseOption = (1 << 0);
+    static constexpr uint8_t kServiceFlagSubType       = (1 << 0);
+    static constexpr uint8_t kServiceFlagDeleted       = (1 << 1);
+
+    // A host record is saved as one or more `Settings` entries since
+    // the flash settings driver limits an entry to 255 bytes. Each
+    // entry starts with a flags byte indicating whether more entries
+    // of the same record follow.
+    static constexpr uint16_t kMaxRecordEntrySize  = 255;
+    static constexpr uint8_t  kRecordEntryFlagMore = (1 << 0);
+    static constexpr uint16_t kMaxRecordEntries    = OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_MAX_ENTRIES;
+
+    // Records are compacted when the number of entries exceeds twice
+    // the number after the last compaction plus `kMinEntriesToCompact`
+    // (a quarter of the entries limit, so that it can be reached).
+    // A compaction leaving less room than that is at the limit.
+    static constexpr uint16_t kMinEntriesToCompact = kMaxRecordEntries / 4;
+
+    // Changed hosts are saved together once `kSaveDelay` elapses
+    // after the first change (or at the end of a lease timer run).
+    static constexpr uint32_t kSaveDelay = OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_SAVE_DELAY;
+#endif
+
     // Metadata for a received SRP Update message.
     struct MessageMetadata
     {
@@ -965,6 +1183,154 @@ private:
         const Ip6::MessageInfo *mMessageInfo; // Set to `nullptr` when from SRPL.
     };
 
+    // This class indexes hosts or services by a name (host full name,
+    // service instance name or service name) in a hash table. Entries
+    // in the same bucket are chained through `kNextMember`. The bucket
+    // array starts inline and is reallocated from heap (doubling its
+    // size) as entries are added, so that the chains stay short. If a
+    // reallocation fails, the current buckets continue to be used.
+    template <typename Type, Type *Type::*kNextMember, const char *(Type::*kGetName)(void) const>
+    class NameIndex : private NonCopyable
+    {
+    public:
+        NameIndex(void)
+            : mBuckets(mInlineBuckets)
+            , mNumBuckets(kNumInlineBuckets)
+            , mNumEntries(0)
+        {
+            for (Type *&bucket : mInlineBuckets)
+            {
+                bucket = nullptr;
+            }
+        }
+
+        ~NameIndex(void) { FreeBuckets(); }
+
+        uint32_t GetNumEntries(void) const { return mNumEntries; }
+        uint32_t GetNumBuckets(void) const { return mNumBuckets; }
+
+        Type *FindFirst(const char *aName) const { return FindFrom(GetBucket(aName), aName); }
+        Type *FindNext(const Type &aPrevEntry, const char *aName) const
+        {
+            return FindFrom(aPrevEntry.*kNextMember, aName);
+        }
+
+        void Add(Type &aEntry)
+        {
+            Type *&bucket = GetBucket((aEntry.*kGetName)());
+
+            aEntry.*kNextMember = bucket;
+            bucket              = &aEntry;
+            mNumEntries++;
+
+            if ((mNumEntries > mNumBuckets * kMaxLoadFactor) && (mNumBuckets < kMaxNumBuckets))
+            {
+                Grow();
+            }
+        }
+
+        void Remove(Type &aEntry)
+        {
+            for (Type **link = &GetBucket((aEntry.*kGetName)()); *link != nullptr; link = &((*link)->*kNextMember))
+            {
+                if (*link == &aEntry)
+                {
+                    *link               = aEntry.*kNextMember;
+                    aEntry.*kNextMember = nullptr;
+                    mNumEntries--;
+                    break;
+                }
+            }
+
+            if (mNumEntries == 0)
+            {
+                FreeBuckets();
+            }
+        }
+
+    private:
+        static constexpr uint32_t kNumInlineBuckets = 16;   // Must be a power of two.
+        static constexpr uint32_t kMaxNumBuckets    = 8192; // Must be a power of two.
+        static constexpr uint32_t kMaxLoadFactor    = 2;    // Max average number of entries per bucket.
+
+        static uint32_t CalculateHash(const char *aName)
+        {
+            // Names are matched case-insensitively, so the
+            // hash is calculated over the lowercase chars.
+
+            uint32_t hash = 0;
+
+            for (; *aName != kNullChar; aName++)
+            {
+                hash = hash * 31 + static_cast<uint8_t>(ToLowercase(*aName));
+            }
+
+            return hash;
+        }
+
+        Type *&GetBucket(const char *aName) const { return mBuckets[CalculateHash(aName) & (mNumBuckets - 1)]; }
+
+        static Type *FindFrom(Type *aEntry, const char *aName)
+        {
+            while ((aEntry != nullptr) && !StringMatch((aEntry->*kGetName)(), aName, kStringCaseInsensitiveMatch))
+            {
+                aEntry = aEntry->*kNextMember;
+            }
+
+            return aEntry;
+        }
+
+        void Grow(void)
+        {
+            uint32_t numBuckets = mNumBuckets * 2;
+            Type   **buckets    = static_cast<Type **>(Heap::CAlloc(numBuckets, sizeof(Type *)));
+
+            VerifyOrExit(buckets != nullptr);
+
+            for (uint32_t index = 0; index < mNumBuckets; index++)
+            {
+                while (mBuckets[index] != nullptr)
+                {
+                    Type  *entry  = mBuckets[index];
+                    Type *&bucket = buckets[CalculateHash((entry->*kGetName)()) & (numBuckets - 1)];
+
+                    mBuckets[index]     = entry->*kNextMember;
+                    entry->*kNextMember = bucket;
+                    bucket              = entry;
+                }
+            }
+
+            FreeBuckets();
+            mBuckets    = buckets;
+            mNumBuckets = numBuckets;
+
+        exit:
+            return;
+        }
+
+        void FreeBuckets(void)
+        {
+            // Releases the heap allocated buckets (if any) and
+            // switches back to the (empty) inline buckets.
+
+            if (mBuckets != mInlineBuckets)
+            {
+                Heap::Free(mBuckets);
+                mBuckets    = mInlineBuckets;
+                mNumBuckets = kNumInlineBuckets;
+            }
+        }
+
+        Type   **mBuckets;
+        uint32_t mNumBuckets;
+        uint32_t mNumEntries;
+        Type    *mInlineBuckets[kNumInlineBuckets];
+    };
+
+    using HostNameIndex     = NameIndex<Host, &Host::mNextInNameIndex, &Host::GetFullName>;
+    using InstanceNameIndex = NameIndex<Service, &Service::mNextInInstanceNameIndex, &Service::GetInstanceName>;
+    using ServiceNameIndex  = NameIndex<Service, &Service::mNextInServiceNameIndex, &Service::GetServiceName>;
+
     // This class includes metadata for processing a SRP update (register, deregister)
     // and sending DNS response to the client.
     class UpdateMetadata : public InstanceLocator,
@@ -1011,6 +1377,7 @@ private:
     void  HandleDnssdServerStateChange(void);
     Error HandleDnssdServerUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
 #endif
+    void InvalidateDnssdAnswers(const Host &aHost);
 
     void HandleNetDataPublisherEvent(NetworkData::Publisher::Event aEvent);
 
@@ -1056,6 +1423,13 @@ private:
     void        HandleUpdate(Host &aHost, const MessageMetadata &aMetadata);
     void        AddHost(Host &aHost);
     void        RemoveHost(Host *aHost, RetainName aRetainName, NotifyMode aNotifyServiceHandler);
+    void        AddToIndexes(Host &aHost);
+    void        RemoveFromIndexes(Host &aHost);
+    void        AddToIndexes(Service &aService);
+    void        RemoveFromIndexes(Service &aService);
+    void        UpdateLeaseExpiry(Host &aHost);
+    void        UpdateLeaseExpiry(Service &aService);
+    void        ScheduleLeaseTimer(void);
     bool        HasNameConflictsWith(Host &aHost) const;
     void        SendResponse(const Dns::UpdateHeader    &aHeader,
                              Dns::UpdateHeader::Response aResponseCode,
@@ -1068,6 +1442,7 @@ private:
     static void HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo);
     void        HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
     void        HandleLeaseTimer(void);
+    void        ExpireLeases(NotifyMode aNotifyServiceHandler);
     static void HandleOutstandingUpdatesTimer(Timer &aTimer);
     void        HandleOutstandingUpdatesTimer(void);
 
@@ -1077,8 +1452,33 @@ private:
 
     void UpdateResponseCounters(Dns::Header::Response aResponseCode);
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+    void         SaveHost(Host &aHost);
+    void         SaveHostRemoval(const Host &aHost);
+    void         SavePendingHostRecords(void);
+    void         HandleSaveTimer(void);
+    Error        AddHostRecord(const Host &aHost);
+    Error        AddRemovedHostsRecord(void);
+    Error        AddRecordEntries(const Message &aMessage);
+    Error        AppendHostRecord(Message &aMessage, const Host &aHost) const;
+    void         CompactHostRecords(void);
+    void         DeleteHostRecords(void);
+    void         RestoreHosts(void);
+    Error        RestoreHost(uint16_t &aEntryIndex, TimeMilli aSaveTime);
+    Error        ReadHostRecord(FrameData &aFrameData, TimeMilli aSaveTime, Host &aHost) const;
+    static Error AppendRecordString(Message &aMessage, const char *aString);
+    static Error ReadRecordString(FrameData &aFrameData, char *aString, uint16_t aSize);
+#else
+    void SaveHost(Host &) {}
+    void SaveHostRemoval(const Host &) {}
+    void SavePendingHostRecords(void) {}
+#endif
+
     using LeaseTimer  = TimerMilliIn<Server, &Server::HandleLeaseTimer>;
     using UpdateTimer = TimerMilliIn<Server, &Server::HandleOutstandingUpdatesTimer>;
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+    using SaveTimer = TimerMilliIn<Server, &Server::HandleSaveTimer>;
+#endif
 
     Ip6::Udp::Socket mSocket;
 
@@ -1089,8 +1489,13 @@ private:
     TtlConfig   mTtlConfig;
     LeaseConfig mLeaseConfig;
 
-    LinkedList<Host> mHosts;
-    LeaseTimer       mLeaseTimer;
+    LinkedList<Host>  mHosts;
+    HostNameIndex     mHostNameIndex;
+    InstanceNameIndex mInstanceNameIndex;
+    ServiceNameIndex  mServiceNameIndex;
+    LeaseExpiryQueue  mHostExpiryQueue;
+    LeaseExpiryQueue  mServiceExpiryQueue;
+    LeaseTimer        mLeaseTimer;
 
     UpdateTimer                mOutstandingUpdatesTimer;
     LinkedList<UpdateMetadata> mOutstandingUpdates;
@@ -1106,6 +1511,17 @@ private:
 #endif
 
     otSrpServerResponseCounters mResponseCounters;
+    otSrpServerLeaseCounters    mLeaseCounters;
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+    uint16_t                  mNumRecordEntries;
+    uint16_t                  mNumCompactedEntries;
+    bool                      mRecordsAtLimit;
+    bool                      mShouldCompactRecords;
+    bool                      mHasStopTime;
+    TimeMilli                 mStopTime;
+    Heap::Array<Heap::String> mRemovedHostNames;
+    SaveTimer                 mSaveTimer;
+#endif
 };
 
 } // namespace Srp
@@ -212,6 +212,9 @@ Error Udp::Bind(SocketHandle &aSocket, const SockAddr &aSockAddr, NetifIdentifie
                  error = kErrorInvalidArgs);
 
     aSocket.mSockName = aSockAddr;
+#if OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_ENABLE
+    mSocketIndex.Invalidate();
+#endif
 
     if (!aSocket.IsBound())
     {
@@ -371,6 +374,10 @@ void Udp::AddSocket(SocketHandle &aSocket)
 {
     SuccessOrExit(mSockets.Add(aSocket));
 
+#if OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_ENABLE
+    mSocketIndex.Invalidate();
+#endif
+
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
     if (mPrevBackboneSockets == nullptr)
     {
@@ -390,6 +397,10 @@ void Udp::RemoveSocket(SocketHandle &aSocket)
     mSockets.PopAfter(prev);
     aSocket.SetNext(nullptr);
 
+#if OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_ENABLE
+    mSocketIndex.HandleSocketRemoved();
+#endif
+
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
     if (&aSocket == mPrevBackboneSockets)
     {
@@ -490,44 +501,71 @@ exit:
 
 void Udp::HandlePayload(Message &aMessage, MessageInfo &aMessageInfo)
 {
-    SocketHandle *socket;
-    SocketHandle *prev;
+    SocketHandle *socket = FindMatchingSocket(aMessageInfo);
+
+    VerifyOrExit(socket != nullptr);
+
+    aMessage.RemoveHeader(aMessage.GetOffset());
+    OT_ASSERT(aMessage.GetOffset() == 0);
+    socket->HandleUdpReceive(aMessage, aMessageInfo);
+
+exit:
+    return;
+}
+
+Udp::SocketHandle *Udp::FindMatchingSocket(const MessageInfo &aMessageInfo)
+{
+    SocketHandle       *socket;
+    SocketHandle       *prev;
+    const SocketHandle *backboneSockets = nullptr;
+    bool                isBackbone      = false;
 
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
+    backboneSockets = GetBackboneSockets();
+    isBackbone      = aMessageInfo.IsHostInterface();
+#endif
+
+#if OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_ENABLE
+    if (mSocketIndex.ShouldBuild())
     {
-        const SocketHandle *socketsBegin, *socketsEnd;
+        mSocketIndex.Build(mSockets.GetHead(), backboneSockets);
+    }
 
-        if (!aMessageInfo.IsHostInterface())
-        {
-            socketsBegin = mSockets.GetHead();
-            socketsEnd   = GetBackboneSockets();
-        }
-        else
-        {
-            socketsBegin = GetBackboneSockets();
-            socketsEnd   = nullptr;
-        }
+    // If there are more open sockets than the index can hold, fall
+    // back to searching the list.
 
-        socket = mSockets.FindMatching(socketsBegin, socketsEnd, aMessageInfo, prev);
+    if (mSocketIndex.IsValid())
+    {
+        ExitNow(socket = mSocketIndex.FindMatching(aMessageInfo, isBackbone));
     }
-#else
-    socket = mSockets.FindMatching(aMessageInfo, prev);
 #endif
 
-    VerifyOrExit(socket != nullptr);
+    if (!isBackbone)
+    {
+        socket = mSockets.FindMatching(mSockets.GetHead(), backboneSockets, aMessageInfo, prev);
+    }
+    else
+    {
+        socket = mSockets.FindMatching(backboneSockets, nullptr, aMessageInfo, prev);
+    }
 
-    aMessage.RemoveHeader(aMessage.GetOffset());
-    OT_ASSERT(aMessage.GetOffset() == 0);
-    socket->HandleUdpReceive(aMessage, aMessageInfo);
+    ExitNow();
 
 exit:
-    return;
+    return socket;
 }
 
 bool Udp::IsPortInUse(uint16_t aPort) const
 {
     bool found = false;
 
+#if OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_ENABLE
+    if (mSocketIndex.IsValid())
+    {
+        ExitNow(found = mSocketIndex.ContainsPort(aPort));
+    }
+#endif
+
     for (const SocketHandle &socket : mSockets)
     {
         if (socket.GetSockName().GetPort() == aPort)
@@ -537,6 +575,9 @@ bool Udp::IsPortInUse(uint16_t aPort) const
         }
     }
 
+    ExitNow();
+
+exit:
     return found;
 }
 
@@ -572,5 +613,126 @@ bool Udp::ShouldUsePlatformUdp(const Udp::SocketHandle &aSocket) const
 }
 #endif // OPENTHREAD_CONFIG_PLATFORM_UDP_ENABLE
 
+#if OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_ENABLE
+
+void Udp::SocketIndex::Build(SocketHandle *aHead, const SocketHandle *aBackboneSockets)
+{
+    uint16_t rangeStart = 0;
+
+    mNumSockets       = 0;
+    mNumThreadSockets = 0;
+    mState            = kStateOverflow;
+
+    for (SocketHandle *socket = aHead; socket != nullptr; socket = socket->GetNext())
+    {
+        uint16_t index;
+
+        if (socket == aBackboneSockets)
+        {
+            rangeStart = mNumSockets;
+        }
+
+        VerifyOrExit(mNumSockets < kMaxSockets);
+
+        // Insert after all entries with the same port, so that
+        // sockets with the same port keep their list order.
+
+        index = FindAfterLast(rangeStart, mNumSockets, socket->GetSockName().GetPort());
+
+        for (uint16_t i = mNumSockets; i > index; i--)
+        {
+            mSockets[i] = mSockets[i - 1];
+        }
+
+        mSockets[index] = socket;
+        mNumSockets++;
+    }
+
+    mNumThreadSockets = (aBackboneSockets != nullptr) ? rangeStart : mNumSockets;
+    mState            = kStateValid;
+
+exit:
+    return;
+}
+
+Udp::SocketHandle *Udp::SocketIndex::FindMatching(const MessageInfo &aMessageInfo, bool aIsBackbone) const
+{
+    SocketHandle *socket = nullptr;
+    uint16_t      start  = aIsBackbone ? mNumThreadSockets : 0;
+    uint16_t      end    = aIsBackbone ? mNumSockets : mNumThreadSockets;
+    uint16_t      port   = aMessageInfo.GetSockPort();
+
+    for (uint16_t index = FindFirst(start, end, port); index < end; index++)
+    {
+        if (mSockets[index]->GetSockName().GetPort() != port)
+        {
+            break;
+        }
+
+        if (mSockets[index]->Matches(aMessageInfo))
+        {
+            socket = mSockets[index];
+            break;
+        }
+    }
+
+    return socket;
+}
+
+bool Udp::SocketIndex::ContainsPort(uint16_t aPort) const
+{
+    uint16_t threadIndex   = FindFirst(0, mNumThreadSockets, aPort);
+    uint16_t backboneIndex = FindFirst(mNumThreadSockets, mNumSockets, aPort);
+
+    return ((threadIndex < mNumThreadSockets) && (mSockets[threadIndex]->GetSockName().GetPort() == aPort)) ||
+           ((backboneIndex < mNumSockets) && (mSockets[backboneIndex]->GetSockName().GetPort() == aPort));
+}
+
+uint16_t Udp::SocketIndex::FindFirst(uint16_t aStart, uint16_t aEnd, uint16_t aPort) const
+{
+    // Returns the index of the first entry in `[aStart, aEnd)` whose
+    // port is not less than `aPort`.
+
+    while (aStart < aEnd)
+    {
+        uint16_t mid = aStart + (aEnd - aStart) / 2;
+
+        if (mSockets[mid]->GetSockName().GetPort() < aPort)
+        {
+            aStart = mid + 1;
+        }
+        else
+        {
+            aEnd = mid;
+        }
+    }
+
+    return aStart;
+}
+
+uint16_t Udp::SocketIndex::FindAfterLast(uint16_t aStart, uint16_t aEnd, uint16_t aPort) const
+{
+    // Returns the index of the first entry in `[aStart, aEnd)` whose
+    // port is greater than `aPort`.
+
+    while (aStart < aEnd)
+    {
+        uint16_t mid = aStart + (aEnd - aStart) / 2;
+
+        if (mSockets[mid]->GetSockName().GetPort() <= aPort)
+        {
+            aStart = mid + 1;
+        }
+        else
+        {
+            aEnd = mid;
+        }
+    }
+
+    return aStart;
+}
+
+#endif // OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_ENABLE
+
 } // namespace Ip6
 } // namespace ot
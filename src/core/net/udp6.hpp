@@ -48,6 +48,9 @@
 #include "net/ip6_headers.hpp"
 
 namespace ot {
+
+class UnitTester;
+
 namespace Ip6 {
 
 class Udp;
@@ -83,6 +86,8 @@ enum NetifIdentifier : uint8_t
  */
 class Udp : public InstanceLocator, private NonCopyable
 {
+    friend class ot::UnitTester;
+
 public:
     /**
      * Implements a UDP/IPv6 socket.
@@ -666,8 +671,9 @@ private:
 
     static bool IsPortReserved(uint16_t aPort);
 
-    void AddSocket(SocketHandle &aSocket);
-    void RemoveSocket(SocketHandle &aSocket);
+    void          AddSocket(SocketHandle &aSocket);
+    void          RemoveSocket(SocketHandle &aSocket);
+    SocketHandle *FindMatchingSocket(const MessageInfo &aMessageInfo);
 #if OPENTHREAD_CONFIG_PLATFORM_UDP_ENABLE
     bool ShouldUsePlatformUdp(const SocketHandle &aSocket) const;
 #endif
@@ -678,12 +684,65 @@ private:
     bool                IsBackboneSocket(const SocketHandle &aSocket) const;
 #endif
 
+#if OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_ENABLE
+    // Index of open sockets sorted by local port, which is rebuilt
+    // from `mSockets` on first use after any change to the list or
+    // to the local address of a socket. Sockets with the same port
+    // keep their relative order in `mSockets`, and the Thread and
+    // backbone sockets are indexed in two separate ranges, so the
+    // first matching socket is the same as in a list traversal.
+    //
+    // If there are more open sockets than the index can hold, it
+    // enters the overflow state and is not rebuilt (the list is
+    // searched instead) until a socket is removed.
+    class SocketIndex
+    {
+    public:
+        SocketIndex(void)
+            : mNumSockets(0)
+            , mNumThreadSockets(0)
+            , mState(kStateInvalid)
+        {
+        }
+
+        bool          IsValid(void) const { return (mState == kStateValid); }
+        bool          IsOverflowed(void) const { return (mState == kStateOverflow); }
+        bool          ShouldBuild(void) const { return (mState == kStateInvalid); }
+        void          Invalidate(void) { mState = IsOverflowed() ? kStateOverflow : kStateInvalid; }
+        void          HandleSocketRemoved(void) { mState = kStateInvalid; }
+        void          Build(SocketHandle *aHead, const SocketHandle *aBackboneSockets);
+        SocketHandle *FindMatching(const MessageInfo &aMessageInfo, bool aIsBackbone) const;
+        bool          ContainsPort(uint16_t aPort) const;
+
+    private:
+        static constexpr uint16_t kMaxSockets = OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE;
+
+        uint16_t FindFirst(uint16_t aStart, uint16_t aEnd, uint16_t aPort) const;
+        uint16_t FindAfterLast(uint16_t aStart, uint16_t aEnd, uint16_t aPort) const;
+
+        enum State : uint8_t
+        {
+            kStateInvalid,
+            kStateValid,
+            kStateOverflow,
+        };
+
+        SocketHandle *mSockets[kMaxSockets];
+        uint16_t      mNumSockets;
+        uint16_t      mNumThreadSockets;
+        State         mState;
+    };
+#endif
+
     uint16_t                 mEphemeralPort;
     LinkedList<Receiver>     mReceivers;
     LinkedList<SocketHandle> mSockets;
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
     SocketHandle *mPrevBackboneSockets;
 #endif
+#if OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_ENABLE
+    SocketIndex mSocketIndex;
+#endif
 #if OPENTHREAD_CONFIG_UDP_FORWARD_ENABLE
     Callback<otUdpForwarder> mUdpForwarder;
 #endif
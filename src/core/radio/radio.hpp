@@ -673,6 +673,25 @@ public:
      */
     void ClearSrcMatchExtEntries(void);
 
+    /**
+     * Begins a batch of source address match updates.
+     *
+     * The source address match table changes and the enabling/disabling of the source address match feature until
+     * `CommitSrcMatchUpdate()` may be applied by the radio at once.
+     *
+     */
+    void BeginSrcMatchUpdate(void);
+
+    /**
+     * Commits the source address match updates since `BeginSrcMatchUpdate()`.
+     *
+     * @retval kErrorNone     Successfully applied all the updates.
+     * @retval kErrorNoBufs   No available entry in the source match table for some of the added addresses.
+     * @retval kErrorFailed   Failed to apply the updates.
+     *
+     */
+    Error CommitSrcMatchUpdate(void);
+
     /**
      * Gets the radio supported channel mask that the device is allowed to be on.
      *
@@ -909,6 +928,10 @@ inline void Radio::ClearSrcMatchShortEntries(void) { otPlatRadioClearSrcMatchSho
 
 inline void Radio::ClearSrcMatchExtEntries(void) { otPlatRadioClearSrcMatchExtEntries(GetInstancePtr()); }
 
+inline void Radio::BeginSrcMatchUpdate(void) { otPlatRadioBeginSrcMatchUpdate(GetInstancePtr()); }
+
+inline Error Radio::CommitSrcMatchUpdate(void) { return otPlatRadioCommitSrcMatchUpdate(GetInstancePtr()); }
+
 #else //----------------------------------------------------------------------------------------------------------------
 
 inline otRadioCaps Radio::GetCaps(void)
@@ -998,6 +1021,10 @@ inline void Radio::ClearSrcMatchShortEntries(void) {}
 
 inline void Radio::ClearSrcMatchExtEntries(void) {}
 
+inline void Radio::BeginSrcMatchUpdate(void) {}
+
+inline Error Radio::CommitSrcMatchUpdate(void) { return kErrorNone; }
+
 #endif // #if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
 
 } // namespace ot
@@ -234,6 +234,15 @@ OT_TOOL_WEAK void otPlatRadioSetMacFrameCounterIfLarger(otInstance *aInstance, u
     otPlatRadioSetMacFrameCounter(aInstance, aMacFrameCounter);
 }
 
+OT_TOOL_WEAK void otPlatRadioBeginSrcMatchUpdate(otInstance *aInstance) { OT_UNUSED_VARIABLE(aInstance); }
+
+OT_TOOL_WEAK otError otPlatRadioCommitSrcMatchUpdate(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    return OT_ERROR_NONE;
+}
+
 OT_TOOL_WEAK uint64_t otPlatTimeGet(void) { return UINT64_MAX; }
 
 OT_TOOL_WEAK uint64_t otPlatRadioGetNow(otInstance *aInstance)
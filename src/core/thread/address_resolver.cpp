@@ -34,6 +34,7 @@
 #include "address_resolver.hpp"
 
 #include "coap/coap_message.hpp"
+#include "common/array.hpp"
 #include "common/as_core_type.hpp"
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
@@ -56,10 +57,14 @@ AddressResolver::AddressResolver(Instance &aInstance)
     : InstanceLocator(aInstance)
 #if OPENTHREAD_FTD
     , mCacheEntryPool(aInstance)
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_INDEX_ENABLE
+    , mCacheIndex(mCacheEntryPool)
+#endif
     , mIcmpHandler(&AddressResolver::HandleIcmpReceive, this)
 #endif
 {
 #if OPENTHREAD_FTD
+    mCounters.Clear();
     IgnoreError(Get<Ip6::Icmp>().RegisterHandler(mIcmpHandler));
 #endif
 }
@@ -84,8 +89,53 @@ void AddressResolver::Clear(void)
             mCacheEntryPool.Free(*entry);
         }
     }
+
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_INDEX_ENABLE
+    mCacheIndex.Clear();
+#endif
+}
+
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_DYNAMIC_SIZE_ENABLE
+
+Error AddressResolver::SetCacheSize(uint16_t aSize)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(Get<Mle::MleRouter>().IsDisabled(), error = kErrorInvalidState);
+    VerifyOrExit((aSize != 0) && (aSize <= kMaxCacheEntries), error = kErrorInvalidArgs);
+
+    Clear();
+    error = AllocateCache(aSize);
+
+exit:
+    return error;
+}
+
+Error AddressResolver::AllocateCache(uint16_t aSize)
+{
+    // All entries MUST be free when this method is called.
+
+    Error error;
+
+    SuccessOrExit(error = mCacheEntryPool.Allocate(aSize));
+
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_INDEX_ENABLE
+    error = mCacheIndex.Allocate(aSize);
+
+    if (error != kErrorNone)
+    {
+        // Release the entries so that the index is never smaller
+        // than the pool. Allocation is tried again on next use.
+        mCacheEntryPool.Release();
+    }
+#endif
+
+exit:
+    return error;
 }
 
+#endif // OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_DYNAMIC_SIZE_ENABLE
+
 Error AddressResolver::GetNextCacheEntry(EntryInfo &aInfo, Iterator &aIterator) const
 {
     Error                 error = kErrorNone;
@@ -207,7 +257,20 @@ AddressResolver::CacheEntry *AddressResolver::FindCacheEntry(const Ip6::Address
                                                              CacheEntryList    *&aList,
                                                              CacheEntry        *&aPrevEntry)
 {
-    CacheEntry     *entry   = nullptr;
+    CacheEntry *entry = nullptr;
+
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_INDEX_ENABLE
+    // Find the entry from the index. The entry tracks its list and
+    // previous entry, so no list is searched.
+
+    entry = mCacheIndex.Find(aEid);
+    VerifyOrExit(entry != nullptr);
+
+    aList      = entry->GetList();
+    aPrevEntry = (aList->GetHead() == entry) ? nullptr : entry->GetPrev();
+
+    OT_ASSERT((aPrevEntry == nullptr) || (aPrevEntry->GetNext() == entry));
+#else
     CacheEntryList *lists[] = {&mCachedList, &mSnoopedList, &mQueryList, &mQueryRetryList};
 
     for (CacheEntryList *list : lists)
@@ -216,6 +279,7 @@ AddressResolver::CacheEntry *AddressResolver::FindCacheEntry(const Ip6::Address
         entry = aList->FindMatching(aEid, aPrevEntry);
         VerifyOrExit(entry == nullptr);
     }
+#endif
 
 exit:
     return entry;
@@ -272,6 +336,13 @@ AddressResolver::CacheEntry *AddressResolver::NewCacheEntry(bool aSnoopedEntry)
     // can be evicted (e.g., first time query entries can not be
     // evicted till timeout).
 
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_DYNAMIC_SIZE_ENABLE
+    if (!mCacheEntryPool.IsAllocated())
+    {
+        IgnoreError(AllocateCache(mCacheEntryPool.GetSize()));
+    }
+#endif
+
     newEntry = mCacheEntryPool.Allocate();
     VerifyOrExit(newEntry == nullptr);
 
@@ -296,6 +367,7 @@ AddressResolver::CacheEntry *AddressResolver::NewCacheEntry(bool aSnoopedEntry)
         if (newEntry != nullptr)
         {
             RemoveCacheEntry(*newEntry, *list, prevEntry, kReasonEvictingForNewEntry);
+            mCounters.mEvictions++;
             ExitNow();
         }
 
@@ -327,6 +399,7 @@ void AddressResolver::RemoveCacheEntry(CacheEntry     &aEntry,
                                        Reason          aReason)
 {
     aList.PopAfter(aPrevEntry);
+    RemoveFromCacheIndex(aEntry);
 
     if (&aList == &mQueryList)
     {
@@ -336,6 +409,24 @@ void AddressResolver::RemoveCacheEntry(CacheEntry     &aEntry,
     LogCacheEntryChange(kEntryRemoved, aReason, aEntry, &aList);
 }
 
+void AddressResolver::AddToCacheIndex(const CacheEntry &aEntry)
+{
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_INDEX_ENABLE
+    mCacheIndex.Add(aEntry);
+#else
+    OT_UNUSED_VARIABLE(aEntry);
+#endif
+}
+
+void AddressResolver::RemoveFromCacheIndex(const CacheEntry &aEntry)
+{
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_INDEX_ENABLE
+    mCacheIndex.Remove(aEntry);
+#else
+    OT_UNUSED_VARIABLE(aEntry);
+#endif
+}
+
 Error AddressResolver::UpdateCacheEntry(const Ip6::Address &aEid, Mac::ShortAddress aRloc16)
 {
     // This method updates an existing cache entry for the EID (if any).
@@ -431,6 +522,7 @@ void AddressResolver::UpdateSnoopedCacheEntry(const Ip6::Address &aEid,
     }
 
     mSnoopedList.Push(*entry);
+    AddToCacheIndex(*entry);
 
     LogCacheEntryChange(kEntryAdded, kReasonSnoop, *entry);
 
@@ -461,6 +553,9 @@ void AddressResolver::RestartAddressQueries(void)
 
     for (CacheEntry &entry : mQueryList)
     {
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_INDEX_ENABLE
+        entry.SetList(&mQueryList);
+#endif
         IgnoreError(SendAddressQuery(entry.GetTarget()));
 
         entry.SetTimeout(kAddressQueryTimeout);
@@ -490,6 +585,11 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aRlo
 
     entry = FindCacheEntry(aEid, list, prev);
 
+    if ((entry == nullptr) || ((list != &mCachedList) && (list != &mSnoopedList)))
+    {
+        mCounters.mMisses++;
+    }
+
     if (entry == nullptr)
     {
         // If the entry is not present in any of the lists, try to
@@ -511,6 +611,8 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aRlo
 
     if ((list == &mCachedList) || (list == &mSnoopedList))
     {
+        mCounters.mHits++;
+
         // Remove the entry from its current list and push it at the
         // head of cached list.
 
@@ -552,10 +654,21 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aRlo
     entry->SetTimeout(kAddressQueryTimeout);
 
     error = SendAddressQuery(aEid);
-    VerifyOrExit(error == kErrorNone, mCacheEntryPool.Free(*entry));
+
+    if (error != kErrorNone)
+    {
+        if (list != nullptr)
+        {
+            RemoveFromCacheIndex(*entry);
+        }
+
+        mCacheEntryPool.Free(*entry);
+        ExitNow();
+    }
 
     if (list == nullptr)
     {
+        AddToCacheIndex(*entry);
         LogCacheEntryChange(kEntryAdded, kReasonQueryRequest, *entry);
     }
 
@@ -1082,6 +1195,181 @@ void AddressResolver::LogCacheEntryChange(EntryChange, Reason, const CacheEntry
 
 // LCOV_EXCL_STOP
 
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_DYNAMIC_SIZE_ENABLE
+
+//---------------------------------------------------------------------------------------------------------------------
+// AddressResolver::CacheEntryPool
+
+AddressResolver::CacheEntryPool::CacheEntryPool(Instance &aInstance)
+    : mInstance(aInstance)
+    , mEntries(nullptr)
+    , mSize(kCacheEntries)
+{
+}
+
+Error AddressResolver::CacheEntryPool::Allocate(uint16_t aSize)
+{
+    Error       error   = kErrorNone;
+    CacheEntry *entries = static_cast<CacheEntry *>(Heap::CAlloc(aSize, sizeof(CacheEntry)));
+
+    VerifyOrExit(entries != nullptr, error = kErrorNoBufs);
+
+    Release();
+
+    mEntries = entries;
+    mSize    = aSize;
+
+    for (uint16_t i = 0; i < mSize; i++)
+    {
+        mEntries[i].Init(mInstance);
+        mFreeList.Push(mEntries[i]);
+    }
+
+exit:
+    return error;
+}
+
+void AddressResolver::CacheEntryPool::Release(void)
+{
+    Heap::Free(mEntries);
+    mEntries = nullptr;
+    mFreeList.Clear();
+}
+
+#endif // OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_DYNAMIC_SIZE_ENABLE
+
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_INDEX_ENABLE
+
+//---------------------------------------------------------------------------------------------------------------------
+// AddressResolver::CacheIndex
+
+AddressResolver::CacheIndex::CacheIndex(CacheEntryPool &aPool)
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_DYNAMIC_SIZE_ENABLE
+    : mSlots(nullptr)
+    , mNumSlots(0)
+#else
+    : mNumSlots(GetArrayLength(mSlots))
+#endif
+    , mPool(aPool)
+{
+    Clear();
+}
+
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_DYNAMIC_SIZE_ENABLE
+Error AddressResolver::CacheIndex::Allocate(uint16_t aNumEntries)
+{
+    // The table is kept at most half full, so probe sequences
+    // stay short and always end at an empty slot.
+
+    Error     error    = kErrorNone;
+    uint16_t  numSlots = 2 * aNumEntries;
+    uint16_t *slots    = static_cast<uint16_t *>(Heap::CAlloc(numSlots, sizeof(uint16_t)));
+
+    VerifyOrExit(slots != nullptr, error = kErrorNoBufs);
+
+    Heap::Free(mSlots);
+    mSlots    = slots;
+    mNumSlots = numSlots;
+    Clear();
+
+exit:
+    return error;
+}
+#endif
+
+void AddressResolver::CacheIndex::Clear(void)
+{
+    for (uint16_t slot = 0; slot < mNumSlots; slot++)
+    {
+        mSlots[slot] = kEmptySlot;
+    }
+}
+
+uint16_t AddressResolver::CacheIndex::GetHomeSlot(const Ip6::Address &aEid) const
+{
+    uint32_t hash = 0;
+
+    for (uint32_t word : aEid.mFields.m32)
+    {
+        hash = (hash ^ word) * 0x9e3779b1;
+    }
+
+    hash ^= (hash >> 16);
+
+    return static_cast<uint16_t>(hash % mNumSlots);
+}
+
+void AddressResolver::CacheIndex::Add(const CacheEntry &aEntry)
+{
+    uint16_t slot;
+
+    VerifyOrExit(mNumSlots != 0);
+
+    for (slot = GetHomeSlot(aEntry.GetTarget()); mSlots[slot] != kEmptySlot; slot = GetNextSlot(slot))
+    {
+    }
+
+    mSlots[slot] = mPool.GetIndexOf(aEntry);
+
+exit:
+    return;
+}
+
+void AddressResolver::CacheIndex::Remove(const CacheEntry &aEntry)
+{
+    uint16_t entryIndex = mPool.GetIndexOf(aEntry);
+    uint16_t slot;
+
+    VerifyOrExit(mNumSlots != 0);
+
+    for (slot = GetHomeSlot(aEntry.GetTarget()); mSlots[slot] != entryIndex; slot = GetNextSlot(slot))
+    {
+        VerifyOrExit(mSlots[slot] != kEmptySlot);
+    }
+
+    // Remove the entry, then shift back any later entries in the
+    // same probe run.
+
+    mSlots[slot] = kEmptySlot;
+    ShiftBackFrom(slot);
+
+exit:
+    return;
+}
+
+uint16_t AddressResolver::CacheIndex::GetHomeSlotOf(uint16_t aSlot) const
+{
+    return GetHomeSlot(mPool.GetEntryAt(mSlots[aSlot]).GetTarget());
+}
+
+void AddressResolver::CacheIndex::MoveSlot(uint16_t aFromSlot, uint16_t aToSlot)
+{
+    mSlots[aToSlot]   = mSlots[aFromSlot];
+    mSlots[aFromSlot] = kEmptySlot;
+}
+
+AddressResolver::CacheEntry *AddressResolver::CacheIndex::Find(const Ip6::Address &aEid) const
+{
+    CacheEntry *entry = nullptr;
+
+    VerifyOrExit(mNumSlots != 0);
+
+    for (uint16_t slot = GetHomeSlot(aEid); mSlots[slot] != kEmptySlot; slot = GetNextSlot(slot))
+    {
+        CacheEntry &candidate = mPool.GetEntryAt(mSlots[slot]);
+
+        if (candidate.Matches(aEid))
+        {
+            ExitNow(entry = &candidate);
+        }
+    }
+
+exit:
+    return entry;
+}
+
+#endif // OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_INDEX_ENABLE
+
 //---------------------------------------------------------------------------------------------------------------------
 // AddressResolver::CacheEntry
 
@@ -1089,6 +1377,10 @@ void AddressResolver::CacheEntry::Init(Instance &aInstance)
 {
     InstanceLocatorInit::Init(aInstance);
     mNextIndex = kNoNextIndex;
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_INDEX_ENABLE
+    mPrevIndex = kNoPrevIndex;
+    mList      = nullptr;
+#endif
 }
 
 AddressResolver::CacheEntry *AddressResolver::CacheEntry::GetNext(void)
@@ -1101,11 +1393,24 @@ const AddressResolver::CacheEntry *AddressResolver::CacheEntry::GetNext(void) co
     return (mNextIndex == kNoNextIndex) ? nullptr : &Get<AddressResolver>().GetCacheEntryPool().GetEntryAt(mNextIndex);
 }
 
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_INDEX_ENABLE
+AddressResolver::CacheEntry *AddressResolver::CacheEntry::GetPrev(void)
+{
+    return (mPrevIndex == kNoPrevIndex) ? nullptr : &Get<AddressResolver>().GetCacheEntryPool().GetEntryAt(mPrevIndex);
+}
+#endif
+
 void AddressResolver::CacheEntry::SetNext(CacheEntry *aEntry)
 {
     VerifyOrExit(aEntry != nullptr, mNextIndex = kNoNextIndex);
     mNextIndex = Get<AddressResolver>().GetCacheEntryPool().GetIndexOf(*aEntry);
 
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_INDEX_ENABLE
+    // All list links are set through `SetNext()`, so the entry linked
+    // after this one always tracks its previous entry.
+    aEntry->mPrevIndex = Get<AddressResolver>().GetCacheEntryPool().GetIndexOf(*this);
+#endif
+
 exit:
     return;
 }
@@ -38,6 +38,9 @@
 
 #include "coap/coap.hpp"
 #include "common/as_core_type.hpp"
+#include "common/clearable.hpp"
+#include "common/heap.hpp"
+#include "common/linear_probing.hpp"
 #include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
@@ -106,6 +109,16 @@ public:
         };
     };
 
+#if OPENTHREAD_FTD
+    /**
+     * Represents the EID cache counters.
+     *
+     */
+    class Counters : public otCacheCounters, public Clearable<Counters>
+    {
+    };
+#endif
+
     /**
      * Initializes the object.
      *
@@ -133,6 +146,45 @@ public:
      */
     Error GetNextCacheEntry(EntryInfo &aInfo, Iterator &aIterator) const;
 
+    /**
+     * Gets the EID cache counters.
+     *
+     * @returns A reference to the EID cache counters.
+     *
+     */
+    const Counters &GetCounters(void) const { return mCounters; }
+
+    /**
+     * Resets the EID cache counters.
+     *
+     */
+    void ResetCounters(void) { mCounters.Clear(); }
+
+    /**
+     * Gets the number of EID cache entries.
+     *
+     * @returns The number of EID cache entries.
+     *
+     */
+    uint16_t GetCacheSize(void) const { return mCacheEntryPool.GetSize(); }
+
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_DYNAMIC_SIZE_ENABLE
+    /**
+     * Sets the number of EID cache entries.
+     *
+     * All existing entries are removed. Requires the Thread protocol to be disabled.
+     *
+     * @param[in] aSize   The number of EID cache entries.
+     *
+     * @retval kErrorNone          Successfully set the number of entries.
+     * @retval kErrorInvalidState  The Thread protocol is enabled.
+     * @retval kErrorInvalidArgs   @p aSize is zero or too large.
+     * @retval kErrorNoBufs        Could not allocate the entries.
+     *
+     */
+    Error SetCacheSize(uint16_t aSize);
+#endif
+
     /**
      * Removes the EID-to-RLOC cache entries corresponding to an RLOC16.
      *
@@ -260,6 +312,14 @@ private:
         const CacheEntry *GetNext(void) const;
         void              SetNext(CacheEntry *aEntry);
 
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_INDEX_ENABLE
+        // The previous entry is only valid when the entry is in a
+        // list and is not the list head.
+        CacheEntry     *GetPrev(void);
+        CacheEntryList *GetList(void) { return mList; }
+        void            SetList(CacheEntryList *aList) { mList = aList; }
+#endif
+
         const Ip6::Address &GetTarget(void) const { return mTarget; }
         void                SetTarget(const Ip6::Address &aTarget) { mTarget = aTarget; }
 
@@ -289,11 +349,16 @@ private:
 
     private:
         static constexpr uint16_t kNoNextIndex          = 0xffff;     // `mNextIndex` value when at end of list.
+        static constexpr uint16_t kNoPrevIndex          = 0xffff;     // `mPrevIndex` value when never linked.
         static constexpr uint32_t kInvalidLastTransTime = 0xffffffff; // Value when `mLastTransactionTime` is invalid.
 
         Ip6::Address      mTarget;
         Mac::ShortAddress mRloc16;
         uint16_t          mNextIndex;
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_INDEX_ENABLE
+        uint16_t        mPrevIndex;
+        CacheEntryList *mList;
+#endif
 
         union
         {
@@ -313,10 +378,92 @@ private:
         } mInfo;
     };
 
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_DYNAMIC_SIZE_ENABLE
+    static constexpr uint16_t kMaxCacheEntries = 0x7fff;
+
+    // Pool of cache entries allocated from the heap. The entries are
+    // allocated on first use or when the size is changed.
+    class CacheEntryPool : private NonCopyable
+    {
+    public:
+        explicit CacheEntryPool(Instance &aInstance);
+        ~CacheEntryPool(void) { Heap::Free(mEntries); }
+
+        bool              IsAllocated(void) const { return mEntries != nullptr; }
+        Error             Allocate(uint16_t aSize);
+        void              Release(void);
+        CacheEntry       *Allocate(void) { return mFreeList.Pop(); }
+        void              Free(CacheEntry &aEntry) { mFreeList.Push(aEntry); }
+        uint16_t          GetSize(void) const { return mSize; }
+        uint16_t          GetIndexOf(const CacheEntry &aEntry) const
+        {
+            return static_cast<uint16_t>(&aEntry - mEntries);
+        }
+        CacheEntry       &GetEntryAt(uint16_t aIndex) { return mEntries[aIndex]; }
+        const CacheEntry &GetEntryAt(uint16_t aIndex) const { return mEntries[aIndex]; }
+
+    private:
+        Instance              &mInstance;
+        LinkedList<CacheEntry> mFreeList;
+        CacheEntry            *mEntries;
+        uint16_t               mSize;
+    };
+#else
     typedef Pool<CacheEntry, kCacheEntries> CacheEntryPool;
+#endif
+
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_INDEX_ENABLE
+    // Open addressing hash table (with linear probing) mapping an EID
+    // to the index of its cache entry in `CacheEntryPool`. It contains
+    // all entries that are in one of the cache lists.
+    class CacheIndex : public LinearProbing<CacheIndex>, private NonCopyable
+    {
+        friend class LinearProbing<CacheIndex>;
+
+    public:
+        explicit CacheIndex(CacheEntryPool &aPool);
+
+        void        Clear(void);
+        void        Add(const CacheEntry &aEntry);
+        void        Remove(const CacheEntry &aEntry);
+        CacheEntry *Find(const Ip6::Address &aEid) const;
+
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_DYNAMIC_SIZE_ENABLE
+        ~CacheIndex(void) { Heap::Free(mSlots); }
+        Error Allocate(uint16_t aNumEntries);
+#endif
+
+    private:
+        static constexpr uint16_t kEmptySlot = 0xffff;
+
+        uint16_t GetHomeSlot(const Ip6::Address &aEid) const;
+        uint16_t GetNumSlots(void) const { return mNumSlots; }
+        bool     IsSlotEmpty(uint16_t aSlot) const { return mSlots[aSlot] == kEmptySlot; }
+        uint16_t GetHomeSlotOf(uint16_t aSlot) const;
+        void     MoveSlot(uint16_t aFromSlot, uint16_t aToSlot);
+
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_DYNAMIC_SIZE_ENABLE
+        uint16_t *mSlots;
+#else
+        uint16_t mSlots[2 * kCacheEntries];
+#endif
+        uint16_t        mNumSlots;
+        CacheEntryPool &mPool;
+    };
+#endif
 
     class CacheEntryList : public LinkedList<CacheEntry>
     {
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_INDEX_ENABLE
+    public:
+        // Entries track their list, so that an entry found from the
+        // index can be removed from its list without searching it.
+        void Push(CacheEntry &aEntry)
+        {
+            aEntry.SetList(this);
+            LinkedList<CacheEntry>::Push(aEntry);
+        }
+#endif
     };
 
     enum EntryChange : uint8_t
@@ -345,6 +492,11 @@ private:
     void        Remove(const Ip6::Address &aEid, Reason aReason);
     CacheEntry *FindCacheEntry(const Ip6::Address &aEid, CacheEntryList *&aList, CacheEntry *&aPrevEntry);
     CacheEntry *NewCacheEntry(bool aSnoopedEntry);
+    void        AddToCacheIndex(const CacheEntry &aEntry);
+    void        RemoveFromCacheIndex(const CacheEntry &aEntry);
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_DYNAMIC_SIZE_ENABLE
+    Error AllocateCache(uint16_t aSize);
+#endif
     void        RemoveCacheEntry(CacheEntry &aEntry, CacheEntryList &aList, CacheEntry *aPrevEntry, Reason aReason);
     Error       UpdateCacheEntry(const Ip6::Address &aEid, Mac::ShortAddress aRloc16);
     Error       SendAddressQuery(const Ip6::Address &aEid);
@@ -378,6 +530,10 @@ private:
     static AddressResolver::CacheEntry *GetEntryAfter(CacheEntry *aPrev, CacheEntryList &aList);
 
     CacheEntryPool     mCacheEntryPool;
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_INDEX_ENABLE
+    CacheIndex mCacheIndex;
+#endif
+    Counters           mCounters;
     CacheEntryList     mCachedList;
     CacheEntryList     mSnoopedList;
     CacheEntryList     mQueryList;
@@ -118,6 +118,19 @@ const Child *ChildTable::FindChild(const Child::AddressMatcher &aMatcher) const
 {
     const Child *child = mChildren;
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    // Children in `kStateInvalid` are not indexed, so the index is
+    // used only when the state filter excludes them.
+
+    if (((aMatcher.mShortAddress != Mac::kShortAddrInvalid) || (aMatcher.mExtAddress != nullptr)) &&
+        (aMatcher.mStateFilter != Child::kInStateInvalid) &&
+        (aMatcher.mStateFilter != Child::kInStateAnyExceptValidOrRestoring) &&
+        (aMatcher.mStateFilter != Child::kInStateAny))
+    {
+        ExitNow(child = FindChildInIndex(aMatcher));
+    }
+#endif
+
     for (uint16_t num = mMaxChildrenAllowed; num != 0; num--, child++)
     {
         if (child->Matches(aMatcher))
@@ -316,8 +329,30 @@ exit:
 
 bool ChildTable::HasSleepyChildWithAddress(const Ip6::Address &aIp6Address) const
 {
-    bool         hasChild = false;
-    const Child *child    = &mChildren[0];
+    bool hasChild = false;
+
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    const Index &index = mIndex;
+    bool         isMeshLocal;
+
+    VerifyOrExit(!aIp6Address.IsUnspecified());
+
+    isMeshLocal = Get<Mle::MleRouter>().IsMeshLocalAddress(aIp6Address);
+
+    for (uint16_t entry = index.GetFirstByIp6Address(aIp6Address, isMeshLocal); entry != Index::kNone;
+         entry = index.GetNextByIp6Address(entry))
+    {
+        const Child &child = mChildren[Index::GetChildIndexOfIp6Entry(entry)];
+
+        if (child.IsStateValidOrRestoring() && !child.IsRxOnWhenIdle() && child.HasIp6Address(aIp6Address))
+        {
+            ExitNow(hasChild = true);
+        }
+    }
+
+exit:
+#else
+    const Child *child = &mChildren[0];
 
     for (uint16_t num = mMaxChildrenAllowed; num != 0; num--, child++)
     {
@@ -327,10 +362,221 @@ bool ChildTable::HasSleepyChildWithAddress(const Ip6::Address &aIp6Address) cons
             break;
         }
     }
+#endif
 
     return hasChild;
 }
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+
+const Child *ChildTable::FindChildInIndex(const Child::AddressMatcher &aMatcher) const
+{
+    const Index &index = mIndex;
+    const Child *child = nullptr;
+    uint16_t     childIndex;
+
+    if (aMatcher.mExtAddress != nullptr)
+    {
+        for (childIndex = index.GetFirstByExtAddress(*aMatcher.mExtAddress); childIndex != Index::kNone;
+             childIndex = index.GetNextByExtAddress(childIndex))
+        {
+            if (mChildren[childIndex].Matches(aMatcher))
+            {
+                ExitNow(child = &mChildren[childIndex]);
+            }
+        }
+    }
+    else
+    {
+        for (childIndex = index.GetFirstByRloc16(aMatcher.mShortAddress); childIndex != Index::kNone;
+             childIndex = index.GetNextByRloc16(childIndex))
+        {
+            if (mChildren[childIndex].Matches(aMatcher))
+            {
+                ExitNow(child = &mChildren[childIndex]);
+            }
+        }
+    }
+
+exit:
+    return child;
+}
+
+void ChildTable::Index::Clear(void)
+{
+    for (uint16_t &head : mRloc16Heads)
+    {
+        head = kNone;
+    }
+
+    for (uint16_t &head : mExtAddressHeads)
+    {
+        head = kNone;
+    }
+
+    for (uint16_t &head : mIp6AddressHeads)
+    {
+        head = kNone;
+    }
+
+    for (uint16_t &bucket : mRloc16Buckets)
+    {
+        bucket = kNone;
+    }
+
+    for (uint16_t &bucket : mExtAddressBuckets)
+    {
+        bucket = kNone;
+    }
+
+    for (uint16_t &bucket : mIp6AddressBuckets)
+    {
+        bucket = kNone;
+    }
+}
+
+void ChildTable::Index::Update(const Child &aChild, uint16_t aChildIndex)
+{
+    Remove(mRloc16Heads, mRloc16Next, mRloc16Buckets, aChildIndex);
+    Remove(mExtAddressHeads, mExtAddressNext, mExtAddressBuckets, aChildIndex);
+    RemoveIp6Addresses(aChildIndex);
+
+    VerifyOrExit(!aChild.IsStateInvalid());
+
+    Insert(mRloc16Heads, mRloc16Next, mRloc16Buckets, Mle::ChildIdFromRloc16(aChild.GetRloc16()), aChildIndex);
+    Insert(mExtAddressHeads, mExtAddressNext, mExtAddressBuckets,
+           GetBucket(aChild.GetExtAddress().m8, sizeof(Mac::ExtAddress), GetArrayLength(mExtAddressHeads)),
+           aChildIndex);
+    AddIp6Addresses(aChild, aChildIndex);
+
+exit:
+    return;
+}
+
+void ChildTable::Index::UpdateIp6Addresses(const Child &aChild, uint16_t aChildIndex)
+{
+    RemoveIp6Addresses(aChildIndex);
+
+    VerifyOrExit(!aChild.IsStateInvalid());
+    AddIp6Addresses(aChild, aChildIndex);
+
+exit:
+    return;
+}
+
+void ChildTable::Index::AddIp6Addresses(const Child &aChild, uint16_t aChildIndex)
+{
+    uint16_t entry = aChildIndex * kIp6EntriesPerChild;
+
+    // The mesh-local address is indexed by its IID only (same as
+    // `Child::HasIp6Address()` which ignores its prefix), other
+    // addresses by the full address. Registered addresses end at
+    // the first unspecified one.
+
+    if (!aChild.mMeshLocalIid.IsUnspecified())
+    {
+        Insert(mIp6AddressHeads, mIp6AddressNext, mIp6AddressBuckets,
+               GetBucket(aChild.mMeshLocalIid.mFields.m8, sizeof(Ip6::InterfaceIdentifier),
+                         GetArrayLength(mIp6AddressHeads)),
+               entry);
+    }
+
+    for (const Ip6::Address &address : aChild.mIp6Address)
+    {
+        if (address.IsUnspecified())
+        {
+            break;
+        }
+
+        entry++;
+        Insert(mIp6AddressHeads, mIp6AddressNext, mIp6AddressBuckets,
+               GetBucket(address.mFields.m8, sizeof(Ip6::Address), GetArrayLength(mIp6AddressHeads)), entry);
+    }
+}
+
+void ChildTable::Index::RemoveIp6Addresses(uint16_t aChildIndex)
+{
+    uint16_t entry = aChildIndex * kIp6EntriesPerChild;
+
+    for (uint16_t num = kIp6EntriesPerChild; num != 0; num--, entry++)
+    {
+        Remove(mIp6AddressHeads, mIp6AddressNext, mIp6AddressBuckets, entry);
+    }
+}
+
+void ChildTable::Index::Insert(uint16_t *aHeads, uint16_t *aNext, uint16_t *aBuckets, uint16_t aBucket, uint16_t aIndex)
+{
+    // Insert in order of entry, so that each chain lists its entries
+    // in table order.
+
+    uint16_t *link = &aHeads[aBucket];
+
+    while ((*link != kNone) && (*link < aIndex))
+    {
+        link = &aNext[*link];
+    }
+
+    aNext[aIndex]    = *link;
+    *link            = aIndex;
+    aBuckets[aIndex] = aBucket;
+}
+
+void ChildTable::Index::Remove(uint16_t *aHeads, uint16_t *aNext, uint16_t *aBuckets, uint16_t aIndex)
+{
+    uint16_t *link;
+
+    VerifyOrExit(aBuckets[aIndex] != kNone);
+
+    for (link = &aHeads[aBuckets[aIndex]]; *link != aIndex; link = &aNext[*link])
+    {
+        OT_ASSERT(*link != kNone);
+    }
+
+    *link            = aNext[aIndex];
+    aBuckets[aIndex] = kNone;
+
+exit:
+    return;
+}
+
+uint16_t ChildTable::Index::GetFirstByExtAddress(const Mac::ExtAddress &aExtAddress) const
+{
+    return mExtAddressHeads[GetBucket(aExtAddress.m8, sizeof(Mac::ExtAddress), GetArrayLength(mExtAddressHeads))];
+}
+
+uint16_t ChildTable::Index::GetFirstByIp6Address(const Ip6::Address &aAddress, bool aIsMeshLocal) const
+{
+    uint16_t bucket;
+
+    if (aIsMeshLocal)
+    {
+        bucket = GetBucket(aAddress.GetIid().mFields.m8, sizeof(Ip6::InterfaceIdentifier),
+                           GetArrayLength(mIp6AddressHeads));
+    }
+    else
+    {
+        bucket = GetBucket(aAddress.mFields.m8, sizeof(Ip6::Address), GetArrayLength(mIp6AddressHeads));
+    }
+
+    return mIp6AddressHeads[bucket];
+}
+
+uint16_t ChildTable::Index::GetBucket(const uint8_t *aBytes, uint16_t aLength, uint16_t aNumBuckets)
+{
+    uint32_t hash = 0;
+
+    for (; aLength != 0; aLength--, aBytes++)
+    {
+        hash = (hash ^ *aBytes) * 0x9e3779b1;
+    }
+
+    hash ^= (hash >> 16);
+
+    return static_cast<uint16_t>(hash % aNumBuckets);
+}
+
+#endif // OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+
 } // namespace ot
 
 #endif // OPENTHREAD_FTD
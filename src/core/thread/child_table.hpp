@@ -320,6 +320,29 @@ public:
         return (mChildren <= child) && (child < GetArrayEnd(mChildren));
     }
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    /**
+     * Updates the child table lookup indexes for a given child entry.
+     *
+     * Must be called whenever the state (to or from `kStateInvalid`), RLOC16 or extended address of a child entry
+     * change. Only the entries of the given child are updated.
+     *
+     * @param[in] aChild  The child entry which changed.
+     *
+     */
+    void UpdateIndex(const Child &aChild) { mIndex.Update(aChild, GetChildIndex(aChild)); }
+
+    /**
+     * Updates the child table IPv6 address lookup index for a given child entry.
+     *
+     * Must be called whenever the registered IPv6 addresses of a child entry change.
+     *
+     * @param[in] aChild  The child entry whose addresses changed.
+     *
+     */
+    void UpdateIp6AddressIndex(const Child &aChild) { mIndex.UpdateIp6Addresses(aChild, GetChildIndex(aChild)); }
+#endif
+
 private:
     static constexpr uint16_t kMaxChildren = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN;
 
@@ -341,11 +364,78 @@ private:
 
     Child *FindChild(const Child::AddressMatcher &aMatcher) { return AsNonConst(AsConst(this)->FindChild(aMatcher)); }
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    class Index : private NonCopyable
+    {
+        // Children are indexed by RLOC16 (direct-mapped by Child ID),
+        // by extended address and by registered IPv6 address, each
+        // using chains of table indexes. Chains are kept in table
+        // order so a lookup finds the same child as a linear search.
+        // Children in `kStateInvalid` are not indexed.
+        //
+        // The index is updated incrementally as child entries change.
+        // The bucket of each indexed entry is remembered, so that it
+        // can be removed after the key it was added with has changed.
+
+    public:
+        static constexpr uint16_t kNone = 0xffff;
+
+        Index(void) { Clear(); }
+
+        void Clear(void);
+        void Update(const Child &aChild, uint16_t aChildIndex);
+        void UpdateIp6Addresses(const Child &aChild, uint16_t aChildIndex);
+
+        uint16_t GetFirstByRloc16(uint16_t aRloc16) const { return mRloc16Heads[Mle::ChildIdFromRloc16(aRloc16)]; }
+        uint16_t GetNextByRloc16(uint16_t aChildIndex) const { return mRloc16Next[aChildIndex]; }
+        uint16_t GetFirstByExtAddress(const Mac::ExtAddress &aExtAddress) const;
+        uint16_t GetNextByExtAddress(uint16_t aChildIndex) const { return mExtAddressNext[aChildIndex]; }
+        uint16_t GetFirstByIp6Address(const Ip6::Address &aAddress, bool aIsMeshLocal) const;
+        uint16_t GetNextByIp6Address(uint16_t aEntry) const { return mIp6AddressNext[aEntry]; }
+
+        static uint16_t GetChildIndexOfIp6Entry(uint16_t aEntry) { return aEntry / kIp6EntriesPerChild; }
+
+    private:
+        // One entry for the mesh-local IID and one for each
+        // registered IPv6 address.
+        static constexpr uint16_t kIp6EntriesPerChild = OPENTHREAD_CONFIG_MLE_IP_ADDRS_PER_CHILD;
+        static constexpr uint16_t kNumIp6Entries      = kMaxChildren * kIp6EntriesPerChild;
+
+        static_assert(kNumIp6Entries < kNone, "OPENTHREAD_CONFIG_MLE_MAX_CHILDREN is too large for child index");
+
+        static uint16_t GetBucket(const uint8_t *aBytes, uint16_t aLength, uint16_t aNumBuckets);
+        static void     Insert(uint16_t *aHeads,
+                               uint16_t *aNext,
+                               uint16_t *aBuckets,
+                               uint16_t  aBucket,
+                               uint16_t  aIndex);
+        static void     Remove(uint16_t *aHeads, uint16_t *aNext, uint16_t *aBuckets, uint16_t aIndex);
+
+        void AddIp6Addresses(const Child &aChild, uint16_t aChildIndex);
+        void RemoveIp6Addresses(uint16_t aChildIndex);
+
+        uint16_t mRloc16Heads[Mle::kMaxChildId + 1];
+        uint16_t mRloc16Next[kMaxChildren];
+        uint16_t mRloc16Buckets[kMaxChildren];
+        uint16_t mExtAddressHeads[kMaxChildren];
+        uint16_t mExtAddressNext[kMaxChildren];
+        uint16_t mExtAddressBuckets[kMaxChildren];
+        uint16_t mIp6AddressHeads[kNumIp6Entries];
+        uint16_t mIp6AddressNext[kNumIp6Entries];
+        uint16_t mIp6AddressBuckets[kNumIp6Entries];
+    };
+
+    const Child *FindChildInIndex(const Child::AddressMatcher &aMatcher) const;
+#endif
+
     const Child *FindChild(const Child::AddressMatcher &aMatcher) const;
     void         RefreshStoredChildren(void);
 
     uint16_t mMaxChildrenAllowed;
     Child    mChildren[kMaxChildren];
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    Index mIndex;
+#endif
 };
 
 } // namespace ot
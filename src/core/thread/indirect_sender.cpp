@@ -74,16 +74,23 @@ void IndirectSender::Stop(void)
 {
     VerifyOrExit(mEnabled);
 
+    mSourceMatchController.BeginUpdate();
+
     for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAnyExceptInvalid))
     {
         child.SetIndirectMessage(nullptr);
         mSourceMatchController.ResetMessageCount(child);
     }
 
+    mSourceMatchController.CommitUpdate();
+
     mDataPollHandler.Clear();
 #if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
     mCslTxScheduler.Clear();
 #endif
+#if OPENTHREAD_CONFIG_INDIRECT_SENDER_MESSAGE_INDEX_ENABLE
+    mMessageIndex.Clear();
+#endif
 
 exit:
     mEnabled = false;
@@ -100,6 +107,9 @@ void IndirectSender::AddMessageForSleepyChild(Message &aMessage, Child &aChild)
 
     aMessage.SetChildMask(childIndex);
     mSourceMatchController.IncrementMessageCount(aChild);
+#if OPENTHREAD_CONFIG_INDIRECT_SENDER_MESSAGE_INDEX_ENABLE
+    mMessageIndex.Add(childIndex, aMessage);
+#endif
 
     if ((aMessage.GetType() != Message::kTypeSupervision) && (aChild.GetIndirectMessageCount() > 1))
     {
@@ -125,8 +135,7 @@ Error IndirectSender::RemoveMessageFromSleepyChild(Message &aMessage, Child &aCh
 
     VerifyOrExit(aMessage.GetChildMask(childIndex), error = kErrorNotFound);
 
-    aMessage.ClearChildMask(childIndex);
-    mSourceMatchController.DecrementMessageCount(aChild);
+    ClearMessageForChild(aMessage, aChild, childIndex);
 
     RequestMessageUpdate(aChild);
 
@@ -134,17 +143,43 @@ exit:
     return error;
 }
 
-void IndirectSender::ClearAllMessagesForSleepyChild(Child &aChild)
+void IndirectSender::RemoveMessageFromSleepyChildren(Message &aMessage)
 {
-    VerifyOrExit(aChild.GetIndirectMessageCount() > 0);
+    VerifyOrExit(aMessage.IsChildPending());
 
-    for (Message &message : Get<MeshForwarder>().mSendQueue)
+    for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAnyExceptInvalid))
     {
-        message.ClearChildMask(Get<ChildTable>().GetChildIndex(aChild));
+        IgnoreError(RemoveMessageFromSleepyChild(aMessage, child));
+    }
 
-        Get<MeshForwarder>().RemoveMessageIfNoPendingTx(message);
+exit:
+    return;
+}
+
+void IndirectSender::UnindexMessage(const Message &aMessage)
+{
+#if OPENTHREAD_CONFIG_INDIRECT_SENDER_MESSAGE_INDEX_ENABLE
+    VerifyOrExit(aMessage.IsChildPending());
+
+    for (uint16_t childIndex = 0; childIndex < Mle::kMaxChildren; childIndex++)
+    {
+        if (aMessage.GetChildMask(childIndex))
+        {
+            mMessageIndex.Remove(childIndex, aMessage);
+        }
     }
 
+exit:
+#endif
+    OT_UNUSED_VARIABLE(aMessage);
+}
+
+void IndirectSender::ClearAllMessagesForSleepyChild(Child &aChild)
+{
+    VerifyOrExit(aChild.GetIndirectMessageCount() > 0);
+
+    ClearChildMaskForAllMessages(aChild, /* aConvertToDirect */ false);
+
     aChild.SetIndirectMessage(nullptr);
     mSourceMatchController.ResetMessageCount(aChild);
 
@@ -179,16 +214,7 @@ void IndirectSender::HandleChildModeChange(Child &aChild, Mle::DeviceMode aOldMo
 
     if (!aOldMode.IsRxOnWhenIdle() && aChild.IsRxOnWhenIdle() && (aChild.GetIndirectMessageCount() > 0))
     {
-        uint16_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
-
-        for (Message &message : Get<MeshForwarder>().mSendQueue)
-        {
-            if (message.GetChildMask(childIndex))
-            {
-                message.ClearChildMask(childIndex);
-                message.SetDirectTransmission();
-            }
-        }
+        ClearChildMaskForAllMessages(aChild, /* aConvertToDirect */ true);
 
         aChild.SetIndirectMessage(nullptr);
         mSourceMatchController.ResetMessageCount(aChild);
@@ -207,11 +233,92 @@ void IndirectSender::HandleChildModeChange(Child &aChild, Mle::DeviceMode aOldMo
     // case.
 }
 
+void IndirectSender::ClearChildMaskForAllMessages(Child &aChild, bool aConvertToDirect)
+{
+    uint16_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
+
+#if OPENTHREAD_CONFIG_INDIRECT_SENDER_MESSAGE_INDEX_ENABLE
+    if (mMessageIndex.IsIndexed(childIndex))
+    {
+        Message *message;
+
+        while ((message = mMessageIndex.Pop(childIndex)) != nullptr)
+        {
+            message->ClearChildMask(childIndex);
+
+            if (aConvertToDirect)
+            {
+                message->SetDirectTransmission();
+            }
+            else
+            {
+                Get<MeshForwarder>().RemoveMessageIfNoPendingTx(*message);
+            }
+        }
+
+        ExitNow();
+    }
+#endif
+
+    for (Message &message : Get<MeshForwarder>().mSendQueue)
+    {
+        if (!message.GetChildMask(childIndex))
+        {
+            continue;
+        }
+
+        message.ClearChildMask(childIndex);
+
+        if (aConvertToDirect)
+        {
+            message.SetDirectTransmission();
+        }
+        else
+        {
+            Get<MeshForwarder>().RemoveMessageIfNoPendingTx(message);
+        }
+    }
+
+    ExitNow();
+
+exit:
+#if OPENTHREAD_CONFIG_INDIRECT_SENDER_MESSAGE_INDEX_ENABLE
+    mMessageIndex.Clear(childIndex);
+#endif
+    return;
+}
+
+void IndirectSender::ClearMessageForChild(Message &aMessage, Child &aChild, uint16_t aChildIndex)
+{
+    aMessage.ClearChildMask(aChildIndex);
+    mSourceMatchController.DecrementMessageCount(aChild);
+
+#if OPENTHREAD_CONFIG_INDIRECT_SENDER_MESSAGE_INDEX_ENABLE
+    mMessageIndex.Remove(aChildIndex, aMessage);
+
+    if (aChild.GetIndirectMessageCount() == 0)
+    {
+        // All messages for the child are now cleared, so an
+        // unindexed child (on earlier entry pool exhaustion) can be
+        // indexed again.
+
+        mMessageIndex.Clear(aChildIndex);
+    }
+#endif
+}
+
 Message *IndirectSender::FindIndirectMessage(Child &aChild, bool aSupervisionTypeOnly)
 {
     Message *msg        = nullptr;
     uint16_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
 
+#if OPENTHREAD_CONFIG_INDIRECT_SENDER_MESSAGE_INDEX_ENABLE
+    if (mMessageIndex.IsIndexed(childIndex))
+    {
+        ExitNow(msg = mMessageIndex.Find(childIndex, aSupervisionTypeOnly));
+    }
+#endif
+
     for (Message &message : Get<MeshForwarder>().mSendQueue)
     {
         if (message.GetChildMask(childIndex) &&
@@ -222,6 +329,9 @@ Message *IndirectSender::FindIndirectMessage(Child &aChild, bool aSupervisionTyp
         }
     }
 
+    ExitNow();
+
+exit:
     return msg;
 }
 
@@ -532,8 +642,7 @@ void IndirectSender::HandleSentFrameToChild(const Mac::TxFrame &aFrame,
 
         if (message->GetChildMask(childIndex))
         {
-            message->ClearChildMask(childIndex);
-            mSourceMatchController.DecrementMessageCount(aChild);
+            ClearMessageForChild(*message, aChild, childIndex);
         }
 
         Get<MeshForwarder>().RemoveMessageIfNoPendingTx(*message);
@@ -561,6 +670,124 @@ void IndirectSender::ClearMessagesForRemovedChildren(void)
     }
 }
 
+#if OPENTHREAD_CONFIG_INDIRECT_SENDER_MESSAGE_INDEX_ENABLE
+
+void IndirectSender::MessageIndex::Clear(void)
+{
+    for (LinkedList<Entry> &list : mLists)
+    {
+        list.Clear();
+    }
+
+    mUnindexedMask.Clear();
+    mEntryPool.FreeAll();
+}
+
+void IndirectSender::MessageIndex::Clear(uint16_t aChildIndex)
+{
+    Entry *entry;
+
+    while ((entry = mLists[aChildIndex].Pop()) != nullptr)
+    {
+        mEntryPool.Free(*entry);
+    }
+
+    mUnindexedMask.Set(aChildIndex, false);
+}
+
+void IndirectSender::MessageIndex::Add(uint16_t aChildIndex, Message &aMessage)
+{
+    Entry *entry;
+    Entry *tail;
+
+    VerifyOrExit(IsIndexed(aChildIndex));
+
+    entry = mEntryPool.Allocate();
+
+    if (entry == nullptr)
+    {
+        Clear(aChildIndex);
+        mUnindexedMask.Set(aChildIndex, true);
+        ExitNow();
+    }
+
+    entry->mMessage = &aMessage;
+
+    // Append at the tail so that entries are kept in the same order
+    // as messages in the send queue (for the same priority).
+
+    tail = mLists[aChildIndex].GetTail();
+
+    if (tail == nullptr)
+    {
+        mLists[aChildIndex].Push(*entry);
+    }
+    else
+    {
+        mLists[aChildIndex].PushAfter(*entry, *tail);
+    }
+
+exit:
+    return;
+}
+
+void IndirectSender::MessageIndex::Remove(uint16_t aChildIndex, const Message &aMessage)
+{
+    Entry *prev = nullptr;
+
+    for (Entry &entry : mLists[aChildIndex])
+    {
+        if (entry.mMessage == &aMessage)
+        {
+            mLists[aChildIndex].PopAfter(prev);
+            mEntryPool.Free(entry);
+            break;
+        }
+
+        prev = &entry;
+    }
+}
+
+Message *IndirectSender::MessageIndex::Pop(uint16_t aChildIndex)
+{
+    Message *message = nullptr;
+    Entry   *entry   = mLists[aChildIndex].Pop();
+
+    if (entry != nullptr)
+    {
+        message = entry->mMessage;
+        mEntryPool.Free(*entry);
+    }
+
+    return message;
+}
+
+Message *IndirectSender::MessageIndex::Find(uint16_t aChildIndex, bool aSupervisionTypeOnly) const
+{
+    // The send queue is ordered by priority and then by the order in
+    // which messages were added, so pick the earliest entry among
+    // the ones with the highest priority.
+
+    Message *found = nullptr;
+
+    for (const Entry &entry : mLists[aChildIndex])
+    {
+        if (aSupervisionTypeOnly && (entry.mMessage->GetType() != Message::kTypeSupervision))
+        {
+            continue;
+        }
+
+        if ((found == nullptr) || (entry.mMessage->GetPriority() > found->GetPriority()))
+        {
+            found = entry.mMessage;
+        }
+    }
+
+    return found;
+}
+
+#endif // OPENTHREAD_CONFIG_INDIRECT_SENDER_MESSAGE_INDEX_ENABLE
+
 } // namespace ot
 
 #endif // #if OPENTHREAD_FTD
@@ -38,11 +38,14 @@
 
 #if OPENTHREAD_FTD
 
+#include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/message.hpp"
 #include "common/non_copyable.hpp"
+#include "common/pool.hpp"
 #include "mac/data_poll_handler.hpp"
 #include "mac/mac_frame.hpp"
+#include "thread/child_mask.hpp"
 #include "thread/csl_tx_scheduler.hpp"
 #include "thread/indirect_sender_frame_context.hpp"
 #include "thread/mle_types.hpp"
@@ -60,6 +63,7 @@ namespace ot {
  */
 
 class Child;
+class UnitTester;
 
 /**
  * Implements indirect transmission.
@@ -72,6 +76,7 @@ class IndirectSender : public InstanceLocator, public IndirectSenderBase, privat
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
     friend class CslTxScheduler::Callbacks;
 #endif
+    friend class UnitTester;
 
 public:
     /**
@@ -176,6 +181,27 @@ public:
      */
     Error RemoveMessageFromSleepyChild(Message &aMessage, Child &aChild);
 
+    /**
+     * Removes a message for indirect transmission to all sleepy children.
+     *
+     * MUST be called before the message is removed from the send queue, so that no child keeps referring to it.
+     *
+     * @param[in] aMessage  The message to update.
+     *
+     */
+    void RemoveMessageFromSleepyChildren(Message &aMessage);
+
+    /**
+     * Removes a message from the index of messages pending indirect transmission (if enabled).
+     *
+     * Unlike `RemoveMessageFromSleepyChildren()`, the message is not cleared from the children. MUST be called before
+     * the message is removed from the send queue, so that the index does not refer to it once freed.
+     *
+     * @param[in] aMessage  The message to remove from the index.
+     *
+     */
+    void UnindexMessage(const Message &aMessage);
+
     /**
      * Removes all added messages for a specific child and frees message (with no indirect/direct tx).
      *
@@ -214,6 +240,44 @@ private:
     uint16_t PrepareDataFrame(Mac::TxFrame &aFrame, Child &aChild, Message &aMessage);
     void     PrepareEmptyFrame(Mac::TxFrame &aFrame, Child &aChild, bool aAckRequest);
     void     ClearMessagesForRemovedChildren(void);
+    void     ClearChildMaskForAllMessages(Child &aChild, bool aConvertToDirect);
+    void     ClearMessageForChild(Message &aMessage, Child &aChild, uint16_t aChildIndex);
+
+#if OPENTHREAD_CONFIG_INDIRECT_SENDER_MESSAGE_INDEX_ENABLE
+    // Tracks, per child index, the messages in the send queue whose
+    // child mask bit for the child is set, in the order they were
+    // added. This avoids scanning the whole send queue on each data
+    // poll. If the entry pool runs out, the child is marked as
+    // unindexed and the send queue is scanned for it instead, until
+    // all its messages are cleared.
+
+    class MessageIndex : private NonCopyable
+    {
+    public:
+        MessageIndex(void) { Clear(); }
+
+        void     Clear(void);
+        void     Clear(uint16_t aChildIndex);
+        void     Add(uint16_t aChildIndex, Message &aMessage);
+        void     Remove(uint16_t aChildIndex, const Message &aMessage);
+        Message *Pop(uint16_t aChildIndex);
+        Message *Find(uint16_t aChildIndex, bool aSupervisionTypeOnly) const;
+        bool     IsIndexed(uint16_t aChildIndex) const { return !mUnindexedMask.Get(aChildIndex); }
+
+    private:
+        static constexpr uint16_t kNumEntries = OPENTHREAD_CONFIG_INDIRECT_SENDER_MESSAGE_INDEX_ENTRIES;
+
+        struct Entry : public LinkedListEntry<Entry>
+        {
+            Message *mMessage;
+            Entry   *mNext;
+        };
+
+        LinkedList<Entry>        mLists[Mle::kMaxChildren];
+        ChildMask                mUnindexedMask;
+        Pool<Entry, kNumEntries> mEntryPool;
+    };
+#endif
 
     bool                  mEnabled;
     SourceMatchController mSourceMatchController;
@@ -221,6 +285,9 @@ private:
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
     CslTxScheduler mCslTxScheduler;
 #endif
+#if OPENTHREAD_CONFIG_INDIRECT_SENDER_MESSAGE_INDEX_ENABLE
+    MessageIndex mMessageIndex;
+#endif
 };
 
 /**
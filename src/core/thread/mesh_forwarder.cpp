@@ -39,6 +39,7 @@
 #include "common/instance.hpp"
 #include "common/locator_getters.hpp"
 #include "common/message.hpp"
+#include "common/num_utils.hpp"
 #include "common/random.hpp"
 #include "common/time_ticker.hpp"
 #include "net/ip6.hpp"
@@ -107,6 +108,7 @@ void ThreadLinkInfo::SetFrom(const Mac::RxFrame &aFrame)
 
 MeshForwarder::MeshForwarder(Instance &aInstance)
     : InstanceLocator(aInstance)
+    , mReassemblyTimer(aInstance)
     , mMessageNextOffset(0)
     , mSendMessage(nullptr)
     , mMeshSource()
@@ -128,9 +130,13 @@ MeshForwarder::MeshForwarder(Instance &aInstance)
     mFragTag = Random::NonCrypto::GetUint16();
 
     ResetCounters();
+    mReassemblyCounters.Clear();
 
 #if OPENTHREAD_FTD
     mFragmentPriorityList.Clear();
+#if OPENTHREAD_CONFIG_6LOWPAN_FRAGMENT_FORWARDING_ENABLE
+    mFragmentForwardList.Clear();
+#endif
 #endif
 }
 
@@ -157,10 +163,18 @@ void MeshForwarder::Stop(void)
 
     mSendQueue.DequeueAndFreeAll();
     mReassemblyList.DequeueAndFreeAll();
+    mReassemblyTimer.Stop();
+    mReassemblyCounters.mCurrentDatagrams = 0;
+#if OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_ENABLE
+    mReassemblyIndex.Clear();
+#endif
 
 #if OPENTHREAD_FTD
     mIndirectSender.Stop();
     mFragmentPriorityList.Clear();
+#if OPENTHREAD_CONFIG_6LOWPAN_FRAGMENT_FORWARDING_ENABLE
+    mFragmentForwardList.Clear();
+#endif
 #endif
 
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_COLLISION_AVOIDANCE_DELAY_ENABLE
@@ -205,23 +219,43 @@ void MeshForwarder::RemoveMessage(Message &aMessage)
 
     OT_ASSERT(queue != nullptr);
 
+    LogMessage(kMessageEvict, aMessage, kErrorNoBufs);
+
     if (queue == &mSendQueue)
     {
 #if OPENTHREAD_FTD
-        for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAnyExceptInvalid))
-        {
-            IgnoreError(mIndirectSender.RemoveMessageFromSleepyChild(aMessage, child));
-        }
+        mIndirectSender.RemoveMessageFromSleepyChildren(aMessage);
+#endif
+        DequeueAndFreeFromSendQueue(aMessage);
+    }
+    else
+    {
+        queue->DequeueAndFree(aMessage);
+    }
+}
+
+void MeshForwarder::DequeueFromSendQueue(Message &aMessage)
+{
+    // All removals from the send queue go through here, so that a
+    // message which is still pending indirect transmission is removed
+    // from the indirect sender message index before it can be freed.
+
+#if OPENTHREAD_FTD
+    mIndirectSender.UnindexMessage(aMessage);
 #endif
 
-        if (mSendMessage == &aMessage)
-        {
-            mSendMessage = nullptr;
-        }
+    if (mSendMessage == &aMessage)
+    {
+        mSendMessage = nullptr;
     }
 
-    LogMessage(kMessageEvict, aMessage, kErrorNoBufs);
-    queue->DequeueAndFree(aMessage);
+    mSendQueue.Dequeue(aMessage);
+}
+
+void MeshForwarder::DequeueAndFreeFromSendQueue(Message &aMessage)
+{
+    DequeueFromSendQueue(aMessage);
+    aMessage.Free();
 }
 
 void MeshForwarder::ResumeMessageTransmissions(void)
@@ -595,7 +629,7 @@ Message *MeshForwarder::PrepareNextDirectTransmission(void)
 
         default:
             LogMessage(kMessageDrop, *curMessage, error);
-            mSendQueue.DequeueAndFree(*curMessage);
+            DequeueAndFreeFromSendQueue(*curMessage);
             continue;
         }
     }
@@ -1290,11 +1324,10 @@ void MeshForwarder::RemoveMessageIfNoPendingTx(Message &aMessage)
 
     if (mSendMessage == &aMessage)
     {
-        mSendMessage       = nullptr;
         mMessageNextOffset = 0;
     }
 
-    mSendQueue.DequeueAndFree(aMessage);
+    DequeueAndFreeFromSendQueue(aMessage);
 
 exit:
     return;
@@ -1405,6 +1438,12 @@ void MeshForwarder::HandleFragment(FrameData            &aFrameData,
 
 #endif // OPENTHREAD_CONFIG_MULTI_RADIO
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_6LOWPAN_FRAGMENT_FORWARDING_ENABLE
+    error = ForwardFragment(fragmentHeader, aFrameData, aMacAddrs, aLinkInfo);
+    VerifyOrExit(error == kErrorNotFound);
+    error = kErrorNone;
+#endif
+
     if (fragmentHeader.GetDatagramOffset() == 0)
     {
         uint16_t datagramSize = fragmentHeader.GetDatagramSize();
@@ -1414,6 +1453,7 @@ void MeshForwarder::HandleFragment(FrameData            &aFrameData,
 #endif
 
         SuccessOrExit(error = FrameToMessage(aFrameData, datagramSize, aMacAddrs, message));
+        message->SetOrigin(Message::kOriginReassembly);
 
         VerifyOrExit(datagramSize >= message->GetLength(), error = kErrorParse);
         SuccessOrExit(error = message->SetLength(datagramSize));
@@ -1437,25 +1477,12 @@ void MeshForwarder::HandleFragment(FrameData            &aFrameData,
             ClearReassemblyList();
         }
 
-        mReassemblyList.Enqueue(*message);
-
-        Get<TimeTicker>().RegisterReceiver(TimeTicker::kMeshForwarder);
+        AddToReassemblyList(*message, aMacAddrs.mSource);
     }
     else // Received frame is a "next fragment".
     {
-        for (Message &msg : mReassemblyList)
-        {
-            // Security Check: only consider reassembly buffers that had the same Security Enabled setting.
-            if (msg.GetLength() == fragmentHeader.GetDatagramSize() &&
-                msg.GetDatagramTag() == fragmentHeader.GetDatagramTag() &&
-                msg.GetOffset() == fragmentHeader.GetDatagramOffset() &&
-                msg.GetOffset() + aFrameData.GetLength() <= fragmentHeader.GetDatagramSize() &&
-                msg.IsLinkSecurityEnabled() == aLinkInfo.IsLinkSecurityEnabled())
-            {
-                message = &msg;
-                break;
-            }
-        }
+        message = FindReassemblyMessage(fragmentHeader, aFrameData.GetLength(), aMacAddrs.mSource,
+                                        aLinkInfo.IsLinkSecurityEnabled());
 
         // For a sleepy-end-device, if we receive a new (secure) next fragment
         // with a non-matching fragmentation offset or tag, it indicates that
@@ -1477,38 +1504,135 @@ void MeshForwarder::HandleFragment(FrameData            &aFrameData,
         message->AddLqi(aLinkInfo.GetLqi());
 #endif
         message->SetTimestampToNow();
+
+        // Move the message to the tail, so the reassembly list stays
+        // sorted by the time of the last received fragment.
+
+        mReassemblyList.Dequeue(*message);
+        mReassemblyList.Enqueue(*message);
+        UpdateReassemblyTimer();
     }
 
 exit:
 
     if (error == kErrorNone)
     {
-        if (message->GetOffset() >= message->GetLength())
+        if ((message != nullptr) && (message->GetOffset() >= message->GetLength()))
         {
-            mReassemblyList.Dequeue(*message);
+            RemoveFromReassemblyList(*message);
             IgnoreError(HandleDatagram(*message, aLinkInfo, aMacAddrs.mSource));
         }
     }
     else
     {
+        mReassemblyCounters.mDroppedFragments++;
         LogFragmentFrameDrop(error, aFrameData.GetLength(), aMacAddrs, fragmentHeader,
                              aLinkInfo.IsLinkSecurityEnabled());
         FreeMessage(message);
     }
 }
 
-void MeshForwarder::ClearReassemblyList(void)
+bool MeshForwarder::MatchesFragment(const Message                &aMessage,
+                                    const Lowpan::FragmentHeader &aFragmentHeader,
+                                    uint16_t                      aFragmentLength,
+                                    bool                          aIsSecure)
 {
-    for (Message &message : mReassemblyList)
-    {
-        LogMessage(kMessageReassemblyDrop, message, kErrorNoFrameReceived);
+    // Security Check: only consider reassembly buffers that had the same Security Enabled setting.
 
-        if (message.GetType() == Message::kTypeIp6)
+    return (aMessage.GetLength() == aFragmentHeader.GetDatagramSize()) &&
+           (aMessage.GetDatagramTag() == aFragmentHeader.GetDatagramTag()) &&
+           (aMessage.GetOffset() == aFragmentHeader.GetDatagramOffset()) &&
+           (aMessage.GetOffset() + aFragmentLength <= aFragmentHeader.GetDatagramSize()) &&
+           (aMessage.IsLinkSecurityEnabled() == aIsSecure);
+}
+
+Message *MeshForwarder::FindReassemblyMessage(const Lowpan::FragmentHeader &aFragmentHeader,
+                                              uint16_t                      aFragmentLength,
+                                              const Mac::Address           &aMacSource,
+                                              bool                          aIsSecure)
+{
+#if OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_ENABLE
+    return mReassemblyIndex.Find(aFragmentHeader, aFragmentLength, aMacSource, aIsSecure);
+#else
+    Message *message = nullptr;
+
+    OT_UNUSED_VARIABLE(aMacSource);
+
+    for (Message &msg : mReassemblyList)
+    {
+        if (MatchesFragment(msg, aFragmentHeader, aFragmentLength, aIsSecure))
         {
-            mIpCounters.mRxFailure++;
+            message = &msg;
+            break;
         }
+    }
+
+    return message;
+#endif
+}
+
+void MeshForwarder::AddToReassemblyList(Message &aMessage, const Mac::Address &aMacSource)
+{
+#if OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_ENABLE
+    if (mReassemblyIndex.IsFull())
+    {
+        // Make room by dropping the datagram that has waited longest
+        // for its next fragment (head of the list).
+
+        DropFromReassemblyList(*mReassemblyList.GetHead(), kErrorNoBufs);
+    }
+
+    mReassemblyIndex.Add(aMessage, aMacSource);
+#else
+    OT_UNUSED_VARIABLE(aMacSource);
+#endif
+
+    mReassemblyList.Enqueue(aMessage);
+
+    mReassemblyCounters.mCurrentDatagrams++;
+    mReassemblyCounters.mMaxDatagrams = Max(mReassemblyCounters.mMaxDatagrams, mReassemblyCounters.mCurrentDatagrams);
+
+    UpdateReassemblyTimer();
+}
+
+void MeshForwarder::RemoveFromReassemblyList(Message &aMessage)
+{
+    mReassemblyList.Dequeue(aMessage);
+#if OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_ENABLE
+    mReassemblyIndex.Remove(aMessage);
+#endif
+    mReassemblyCounters.mCurrentDatagrams--;
+
+    UpdateReassemblyTimer();
+}
+
+void MeshForwarder::DropFromReassemblyList(Message &aMessage, Error aError)
+{
+    LogMessage(kMessageReassemblyDrop, aMessage, aError);
+
+    if (aMessage.GetType() == Message::kTypeIp6)
+    {
+        mIpCounters.mRxFailure++;
+    }
+
+    if (aError == kErrorReassemblyTimeout)
+    {
+        mReassemblyCounters.mTimeouts++;
+    }
+    else
+    {
+        mReassemblyCounters.mDroppedDatagrams++;
+    }
 
-        mReassemblyList.DequeueAndFree(message);
+    RemoveFromReassemblyList(aMessage);
+    aMessage.Free();
+}
+
+void MeshForwarder::ClearReassemblyList(void)
+{
+    for (Message &message : mReassemblyList)
+    {
+        DropFromReassemblyList(message, kErrorNoFrameReceived);
     }
 }
 
@@ -1518,9 +1642,10 @@ void MeshForwarder::HandleTimeTick(void)
 
 #if OPENTHREAD_FTD
     continueRxingTicks = mFragmentPriorityList.UpdateOnTimeTick();
+#if OPENTHREAD_CONFIG_6LOWPAN_FRAGMENT_FORWARDING_ENABLE
+    continueRxingTicks = mFragmentForwardList.UpdateOnTimeTick() || continueRxingTicks;
+#endif
 #endif
-
-    continueRxingTicks = UpdateReassemblyList() || continueRxingTicks;
 
     if (!continueRxingTicks)
     {
@@ -1528,28 +1653,148 @@ void MeshForwarder::HandleTimeTick(void)
     }
 }
 
-bool MeshForwarder::UpdateReassemblyList(void)
+void MeshForwarder::UpdateReassemblyTimer(void)
+{
+    // The reassembly list is sorted by the time of the last received
+    // fragment, so the head of the list has the earliest deadline.
+
+    const Message *head = mReassemblyList.GetHead();
+    TimeMilli      deadline;
+
+    if (head == nullptr)
+    {
+        mReassemblyTimer.Stop();
+        ExitNow();
+    }
+
+    deadline = head->GetTimestamp() + TimeMilli::SecToMsec(kReassemblyTimeout);
+
+    if (!mReassemblyTimer.IsRunning() || (mReassemblyTimer.GetFireTime() != deadline))
+    {
+        mReassemblyTimer.FireAt(deadline);
+    }
+
+exit:
+    return;
+}
+
+void MeshForwarder::HandleReassemblyTimer(void)
 {
     TimeMilli now = TimerMilli::GetNow();
+    Message  *message;
 
-    for (Message &message : mReassemblyList)
+    while (((message = mReassemblyList.GetHead()) != nullptr) &&
+           (now - message->GetTimestamp() >= TimeMilli::SecToMsec(kReassemblyTimeout)))
     {
-        if (now - message.GetTimestamp() >= TimeMilli::SecToMsec(kReassemblyTimeout))
-        {
-            LogMessage(kMessageReassemblyDrop, message, kErrorReassemblyTimeout);
+        DropFromReassemblyList(*message, kErrorReassemblyTimeout);
+    }
 
-            if (message.GetType() == Message::kTypeIp6)
-            {
-                mIpCounters.mRxFailure++;
-            }
+    UpdateReassemblyTimer();
+}
+
+void MeshForwarder::ResetReassemblyCounters(void)
+{
+    uint16_t currentDatagrams = mReassemblyCounters.mCurrentDatagrams;
+
+    mReassemblyCounters.Clear();
+    mReassemblyCounters.mCurrentDatagrams = currentDatagrams;
+    mReassemblyCounters.mMaxDatagrams     = currentDatagrams;
+}
+
+#if OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_ENABLE
+
+void MeshForwarder::ReassemblyIndex::Clear(void)
+{
+    for (Slot &slot : mSlots)
+    {
+        slot.mMessage = nullptr;
+    }
 
-            mReassemblyList.DequeueAndFree(message);
+    mNumEntries = 0;
+}
+
+uint16_t MeshForwarder::ReassemblyIndex::GetHomeSlot(uint32_t aDatagramTag, uint16_t aDatagramSize)
+{
+    uint32_t hash = (aDatagramTag ^ (static_cast<uint32_t>(aDatagramSize) << 16)) * 0x9e3779b1;
+
+    hash ^= (hash >> 16);
+
+    return static_cast<uint16_t>(hash % kNumSlots);
+}
+
+void MeshForwarder::ReassemblyIndex::Add(Message &aMessage, const Mac::Address &aMacSource)
+{
+    uint16_t slot;
+
+    OT_ASSERT(!IsFull());
+
+    for (slot = GetHomeSlot(aMessage.GetDatagramTag(), aMessage.GetLength()); mSlots[slot].mMessage != nullptr;
+         slot = GetNextSlot(slot))
+    {
+    }
+
+    mSlots[slot].mMessage   = &aMessage;
+    mSlots[slot].mMacSource = aMacSource;
+    mNumEntries++;
+}
+
+void MeshForwarder::ReassemblyIndex::Remove(const Message &aMessage)
+{
+    uint16_t slot;
+
+    for (slot = GetHomeSlot(aMessage.GetDatagramTag(), aMessage.GetLength()); mSlots[slot].mMessage != &aMessage;
+         slot = GetNextSlot(slot))
+    {
+        VerifyOrExit(mSlots[slot].mMessage != nullptr);
+    }
+
+    // Remove the entry, then shift back any later entries in the
+    // same probe run.
+
+    mSlots[slot].mMessage = nullptr;
+    mNumEntries--;
+    ShiftBackFrom(slot);
+
+exit:
+    return;
+}
+
+uint16_t MeshForwarder::ReassemblyIndex::GetHomeSlotOf(uint16_t aSlot) const
+{
+    const Message &message = *mSlots[aSlot].mMessage;
+
+    return GetHomeSlot(message.GetDatagramTag(), message.GetLength());
+}
+
+void MeshForwarder::ReassemblyIndex::MoveSlot(uint16_t aFromSlot, uint16_t aToSlot)
+{
+    mSlots[aToSlot]            = mSlots[aFromSlot];
+    mSlots[aFromSlot].mMessage = nullptr;
+}
+
+Message *MeshForwarder::ReassemblyIndex::Find(const Lowpan::FragmentHeader &aFragmentHeader,
+                                              uint16_t                      aFragmentLength,
+                                              const Mac::Address           &aMacSource,
+                                              bool                          aIsSecure) const
+{
+    Message *message = nullptr;
+
+    for (uint16_t slot = GetHomeSlot(aFragmentHeader.GetDatagramTag(), aFragmentHeader.GetDatagramSize());
+         mSlots[slot].mMessage != nullptr; slot = GetNextSlot(slot))
+    {
+        if ((mSlots[slot].mMacSource == aMacSource) &&
+            MatchesFragment(*mSlots[slot].mMessage, aFragmentHeader, aFragmentLength, aIsSecure))
+        {
+            ExitNow(message = mSlots[slot].mMessage);
         }
     }
 
-    return mReassemblyList.GetHead() != nullptr;
+exit:
+    return message;
 }
 
+#endif // OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_ENABLE
+
 Error MeshForwarder::FrameToMessage(const FrameData      &aFrameData,
                                     uint16_t              aDatagramSize,
                                     const Mac::Addresses &aMacAddrs,
@@ -1563,6 +1808,7 @@ Error MeshForwarder::FrameToMessage(const FrameData      &aFrameData,
 
     aMessage = Get<MessagePool>().Allocate(Message::kTypeIp6, /* aReserveHeader */ 0, Message::Settings(priority));
     VerifyOrExit(aMessage, error = kErrorNoBufs);
+    aMessage->SetOrigin(Message::kOriginLowpan);
 
     SuccessOrExit(error = Get<Lowpan::Lowpan>().Decompress(*aMessage, aMacAddrs, frameData, aDatagramSize));
 
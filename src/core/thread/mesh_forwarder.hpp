@@ -39,11 +39,13 @@
 #include "common/as_core_type.hpp"
 #include "common/clearable.hpp"
 #include "common/frame_data.hpp"
+#include "common/linear_probing.hpp"
 #include "common/locator.hpp"
 #include "common/log.hpp"
 #include "common/non_copyable.hpp"
 #include "common/tasklet.hpp"
 #include "common/time_ticker.hpp"
+#include "common/timer.hpp"
 #include "mac/channel_mask.hpp"
 #include "mac/data_poll_sender.hpp"
 #include "mac/mac.hpp"
@@ -65,6 +67,8 @@ namespace Utils {
 class HistoryTracker;
 }
 
+class UnitTester;
+
 /**
  * @addtogroup core-mesh-forwarding
  *
@@ -171,6 +175,7 @@ class MeshForwarder : public InstanceLocator, private NonCopyable
     friend class Ip6::Ip6;
     friend class Mle::DiscoverScanner;
     friend class TimeTicker;
+    friend class UnitTester;
 
 public:
     /**
@@ -311,6 +316,22 @@ public:
      */
     void ResetCounters(void) { memset(&mIpCounters, 0, sizeof(mIpCounters)); }
 
+    /**
+     * Returns a reference to the 6LoWPAN reassembly counters.
+     *
+     * @returns A reference to the 6LoWPAN reassembly counters.
+     *
+     */
+    const otReassemblyCounters &GetReassemblyCounters(void) const { return mReassemblyCounters; }
+
+    /**
+     * Resets the 6LoWPAN reassembly counters.
+     *
+     * The number of datagrams currently being reassembled is kept, and the maximum is set to it.
+     *
+     */
+    void ResetReassemblyCounters(void);
+
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
     /**
      * Handles a deferred ack.
@@ -342,6 +363,19 @@ private:
 
     static constexpr uint32_t kTxDelayInterval = OPENTHREAD_CONFIG_MAC_COLLISION_AVOIDANCE_DELAY_INTERVAL; // In msec
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_6LOWPAN_FRAGMENT_FORWARDING_ENABLE
+    // Max payload length of a forwarded Mesh Header frame: the MAC
+    // header (FCF, sequence number, compressed PAN ID, short source
+    // and destination addresses), the auxiliary security header (key
+    // ID mode 1) and the MIC-32 are removed from `kMeshHeaderFrameMtu`
+    // along with the FCS. This is the same length as `PrepareDataFrame()`
+    // uses when it adds a Mesh Header.
+    static constexpr uint16_t kForwardFrameMaxPayloadLength =
+        kMeshHeaderFrameMtu - (Mac::Frame::kFcfSize + Mac::Frame::kDsnSize + sizeof(Mac::PanId) +
+                               2 * sizeof(Mac::ShortAddress)) -
+        (sizeof(uint8_t) + sizeof(uint32_t) + sizeof(uint8_t)) - sizeof(uint32_t) - kMeshHeaderFrameFcsSize;
+#endif
+
 #if OPENTHREAD_CONFIG_DELAY_AWARE_QUEUE_MANAGEMENT_ENABLE
     static constexpr uint32_t kTimeInQueueMarkEcn = OPENTHREAD_CONFIG_DELAY_AWARE_QUEUE_MANAGEMENT_MARK_ECN_INTERVAL;
     static constexpr uint32_t kTimeInQueueDropMsg = OPENTHREAD_CONFIG_DELAY_AWARE_QUEUE_MANAGEMENT_DROP_MSG_INTERVAL;
@@ -430,6 +464,54 @@ private:
 
         Entry mEntries[kNumEntries];
     };
+
+#if OPENTHREAD_CONFIG_6LOWPAN_FRAGMENT_FORWARDING_ENABLE
+    class FragmentForwardList : public Clearable<FragmentForwardList>
+    {
+    public:
+        class Entry : public Clearable<Entry>
+        {
+            friend class FragmentForwardList;
+
+        public:
+            Message::Priority GetPriority(void) const { return static_cast<Message::Priority>(mPriority); }
+            uint16_t          GetForwardTag(void) const { return mForwardTag; }
+            uint16_t          GetMeshDest(void) const { return mMeshDest; }
+            uint16_t          GetNextOffset(void) const { return mNextOffset; }
+            void              SetNextOffset(uint16_t aOffset) { mNextOffset = aOffset; }
+            bool              IsExpired(void) const { return (mLifetime == 0); }
+            void              DecrementLifetime(void) { mLifetime--; }
+            void              ResetLifetime(void) { mLifetime = kReassemblyTimeout; }
+
+            bool Matches(const Mac::Address &aMacSource, const Lowpan::FragmentHeader &aFragmentHeader) const
+            {
+                return (mMacSource == aMacSource) && (mDatagramTag == aFragmentHeader.GetDatagramTag()) &&
+                       (mDatagramSize == aFragmentHeader.GetDatagramSize());
+            }
+
+        private:
+            Mac::Address mMacSource;
+            uint16_t     mDatagramTag;
+            uint16_t     mDatagramSize;
+            uint16_t     mForwardTag;
+            uint16_t     mMeshDest;
+            uint16_t     mNextOffset;
+            uint8_t      mLifetime;
+            uint8_t      mPriority;
+        };
+
+        Entry *AllocateEntry(const Mac::Address           &aMacSource,
+                             const Lowpan::FragmentHeader &aFragmentHeader,
+                             uint16_t                      aForwardTag,
+                             uint16_t                      aMeshDest,
+                             Message::Priority             aPriority);
+        Entry *FindEntry(const Mac::Address &aMacSource, const Lowpan::FragmentHeader &aFragmentHeader);
+        bool   UpdateOnTimeTick(void);
+
+    private:
+        Entry mEntries[OPENTHREAD_CONFIG_6LOWPAN_FRAGMENT_FORWARDING_ENTRIES];
+    };
+#endif // OPENTHREAD_CONFIG_6LOWPAN_FRAGMENT_FORWARDING_ENABLE
 #endif // OPENTHREAD_FTD
 
     void     SendIcmpErrorIfDstUnreach(const Message &aMessage, const Mac::Addresses &aMacAddrs);
@@ -478,16 +560,53 @@ private:
     void  EvaluateRoutingCost(uint16_t aDest, uint8_t &aBestCost, uint16_t &aBestDest) const;
     Error AnycastRouteLookup(uint8_t aServiceId, AnycastType aType, uint16_t &aMeshDest) const;
     Error UpdateMeshRoute(Message &aMessage);
-    bool  UpdateReassemblyList(void);
     void  UpdateFragmentPriority(Lowpan::FragmentHeader &aFragmentHeader,
                                  uint16_t                aFragmentLength,
                                  uint16_t                aSrcRloc16,
                                  Message::Priority       aPriority);
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_6LOWPAN_FRAGMENT_FORWARDING_ENABLE
+    Error ForwardFragment(const Lowpan::FragmentHeader &aFragmentHeader,
+                          const FrameData              &aFrameData,
+                          const Mac::Addresses         &aMacAddrs,
+                          const ThreadLinkInfo         &aLinkInfo);
+    Error ForwardFirstFragment(const Lowpan::FragmentHeader &aFragmentHeader,
+                               const FrameData              &aFrameData,
+                               const Mac::Addresses         &aMacAddrs,
+                               const ThreadLinkInfo         &aLinkInfo);
+    Error LookUpFragmentForwardRoute(const Ip6::Header &aIp6Header, uint16_t &aMeshDest);
+    Error SendForwardedFragment(const FragmentForwardList::Entry &aEntry,
+                                uint16_t                          aDatagramSize,
+                                uint16_t                          aOffset,
+                                const uint8_t                    *aPayload,
+                                uint16_t                          aPayloadLength,
+                                const ThreadLinkInfo             &aLinkInfo);
+    Error SendForwardedFrame(Message::Priority     aPriority,
+                             const uint8_t        *aFrame,
+                             uint16_t              aLength,
+                             const ThreadLinkInfo &aLinkInfo);
+#endif
     Error HandleDatagram(Message &aMessage, const ThreadLinkInfo &aLinkInfo, const Mac::Address &aMacSource);
     void  ClearReassemblyList(void);
     void  RemoveMessage(Message &aMessage);
+    void  DequeueFromSendQueue(Message &aMessage);
+    void  DequeueAndFreeFromSendQueue(Message &aMessage);
     void  HandleDiscoverComplete(void);
 
+    void     AddToReassemblyList(Message &aMessage, const Mac::Address &aMacSource);
+    void     RemoveFromReassemblyList(Message &aMessage);
+    void     DropFromReassemblyList(Message &aMessage, Error aError);
+    void     UpdateReassemblyTimer(void);
+    void     HandleReassemblyTimer(void);
+    Message *FindReassemblyMessage(const Lowpan::FragmentHeader &aFragmentHeader,
+                                   uint16_t                      aFragmentLength,
+                                   const Mac::Address           &aMacSource,
+                                   bool                          aIsSecure);
+
+    static bool MatchesFragment(const Message                &aMessage,
+                                const Lowpan::FragmentHeader &aFragmentHeader,
+                                uint16_t                      aFragmentLength,
+                                bool                          aIsSecure);
+
     void          HandleReceivedFrame(Mac::RxFrame &aFrame);
     Mac::TxFrame *HandleFrameRequest(Mac::TxFrames &aTxFrames);
     Neighbor     *UpdateNeighborOnSentFrame(Mac::TxFrame       &aFrame,
@@ -568,16 +687,68 @@ private:
                        LogLevel            aLogLevel);
 #endif // #if OT_SHOULD_LOG_AT(OT_LOG_LEVEL_NOTE)
 
-    using TxTask = TaskletIn<MeshForwarder, &MeshForwarder::ScheduleTransmissionTask>;
+#if OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_ENABLE
+    class ReassemblyIndex : public LinearProbing<ReassemblyIndex>
+    {
+        // Open-addressing hash table (linear probing) of the messages
+        // in the reassembly list. The home slot is derived from the
+        // datagram tag and size (which are kept in the message), and
+        // each slot also holds the MAC source of the datagram.
+
+        friend class LinearProbing<ReassemblyIndex>;
+
+    public:
+        ReassemblyIndex(void) { Clear(); }
+
+        void     Clear(void);
+        bool     IsFull(void) const { return mNumEntries >= kMaxEntries; }
+        void     Add(Message &aMessage, const Mac::Address &aMacSource);
+        void     Remove(const Message &aMessage);
+        Message *Find(const Lowpan::FragmentHeader &aFragmentHeader,
+                      uint16_t                      aFragmentLength,
+                      const Mac::Address           &aMacSource,
+                      bool                          aIsSecure) const;
+
+    private:
+        static constexpr uint16_t kMaxEntries = OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_SIZE;
+        static constexpr uint16_t kNumSlots   = 2 * kMaxEntries; // Kept at most half full.
+
+        struct Slot
+        {
+            Message     *mMessage;
+            Mac::Address mMacSource;
+        };
+
+        static uint16_t GetHomeSlot(uint32_t aDatagramTag, uint16_t aDatagramSize);
+        uint16_t        GetNumSlots(void) const { return kNumSlots; }
+        bool            IsSlotEmpty(uint16_t aSlot) const { return mSlots[aSlot].mMessage == nullptr; }
+        uint16_t        GetHomeSlotOf(uint16_t aSlot) const;
+        void            MoveSlot(uint16_t aFromSlot, uint16_t aToSlot);
+
+        Slot     mSlots[kNumSlots];
+        uint16_t mNumEntries;
+    };
+#endif
+
+    class ReassemblyCounters : public otReassemblyCounters, public Clearable<ReassemblyCounters>
+    {
+    };
+
+    using TxTask          = TaskletIn<MeshForwarder, &MeshForwarder::ScheduleTransmissionTask>;
+    using ReassemblyTimer = TimerMilliIn<MeshForwarder, &MeshForwarder::HandleReassemblyTimer>;
 
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_COLLISION_AVOIDANCE_DELAY_ENABLE
     using TxDelayTimer = TimerMilliIn<MeshForwarder, &MeshForwarder::HandleTxDelayTimer>;
 #endif
 
-    PriorityQueue mSendQueue;
-    MessageQueue  mReassemblyList;
-    uint16_t      mFragTag;
-    uint16_t      mMessageNextOffset;
+    PriorityQueue   mSendQueue;
+    MessageQueue    mReassemblyList;
+    ReassemblyTimer mReassemblyTimer;
+    uint16_t        mFragTag;
+    uint16_t        mMessageNextOffset;
+#if OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_ENABLE
+    ReassemblyIndex mReassemblyIndex;
+#endif
 
     Message *mSendMessage;
 
@@ -595,11 +766,15 @@ private:
 
     TxTask mScheduleTransmissionTask;
 
-    otIpCounters mIpCounters;
+    otIpCounters       mIpCounters;
+    ReassemblyCounters mReassemblyCounters;
 
 #if OPENTHREAD_FTD
     FragmentPriorityList mFragmentPriorityList;
     IndirectSender       mIndirectSender;
+#if OPENTHREAD_CONFIG_6LOWPAN_FRAGMENT_FORWARDING_ENABLE
+    FragmentForwardList mFragmentForwardList;
+#endif
 #endif
 
     DataPollSender mDataPollSender;
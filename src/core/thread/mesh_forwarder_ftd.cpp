@@ -166,7 +166,7 @@ void MeshForwarder::HandleResolved(const Ip6::Address &aEid, Error aError)
         if (aError != kErrorNone)
         {
             LogMessage(kMessageDrop, message, kErrorAddressQuery);
-            mSendQueue.DequeueAndFree(message);
+            DequeueAndFreeFromSendQueue(message);
             continue;
         }
 
@@ -178,7 +178,7 @@ void MeshForwarder::HandleResolved(const Ip6::Address &aEid, Error aError)
         {
             uint8_t hopLimit;
 
-            mSendQueue.Dequeue(message);
+            DequeueFromSendQueue(message);
 
             // Avoid decreasing Hop Limit twice
             IgnoreError(message.Read(Ip6::Header::kHopLimitFieldOffset, hopLimit));
@@ -329,19 +329,11 @@ void MeshForwarder::RemoveDataResponseMessages(void)
 
         if (!(ip6Header.GetDestination().IsMulticast()))
         {
-            for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAnyExceptInvalid))
-            {
-                IgnoreError(mIndirectSender.RemoveMessageFromSleepyChild(message, child));
-            }
-        }
-
-        if (mSendMessage == &message)
-        {
-            mSendMessage = nullptr;
+            mIndirectSender.RemoveMessageFromSleepyChildren(message);
         }
 
         LogMessage(kMessageDrop, message);
-        mSendQueue.DequeueAndFree(message);
+        DequeueAndFreeFromSendQueue(message);
     }
 }
 
@@ -700,6 +692,7 @@ void MeshForwarder::HandleMesh(FrameData &aFrameData, const Mac::Address &aMacSo
         message =
             Get<MessagePool>().Allocate(Message::kType6lowpan, /* aReserveHeader */ 0, Message::Settings(priority));
         VerifyOrExit(message != nullptr, error = kErrorNoBufs);
+        message->SetOrigin(Message::kOriginLowpan);
 
         SuccessOrExit(error = meshHeader.AppendTo(*message));
         SuccessOrExit(error = message->AppendData(aFrameData));
@@ -917,6 +910,393 @@ exit:
     }
 }
 
+#if OPENTHREAD_CONFIG_6LOWPAN_FRAGMENT_FORWARDING_ENABLE
+
+Error MeshForwarder::ForwardFragment(const Lowpan::FragmentHeader &aFragmentHeader,
+                                     const FrameData              &aFrameData,
+                                     const Mac::Addresses         &aMacAddrs,
+                                     const ThreadLinkInfo         &aLinkInfo)
+{
+    // Returns `kErrorNotFound` if the fragment is not forwarded and
+    // should be reassembled instead.
+
+    Error                       error  = kErrorNotFound;
+    uint16_t                    offset = aFragmentHeader.GetDatagramOffset();
+    FragmentForwardList::Entry *entry;
+
+    VerifyOrExit(aLinkInfo.IsLinkSecurityEnabled() && !aMacAddrs.mDestination.IsBroadcast());
+    VerifyOrExit(Get<Mle::MleRouter>().IsRouterOrLeader());
+
+    entry = mFragmentForwardList.FindEntry(aMacAddrs.mSource, aFragmentHeader);
+
+    if (offset == 0)
+    {
+        VerifyOrExit(entry == nullptr, error = kErrorDuplicated);
+        ExitNow(error = ForwardFirstFragment(aFragmentHeader, aFrameData, aMacAddrs, aLinkInfo));
+    }
+
+    VerifyOrExit(entry != nullptr);
+
+    VerifyOrExit(offset + aFrameData.GetLength() <= aFragmentHeader.GetDatagramSize(), error = kErrorParse);
+
+    // Fragments are forwarded in order only, matching what the
+    // destination accepts when reassembling. A duplicate or a fragment
+    // overlapping an already forwarded one is dropped, and so is an
+    // out-of-order fragment, leaving the entry waiting for the
+    // expected offset.
+
+    VerifyOrExit(offset >= entry->GetNextOffset(), error = kErrorDuplicated);
+    VerifyOrExit(offset == entry->GetNextOffset(), error = kErrorDrop);
+
+    error = SendForwardedFragment(*entry, aFragmentHeader.GetDatagramSize(), offset, aFrameData.GetBytes(),
+                                  aFrameData.GetLength(), aLinkInfo);
+
+    if ((error != kErrorNone) || (offset + aFrameData.GetLength() >= aFragmentHeader.GetDatagramSize()))
+    {
+        entry->Clear();
+    }
+    else
+    {
+        entry->SetNextOffset(offset + aFrameData.GetLength());
+        entry->ResetLifetime();
+    }
+
+exit:
+    return error;
+}
+
+Error MeshForwarder::ForwardFirstFragment(const Lowpan::FragmentHeader &aFragmentHeader,
+                                          const FrameData              &aFrameData,
+                                          const Mac::Addresses         &aMacAddrs,
+                                          const ThreadLinkInfo         &aLinkInfo)
+{
+    Error                             error     = kErrorNotFound;
+    FrameData                         frameData = aFrameData;
+    Message                          *message   = nullptr;
+    FragmentForwardList::Entry       *entry;
+    Message::Priority                 priority;
+    Ip6::Header                       ip6Header;
+    uint16_t                          meshDest;
+    uint16_t                          forwardTag;
+    uint16_t                          fragHeaderOffset;
+    uint16_t                          payloadLength;
+    Mac::Addresses                    meshAddrs;
+    Lowpan::MeshHeader                meshHeader;
+    Lowpan::FragmentHeader::FirstFrag firstFragHeader;
+    FrameBuilder                      frameBuilder;
+    uint8_t                           frame[kForwardFrameMaxPayloadLength];
+
+    VerifyOrExit(GetFramePriority(frameData, aMacAddrs, priority) == kErrorNone);
+
+    message = Get<MessagePool>().Allocate(Message::kTypeIp6, /* aReserveHeader */ 0, Message::Settings(priority));
+    VerifyOrExit(message != nullptr);
+    message->SetOrigin(Message::kOriginLowpan);
+
+    VerifyOrExit(Get<Lowpan::Lowpan>().Decompress(*message, aMacAddrs, frameData,
+                                                  aFragmentHeader.GetDatagramSize()) == kErrorNone);
+    IgnoreError(message->Read(0, ip6Header));
+
+    // Only datagrams whose upper-layer header directly follows the
+    // IPv6 header are forwarded, subject to the same checks as in
+    // `Ip6::HandleDatagram()`. Any other datagram is reassembled.
+
+    switch (ip6Header.GetNextHeader())
+    {
+    case Ip6::kProtoUdp:
+    case Ip6::kProtoTcp:
+        break;
+
+    case Ip6::kProtoIcmp6:
+        VerifyOrExit(frameData.CanRead(sizeof(uint8_t)));
+        VerifyOrExit(Ip6::Ip6::IsForwardableIcmpType(frameData.GetBytes()[0]));
+        break;
+
+    default:
+        ExitNow();
+    }
+
+    VerifyOrExit(ip6Header.GetHopLimit() > 1);
+    SuccessOrExit(LookUpFragmentForwardRoute(ip6Header, meshDest));
+
+    ip6Header.SetHopLimit(ip6Header.GetHopLimit() - 1);
+    message->Write(0, ip6Header);
+    message->SetOffset(0);
+
+    // Re-compress the IPv6 header using the Mesh Header addresses and
+    // prepare the first fragment frame. The rest of the received
+    // fragment that does not fit is sent as a "next fragment".
+
+    meshAddrs.mSource.SetShort(Get<Mac::Mac>().GetShortAddress());
+    meshAddrs.mDestination.SetShort(meshDest);
+
+    frameBuilder.Init(frame, sizeof(frame));
+
+    meshHeader.Init(meshAddrs.mSource.GetShort(), meshDest, kMeshHeaderHopsLeft);
+    IgnoreError(meshHeader.AppendTo(frameBuilder));
+
+    fragHeaderOffset = frameBuilder.GetLength();
+    frameBuilder.SetMaxLength(sizeof(frame) - sizeof(Lowpan::FragmentHeader::FirstFrag));
+
+    VerifyOrExit(Get<Lowpan::Lowpan>().Compress(*message, meshAddrs, frameBuilder) == kErrorNone);
+    VerifyOrExit(message->GetOffset() == message->GetLength());
+
+    frameBuilder.SetMaxLength(sizeof(frame));
+
+    if (mFragTag == 0)
+    {
+        mFragTag++;
+    }
+
+    forwardTag = mFragTag++;
+
+    firstFragHeader.Init(aFragmentHeader.GetDatagramSize(), forwardTag);
+    IgnoreError(frameBuilder.Insert(fragHeaderOffset, firstFragHeader));
+
+    payloadLength = frameData.GetLength();
+
+    if (payloadLength > frameBuilder.GetRemainingLength())
+    {
+        payloadLength = (frameBuilder.GetRemainingLength() & ~0x7);
+    }
+
+    IgnoreError(frameBuilder.AppendBytes(frameData.GetBytes(), payloadLength));
+
+    entry = mFragmentForwardList.AllocateEntry(aMacAddrs.mSource, aFragmentHeader, forwardTag, meshDest, priority);
+    VerifyOrExit(entry != nullptr);
+
+    error = SendForwardedFrame(priority, frame, frameBuilder.GetLength(), aLinkInfo);
+
+    frameData.SkipOver(payloadLength);
+
+    if ((error == kErrorNone) && (frameData.GetLength() > 0))
+    {
+        error = SendForwardedFragment(*entry, aFragmentHeader.GetDatagramSize(), message->GetLength() + payloadLength,
+                                      frameData.GetBytes(), frameData.GetLength(), aLinkInfo);
+    }
+
+    if ((error != kErrorNone) ||
+        (message->GetLength() + payloadLength + frameData.GetLength() >= aFragmentHeader.GetDatagramSize()))
+    {
+        entry->Clear();
+    }
+    else
+    {
+        entry->SetNextOffset(message->GetLength() + payloadLength + frameData.GetLength());
+        Get<TimeTicker>().RegisterReceiver(TimeTicker::kMeshForwarder);
+    }
+
+    SuccessOrExit(error);
+
+    mReassemblyCounters.mForwardedDatagrams++;
+    UpdateRoutes(aFrameData, aMacAddrs);
+
+exit:
+    FreeMessage(message);
+    return error;
+}
+
+Error MeshForwarder::LookUpFragmentForwardRoute(const Ip6::Header &aIp6Header, uint16_t &aMeshDest)
+{
+    Mle::MleRouter     &mle         = Get<Mle::MleRouter>();
+    const Ip6::Address &destination = aIp6Header.GetDestination();
+    Error               error       = kErrorNotFound;
+    uint16_t            meshDest    = Mac::kShortAddrInvalid;
+    Neighbor           *neighbor;
+
+    VerifyOrExit(!destination.IsMulticast() && !destination.IsLinkLocal() && !mle.IsAnycastLocator(destination));
+    VerifyOrExit(!Get<ThreadNetif>().HasUnicastAddress(destination));
+
+    if (mle.IsRoutingLocator(destination))
+    {
+        meshDest = destination.GetIid().GetLocator();
+    }
+    else if ((neighbor = Get<NeighborTable>().FindNeighbor(destination)) != nullptr)
+    {
+        meshDest = neighbor->GetRloc16();
+    }
+    else if (Get<NetworkData::Leader>().IsOnMesh(destination))
+    {
+#if OPENTHREAD_CONFIG_BACKBONE_ROUTER_DUA_NDPROXYING_ENABLE
+        VerifyOrExit(!Get<BackboneRouter::Manager>().ShouldForwardDuaToBackbone(destination));
+#endif
+        // Only use the address cache here. If the EID is not cached
+        // the datagram is reassembled and the Address Query is sent
+        // when it is forwarded.
+        meshDest = Get<AddressResolver>().LookUp(destination);
+    }
+    else
+    {
+        IgnoreError(Get<NetworkData::Leader>().RouteLookup(aIp6Header.GetSource(), destination, meshDest));
+    }
+
+    // Datagrams to this router or to one of its children are
+    // reassembled.
+
+    VerifyOrExit(meshDest != Mac::kShortAddrInvalid);
+    VerifyOrExit(!Mle::RouterIdMatch(meshDest, Get<Mac::Mac>().GetShortAddress()));
+    VerifyOrExit(mle.GetNextHop(meshDest) != Mac::kShortAddrInvalid);
+
+    aMeshDest = meshDest;
+    error     = kErrorNone;
+
+exit:
+    return error;
+}
+
+Error MeshForwarder::SendForwardedFragment(const FragmentForwardList::Entry &aEntry,
+                                           uint16_t                          aDatagramSize,
+                                           uint16_t                          aOffset,
+                                           const uint8_t                    *aPayload,
+                                           uint16_t                          aPayloadLength,
+                                           const ThreadLinkInfo             &aLinkInfo)
+{
+    Error error = kErrorNone;
+
+    // A received fragment is split over two or more frames if it does
+    // not fit along with the Mesh Header. Every frame except the last
+    // one of the datagram must carry a multiple of 8 bytes.
+
+    while (aPayloadLength > 0)
+    {
+        Lowpan::MeshHeader               meshHeader;
+        Lowpan::FragmentHeader::NextFrag nextFragHeader;
+        FrameBuilder                     frameBuilder;
+        uint8_t                          frame[kForwardFrameMaxPayloadLength];
+        uint16_t                         length;
+
+        frameBuilder.Init(frame, sizeof(frame));
+
+        meshHeader.Init(Get<Mac::Mac>().GetShortAddress(), aEntry.GetMeshDest(), kMeshHeaderHopsLeft);
+        IgnoreError(meshHeader.AppendTo(frameBuilder));
+
+        nextFragHeader.Init(aDatagramSize, aEntry.GetForwardTag(), aOffset);
+        IgnoreError(frameBuilder.Append(nextFragHeader));
+
+        length = aPayloadLength;
+
+        if (length > frameBuilder.GetRemainingLength())
+        {
+            length = (frameBuilder.GetRemainingLength() & ~0x7);
+        }
+
+        IgnoreError(frameBuilder.AppendBytes(aPayload, length));
+
+        SuccessOrExit(error = SendForwardedFrame(aEntry.GetPriority(), frame, frameBuilder.GetLength(), aLinkInfo));
+
+        aPayload += length;
+        aPayloadLength -= length;
+        aOffset += length;
+    }
+
+exit:
+    return error;
+}
+
+Error MeshForwarder::SendForwardedFrame(Message::Priority     aPriority,
+                                        const uint8_t        *aFrame,
+                                        uint16_t              aLength,
+                                        const ThreadLinkInfo &aLinkInfo)
+{
+    Error    error = kErrorNone;
+    Message *message;
+
+    message = Get<MessagePool>().Allocate(Message::kType6lowpan, /* aReserveHeader */ 0, Message::Settings(aPriority));
+    VerifyOrExit(message != nullptr, error = kErrorNoBufs);
+    message->SetOrigin(Message::kOriginLowpan);
+
+    SuccessOrExit(error = message->AppendBytes(aFrame, aLength));
+
+    message->SetLinkInfo(aLinkInfo);
+
+#if OPENTHREAD_CONFIG_MULTI_RADIO
+    // Clear the radio type to allow the radio type for tx to be
+    // selected based on the radios supported by the next hop.
+    message->ClearRadioType();
+#endif
+
+    IgnoreError(SendMessage(*message));
+    message = nullptr;
+
+exit:
+    FreeMessage(message);
+    return error;
+}
+
+bool MeshForwarder::FragmentForwardList::UpdateOnTimeTick(void)
+{
+    bool continueRxingTicks = false;
+
+    for (Entry &entry : mEntries)
+    {
+        if (!entry.IsExpired())
+        {
+            entry.DecrementLifetime();
+
+            if (!entry.IsExpired())
+            {
+                continueRxingTicks = true;
+            }
+        }
+    }
+
+    return continueRxingTicks;
+}
+
+MeshForwarder::FragmentForwardList::Entry *MeshForwarder::FragmentForwardList::FindEntry(
+    const Mac::Address           &aMacSource,
+    const Lowpan::FragmentHeader &aFragmentHeader)
+{
+    Entry *rval = nullptr;
+
+    for (Entry &entry : mEntries)
+    {
+        if (!entry.IsExpired() && entry.Matches(aMacSource, aFragmentHeader))
+        {
+            rval = &entry;
+            break;
+        }
+    }
+
+    return rval;
+}
+
+MeshForwarder::FragmentForwardList::Entry *MeshForwarder::FragmentForwardList::AllocateEntry(
+    const Mac::Address           &aMacSource,
+    const Lowpan::FragmentHeader &aFragmentHeader,
+    uint16_t                      aForwardTag,
+    uint16_t                      aMeshDest,
+    Message::Priority             aPriority)
+{
+    Entry *newEntry = nullptr;
+
+    OT_ASSERT(FindEntry(aMacSource, aFragmentHeader) == nullptr);
+
+    for (Entry &entry : mEntries)
+    {
+        if (entry.IsExpired())
+        {
+            newEntry = &entry;
+            break;
+        }
+    }
+
+    VerifyOrExit(newEntry != nullptr);
+
+    newEntry->Clear();
+    newEntry->mMacSource    = aMacSource;
+    newEntry->mDatagramTag  = aFragmentHeader.GetDatagramTag();
+    newEntry->mDatagramSize = aFragmentHeader.GetDatagramSize();
+    newEntry->mForwardTag   = aForwardTag;
+    newEntry->mMeshDest     = aMeshDest;
+    newEntry->mPriority     = aPriority;
+    newEntry->ResetLifetime();
+
+exit:
+    return newEntry;
+}
+
+#endif // OPENTHREAD_CONFIG_6LOWPAN_FRAGMENT_FORWARDING_ENABLE
+
 // LCOV_EXCL_START
 
 #if OT_SHOULD_LOG_AT(OT_LOG_LEVEL_NOTE)
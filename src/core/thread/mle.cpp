@@ -1131,7 +1131,10 @@ exit:
 
 void Mle::InitNeighbor(Neighbor &aNeighbor, const RxInfo &aRxInfo)
 {
-    aRxInfo.mMessageInfo.GetPeerAddr().GetIid().ConvertToExtAddress(aNeighbor.GetExtAddress());
+    Mac::ExtAddress extAddress;
+
+    aRxInfo.mMessageInfo.GetPeerAddr().GetIid().ConvertToExtAddress(extAddress);
+    aNeighbor.SetExtAddress(extAddress);
     aNeighbor.GetLinkInfo().Clear();
     aNeighbor.GetLinkInfo().AddRss(aRxInfo.mMessageInfo.GetThreadLinkInfo()->GetRss());
     aNeighbor.ResetLinkFailures();
@@ -4449,6 +4452,7 @@ Mle::TxMessage *Mle::NewMleMessage(Command aCommand)
 
     message = static_cast<TxMessage *>(mSocket.NewMessage(0, settings));
     VerifyOrExit(message != nullptr, error = kErrorNoBufs);
+    message->SetOrigin(Message::kOriginMle);
 
     securitySuite = k154Security;
     subType       = Message::kSubTypeMleGeneral;
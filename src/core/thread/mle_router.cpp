@@ -1631,7 +1631,11 @@ void MleRouter::HandleTimeTick(void)
         OT_ASSERT(false);
     }
 
-    // update children state
+    // update children state, the source match table changes for the
+    // removed children and the queued Child Update Requests (e.g., to
+    // all the restored children after a reset) are applied at once.
+    Get<SourceMatchController>().BeginUpdate();
+
     for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAnyExceptInvalid))
     {
         uint32_t timeout = 0;
@@ -1675,6 +1679,8 @@ void MleRouter::HandleTimeTick(void)
         }
     }
 
+    Get<SourceMatchController>().CommitUpdate();
+
     // update router state
     for (Router &router : Get<RouterTable>())
     {
@@ -113,33 +113,85 @@ Error LeaderBase::GetPreferredNat64Prefix(ExternalRouteConfig &aConfig) const
     return error;
 }
 
-const PrefixTlv *LeaderBase::FindNextMatchingPrefixTlv(const Ip6::Address &aAddress, const PrefixTlv *aPrevTlv) const
+void LeaderBase::UpdatePrefixTable(void)
 {
-    // This method iterates over Prefix TLVs which match a given IPv6
-    // `aAddress`. If `aPrevTlv` is `nullptr` we start from the
-    // beginning. Otherwise, we search for a match after `aPrevTlv`.
-    // This method returns a pointer to the next matching Prefix TLV
-    // when found, or `nullptr` if no match is found.
+    // Compiles the Prefix TLVs into `mPrefixTable` and their route
+    // entries into `mRouteTable`. Both tables are large enough for
+    // any Network Data (each entry takes at least as many bytes in
+    // the Network Data as its table is sized by).
 
+    TlvIterator      tlvIterator(GetTlvsStart(), GetTlvsEnd());
     const PrefixTlv *prefixTlv;
-    TlvIterator      tlvIterator((aPrevTlv == nullptr) ? GetTlvsStart() : aPrevTlv->GetNext(), GetTlvsEnd());
+
+    mPrefixTable.Clear();
+    mRouteTable.Clear();
 
     while ((prefixTlv = tlvIterator.Iterate<PrefixTlv>()) != nullptr)
     {
-        if (aAddress.MatchesPrefix(prefixTlv->GetPrefix(), prefixTlv->GetPrefixLength()))
+        PrefixEntry           *prefixEntry = mPrefixTable.PushBack();
+        const ContextTlv      *contextTlv  = prefixTlv->FindSubTlv<ContextTlv>();
+        TlvIterator            subTlvIterator(*prefixTlv);
+        const HasRouteTlv     *hasRouteTlv;
+        const BorderRouterTlv *brTlv;
+
+        OT_ASSERT(prefixEntry != nullptr);
+
+        prefixTlv->CopyPrefixTo(prefixEntry->mPrefix);
+        prefixEntry->mDomainId   = prefixTlv->GetDomainId();
+        prefixEntry->mHasContext = (contextTlv != nullptr);
+        prefixEntry->mContextId  = (contextTlv != nullptr) ? contextTlv->GetContextId() : 0;
+        prefixEntry->mIsCompress = (contextTlv != nullptr) && contextTlv->IsCompress();
+        prefixEntry->mIsOnMesh   = false;
+
+        prefixEntry->mHasRouteStart = static_cast<uint8_t>(mRouteTable.GetLength());
+
+        while ((hasRouteTlv = subTlvIterator.Iterate<HasRouteTlv>()) != nullptr)
         {
-            break;
+            for (const HasRouteEntry *entry = hasRouteTlv->GetFirstEntry(); entry <= hasRouteTlv->GetLastEntry();
+                 entry                      = entry->GetNext())
+            {
+                RouteEntry *routeEntry = mRouteTable.PushBack();
+
+                OT_ASSERT(routeEntry != nullptr);
+                routeEntry->mRloc16     = entry->GetRloc();
+                routeEntry->mPreference = entry->GetPreference();
+            }
+        }
+
+        prefixEntry->mHasRouteEnd = static_cast<uint8_t>(mRouteTable.GetLength());
+
+        subTlvIterator = TlvIterator(*prefixTlv);
+
+        while ((brTlv = subTlvIterator.Iterate<BorderRouterTlv>()) != nullptr)
+        {
+            for (const BorderRouterEntry *entry = brTlv->GetFirstEntry(); entry <= brTlv->GetLastEntry();
+                 entry                          = entry->GetNext())
+            {
+                RouteEntry *routeEntry;
+
+                if (entry->IsOnMesh())
+                {
+                    prefixEntry->mIsOnMesh = true;
+                }
+
+                if (!entry->IsDefaultRoute())
+                {
+                    continue;
+                }
+
+                routeEntry = mRouteTable.PushBack();
+                OT_ASSERT(routeEntry != nullptr);
+                routeEntry->mRloc16     = entry->GetRloc();
+                routeEntry->mPreference = entry->GetPreference();
+            }
         }
-    }
 
-    return prefixTlv;
+        prefixEntry->mDefaultRouteEnd = static_cast<uint8_t>(mRouteTable.GetLength());
+    }
 }
 
 Error LeaderBase::GetContext(const Ip6::Address &aAddress, Lowpan::Context &aContext) const
 {
-    const PrefixTlv  *prefixTlv = nullptr;
-    const ContextTlv *contextTlv;
-
     aContext.mPrefix.SetLength(0);
 
     if (Get<Mle::MleRouter>().IsMeshLocalAddress(aAddress))
@@ -147,20 +199,18 @@ Error LeaderBase::GetContext(const Ip6::Address &aAddress, Lowpan::Context &aCon
         GetContextForMeshLocalPrefix(aContext);
     }
 
-    while ((prefixTlv = FindNextMatchingPrefixTlv(aAddress, prefixTlv)) != nullptr)
+    for (const PrefixEntry &prefixEntry : mPrefixTable)
     {
-        contextTlv = prefixTlv->FindSubTlv<ContextTlv>();
-
-        if (contextTlv == nullptr)
+        if (!prefixEntry.mHasContext || !prefixEntry.Matches(aAddress))
         {
             continue;
         }
 
-        if (prefixTlv->GetPrefixLength() > aContext.mPrefix.GetLength())
+        if (prefixEntry.mPrefix.GetLength() > aContext.mPrefix.GetLength())
         {
-            prefixTlv->CopyPrefixTo(aContext.mPrefix);
-            aContext.mContextId    = contextTlv->GetContextId();
-            aContext.mCompressFlag = contextTlv->IsCompress();
+            aContext.mPrefix       = prefixEntry.mPrefix;
+            aContext.mContextId    = prefixEntry.mContextId;
+            aContext.mCompressFlag = prefixEntry.mIsCompress;
             aContext.mIsValid      = true;
         }
     }
@@ -210,26 +260,15 @@ void LeaderBase::GetContextForMeshLocalPrefix(Lowpan::Context &aContext) const
 
 bool LeaderBase::IsOnMesh(const Ip6::Address &aAddress) const
 {
-    const PrefixTlv *prefixTlv = nullptr;
-    bool             isOnMesh  = false;
+    bool isOnMesh = false;
 
     VerifyOrExit(!Get<Mle::MleRouter>().IsMeshLocalAddress(aAddress), isOnMesh = true);
 
-    while ((prefixTlv = FindNextMatchingPrefixTlv(aAddress, prefixTlv)) != nullptr)
+    for (const PrefixEntry &prefixEntry : mPrefixTable)
     {
-        TlvIterator            subTlvIterator(*prefixTlv);
-        const BorderRouterTlv *brTlv;
-
-        while ((brTlv = subTlvIterator.Iterate<BorderRouterTlv>()) != nullptr)
+        if (prefixEntry.mIsOnMesh && prefixEntry.Matches(aAddress))
         {
-            for (const BorderRouterEntry *entry = brTlv->GetFirstEntry(); entry <= brTlv->GetLastEntry();
-                 entry                          = entry->GetNext())
-            {
-                if (entry->IsOnMesh())
-                {
-                    ExitNow(isOnMesh = true);
-                }
-            }
+            ExitNow(isOnMesh = true);
         }
     }
 
@@ -239,17 +278,21 @@ exit:
 
 Error LeaderBase::RouteLookup(const Ip6::Address &aSource, const Ip6::Address &aDestination, uint16_t &aRloc16) const
 {
-    Error            error     = kErrorNoRoute;
-    const PrefixTlv *prefixTlv = nullptr;
+    Error error = kErrorNoRoute;
 
-    while ((prefixTlv = FindNextMatchingPrefixTlv(aSource, prefixTlv)) != nullptr)
+    for (const PrefixEntry &prefixEntry : mPrefixTable)
     {
-        if (ExternalRouteLookup(prefixTlv->GetDomainId(), aDestination, aRloc16) == kErrorNone)
+        if (!prefixEntry.Matches(aSource))
+        {
+            continue;
+        }
+
+        if (ExternalRouteLookup(prefixEntry.mDomainId, aDestination, aRloc16) == kErrorNone)
         {
             ExitNow(error = kErrorNone);
         }
 
-        if (DefaultRouteLookup(*prefixTlv, aRloc16) == kErrorNone)
+        if (DefaultRouteLookup(prefixEntry, aRloc16) == kErrorNone)
         {
             ExitNow(error = kErrorNone);
         }
@@ -262,7 +305,7 @@ exit:
 template <typename EntryType>
 int LeaderBase::CompareRouteEntries(const EntryType &aFirst, const EntryType &aSecond) const
 {
-    // `EntryType` can be `HasRouteEntry` or `BorderRouterEntry`.
+    // `EntryType` is `RouteEntry`.
 
     return CompareRouteEntries(aFirst.GetPreference(), aFirst.GetRloc(), aSecond.GetPreference(), aSecond.GetRloc());
 }
@@ -309,18 +352,15 @@ exit:
 
 Error LeaderBase::ExternalRouteLookup(uint8_t aDomainId, const Ip6::Address &aDestination, uint16_t &aRloc16) const
 {
-    Error                error           = kErrorNoRoute;
-    const PrefixTlv     *prefixTlv       = nullptr;
-    const HasRouteEntry *bestRouteEntry  = nullptr;
-    uint8_t              bestMatchLength = 0;
+    Error             error           = kErrorNoRoute;
+    const RouteEntry *bestRouteEntry  = nullptr;
+    uint8_t           bestMatchLength = 0;
 
-    while ((prefixTlv = FindNextMatchingPrefixTlv(aDestination, prefixTlv)) != nullptr)
+    for (const PrefixEntry &prefixEntry : mPrefixTable)
     {
-        const HasRouteTlv *hasRoute;
-        uint8_t            prefixLength = prefixTlv->GetPrefixLength();
-        TlvIterator        subTlvIterator(*prefixTlv);
+        uint8_t prefixLength = prefixEntry.mPrefix.GetLength();
 
-        if (prefixTlv->GetDomainId() != aDomainId)
+        if ((prefixEntry.mDomainId != aDomainId) || !prefixEntry.Matches(aDestination))
         {
             continue;
         }
@@ -330,17 +370,15 @@ Error LeaderBase::ExternalRouteLookup(uint8_t aDomainId, const Ip6::Address &aDe
             continue;
         }
 
-        while ((hasRoute = subTlvIterator.Iterate<HasRouteTlv>()) != nullptr)
+        for (uint8_t index = prefixEntry.mHasRouteStart; index < prefixEntry.mHasRouteEnd; index++)
         {
-            for (const HasRouteEntry *entry = hasRoute->GetFirstEntry(); entry <= hasRoute->GetLastEntry();
-                 entry                      = entry->GetNext())
+            const RouteEntry &entry = mRouteTable[index];
+
+            if ((bestRouteEntry == nullptr) || (prefixLength > bestMatchLength) ||
+                CompareRouteEntries(entry, *bestRouteEntry) > 0)
             {
-                if ((bestRouteEntry == nullptr) || (prefixLength > bestMatchLength) ||
-                    CompareRouteEntries(*entry, *bestRouteEntry) > 0)
-                {
-                    bestRouteEntry  = entry;
-                    bestMatchLength = prefixLength;
-                }
+                bestRouteEntry  = &entry;
+                bestMatchLength = prefixLength;
             }
         }
     }
@@ -354,27 +392,18 @@ Error LeaderBase::ExternalRouteLookup(uint8_t aDomainId, const Ip6::Address &aDe
     return error;
 }
 
-Error LeaderBase::DefaultRouteLookup(const PrefixTlv &aPrefix, uint16_t &aRloc16) const
+Error LeaderBase::DefaultRouteLookup(const PrefixEntry &aPrefix, uint16_t &aRloc16) const
 {
-    Error                    error = kErrorNoRoute;
-    TlvIterator              subTlvIterator(aPrefix);
-    const BorderRouterTlv   *brTlv;
-    const BorderRouterEntry *route = nullptr;
+    Error             error = kErrorNoRoute;
+    const RouteEntry *route = nullptr;
 
-    while ((brTlv = subTlvIterator.Iterate<BorderRouterTlv>()) != nullptr)
+    for (uint8_t index = aPrefix.mHasRouteEnd; index < aPrefix.mDefaultRouteEnd; index++)
     {
-        for (const BorderRouterEntry *entry = brTlv->GetFirstEntry(); entry <= brTlv->GetLastEntry();
-             entry                          = entry->GetNext())
-        {
-            if (!entry->IsDefaultRoute())
-            {
-                continue;
-            }
+        const RouteEntry &entry = mRouteTable[index];
 
-            if (route == nullptr || CompareRouteEntries(*entry, *route) > 0)
-            {
-                route = entry;
-            }
+        if (route == nullptr || CompareRouteEntries(entry, *route) > 0)
+        {
+            route = &entry;
         }
     }
 
@@ -539,6 +568,9 @@ Error LeaderBase::SteeringDataCheckJoiner(const MeshCoP::JoinerDiscerner &aDisce
 
 void LeaderBase::SignalNetDataChanged(void)
 {
+    // Called whenever the Network Data (and its version) changes.
+
+    UpdatePrefixTable();
     mMaxLength = Max(mMaxLength, GetLength());
     Get<ot::Notifier>().Signal(kEventThreadNetdataChanged);
 }
@@ -39,6 +39,7 @@
 #include <stdint.h>
 
 #include "coap/coap.hpp"
+#include "common/array.hpp"
 #include "common/const_cast.hpp"
 #include "common/timer.hpp"
 #include "net/ip6_address.hpp"
@@ -306,8 +307,45 @@ protected:
 private:
     using FilterIndexes = MeshCoP::SteeringData::HashBitIndexes;
 
-    const PrefixTlv *FindNextMatchingPrefixTlv(const Ip6::Address &aAddress, const PrefixTlv *aPrevTlv) const;
+    // The Prefix TLVs are compiled into `mPrefixTable` (in the same
+    // order as in the Network Data) whenever the Network Data changes,
+    // so that the lookups (on each forwarded or compressed datagram)
+    // only match the addresses against the prefixes. The Has Route
+    // entries and the default route Border Router entries of each
+    // prefix are saved in `mRouteTable`.
 
+    static constexpr uint8_t kMaxPrefixEntries = kMaxSize / sizeof(PrefixTlv);
+    static constexpr uint8_t kMaxRouteEntries  = kMaxSize / sizeof(HasRouteEntry);
+
+    struct RouteEntry
+    {
+        uint16_t GetRloc(void) const { return mRloc16; }
+        int8_t   GetPreference(void) const { return mPreference; }
+
+        uint16_t mRloc16;
+        int8_t   mPreference;
+    };
+
+    // The Has Route entries of a prefix are the `mRouteTable` entries
+    // from `mHasRouteStart` up to `mHasRouteEnd`, followed by its
+    // default route entries up to `mDefaultRouteEnd`.
+
+    struct PrefixEntry
+    {
+        bool Matches(const Ip6::Address &aAddress) const { return aAddress.MatchesPrefix(mPrefix); }
+
+        Ip6::Prefix mPrefix;
+        uint8_t     mDomainId;
+        uint8_t     mContextId;
+        bool        mHasContext : 1;
+        bool        mIsCompress : 1;
+        bool        mIsOnMesh : 1;
+        uint8_t     mHasRouteStart;
+        uint8_t     mHasRouteEnd;
+        uint8_t     mDefaultRouteEnd;
+    };
+
+    void UpdatePrefixTable(void);
     void RemoveCommissioningData(void);
 
     template <typename EntryType> int CompareRouteEntries(const EntryType &aFirst, const EntryType &aSecond) const;
@@ -317,12 +355,14 @@ private:
                                                           uint16_t aSecondRloc) const;
 
     Error ExternalRouteLookup(uint8_t aDomainId, const Ip6::Address &aDestination, uint16_t &aRloc16) const;
-    Error DefaultRouteLookup(const PrefixTlv &aPrefix, uint16_t &aRloc16) const;
+    Error DefaultRouteLookup(const PrefixEntry &aPrefix, uint16_t &aRloc16) const;
     Error SteeringDataCheck(const FilterIndexes &aFilterIndexes) const;
     void  GetContextForMeshLocalPrefix(Lowpan::Context &aContext) const;
 
-    uint8_t mTlvBuffer[kMaxSize];
-    uint8_t mMaxLength;
+    uint8_t                               mTlvBuffer[kMaxSize];
+    uint8_t                               mMaxLength;
+    Array<PrefixEntry, kMaxPrefixEntries> mPrefixTable;
+    Array<RouteEntry, kMaxRouteEntries>   mRouteTable;
 };
 
 /**
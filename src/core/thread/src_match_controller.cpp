@@ -53,6 +53,7 @@ RegisterLogModule("SrcMatchCtrl");
 SourceMatchController::SourceMatchController(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mEnabled(false)
+    , mUpdateDepth(0)
 {
     ClearTable();
 }
@@ -111,6 +112,57 @@ exit:
     return;
 }
 
+void SourceMatchController::BeginUpdate(void)
+{
+    if (mUpdateDepth++ == 0)
+    {
+        Get<Radio>().BeginSrcMatchUpdate();
+    }
+}
+
+void SourceMatchController::CommitUpdate(void)
+{
+    Error error;
+
+    OT_ASSERT(mUpdateDepth > 0);
+    VerifyOrExit(--mUpdateDepth == 0);
+
+    error = Get<Radio>().CommitSrcMatchUpdate();
+
+    if (error != kErrorNone)
+    {
+        LogWarn("Failed to commit update -- %s, rebuilding table", ErrorToString(error));
+        Rebuild();
+    }
+
+exit:
+    return;
+}
+
+void SourceMatchController::Rebuild(void)
+{
+    // The radio may have applied only part of the failed batch (e.g.,
+    // enabled source matching on top of a partial table), so source
+    // matching is disabled first. All the children with indirect
+    // messages are then marked as pending and added back to the cleared
+    // table outside of any batch, so each add reports whether the entry
+    // is actually in the radio table. Source matching is only enabled
+    // again once all of them are added, and is left disabled if some of
+    // them do not fit.
+
+    OT_ASSERT(mUpdateDepth == 0);
+
+    Enable(false);
+    ClearTable();
+
+    for (Child &child : Get<ChildTable>().Iterate(Child::kInStateValidOrRestoring))
+    {
+        child.SetIndirectSourceMatchPending(child.GetIndirectMessageCount() > 0);
+    }
+
+    Enable(AddPendingEntries() == kErrorNone);
+}
+
 void SourceMatchController::ClearTable(void)
 {
     Get<Radio>().ClearSrcMatchShortEntries();
@@ -131,8 +183,7 @@ void SourceMatchController::AddEntry(Child &aChild)
 
     if (!IsEnabled())
     {
-        SuccessOrExit(AddPendingEntries());
-        Enable(true);
+        EnableWithPendingEntries();
     }
     else
     {
@@ -200,14 +251,25 @@ void SourceMatchController::ClearEntry(Child &aChild)
 
     if (!IsEnabled())
     {
-        SuccessOrExit(AddPendingEntries());
-        Enable(true);
+        EnableWithPendingEntries();
     }
 
 exit:
     return;
 }
 
+void SourceMatchController::EnableWithPendingEntries(void)
+{
+    BeginUpdate();
+
+    if (AddPendingEntries() == kErrorNone)
+    {
+        Enable(true);
+    }
+
+    CommitUpdate();
+}
+
 Error SourceMatchController::AddPendingEntries(void)
 {
     Error error = kErrorNone;
@@ -121,6 +121,23 @@ public:
      */
     void SetSrcMatchAsShort(Child &aChild, bool aUseShortAddress);
 
+    /**
+     * Begins a batch of source match table updates.
+     *
+     * The source match table changes until the matching `CommitUpdate()` are applied by the radio at once (e.g., in a
+     * single transaction with the RCP). Calls can be nested, the changes are applied by the outermost `CommitUpdate()`.
+     *
+     */
+    void BeginUpdate(void);
+
+    /**
+     * Commits the source match table updates since the matching `BeginUpdate()`.
+     *
+     * If the radio fails to apply the batched changes, the source match table is rebuilt entry by entry.
+     *
+     */
+    void CommitUpdate(void);
+
 private:
     /**
      * Clears the source match table.
@@ -186,7 +203,22 @@ private:
      */
     Error AddPendingEntries(void);
 
-    bool mEnabled;
+    /**
+     * Adds all pending entries to the source match table in one batch and enables source matching if they all fit.
+     *
+     */
+    void EnableWithPendingEntries(void);
+
+    /**
+     * Rebuilds the source match table entry by entry after a batched update failed.
+     *
+     * Source matching is disabled until all the children with indirect messages are added back to the table.
+     *
+     */
+    void Rebuild(void);
+
+    bool    mEnabled;
+    uint8_t mUpdateDepth;
 };
 
 /**
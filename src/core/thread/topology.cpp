@@ -44,8 +44,17 @@ namespace ot {
 
 void Neighbor::SetState(State aState)
 {
+    bool updateIndex;
+
     VerifyOrExit(mState != aState);
-    mState = static_cast<uint8_t>(aState);
+
+    updateIndex = (mState == kStateInvalid) || (aState == kStateInvalid);
+    mState      = static_cast<uint8_t>(aState);
+
+    if (updateIndex)
+    {
+        UpdateChildTableIndex();
+    }
 
 #if OPENTHREAD_CONFIG_UPTIME_ENABLE
     if (mState == kStateValid)
@@ -87,6 +96,28 @@ exit:
     return matches;
 }
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+void Neighbor::UpdateChildTableIndex(void)
+{
+    ChildTable &childTable = Get<ChildTable>();
+
+    if (childTable.Contains(*this))
+    {
+        childTable.UpdateIndex(*static_cast<Child *>(this));
+    }
+}
+
+void Child::UpdateChildTableIp6Index(void)
+{
+    ChildTable &childTable = Get<ChildTable>();
+
+    if (childTable.Contains(*this))
+    {
+        childTable.UpdateIp6AddressIndex(*this);
+    }
+}
+#endif
+
 void Neighbor::Info::SetFrom(const Neighbor &aNeighbor)
 {
     Clear();
@@ -336,12 +367,14 @@ void Child::Clear(void)
 
     memset(reinterpret_cast<void *>(this), 0, sizeof(Child));
     Init(instance);
+    UpdateChildTableIndex();
 }
 
 void Child::ClearIp6Addresses(void)
 {
     mMeshLocalIid.Clear();
     memset(mIp6Address, 0, sizeof(mIp6Address));
+    UpdateChildTableIp6Index();
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_MLR_ENABLE
     mMlrToRegisterMask.Clear();
     mMlrRegisteredMask.Clear();
@@ -401,6 +434,11 @@ Error Child::AddIp6Address(const Ip6::Address &aAddress)
     error = kErrorNoBufs;
 
 exit:
+    if (error == kErrorNone)
+    {
+        UpdateChildTableIp6Index();
+    }
+
     return error;
 }
 
@@ -443,6 +481,11 @@ Error Child::RemoveIp6Address(const Ip6::Address &aAddress)
     mIp6Address[kNumIp6Addresses - 1].Clear();
 
 exit:
+    if (error == kErrorNone)
+    {
+        UpdateChildTableIp6Index();
+    }
+
     return error;
 }
 
@@ -120,6 +120,8 @@ public:
      */
     class AddressMatcher
     {
+        friend class ChildTable;
+
     public:
         /**
          * Initializes the `AddressMatcher` with a given MAC short address (RCOC16) and state filter.
@@ -372,21 +374,17 @@ public:
      */
     const Mac::ExtAddress &GetExtAddress(void) const { return mMacAddr; }
 
-    /**
-     * Returns the Extended Address.
-     *
-     * @returns A reference to the Extended Address.
-     *
-     */
-    Mac::ExtAddress &GetExtAddress(void) { return mMacAddr; }
-
     /**
      * Sets the Extended Address.
      *
      * @param[in]  aAddress  The Extended Address value to set.
      *
      */
-    void SetExtAddress(const Mac::ExtAddress &aAddress) { mMacAddr = aAddress; }
+    void SetExtAddress(const Mac::ExtAddress &aAddress)
+    {
+        mMacAddr = aAddress;
+        UpdateChildTableIndex();
+    }
 
     /**
      * Gets the key sequence value.
@@ -499,7 +497,11 @@ public:
      * @param[in]  aRloc16  The RLOC16 value.
      *
      */
-    void SetRloc16(uint16_t aRloc16) { mRloc16 = aRloc16; }
+    void SetRloc16(uint16_t aRloc16)
+    {
+        mRloc16 = aRloc16;
+        UpdateChildTableIndex();
+    }
 
 #if OPENTHREAD_CONFIG_MULTI_RADIO
     /**
@@ -799,6 +801,12 @@ protected:
      */
     void Init(Instance &aInstance);
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    void UpdateChildTableIndex(void);
+#else
+    void UpdateChildTableIndex(void) {}
+#endif
+
 private:
     enum : uint32_t
     {
@@ -870,6 +878,8 @@ class Child : public Neighbor,
               public CslTxScheduler::ChildInfo
 #endif
 {
+    friend class ChildTable;
+
     class AddressIteratorBuilder;
 
 public:
@@ -1325,6 +1335,12 @@ private:
 
     typedef BitVector<kNumIp6Addresses> ChildIp6AddressMask;
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    void UpdateChildTableIp6Index(void);
+#else
+    void UpdateChildTableIp6Index(void) {}
+#endif
+
     class AddressIteratorBuilder
     {
     public:
@@ -210,7 +210,8 @@ private:
     private:
         static constexpr uint16_t kMaxDataSize = 255;
 
-        uint8_t mData[kMaxDataSize];
+        // The data is padded to a multiple of 4 bytes (see `GetSize()`).
+        uint8_t mData[(kMaxDataSize + 3) & 0xfffc];
     } OT_TOOL_PACKED_END;
 
     Error Add(uint16_t aKey, bool aFirst, const uint8_t *aValue, uint16_t aValueLength);
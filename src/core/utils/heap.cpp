@@ -45,6 +45,8 @@ namespace ot {
 namespace Utils {
 
 Heap::Heap(void)
+    : mPeakUsedSize(0)
+    , mNumAllocFailures(0)
 {
     Block &super = BlockAt(kSuperBlockOffset);
     super.SetSize(kSuperBlockSize);
@@ -59,17 +61,65 @@ Heap::Heap(void)
     first.SetNext(BlockOffset(guard));
 
     mMemory.mFreeSize = kFirstBlockSize;
+
+#if OPENTHREAD_CONFIG_HEAP_SLAB_ENABLE
+    memset(mSlabClasses, 0, sizeof(mSlabClasses));
+#endif
 }
 
 void *Heap::CAlloc(size_t aCount, size_t aSize)
 {
     void    *ret  = nullptr;
-    Block   *prev = nullptr;
-    Block   *curr = nullptr;
     uint16_t size = static_cast<uint16_t>(aCount * aSize);
 
     VerifyOrExit(size);
 
+#if OPENTHREAD_CONFIG_HEAP_SLAB_ENABLE
+    // A small allocation falls back to a block of its own when no
+    // slab page can be allocated.
+    if (size <= kMaxSlabObjectSize)
+    {
+        ret = SlabAlloc(size);
+        VerifyOrExit(ret == nullptr);
+    }
+#endif
+
+    ret = BlockAlloc(size);
+
+    if (ret == nullptr)
+    {
+        mNumAllocFailures++;
+    }
+
+exit:
+    return ret;
+}
+
+void Heap::Free(void *aPointer)
+{
+    VerifyOrExit(aPointer != nullptr);
+
+#if OPENTHREAD_CONFIG_HEAP_SLAB_ENABLE
+    if (IsSlabObject(aPointer))
+    {
+        SlabFree(aPointer);
+        ExitNow();
+    }
+#endif
+
+    BlockFree(aPointer);
+
+exit:
+    return;
+}
+
+void *Heap::BlockAlloc(uint16_t aSize)
+{
+    void    *ret  = nullptr;
+    Block   *prev = nullptr;
+    Block   *curr = nullptr;
+    uint16_t size = aSize;
+
     size += kAlignSize - 1 - kBlockRemainderSize;
     size &= ~(kAlignSize - 1);
     size += kBlockRemainderSize;
@@ -115,6 +165,8 @@ void *Heap::CAlloc(size_t aCount, size_t aSize)
     memset(curr->GetPointer(), 0, size);
     ret = curr->GetPointer();
 
+    UpdatePeakUsage();
+
 exit:
     return ret;
 }
@@ -144,13 +196,8 @@ Block &Heap::BlockPrev(const Block &aBlock)
     return *prev;
 }
 
-void Heap::Free(void *aPointer)
+void Heap::BlockFree(void *aPointer)
 {
-    if (aPointer == nullptr)
-    {
-        return;
-    }
-
     Block &block = BlockOf(aPointer);
     Block &right = BlockRight(block);
 
@@ -217,6 +264,191 @@ void Heap::Free(void *aPointer)
     }
 }
 
+void Heap::UpdatePeakUsage(void)
+{
+    uint16_t usedSize = kFirstBlockSize - mMemory.mFreeSize;
+
+    if (usedSize > mPeakUsedSize)
+    {
+        mPeakUsedSize = usedSize;
+    }
+}
+
+void Heap::ResetPeakUsage(void)
+{
+    mPeakUsedSize = 0;
+    UpdatePeakUsage();
+
+#if OPENTHREAD_CONFIG_HEAP_SLAB_ENABLE
+    for (SlabClass &slabClass : mSlabClasses)
+    {
+        slabClass.mPeakInUse = slabClass.mNumInUse;
+    }
+#endif
+}
+
+void Heap::GetStats(Stats &aStats) const
+{
+    Heap &self = *AsNonConst(this);
+
+    aStats.Clear();
+    aStats.mCapacity         = GetCapacity();
+    aStats.mFreeSize         = GetFreeSize();
+    aStats.mPeakUsedSize     = mPeakUsedSize;
+    aStats.mNumAllocFailures = mNumAllocFailures;
+
+    // The free block list is sorted by size and ends with the guard
+    // block, so the largest free block is the last one.
+    for (const Block *block = &self.BlockNext(self.BlockSuper()); block->GetSize() != Block::kGuardBlockSize;
+         block              = &self.BlockNext(*block))
+    {
+        aStats.mLargestFreeBlock = block->GetSize();
+        aStats.mNumFreeBlocks++;
+    }
+
+    if (aStats.mFreeSize > 0)
+    {
+        aStats.mFragmentation =
+            static_cast<uint8_t>(100 - (static_cast<uint32_t>(aStats.mLargestFreeBlock) * 100) / aStats.mFreeSize);
+    }
+}
+
+#if OPENTHREAD_CONFIG_HEAP_SLAB_ENABLE
+
+uint16_t Heap::SlabObjectSize(uint8_t aClass)
+{
+    // The sizes are multiples of `kAlignSize` and at most 1.5 times
+    // the previous size, to limit the memory wasted per object.
+    static const uint16_t kObjectSizes[kNumSlabClasses] = {16, 32, 48, 64, 96, 128, 192, kMaxSlabObjectSize};
+
+    return kObjectSizes[aClass];
+}
+
+Error Heap::GetSlabStats(uint8_t aIndex, SlabStats &aStats) const
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(aIndex < kNumSlabClasses, error = kErrorNotFound);
+
+    aStats.Clear();
+    aStats.mObjectSize       = SlabObjectSize(aIndex);
+    aStats.mNumPages         = mSlabClasses[aIndex].mNumPages;
+    aStats.mNumObjectsInUse  = mSlabClasses[aIndex].mNumInUse;
+    aStats.mPeakObjectsInUse = mSlabClasses[aIndex].mPeakInUse;
+    aStats.mNumAllocs        = mSlabClasses[aIndex].mNumAllocs;
+
+exit:
+    return error;
+}
+
+void *Heap::SlabAlloc(uint16_t aSize)
+{
+    uint8_t    classIndex = 0;
+    SlabClass *slabClass;
+    SlabPage  *page;
+    void      *object = nullptr;
+
+    while (SlabObjectSize(classIndex) < aSize)
+    {
+        classIndex++;
+    }
+
+    slabClass = &mSlabClasses[classIndex];
+
+    for (page = slabClass->mPages; page != nullptr; page = page->mNext)
+    {
+        if (page->mNumFree > 0)
+        {
+            break;
+        }
+    }
+
+    if (page == nullptr)
+    {
+        page = static_cast<SlabPage *>(BlockAlloc(SlabPageSize(classIndex)));
+        VerifyOrExit(page != nullptr);
+
+        SlabInitPage(*page, classIndex);
+        page->mNext       = slabClass->mPages;
+        slabClass->mPages = page;
+        slabClass->mNumPages++;
+    }
+
+    object = SlabObjectAt(*page, classIndex, page->mFreeHead);
+
+    // The index of the next free object is kept in the first bytes
+    // of a free object.
+    page->mFreeHead = *static_cast<uint16_t *>(object);
+    page->mNumFree--;
+
+    memset(object, 0, SlabObjectSize(classIndex));
+
+    slabClass->mNumAllocs++;
+    slabClass->mNumInUse++;
+
+    if (slabClass->mNumInUse > slabClass->mPeakInUse)
+    {
+        slabClass->mPeakInUse = slabClass->mNumInUse;
+    }
+
+exit:
+    return object;
+}
+
+void Heap::SlabInitPage(SlabPage &aPage, uint8_t aClass)
+{
+    for (uint16_t index = 0; index < kSlabObjectsPerPage; index++)
+    {
+        void *object = SlabObjectAt(aPage, aClass, index);
+
+        SlabTag(object) = static_cast<uint16_t>((index << kSlabTagIndexShift) | (aClass << kSlabTagClassShift) |
+                                                kSlabTagFlag);
+        *static_cast<uint16_t *>(object) = (index + 1 < kSlabObjectsPerPage) ? index + 1 : kSlabNoObject;
+    }
+
+    aPage.mFreeHead = 0;
+    aPage.mNumFree  = kSlabObjectsPerPage;
+}
+
+void Heap::SlabFree(void *aPointer)
+{
+    uint16_t   tag        = SlabTag(aPointer);
+    uint8_t    classIndex = static_cast<uint8_t>((tag & kSlabTagClassMask) >> kSlabTagClassShift);
+    uint16_t   index      = tag >> kSlabTagIndexShift;
+    SlabClass &slabClass  = mSlabClasses[classIndex];
+    SlabPage  &page       = *reinterpret_cast<SlabPage *>(reinterpret_cast<void *>(
+        static_cast<uint8_t *>(aPointer) - kAlignSize - index * SlabStride(classIndex) - kSlabPageHeaderSize));
+
+    OT_ASSERT(SlabObjectAt(page, classIndex, index) == aPointer);
+
+    *static_cast<uint16_t *>(aPointer) = page.mFreeHead;
+    page.mFreeHead                     = index;
+    page.mNumFree++;
+    slabClass.mNumInUse--;
+
+    VerifyOrExit(page.mNumFree == kSlabObjectsPerPage);
+
+    // Return the empty page to the heap, so that its memory can be
+    // used by other size classes or larger allocations.
+
+    for (SlabPage **prevNext = &slabClass.mPages; *prevNext != nullptr; prevNext = &(*prevNext)->mNext)
+    {
+        if (*prevNext == &page)
+        {
+            *prevNext = page.mNext;
+            break;
+        }
+    }
+
+    slabClass.mNumPages--;
+    BlockFree(&page);
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_HEAP_SLAB_ENABLE
+
 } // namespace Utils
 } // namespace ot
 
@@ -42,7 +42,11 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <openthread/heap.h>
+
+#include "common/clearable.hpp"
 #include "common/const_cast.hpp"
+#include "common/error.hpp"
 #include "common/non_copyable.hpp"
 
 namespace ot {
@@ -172,10 +176,38 @@ private:
  *     | kAlignSize - 2 | kAlignSize | 4 + s1  | 4 + s2  | ... | 4 + s4  |   2    |
  *     +--------------------------------------------------------------------------+
  *
+ * When `OPENTHREAD_CONFIG_HEAP_SLAB_ENABLE` is set, allocations of up to `kMaxSlabObjectSize` bytes are served from
+ * slab pages, each page being a block holding `kSlabObjectsPerPage` objects of the same size class:
+ *
+ *     +-----------------------------------------------------------------------------------+
+ *     | page header | tag        | object 0 | tag        | object 1 | ... | tag        | ...
+ *     +-------------+------------+----------+------------+----------+-----+------------+----
+ *     | n*kAlignSize| kAlignSize |   size   | kAlignSize |   size   | ... | kAlignSize | ...
+ *     +-----------------------------------------------------------------------------------+
+ *
+ * The tag is at the same position relative to the object as `mSize` relative to the memory of a block. Since block
+ * sizes are always even, an odd tag identifies a slab object, its size class and its index in the page.
+ *
  */
 class Heap : private NonCopyable
 {
 public:
+    /**
+     * Represents the heap usage statistics.
+     *
+     */
+    class Stats : public otHeapStats, public Clearable<Stats>
+    {
+    };
+
+    /**
+     * Represents the usage statistics of a slab size class.
+     *
+     */
+    class SlabStats : public otHeapSlabStats, public Clearable<SlabStats>
+    {
+    };
+
     /**
      * Initializes a memory heap.
      *
@@ -226,6 +258,34 @@ public:
      */
     size_t GetFreeSize(void) const { return mMemory.mFreeSize; }
 
+    /**
+     * Gets the heap usage statistics.
+     *
+     * @param[out] aStats   A reference to return the statistics.
+     *
+     */
+    void GetStats(Stats &aStats) const;
+
+#if OPENTHREAD_CONFIG_HEAP_SLAB_ENABLE
+    /**
+     * Gets the usage statistics of a slab size class.
+     *
+     * @param[in]  aIndex   The index of the size class, from zero for the smallest size.
+     * @param[out] aStats   A reference to return the statistics.
+     *
+     * @retval kErrorNone      Successfully retrieved the statistics.
+     * @retval kErrorNotFound  There is no size class with index @p aIndex.
+     *
+     */
+    Error GetSlabStats(uint8_t aIndex, SlabStats &aStats) const;
+#endif
+
+    /**
+     * Resets the peak usage of the heap (and of its slab size classes) to the current usage.
+     *
+     */
+    void ResetPeakUsage(void);
+
 private:
 #if OPENTHREAD_CONFIG_TLS_ENABLE || OPENTHREAD_CONFIG_DTLS_ENABLE
     static constexpr uint16_t kMemorySize = OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE;
@@ -242,6 +302,81 @@ private:
 
     static_assert(kMemorySize % kAlignSize == 0, "The heap memory size is not aligned to kAlignSize!");
 
+#if OPENTHREAD_CONFIG_HEAP_SLAB_ENABLE
+    static constexpr uint8_t  kNumSlabClasses     = 8;   // Size classes of 16, 32, 48, 64, 96, 128, 192, 256 bytes.
+    static constexpr uint16_t kMaxSlabObjectSize  = 256; // Object size of the largest size class.
+    static constexpr uint16_t kSlabObjectsPerPage = OPENTHREAD_CONFIG_HEAP_SLAB_OBJECTS_PER_PAGE;
+    static constexpr uint16_t kSlabNoObject       = 0xffff; // Index marking the end of a page free object list.
+    static constexpr uint16_t kSlabTagFlag        = 1;      // Bit set in the tag of slab objects.
+    static constexpr uint8_t  kSlabTagClassShift  = 1;
+    static constexpr uint16_t kSlabTagClassMask   = 0x7 << kSlabTagClassShift;
+    static constexpr uint8_t  kSlabTagIndexShift  = 4;
+
+    static_assert(kSlabObjectsPerPage > 0 && kSlabObjectsPerPage <= (0xffff >> kSlabTagIndexShift),
+                  "OPENTHREAD_CONFIG_HEAP_SLAB_OBJECTS_PER_PAGE is invalid");
+
+    struct SlabPage
+    {
+        SlabPage *mNext;     // Next page of the same size class.
+        uint16_t  mFreeHead; // Index of the first free object, or `kSlabNoObject`.
+        uint16_t  mNumFree;  // Number of free objects.
+    };
+
+    struct SlabClass
+    {
+        SlabPage *mPages; // List of pages, with free objects or not.
+        uint16_t  mNumPages;
+        uint16_t  mNumInUse;
+        uint16_t  mPeakInUse;
+        uint32_t  mNumAllocs;
+    };
+
+    static constexpr uint16_t kSlabPageHeaderSize = (sizeof(SlabPage) + kAlignSize - 1) & ~(kAlignSize - 1);
+
+    static uint16_t SlabObjectSize(uint8_t aClass);
+    static uint16_t SlabStride(uint8_t aClass) { return kAlignSize + SlabObjectSize(aClass); }
+    static uint16_t SlabPageSize(uint8_t aClass)
+    {
+        return static_cast<uint16_t>(kSlabPageHeaderSize + kSlabObjectsPerPage * SlabStride(aClass));
+    }
+
+    static uint16_t &SlabTag(void *aObject)
+    {
+        uint8_t *tag = static_cast<uint8_t *>(aObject) - sizeof(uint16_t);
+
+        return *reinterpret_cast<uint16_t *>(reinterpret_cast<void *>(tag));
+    }
+
+    static bool IsSlabObject(void *aPointer) { return (SlabTag(aPointer) & kSlabTagFlag) != 0; }
+
+    static void *SlabObjectAt(SlabPage &aPage, uint8_t aClass, uint16_t aIndex)
+    {
+        return reinterpret_cast<uint8_t *>(&aPage) + kSlabPageHeaderSize + aIndex * SlabStride(aClass) + kAlignSize;
+    }
+
+    void *SlabAlloc(uint16_t aSize);
+    void  SlabFree(void *aPointer);
+    void  SlabInitPage(SlabPage &aPage, uint8_t aClass);
+#endif // OPENTHREAD_CONFIG_HEAP_SLAB_ENABLE
+
+    /**
+     * Allocates a block of at least @p aSize bytes from the free block list and initializes it to zero.
+     *
+     * @param[in]   aSize   Size in bytes, must not be zero.
+     *
+     * @returns A pointer to the block memory, or `nullptr` if no free block is large enough.
+     *
+     */
+    void *BlockAlloc(uint16_t aSize);
+
+    /**
+     * Frees the block of the memory pointed by @p aPointer.
+     *
+     * @param[in]   aPointer    A pointer returned by `BlockAlloc()`.
+     *
+     */
+    void BlockFree(void *aPointer);
+
     /**
      * Returns the block at offset @p aOffset.
      *
@@ -335,6 +470,14 @@ private:
      */
     void BlockInsert(Block &aPrev, Block &aBlock);
 
+    void UpdatePeakUsage(void);
+
+#if OPENTHREAD_CONFIG_HEAP_SLAB_ENABLE
+    SlabClass mSlabClasses[kNumSlabClasses];
+#endif
+    uint16_t mPeakUsedSize;
+    uint32_t mNumAllocFailures;
+
     union
     {
         uint16_t mFreeSize;
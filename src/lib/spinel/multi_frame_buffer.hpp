@@ -90,6 +90,24 @@ public:
                                          : OT_ERROR_NO_BUFS;
     }
 
+    /**
+     * Writes a block of bytes into the buffer and updates the write pointer (if space is available).
+     *
+     * @param[in]  aData    A pointer to the bytes to be written to the buffer.
+     * @param[in]  aLength  Number of bytes to write.
+     *
+     * @retval OT_ERROR_NONE     Successfully wrote the bytes and updated the pointer.
+     * @retval OT_ERROR_NO_BUFS  Insufficient buffer space to write the bytes. Nothing is written.
+     *
+     */
+    otError WriteData(const uint8_t *aData, uint16_t aLength)
+    {
+        return CanWrite(aLength)
+                   ? (memcpy(mWritePointer, aData, aLength), mWritePointer += aLength, mRemainingLength -= aLength,
+                      OT_ERROR_NONE)
+                   : OT_ERROR_NO_BUFS;
+    }
+
     /**
      * Undoes the last @p aUndoLength writes, removing them from frame.
      *
@@ -66,4 +66,31 @@
 #ifndef OPENTHREAD_SPINEL_CONFIG_ABORT_ON_UNEXPECTED_RCP_RESET_ENABLE
 #define OPENTHREAD_SPINEL_CONFIG_ABORT_ON_UNEXPECTED_RCP_RESET_ENABLE 0
 #endif
+
+/**
+ * @def OPENTHREAD_SPINEL_CONFIG_HDLC_SLICE_BY_4_FCS_ENABLE
+ *
+ * Define 1 to calculate the HDLC FCS four bytes at a time (slice-by-4).
+ *
+ * This uses three additional 256-entry lookup tables (1.5 KB of read-only data) and is intended for the host side.
+ *
+ */
+#ifndef OPENTHREAD_SPINEL_CONFIG_HDLC_SLICE_BY_4_FCS_ENABLE
+#define OPENTHREAD_SPINEL_CONFIG_HDLC_SLICE_BY_4_FCS_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_SPINEL_CONFIG_MAX_PENDING_REQUESTS
+ *
+ * The maximum number of spinel property updates (set, insert and remove) which the host keeps in flight without
+ * waiting for their responses. Define as 0 to wait for the response of each request.
+ *
+ * At most 13 requests can be pending, the remaining spinel transaction IDs are used by radio frame transmissions and
+ * synchronous requests.
+ *
+ */
+#ifndef OPENTHREAD_SPINEL_CONFIG_MAX_PENDING_REQUESTS
+#define OPENTHREAD_SPINEL_CONFIG_MAX_PENDING_REQUESTS 0
+#endif
+
 #endif // OPENTHREAD_SPINEL_CONFIG_H_
@@ -451,6 +451,29 @@ public:
      */
     otError ClearSrcMatchExtEntries(void);
 
+    /**
+     * Begins a batch of source address match updates.
+     *
+     * Until `CommitSrcMatchUpdate()`, the source address match table changes and the enabling/disabling of the source
+     * address match feature are only recorded on the host, they are then sent to the RCP in a single transaction.
+     *
+     */
+    void BeginSrcMatchUpdate(void);
+
+    /**
+     * Commits the source address match updates made since `BeginSrcMatchUpdate()`.
+     *
+     * The updated source address match tables are sent to the RCP by setting their whole content at once, followed by
+     * the source address match feature state, in a `VALUE_MULTI_SET` command when the RCP supports it.
+     *
+     * @retval  OT_ERROR_NONE               Succeeded.
+     * @retval  OT_ERROR_NO_BUFS            No available entry in the source match table of the RCP.
+     * @retval  OT_ERROR_BUSY               Failed due to another operation is on going.
+     * @retval  OT_ERROR_RESPONSE_TIMEOUT   Failed due to no response received from the transceiver.
+     *
+     */
+    otError CommitSrcMatchUpdate(void);
+
     /**
      * Begins the energy scan sequence on the radio.
      *
@@ -552,6 +575,14 @@ public:
      */
     uint64_t GetTxRadioEndUs(void) const { return mTxRadioEndUs; }
 
+    /**
+     * Returns the timeout timepoint of the oldest pending (asynchronous) spinel request.
+     *
+     * @returns The timeout timepoint of the oldest pending request, or `UINT64_MAX` if there is none.
+     *
+     */
+    uint64_t GetPendingRequestsDeadline(void) const;
+
     /**
      * Processes any pending the I/O data.
      *
@@ -875,6 +906,15 @@ public:
      */
     const otRadioSpinelMetrics *GetRadioSpinelMetrics(void) const { return &mRadioSpinelMetrics; }
 
+    /**
+     * Logs the time taken by a phase of the RCP bring-up and starts the next phase.
+     *
+     * @param[in]     aPhase       A pointer to the null-terminated name of the phase.
+     * @param[inout]  aPhaseStart  The start time of the phase, set to the current time.
+     *
+     */
+    static void LogBringUpPhase(const char *aPhase, uint64_t &aPhaseStart);
+
 #if OPENTHREAD_CONFIG_PLATFORM_POWER_CALIBRATION_ENABLE
     /**
      * Add a calibrated power of the specified channel to the power calibration table.
@@ -932,6 +972,12 @@ private:
         kVersionStringSize     = 128,  ///< Max size of version string.
         kCapsBufferSize        = 100,  ///< Max buffer size used to store `SPINEL_PROP_CAPS` value.
         kChannelMaskBufferSize = 32,   ///< Max buffer size used to store `SPINEL_PROP_PHY_CHAN_SUPPORTED` value.
+        kMaxSpinelTid          = 15,   ///< Max spinel transaction id.
+        kMaxBatchProperties    = 16,   ///< Max number of properties in one `VALUE_MULTI_SET` command.
+        kBatchHeaderSize       = 2,    ///< Size of the spinel header and `VALUE_MULTI_SET` command.
+        kMaxSrcMatchSetLength  = kMaxSpinelFrame - 8, ///< Max size of a src match table set in one property.
+        kMaxSrcMatchShortSet   = kMaxSrcMatchSetLength / sizeof(uint16_t),     ///< Max short entries in one set.
+        kMaxSrcMatchExtSet     = kMaxSrcMatchSetLength / sizeof(otExtAddress), ///< Max extended entries in one set.
     };
 
     enum State
@@ -985,6 +1031,65 @@ private:
                                         const char       *aFormat,
                                         va_list           aArgs);
     otError WaitResponse(bool aHandleRcpTimeout = true);
+
+    /**
+     * Sends a spinel property update without waiting for its response.
+     *
+     * The response is handled by `HandlePendingResponse()` when it is received. Up to
+     * `OPENTHREAD_SPINEL_CONFIG_MAX_PENDING_REQUESTS` requests are kept in flight, this method waits for the oldest
+     * one to complete when the limit is reached. As the RCP handles the requests in order, a following synchronous
+     * request also waits for all the pending ones.
+     *
+     * When `OPENTHREAD_SPINEL_CONFIG_MAX_PENDING_REQUESTS` is 0, this method waits for the response.
+     *
+     */
+    otError SetAsync(spinel_prop_key_t aKey, const char *aFormat, ...);
+    otError InsertAsync(spinel_prop_key_t aKey, const char *aFormat, ...);
+    otError RemoveAsync(spinel_prop_key_t aKey, const char *aFormat, ...);
+    otError RequestAsyncV(uint32_t          aExpectedCommand,
+                          uint32_t          aCommand,
+                          spinel_prop_key_t aKey,
+                          const char       *aFormat,
+                          va_list           aArgs);
+#if OPENTHREAD_SPINEL_CONFIG_MAX_PENDING_REQUESTS > 0
+    void WaitForPendingRequestSlot(void);
+    void HandlePendingResponse(spinel_tid_t      aTid,
+                               uint32_t          aCommand,
+                               spinel_prop_key_t aKey,
+                               const uint8_t    *aBuffer,
+                               uint16_t          aLength);
+    void ProcessPendingRequests(void);
+    void ClearPendingRequests(void);
+#endif
+
+    /**
+     * Starts batching the property updates of `BatchSet()`.
+     *
+     * When the RCP supports `SPINEL_CAP_CMD_MULTI`, the batched properties are sent in
+     * `SPINEL_CMD_PROP_VALUE_MULTI_SET` commands of up to `kMaxBatchProperties` properties each, otherwise
+     * `BatchSet()` sets each property in its own request and waits for the response.
+     *
+     * `EndBatch()` sends the remaining batched properties and returns the first error of the batch, including the
+     * errors reported by the RCP.
+     *
+     */
+    void    BeginBatch(void);
+    void    BatchSet(spinel_prop_key_t aKey, const char *aFormat, ...);
+    otError EndBatch(void);
+    otError AppendBatchEntry(spinel_prop_key_t aKey, const char *aFormat, va_list aArgs);
+    otError SendBatch(void);
+    void    HandleMultiSetResponse(const uint8_t *aBuffer, uint16_t aLength);
+
+    /**
+     * Batches the set of the whole source address match tables, see `BatchSet()`.
+     *
+     * Entries that do not fit in a single property are left to `InsertSrcMatchOverflow()`, which must be called
+     * after `EndBatch()`.
+     *
+     */
+    void    BatchSrcMatchTables(bool aShort, bool aExt);
+    otError InsertSrcMatchOverflow(bool aShort, bool aExt);
+
     otError SendCommand(uint32_t          aCommand,
                         spinel_prop_key_t aKey,
                         spinel_tid_t      aTid,
@@ -1053,6 +1158,27 @@ private:
     uint32_t          mExpectedCommand; ///< Expected response command of current transaction.
     otError           mError;           ///< The result of current transaction.
 
+#if OPENTHREAD_SPINEL_CONFIG_MAX_PENDING_REQUESTS > 0
+    static_assert(OPENTHREAD_SPINEL_CONFIG_MAX_PENDING_REQUESTS <= 13,
+                  "OPENTHREAD_SPINEL_CONFIG_MAX_PENDING_REQUESTS must not be larger than 13");
+
+    struct PendingRequest
+    {
+        spinel_prop_key_t mKey;             ///< The property key of the request.
+        uint32_t          mExpectedCommand; ///< Expected response command of the request.
+        uint64_t          mDeadline;        ///< When to give up waiting for the response.
+    };
+
+    uint16_t       mPendingTids;                        ///< Transaction ids of the pending requests.
+    uint8_t        mPendingCount;                       ///< Number of pending requests.
+    PendingRequest mPendingRequests[kMaxSpinelTid + 1]; ///< Pending requests, indexed by transaction id.
+#endif
+
+    uint8_t  mBatchFrame[kMaxSpinelFrame]; ///< The `VALUE_MULTI_SET` command being batched.
+    uint16_t mBatchLength;                 ///< Length of `mBatchFrame`, 0 if not batching.
+    uint8_t  mBatchCount;                  ///< Number of properties in `mBatchFrame`.
+    otError  mBatchError;                  ///< The first error of the current batch.
+
     uint8_t       mRxPsdu[OT_RADIO_FRAME_MAX_SIZE];
     uint8_t       mTxPsdu[OT_RADIO_FRAME_MAX_SIZE];
     uint8_t       mAckPsdu[OT_RADIO_FRAME_MAX_SIZE];
@@ -1076,6 +1202,18 @@ private:
     bool  mIsReady : 1;           ///< NCP ready.
     bool  mSupportsLogStream : 1; ///< RCP supports `LOG_STREAM` property with OpenThread log meta-data format.
     bool  mIsTimeSynced : 1;      ///< Host has calculated the time difference between host and RCP.
+    bool  mSupportsMultiCmd : 1;  ///< RCP supports `VALUE_MULTI_GET` and `VALUE_MULTI_SET` commands.
+
+    // Source address match tables and state as set by core.
+    uint16_t     mSrcMatchShortEntries[OPENTHREAD_CONFIG_MLE_MAX_CHILDREN];
+    int16_t      mSrcMatchShortEntryCount;
+    otExtAddress mSrcMatchExtEntries[OPENTHREAD_CONFIG_MLE_MAX_CHILDREN];
+    int16_t      mSrcMatchExtEntryCount;
+    bool         mSrcMatchEnabled : 1;
+    bool         mSrcMatchUpdating : 1;      ///< Whether a batch of src match updates is in progress.
+    bool         mSrcMatchShortChanged : 1;  ///< Whether the short address table changed in the current batch.
+    bool         mSrcMatchExtChanged : 1;    ///< Whether the extended address table changed in the current batch.
+    bool         mSrcMatchEnableChanged : 1; ///< Whether the src match state changed in the current batch.
 
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
 
@@ -1088,10 +1226,6 @@ private:
     otMacKey     mPrevKey;
     otMacKey     mCurrKey;
     otMacKey     mNextKey;
-    uint16_t     mSrcMatchShortEntries[OPENTHREAD_CONFIG_MLE_MAX_CHILDREN];
-    int16_t      mSrcMatchShortEntryCount;
-    otExtAddress mSrcMatchExtEntries[OPENTHREAD_CONFIG_MLE_MAX_CHILDREN];
-    int16_t      mSrcMatchExtEntryCount;
     uint8_t      mScanChannel;
     uint16_t     mScanDuration;
     int8_t       mCcaEnergyDetectThreshold;
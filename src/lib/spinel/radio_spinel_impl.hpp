@@ -176,6 +176,13 @@ RadioSpinel<InterfaceType>::RadioSpinel(void)
     , mPropertyFormat(nullptr)
     , mExpectedCommand(0)
     , mError(OT_ERROR_NONE)
+#if OPENTHREAD_SPINEL_CONFIG_MAX_PENDING_REQUESTS > 0
+    , mPendingTids(0)
+    , mPendingCount(0)
+#endif
+    , mBatchLength(0)
+    , mBatchCount(0)
+    , mBatchError(OT_ERROR_NONE)
     , mTransmitFrame(nullptr)
     , mShortAddress(0)
     , mPanId(0xffff)
@@ -187,10 +194,16 @@ RadioSpinel<InterfaceType>::RadioSpinel(void)
     , mIsReady(false)
     , mSupportsLogStream(false)
     , mIsTimeSynced(false)
-#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
-    , mRcpFailureCount(0)
+    , mSupportsMultiCmd(false)
     , mSrcMatchShortEntryCount(0)
     , mSrcMatchExtEntryCount(0)
+    , mSrcMatchEnabled(false)
+    , mSrcMatchUpdating(false)
+    , mSrcMatchShortChanged(false)
+    , mSrcMatchExtChanged(false)
+    , mSrcMatchEnableChanged(false)
+#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
+    , mRcpFailureCount(0)
     , mMacKeySet(false)
     , mCcaEnergyDetectThresholdSet(false)
     , mTransmitPowerSet(false)
@@ -215,35 +228,54 @@ RadioSpinel<InterfaceType>::RadioSpinel(void)
 template <typename InterfaceType>
 void RadioSpinel<InterfaceType>::Init(bool aResetRadio, bool aSkipRcpCompatibilityCheck)
 {
-    otError error = OT_ERROR_NONE;
-    bool    supportsRcpApiVersion;
-    bool    supportsRcpMinHostApiVersion;
+    otError  error = OT_ERROR_NONE;
+    bool     supportsRcpApiVersion;
+    bool     supportsRcpMinHostApiVersion;
+    uint64_t startTime  = otPlatTimeGet();
+    uint64_t phaseStart = startTime;
 
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
     mResetRadioOnStartup = aResetRadio;
 #endif
 
     ResetRcp(aResetRadio);
+    LogBringUpPhase("reset", phaseStart);
+
     SuccessOrExit(error = CheckSpinelVersion());
     SuccessOrExit(error = Get(SPINEL_PROP_NCP_VERSION, SPINEL_DATATYPE_UTF8_S, mVersion, sizeof(mVersion)));
     SuccessOrExit(error = Get(SPINEL_PROP_HWADDR, SPINEL_DATATYPE_EUI64_S, mIeeeEui64.m8));
+    LogBringUpPhase("version", phaseStart);
 
     VerifyOrDie(IsRcp(supportsRcpApiVersion, supportsRcpMinHostApiVersion), OT_EXIT_RADIO_SPINEL_INCOMPATIBLE);
+    LogBringUpPhase("capabilities", phaseStart);
 
     if (!aSkipRcpCompatibilityCheck)
     {
         SuccessOrDie(CheckRcpApiVersion(supportsRcpApiVersion, supportsRcpMinHostApiVersion));
         SuccessOrDie(CheckRadioCapabilities());
+        LogBringUpPhase("compatibility check", phaseStart);
     }
 
     mRxRadioFrame.mPsdu  = mRxPsdu;
     mTxRadioFrame.mPsdu  = mTxPsdu;
     mAckRadioFrame.mPsdu = mAckPsdu;
 
+    otLogNotePlat("RCP bring-up: spinel init took %lu us (multi-property commands %ssupported)",
+                  ToUlong(static_cast<uint32_t>(otPlatTimeGet() - startTime)), mSupportsMultiCmd ? "" : "not ");
+
 exit:
     SuccessOrDie(error);
 }
 
+template <typename InterfaceType>
+void RadioSpinel<InterfaceType>::LogBringUpPhase(const char *aPhase, uint64_t &aPhaseStart)
+{
+    uint64_t now = otPlatTimeGet();
+
+    otLogInfoPlat("RCP bring-up: %s took %lu us", aPhase, ToUlong(static_cast<uint32_t>(now - aPhaseStart)));
+    aPhaseStart = now;
+}
+
 template <typename InterfaceType> void RadioSpinel<InterfaceType>::ResetRcp(bool aResetRadio)
 {
     bool hardwareReset;
@@ -252,6 +284,10 @@ template <typename InterfaceType> void RadioSpinel<InterfaceType>::ResetRcp(bool
     mIsReady    = false;
     mWaitingKey = SPINEL_PROP_LAST_STATUS;
 
+#if OPENTHREAD_SPINEL_CONFIG_MAX_PENDING_REQUESTS > 0
+    ClearPendingRequests();
+#endif
+
     if (aResetRadio && (SendReset(SPINEL_RESET_STACK) == OT_ERROR_NONE) && (WaitResponse(false) == OT_ERROR_NONE))
     {
         otLogInfoPlat("Software reset RCP successfully");
@@ -339,6 +375,11 @@ bool RadioSpinel<InterfaceType>::IsRcp(bool &aSupportsRcpApiVersion, bool &aSupp
             mSupportsLogStream = true;
         }
 
+        if (capability == SPINEL_CAP_CMD_MULTI)
+        {
+            mSupportsMultiCmd = true;
+        }
+
         if (capability == SPINEL_CAP_RCP_API_VERSION)
         {
             aSupportsRcpApiVersion = true;
@@ -569,14 +610,28 @@ template <typename InterfaceType>
 void RadioSpinel<InterfaceType>::HandleResponse(const uint8_t *aBuffer, uint16_t aLength)
 {
     spinel_prop_key_t key;
-    uint8_t          *data   = nullptr;
-    spinel_size_t     len    = 0;
-    uint8_t           header = 0;
-    uint32_t          cmd    = 0;
-    spinel_ssize_t    rval   = 0;
-    otError           error  = OT_ERROR_NONE;
-
-    rval = spinel_datatype_unpack(aBuffer, aLength, "CiiD", &header, &cmd, &key, &data, &len);
+    uint8_t          *payload    = nullptr;
+    spinel_size_t     payloadLen = 0;
+    uint8_t          *data       = nullptr;
+    spinel_size_t     len        = 0;
+    uint8_t           header     = 0;
+    uint32_t          cmd        = 0;
+    spinel_ssize_t    rval       = 0;
+    otError           error      = OT_ERROR_NONE;
+
+    rval = spinel_datatype_unpack(aBuffer, aLength, "CiD", &header, &cmd, &payload, &payloadLen);
+    VerifyOrExit(rval > 0, error = OT_ERROR_PARSE);
+
+    if (cmd == SPINEL_CMD_PROP_VALUES_ARE)
+    {
+        VerifyOrExit(mWaitingTid != 0 && mWaitingTid == SPINEL_HEADER_GET_TID(header), error = OT_ERROR_DROP);
+        HandleMultiSetResponse(payload, static_cast<uint16_t>(payloadLen));
+        FreeTid(mWaitingTid);
+        mWaitingTid = 0;
+        ExitNow();
+    }
+
+    rval = spinel_datatype_unpack(payload, payloadLen, "iD", &key, &data, &len);
     VerifyOrExit(rval > 0 && cmd >= SPINEL_CMD_PROP_VALUE_IS && cmd <= SPINEL_CMD_PROP_VALUE_REMOVED,
                  error = OT_ERROR_PARSE);
 
@@ -596,6 +651,12 @@ void RadioSpinel<InterfaceType>::HandleResponse(const uint8_t *aBuffer, uint16_t
         FreeTid(mTxRadioTid);
         mTxRadioTid = 0;
     }
+#if OPENTHREAD_SPINEL_CONFIG_MAX_PENDING_REQUESTS > 0
+    else if ((mPendingTids & (1 << SPINEL_HEADER_GET_TID(header))) != 0)
+    {
+        HandlePendingResponse(SPINEL_HEADER_GET_TID(header), cmd, key, data, static_cast<uint16_t>(len));
+    }
+#endif
     else
     {
         otLogWarnPlat("Unexpected Spinel transaction message: %u", SPINEL_HEADER_GET_TID(header));
@@ -676,6 +737,60 @@ exit:
     LogIfFail("Error processing result", mError);
 }
 
+template <typename InterfaceType>
+void RadioSpinel<InterfaceType>::HandleMultiSetResponse(const uint8_t *aBuffer, uint16_t aLength)
+{
+    // Each entry of the `VALUES_ARE` response is either the new value of
+    // the property or a `LAST_STATUS` with the error of setting it.
+
+    uint8_t index = 0;
+
+    mError = OT_ERROR_NONE;
+
+    while (aLength > 0)
+    {
+        spinel_prop_key_t key;
+        const uint8_t    *value;
+        spinel_size_t     valueLength;
+        spinel_ssize_t    unpacked;
+
+        unpacked = spinel_datatype_unpack(aBuffer, aLength, "t(iD)", &key, &value, &valueLength);
+        VerifyOrExit(unpacked > 0, mError = OT_ERROR_PARSE);
+
+        if (key == SPINEL_PROP_LAST_STATUS)
+        {
+            spinel_status_t status;
+            otError         error;
+
+            VerifyOrExit(spinel_datatype_unpack(value, valueLength, "i", &status) > 0, mError = OT_ERROR_PARSE);
+            error = SpinelStatusToOtError(status);
+
+            if (error != OT_ERROR_NONE)
+            {
+                otLogWarnPlat("Failed to set batched property %u: %s", index, otThreadErrorToString(error));
+
+                if (mError == OT_ERROR_NONE)
+                {
+                    mError = error;
+                }
+            }
+        }
+
+        aBuffer += unpacked;
+        aLength -= static_cast<uint16_t>(unpacked);
+        index++;
+    }
+
+    if (index != mBatchCount)
+    {
+        mError = OT_ERROR_DROP;
+    }
+
+exit:
+    UpdateParseErrorCount(mError);
+    LogIfFail("Error processing multi-set response", mError);
+}
+
 template <typename InterfaceType>
 void RadioSpinel<InterfaceType>::HandleValueIs(spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength)
 {
@@ -949,6 +1064,11 @@ template <typename InterfaceType> void RadioSpinel<InterfaceType>::Process(const
         RecoverFromRcpFailure();
     }
 
+#if OPENTHREAD_SPINEL_CONFIG_MAX_PENDING_REQUESTS > 0
+    ProcessPendingRequests();
+    RecoverFromRcpFailure();
+#endif
+
     ProcessRadioStateMachine();
     RecoverFromRcpFailure();
     CalcRcpTimeOffset();
@@ -959,7 +1079,7 @@ template <typename InterfaceType> otError RadioSpinel<InterfaceType>::SetPromisc
     otError error;
 
     uint8_t mode = (aEnable ? SPINEL_MAC_PROMISCUOUS_MODE_NETWORK : SPINEL_MAC_PROMISCUOUS_MODE_OFF);
-    SuccessOrExit(error = Set(SPINEL_PROP_MAC_PROMISCUOUS_MODE, SPINEL_DATATYPE_UINT8_S, mode));
+    SuccessOrExit(error = SetAsync(SPINEL_PROP_MAC_PROMISCUOUS_MODE, SPINEL_DATATYPE_UINT8_S, mode));
     mIsPromiscuous = aEnable;
 
 exit:
@@ -971,7 +1091,7 @@ template <typename InterfaceType> otError RadioSpinel<InterfaceType>::SetShortAd
     otError error = OT_ERROR_NONE;
 
     VerifyOrExit(mShortAddress != aAddress);
-    SuccessOrExit(error = Set(SPINEL_PROP_MAC_15_4_SADDR, SPINEL_DATATYPE_UINT16_S, aAddress));
+    SuccessOrExit(error = SetAsync(SPINEL_PROP_MAC_15_4_SADDR, SPINEL_DATATYPE_UINT16_S, aAddress));
     mShortAddress = aAddress;
 
 exit:
@@ -1001,12 +1121,12 @@ otError RadioSpinel<InterfaceType>::SetMacKey(uint8_t                 aKeyIdMode
     OT_UNUSED_VARIABLE(aKeySize);
 #endif
 
-    SuccessOrExit(error = Set(SPINEL_PROP_RCP_MAC_KEY,
-                              SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_DATA_WLEN_S
-                                  SPINEL_DATATYPE_DATA_WLEN_S SPINEL_DATATYPE_DATA_WLEN_S,
-                              aKeyIdMode, aKeyId, aPrevKey->mKeyMaterial.mKey.m8, sizeof(otMacKey),
-                              aCurrKey->mKeyMaterial.mKey.m8, sizeof(otMacKey), aNextKey->mKeyMaterial.mKey.m8,
-                              sizeof(otMacKey)));
+    SuccessOrExit(error = SetAsync(SPINEL_PROP_RCP_MAC_KEY,
+                                   SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_DATA_WLEN_S
+                                       SPINEL_DATATYPE_DATA_WLEN_S SPINEL_DATATYPE_DATA_WLEN_S,
+                                   aKeyIdMode, aKeyId, aPrevKey->mKeyMaterial.mKey.m8, sizeof(otMacKey),
+                                   aCurrKey->mKeyMaterial.mKey.m8, sizeof(otMacKey), aNextKey->mKeyMaterial.mKey.m8,
+                                   sizeof(otMacKey)));
 
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
     mKeyIdMode = aKeyIdMode;
@@ -1026,8 +1146,8 @@ otError RadioSpinel<InterfaceType>::SetMacFrameCounter(uint32_t aMacFrameCounter
 {
     otError error;
 
-    SuccessOrExit(error = Set(SPINEL_PROP_RCP_MAC_FRAME_COUNTER, SPINEL_DATATYPE_UINT32_S SPINEL_DATATYPE_BOOL_S,
-                              aMacFrameCounter, aSetIfLarger));
+    SuccessOrExit(error = SetAsync(SPINEL_PROP_RCP_MAC_FRAME_COUNTER, SPINEL_DATATYPE_UINT32_S SPINEL_DATATYPE_BOOL_S,
+                                   aMacFrameCounter, aSetIfLarger));
 
 exit:
     return error;
@@ -1045,7 +1165,7 @@ otError RadioSpinel<InterfaceType>::SetExtendedAddress(const otExtAddress &aExtA
 {
     otError error;
 
-    SuccessOrExit(error = Set(SPINEL_PROP_MAC_15_4_LADDR, SPINEL_DATATYPE_EUI64_S, aExtAddress.m8));
+    SuccessOrExit(error = SetAsync(SPINEL_PROP_MAC_15_4_LADDR, SPINEL_DATATYPE_EUI64_S, aExtAddress.m8));
     mExtendedAddress = aExtAddress;
 
 exit:
@@ -1057,7 +1177,7 @@ template <typename InterfaceType> otError RadioSpinel<InterfaceType>::SetPanId(u
     otError error = OT_ERROR_NONE;
 
     VerifyOrExit(mPanId != aPanId);
-    SuccessOrExit(error = Set(SPINEL_PROP_MAC_15_4_PANID, SPINEL_DATATYPE_UINT16_S, aPanId));
+    SuccessOrExit(error = SetAsync(SPINEL_PROP_MAC_15_4_PANID, SPINEL_DATATYPE_UINT16_S, aPanId));
     mPanId = aPanId;
 
 exit:
@@ -1066,17 +1186,26 @@ exit:
 
 template <typename InterfaceType> otError RadioSpinel<InterfaceType>::EnableSrcMatch(bool aEnable)
 {
-    return Set(SPINEL_PROP_MAC_SRC_MATCH_ENABLED, SPINEL_DATATYPE_BOOL_S, aEnable);
+    otError error = OT_ERROR_NONE;
+
+    if (mSrcMatchUpdating)
+    {
+        mSrcMatchEnableChanged = true;
+    }
+    else
+    {
+        SuccessOrExit(error = SetAsync(SPINEL_PROP_MAC_SRC_MATCH_ENABLED, SPINEL_DATATYPE_BOOL_S, aEnable));
+    }
+
+    mSrcMatchEnabled = aEnable;
+
+exit:
+    return error;
 }
 
 template <typename InterfaceType> otError RadioSpinel<InterfaceType>::AddSrcMatchShortEntry(uint16_t aShortAddress)
 {
-    otError error;
-
-    SuccessOrExit(error = Insert(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_UINT16_S, aShortAddress));
-
-#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
-    assert(mSrcMatchShortEntryCount < OPENTHREAD_CONFIG_MLE_MAX_CHILDREN);
+    otError error = OT_ERROR_NONE;
 
     for (int i = 0; i < mSrcMatchShortEntryCount; ++i)
     {
@@ -1085,9 +1214,21 @@ template <typename InterfaceType> otError RadioSpinel<InterfaceType>::AddSrcMatc
             ExitNow();
         }
     }
+
+    if (mSrcMatchUpdating)
+    {
+        VerifyOrExit(mSrcMatchShortEntryCount < OPENTHREAD_CONFIG_MLE_MAX_CHILDREN, error = OT_ERROR_NO_BUFS);
+        mSrcMatchShortChanged = true;
+    }
+    else
+    {
+        SuccessOrExit(
+            error = Insert(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_UINT16_S, aShortAddress));
+    }
+
+    assert(mSrcMatchShortEntryCount < OPENTHREAD_CONFIG_MLE_MAX_CHILDREN);
     mSrcMatchShortEntries[mSrcMatchShortEntryCount] = aShortAddress;
     ++mSrcMatchShortEntryCount;
-#endif
 
 exit:
     return error;
@@ -1096,13 +1237,7 @@ exit:
 template <typename InterfaceType>
 otError RadioSpinel<InterfaceType>::AddSrcMatchExtEntry(const otExtAddress &aExtAddress)
 {
-    otError error;
-
-    SuccessOrExit(error =
-                      Insert(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, SPINEL_DATATYPE_EUI64_S, aExtAddress.m8));
-
-#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
-    assert(mSrcMatchExtEntryCount < OPENTHREAD_CONFIG_MLE_MAX_CHILDREN);
+    otError error = OT_ERROR_NONE;
 
     for (int i = 0; i < mSrcMatchExtEntryCount; ++i)
     {
@@ -1111,9 +1246,21 @@ otError RadioSpinel<InterfaceType>::AddSrcMatchExtEntry(const otExtAddress &aExt
             ExitNow();
         }
     }
+
+    if (mSrcMatchUpdating)
+    {
+        VerifyOrExit(mSrcMatchExtEntryCount < OPENTHREAD_CONFIG_MLE_MAX_CHILDREN, error = OT_ERROR_NO_BUFS);
+        mSrcMatchExtChanged = true;
+    }
+    else
+    {
+        SuccessOrExit(error = Insert(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, SPINEL_DATATYPE_EUI64_S,
+                                     aExtAddress.m8));
+    }
+
+    assert(mSrcMatchExtEntryCount < OPENTHREAD_CONFIG_MLE_MAX_CHILDREN);
     mSrcMatchExtEntries[mSrcMatchExtEntryCount] = aExtAddress;
     ++mSrcMatchExtEntryCount;
-#endif
 
 exit:
     return error;
@@ -1121,21 +1268,28 @@ exit:
 
 template <typename InterfaceType> otError RadioSpinel<InterfaceType>::ClearSrcMatchShortEntry(uint16_t aShortAddress)
 {
-    otError error;
+    otError error = OT_ERROR_NONE;
+    int     index = 0;
 
-    SuccessOrExit(error = Remove(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_UINT16_S, aShortAddress));
+    while (index < mSrcMatchShortEntryCount && mSrcMatchShortEntries[index] != aShortAddress)
+    {
+        index++;
+    }
 
-#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
-    for (int i = 0; i < mSrcMatchShortEntryCount; ++i)
+    if (mSrcMatchUpdating)
     {
-        if (mSrcMatchShortEntries[i] == aShortAddress)
-        {
-            mSrcMatchShortEntries[i] = mSrcMatchShortEntries[mSrcMatchShortEntryCount - 1];
-            --mSrcMatchShortEntryCount;
-            break;
-        }
+        VerifyOrExit(index < mSrcMatchShortEntryCount, error = OT_ERROR_NO_ADDRESS);
+        mSrcMatchShortChanged = true;
+    }
+    else
+    {
+        SuccessOrExit(
+            error = Remove(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_UINT16_S, aShortAddress));
+        VerifyOrExit(index < mSrcMatchShortEntryCount);
     }
-#endif
+
+    mSrcMatchShortEntries[index] = mSrcMatchShortEntries[mSrcMatchShortEntryCount - 1];
+    --mSrcMatchShortEntryCount;
 
 exit:
     return error;
@@ -1144,22 +1298,29 @@ exit:
 template <typename InterfaceType>
 otError RadioSpinel<InterfaceType>::ClearSrcMatchExtEntry(const otExtAddress &aExtAddress)
 {
-    otError error;
+    otError error = OT_ERROR_NONE;
+    int     index = 0;
 
-    SuccessOrExit(error =
-                      Remove(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, SPINEL_DATATYPE_EUI64_S, aExtAddress.m8));
+    while (index < mSrcMatchExtEntryCount &&
+           memcmp(mSrcMatchExtEntries[index].m8, aExtAddress.m8, OT_EXT_ADDRESS_SIZE) != 0)
+    {
+        index++;
+    }
 
-#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
-    for (int i = 0; i < mSrcMatchExtEntryCount; ++i)
+    if (mSrcMatchUpdating)
     {
-        if (memcmp(mSrcMatchExtEntries[i].m8, aExtAddress.m8, OT_EXT_ADDRESS_SIZE) == 0)
-        {
-            mSrcMatchExtEntries[i] = mSrcMatchExtEntries[mSrcMatchExtEntryCount - 1];
-            --mSrcMatchExtEntryCount;
-            break;
-        }
+        VerifyOrExit(index < mSrcMatchExtEntryCount, error = OT_ERROR_NO_ADDRESS);
+        mSrcMatchExtChanged = true;
+    }
+    else
+    {
+        SuccessOrExit(error = Remove(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, SPINEL_DATATYPE_EUI64_S,
+                                     aExtAddress.m8));
+        VerifyOrExit(index < mSrcMatchExtEntryCount);
     }
-#endif
+
+    mSrcMatchExtEntries[index] = mSrcMatchExtEntries[mSrcMatchExtEntryCount - 1];
+    --mSrcMatchExtEntryCount;
 
 exit:
     return error;
@@ -1167,13 +1328,18 @@ exit:
 
 template <typename InterfaceType> otError RadioSpinel<InterfaceType>::ClearSrcMatchShortEntries(void)
 {
-    otError error;
+    otError error = OT_ERROR_NONE;
 
-    SuccessOrExit(error = Set(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, nullptr));
+    if (mSrcMatchUpdating)
+    {
+        mSrcMatchShortChanged = true;
+    }
+    else
+    {
+        SuccessOrExit(error = Set(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, nullptr));
+    }
 
-#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
     mSrcMatchShortEntryCount = 0;
-#endif
 
 exit:
     return error;
@@ -1181,13 +1347,103 @@ exit:
 
 template <typename InterfaceType> otError RadioSpinel<InterfaceType>::ClearSrcMatchExtEntries(void)
 {
-    otError error;
+    otError error = OT_ERROR_NONE;
 
-    SuccessOrExit(error = Set(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, nullptr));
+    if (mSrcMatchUpdating)
+    {
+        mSrcMatchExtChanged = true;
+    }
+    else
+    {
+        SuccessOrExit(error = Set(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, nullptr));
+    }
 
-#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
     mSrcMatchExtEntryCount = 0;
-#endif
+
+exit:
+    return error;
+}
+
+template <typename InterfaceType> void RadioSpinel<InterfaceType>::BeginSrcMatchUpdate(void)
+{
+    assert(!mSrcMatchUpdating);
+
+    mSrcMatchUpdating      = true;
+    mSrcMatchShortChanged  = false;
+    mSrcMatchExtChanged    = false;
+    mSrcMatchEnableChanged = false;
+}
+
+template <typename InterfaceType> otError RadioSpinel<InterfaceType>::CommitSrcMatchUpdate(void)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(mSrcMatchUpdating);
+    mSrcMatchUpdating = false;
+
+    VerifyOrExit(mSrcMatchShortChanged || mSrcMatchExtChanged || mSrcMatchEnableChanged);
+
+    // The tables are set before the src match state so that enabling
+    // the src match never uses a partially updated table.
+    BeginBatch();
+    BatchSrcMatchTables(mSrcMatchShortChanged, mSrcMatchExtChanged);
+
+    if (mSrcMatchEnableChanged)
+    {
+        BatchSet(SPINEL_PROP_MAC_SRC_MATCH_ENABLED, SPINEL_DATATYPE_BOOL_S, mSrcMatchEnabled);
+    }
+
+    SuccessOrExit(error = EndBatch());
+    SuccessOrExit(error = InsertSrcMatchOverflow(mSrcMatchShortChanged, mSrcMatchExtChanged));
+
+    otLogDebgPlat("Committed src match update: %d short, %d ext entries", mSrcMatchShortEntryCount,
+                  mSrcMatchExtEntryCount);
+
+exit:
+    return error;
+}
+
+template <typename InterfaceType> void RadioSpinel<InterfaceType>::BatchSrcMatchTables(bool aShort, bool aExt)
+{
+    uint8_t shortTable[sizeof(mSrcMatchShortEntries)];
+
+    if (aShort)
+    {
+        int count = OT_MIN(mSrcMatchShortEntryCount, static_cast<int16_t>(kMaxSrcMatchShortSet));
+
+        for (int i = 0; i < count; ++i)
+        {
+            Encoding::LittleEndian::WriteUint16(mSrcMatchShortEntries[i], &shortTable[i * sizeof(uint16_t)]);
+        }
+
+        BatchSet(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_DATA_S, shortTable,
+                 static_cast<uint32_t>(count * sizeof(uint16_t)));
+    }
+
+    if (aExt)
+    {
+        int count = OT_MIN(mSrcMatchExtEntryCount, static_cast<int16_t>(kMaxSrcMatchExtSet));
+
+        BatchSet(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, SPINEL_DATATYPE_DATA_S, mSrcMatchExtEntries[0].m8,
+                 static_cast<uint32_t>(count * sizeof(otExtAddress)));
+    }
+}
+
+template <typename InterfaceType> otError RadioSpinel<InterfaceType>::InsertSrcMatchOverflow(bool aShort, bool aExt)
+{
+    otError error = OT_ERROR_NONE;
+
+    for (int i = kMaxSrcMatchShortSet; aShort && i < mSrcMatchShortEntryCount; ++i)
+    {
+        SuccessOrExit(error = Insert(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_UINT16_S,
+                                     mSrcMatchShortEntries[i]));
+    }
+
+    for (int i = kMaxSrcMatchExtSet; aExt && i < mSrcMatchExtEntryCount; ++i)
+    {
+        SuccessOrExit(error = Insert(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, SPINEL_DATATYPE_EUI64_S,
+                                     mSrcMatchExtEntries[i].m8));
+    }
 
 exit:
     return error;
@@ -1511,6 +1767,350 @@ exit:
     return mError;
 }
 
+template <typename InterfaceType>
+otError RadioSpinel<InterfaceType>::SetAsync(spinel_prop_key_t aKey, const char *aFormat, ...)
+{
+    otError error;
+    va_list args;
+
+    va_start(args, aFormat);
+    error = RequestAsyncV(SPINEL_CMD_PROP_VALUE_IS, SPINEL_CMD_PROP_VALUE_SET, aKey, aFormat, args);
+    va_end(args);
+
+    return error;
+}
+
+template <typename InterfaceType>
+otError RadioSpinel<InterfaceType>::InsertAsync(spinel_prop_key_t aKey, const char *aFormat, ...)
+{
+    otError error;
+    va_list args;
+
+    va_start(args, aFormat);
+    error = RequestAsyncV(SPINEL_CMD_PROP_VALUE_INSERTED, SPINEL_CMD_PROP_VALUE_INSERT, aKey, aFormat, args);
+    va_end(args);
+
+    return error;
+}
+
+template <typename InterfaceType>
+otError RadioSpinel<InterfaceType>::RemoveAsync(spinel_prop_key_t aKey, const char *aFormat, ...)
+{
+    otError error;
+    va_list args;
+
+    va_start(args, aFormat);
+    error = RequestAsyncV(SPINEL_CMD_PROP_VALUE_REMOVED, SPINEL_CMD_PROP_VALUE_REMOVE, aKey, aFormat, args);
+    va_end(args);
+
+    return error;
+}
+
+template <typename InterfaceType>
+otError RadioSpinel<InterfaceType>::RequestAsyncV(uint32_t          aExpectedCommand,
+                                                  uint32_t          aCommand,
+                                                  spinel_prop_key_t aKey,
+                                                  const char       *aFormat,
+                                                  va_list           aArgs)
+{
+    otError error;
+
+    assert(mWaitingTid == 0);
+
+#if OPENTHREAD_SPINEL_CONFIG_MAX_PENDING_REQUESTS > 0
+    spinel_tid_t tid;
+
+#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
+    do
+    {
+        RecoverFromRcpFailure();
+#endif
+        WaitForPendingRequestSlot();
+#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
+    } while (mRcpFailed);
+#endif
+
+    tid = GetNextTid();
+    VerifyOrExit(tid > 0, error = OT_ERROR_BUSY);
+
+    error = SendCommand(aCommand, aKey, tid, aFormat, aArgs);
+
+    if (error != OT_ERROR_NONE)
+    {
+        FreeTid(tid);
+        ExitNow();
+    }
+
+    mPendingRequests[tid].mKey             = aKey;
+    mPendingRequests[tid].mExpectedCommand = aExpectedCommand;
+    mPendingRequests[tid].mDeadline        = otPlatTimeGet() + kMaxWaitTime * US_PER_MS;
+    mPendingTids |= (1 << tid);
+    mPendingCount++;
+
+    otLogDebgPlat("Pending request: tid=%u key=%lu", tid, ToUlong(aKey));
+
+exit:
+#else // OPENTHREAD_SPINEL_CONFIG_MAX_PENDING_REQUESTS > 0
+#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
+    do
+    {
+        RecoverFromRcpFailure();
+#endif
+        va_list args;
+
+        va_copy(args, aArgs);
+        error = RequestWithExpectedCommandV(aExpectedCommand, aCommand, aKey, aFormat, args);
+        va_end(args);
+#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
+    } while (mRcpFailed);
+#endif
+#endif // OPENTHREAD_SPINEL_CONFIG_MAX_PENDING_REQUESTS > 0
+
+    return error;
+}
+
+template <typename InterfaceType> void RadioSpinel<InterfaceType>::BeginBatch(void)
+{
+    assert(mBatchLength == 0);
+
+    mBatchLength = mSupportsMultiCmd ? static_cast<uint16_t>(kBatchHeaderSize) : 0;
+    mBatchCount  = 0;
+    mBatchError  = OT_ERROR_NONE;
+}
+
+template <typename InterfaceType>
+void RadioSpinel<InterfaceType>::BatchSet(spinel_prop_key_t aKey, const char *aFormat, ...)
+{
+    otError error;
+    va_list args;
+    va_list argsCopy;
+
+    va_start(args, aFormat);
+
+    if (mBatchLength == 0)
+    {
+        // Each property is set in its own request, which waits for the
+        // response so that `EndBatch()` also returns the RCP failures.
+        error = RequestWithExpectedCommandV(SPINEL_CMD_PROP_VALUE_IS, SPINEL_CMD_PROP_VALUE_SET, aKey, aFormat, args);
+        ExitNow();
+    }
+
+    va_copy(argsCopy, args);
+    error = AppendBatchEntry(aKey, aFormat, argsCopy);
+    va_end(argsCopy);
+
+    if (error == OT_ERROR_NO_BUFS && mBatchCount > 0)
+    {
+        // Send the properties batched so far to make room for this one.
+        SuccessOrExit(error = SendBatch());
+        error = AppendBatchEntry(aKey, aFormat, args);
+    }
+
+    SuccessOrExit(error);
+
+    if (mBatchCount >= kMaxBatchProperties)
+    {
+        error = SendBatch();
+    }
+
+exit:
+    va_end(args);
+
+    if (mBatchError == OT_ERROR_NONE)
+    {
+        mBatchError = error;
+    }
+}
+
+template <typename InterfaceType> otError RadioSpinel<InterfaceType>::EndBatch(void)
+{
+    if (mBatchCount > 0)
+    {
+        otError error = SendBatch();
+
+        if (mBatchError == OT_ERROR_NONE)
+        {
+            mBatchError = error;
+        }
+    }
+
+    mBatchLength = 0;
+
+    return mBatchError;
+}
+
+template <typename InterfaceType>
+otError RadioSpinel<InterfaceType>::AppendBatchEntry(spinel_prop_key_t aKey, const char *aFormat, va_list aArgs)
+{
+    // Each property is packed as a `t(iD)` struct, i.e. a little-endian
+    // `uint16_t` length followed by the property key and value.
+
+    otError        error  = OT_ERROR_NONE;
+    uint16_t       offset = mBatchLength + sizeof(uint16_t);
+    spinel_ssize_t packed;
+
+    VerifyOrExit(offset < sizeof(mBatchFrame), error = OT_ERROR_NO_BUFS);
+
+    packed = spinel_datatype_pack(mBatchFrame + offset, sizeof(mBatchFrame) - offset, SPINEL_DATATYPE_UINT_PACKED_S,
+                                  aKey);
+    VerifyOrExit(packed > 0 && static_cast<size_t>(packed + offset) <= sizeof(mBatchFrame), error = OT_ERROR_NO_BUFS);
+    offset += static_cast<uint16_t>(packed);
+
+    if (aFormat)
+    {
+        packed = spinel_datatype_vpack(mBatchFrame + offset, sizeof(mBatchFrame) - offset, aFormat, aArgs);
+        VerifyOrExit(packed > 0 && static_cast<size_t>(packed + offset) <= sizeof(mBatchFrame),
+                     error = OT_ERROR_NO_BUFS);
+        offset += static_cast<uint16_t>(packed);
+    }
+
+    Encoding::LittleEndian::WriteUint16(static_cast<uint16_t>(offset - mBatchLength - sizeof(uint16_t)),
+                                        mBatchFrame + mBatchLength);
+    mBatchLength = offset;
+    mBatchCount++;
+
+exit:
+    return error;
+}
+
+template <typename InterfaceType> otError RadioSpinel<InterfaceType>::SendBatch(void)
+{
+    otError      error = OT_ERROR_NONE;
+    spinel_tid_t tid   = GetNextTid();
+
+    assert(mWaitingTid == 0);
+
+    VerifyOrExit(tid > 0, error = OT_ERROR_BUSY);
+
+    // The header and command are packed in front of the batched properties.
+    IgnoreReturnValue(spinel_datatype_pack(mBatchFrame, kBatchHeaderSize, "Ci",
+                                           SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0 | tid,
+                                           SPINEL_CMD_PROP_VALUE_MULTI_SET));
+
+    error = mSpinelInterface.SendFrame(mBatchFrame, mBatchLength);
+
+    if (error != OT_ERROR_NONE)
+    {
+        FreeTid(tid);
+        ExitNow();
+    }
+
+    LogSpinelFrame(mBatchFrame, mBatchLength, true);
+
+    otLogDebgPlat("Sent %u batched properties: tid=%u", mBatchCount, tid);
+
+    mWaitingKey = SPINEL_PROP_LAST_STATUS;
+    mWaitingTid = tid;
+    error       = WaitResponse();
+
+exit:
+    mBatchLength = kBatchHeaderSize;
+    mBatchCount  = 0;
+
+    return error;
+}
+
+#if OPENTHREAD_SPINEL_CONFIG_MAX_PENDING_REQUESTS > 0
+template <typename InterfaceType> void RadioSpinel<InterfaceType>::WaitForPendingRequestSlot(void)
+{
+    uint64_t end = otPlatTimeGet() + kMaxWaitTime * US_PER_MS;
+
+    while (mPendingCount >= OPENTHREAD_SPINEL_CONFIG_MAX_PENDING_REQUESTS)
+    {
+        uint64_t now = otPlatTimeGet();
+
+        if ((end <= now) || (mSpinelInterface.WaitForFrame(end - now) != OT_ERROR_NONE))
+        {
+            otLogWarnPlat("Wait for pending response timeout");
+            ClearPendingRequests();
+            HandleRcpTimeout();
+            break;
+        }
+    }
+}
+
+template <typename InterfaceType>
+void RadioSpinel<InterfaceType>::HandlePendingResponse(spinel_tid_t      aTid,
+                                                       uint32_t          aCommand,
+                                                       spinel_prop_key_t aKey,
+                                                       const uint8_t    *aBuffer,
+                                                       uint16_t          aLength)
+{
+    const PendingRequest &request = mPendingRequests[aTid];
+    otError               error   = OT_ERROR_NONE;
+
+    if (aKey == SPINEL_PROP_LAST_STATUS)
+    {
+        spinel_status_t status;
+        spinel_ssize_t  unpacked = spinel_datatype_unpack(aBuffer, aLength, "i", &status);
+
+        VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
+        error = SpinelStatusToOtError(status);
+    }
+    else if ((aKey != request.mKey) || (aCommand != request.mExpectedCommand))
+    {
+        error = OT_ERROR_DROP;
+    }
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        otLogWarnPlat("Error processing pending request: tid=%u key=%lu: %s", aTid, ToUlong(request.mKey),
+                      otThreadErrorToString(error));
+    }
+
+    UpdateParseErrorCount(error);
+
+    mPendingTids &= ~(1 << aTid);
+    mPendingCount--;
+    FreeTid(aTid);
+}
+
+template <typename InterfaceType> void RadioSpinel<InterfaceType>::ProcessPendingRequests(void)
+{
+    VerifyOrExit(mPendingTids != 0);
+    VerifyOrExit(otPlatTimeGet() >= GetPendingRequestsDeadline());
+
+    otLogWarnPlat("Wait for pending response timeout");
+    ClearPendingRequests();
+    HandleRcpTimeout();
+
+exit:
+    return;
+}
+
+template <typename InterfaceType> void RadioSpinel<InterfaceType>::ClearPendingRequests(void)
+{
+    for (spinel_tid_t tid = 1; tid <= kMaxSpinelTid; tid++)
+    {
+        if ((mPendingTids & (1 << tid)) != 0)
+        {
+            FreeTid(tid);
+        }
+    }
+
+    mPendingTids  = 0;
+    mPendingCount = 0;
+}
+#endif // OPENTHREAD_SPINEL_CONFIG_MAX_PENDING_REQUESTS > 0
+
+template <typename InterfaceType> uint64_t RadioSpinel<InterfaceType>::GetPendingRequestsDeadline(void) const
+{
+    uint64_t deadline = UINT64_MAX;
+
+#if OPENTHREAD_SPINEL_CONFIG_MAX_PENDING_REQUESTS > 0
+    for (spinel_tid_t tid = 1; tid <= kMaxSpinelTid; tid++)
+    {
+        if (((mPendingTids & (1 << tid)) != 0) && (mPendingRequests[tid].mDeadline < deadline))
+        {
+            deadline = mPendingRequests[tid].mDeadline;
+        }
+    }
+#endif
+
+    return deadline;
+}
+
 template <typename InterfaceType> spinel_tid_t RadioSpinel<InterfaceType>::GetNextTid(void)
 {
     spinel_tid_t tid = mCmdNextTid;
@@ -1797,14 +2397,14 @@ template <typename InterfaceType> otError RadioSpinel<InterfaceType>::Receive(ui
 
     if (mChannel != aChannel)
     {
-        error = Set(SPINEL_PROP_PHY_CHAN, SPINEL_DATATYPE_UINT8_S, aChannel);
+        error = SetAsync(SPINEL_PROP_PHY_CHAN, SPINEL_DATATYPE_UINT8_S, aChannel);
         SuccessOrExit(error);
         mChannel = aChannel;
     }
 
     if (mState == kStateSleep)
     {
-        error = Set(SPINEL_PROP_MAC_RAW_STREAM_ENABLED, SPINEL_DATATYPE_BOOL_S, true);
+        error = SetAsync(SPINEL_PROP_MAC_RAW_STREAM_ENABLED, SPINEL_DATATYPE_BOOL_S, true);
         SuccessOrExit(error);
     }
 
@@ -1827,7 +2427,7 @@ template <typename InterfaceType> otError RadioSpinel<InterfaceType>::Sleep(void
     switch (mState)
     {
     case kStateReceive:
-        error = Set(SPINEL_PROP_MAC_RAW_STREAM_ENABLED, SPINEL_DATATYPE_BOOL_S, false);
+        error = SetAsync(SPINEL_PROP_MAC_RAW_STREAM_ENABLED, SPINEL_DATATYPE_BOOL_S, false);
         SuccessOrExit(error);
 
         mState = kStateSleep;
@@ -1853,9 +2453,11 @@ template <typename InterfaceType> otError RadioSpinel<InterfaceType>::Enable(otI
 
     mInstance = aInstance;
 
-    SuccessOrExit(error = Set(SPINEL_PROP_PHY_ENABLED, SPINEL_DATATYPE_BOOL_S, true));
-    SuccessOrExit(error = Set(SPINEL_PROP_MAC_15_4_PANID, SPINEL_DATATYPE_UINT16_S, mPanId));
-    SuccessOrExit(error = Set(SPINEL_PROP_MAC_15_4_SADDR, SPINEL_DATATYPE_UINT16_S, mShortAddress));
+    BeginBatch();
+    BatchSet(SPINEL_PROP_PHY_ENABLED, SPINEL_DATATYPE_BOOL_S, true);
+    BatchSet(SPINEL_PROP_MAC_15_4_PANID, SPINEL_DATATYPE_UINT16_S, mPanId);
+    BatchSet(SPINEL_PROP_MAC_15_4_SADDR, SPINEL_DATATYPE_UINT16_S, mShortAddress);
+    SuccessOrExit(error = EndBatch());
     SuccessOrExit(error = Get(SPINEL_PROP_PHY_RX_SENSITIVITY, SPINEL_DATATYPE_INT8_S, &mRxSensitivity));
 
     mState = kStateSleep;
@@ -2084,6 +2686,9 @@ template <typename InterfaceType> void RadioSpinel<InterfaceType>::RecoverFromRc
     mWaitingTid   = 0;
     mError        = OT_ERROR_NONE;
     mIsTimeSynced = false;
+#if OPENTHREAD_SPINEL_CONFIG_MAX_PENDING_REQUESTS > 0
+    ClearPendingRequests();
+#endif
 
     ResetRcp(mResetRadioOnStartup);
     SuccessOrDie(Set(SPINEL_PROP_PHY_ENABLED, SPINEL_DATATYPE_BOOL_S, true));
@@ -2126,59 +2731,55 @@ template <typename InterfaceType> void RadioSpinel<InterfaceType>::RestoreProper
 {
     Settings::NetworkInfo networkInfo;
 
-    SuccessOrDie(Set(SPINEL_PROP_MAC_15_4_PANID, SPINEL_DATATYPE_UINT16_S, mPanId));
-    SuccessOrDie(Set(SPINEL_PROP_MAC_15_4_SADDR, SPINEL_DATATYPE_UINT16_S, mShortAddress));
-    SuccessOrDie(Set(SPINEL_PROP_MAC_15_4_LADDR, SPINEL_DATATYPE_EUI64_S, mExtendedAddress.m8));
-    SuccessOrDie(Set(SPINEL_PROP_PHY_CHAN, SPINEL_DATATYPE_UINT8_S, mChannel));
+    BeginBatch();
+
+    BatchSet(SPINEL_PROP_MAC_15_4_PANID, SPINEL_DATATYPE_UINT16_S, mPanId);
+    BatchSet(SPINEL_PROP_MAC_15_4_SADDR, SPINEL_DATATYPE_UINT16_S, mShortAddress);
+    BatchSet(SPINEL_PROP_MAC_15_4_LADDR, SPINEL_DATATYPE_EUI64_S, mExtendedAddress.m8);
+    BatchSet(SPINEL_PROP_PHY_CHAN, SPINEL_DATATYPE_UINT8_S, mChannel);
 
     if (mMacKeySet)
     {
-        SuccessOrDie(Set(SPINEL_PROP_RCP_MAC_KEY,
-                         SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_DATA_WLEN_S
-                             SPINEL_DATATYPE_DATA_WLEN_S SPINEL_DATATYPE_DATA_WLEN_S,
-                         mKeyIdMode, mKeyId, mPrevKey.m8, sizeof(otMacKey), mCurrKey.m8, sizeof(otMacKey), mNextKey.m8,
-                         sizeof(otMacKey)));
+        BatchSet(SPINEL_PROP_RCP_MAC_KEY,
+                 SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_DATA_WLEN_S SPINEL_DATATYPE_DATA_WLEN_S
+                     SPINEL_DATATYPE_DATA_WLEN_S,
+                 mKeyIdMode, mKeyId, mPrevKey.m8, sizeof(otMacKey), mCurrKey.m8, sizeof(otMacKey), mNextKey.m8,
+                 sizeof(otMacKey));
     }
 
     if (mInstance != nullptr)
     {
         SuccessOrDie(static_cast<Instance *>(mInstance)->template Get<Settings>().Read(networkInfo));
-        SuccessOrDie(
-            Set(SPINEL_PROP_RCP_MAC_FRAME_COUNTER, SPINEL_DATATYPE_UINT32_S, networkInfo.GetMacFrameCounter()));
+        BatchSet(SPINEL_PROP_RCP_MAC_FRAME_COUNTER, SPINEL_DATATYPE_UINT32_S, networkInfo.GetMacFrameCounter());
     }
 
-    for (int i = 0; i < mSrcMatchShortEntryCount; ++i)
-    {
-        SuccessOrDie(
-            Insert(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_UINT16_S, mSrcMatchShortEntries[i]));
-    }
-
-    for (int i = 0; i < mSrcMatchExtEntryCount; ++i)
-    {
-        SuccessOrDie(
-            Insert(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, SPINEL_DATATYPE_EUI64_S, mSrcMatchExtEntries[i].m8));
-    }
+    // The src match tables are restored by setting all the entries at
+    // once, as the RCP tables are empty after its reset.
+    BatchSrcMatchTables(mSrcMatchShortEntryCount > 0, mSrcMatchExtEntryCount > 0);
 
     if (mCcaEnergyDetectThresholdSet)
     {
-        SuccessOrDie(Set(SPINEL_PROP_PHY_CCA_THRESHOLD, SPINEL_DATATYPE_INT8_S, mCcaEnergyDetectThreshold));
+        BatchSet(SPINEL_PROP_PHY_CCA_THRESHOLD, SPINEL_DATATYPE_INT8_S, mCcaEnergyDetectThreshold);
     }
 
     if (mTransmitPowerSet)
     {
-        SuccessOrDie(Set(SPINEL_PROP_PHY_TX_POWER, SPINEL_DATATYPE_INT8_S, mTransmitPower));
+        BatchSet(SPINEL_PROP_PHY_TX_POWER, SPINEL_DATATYPE_INT8_S, mTransmitPower);
     }
 
     if (mCoexEnabledSet)
     {
-        SuccessOrDie(Set(SPINEL_PROP_RADIO_COEX_ENABLE, SPINEL_DATATYPE_BOOL_S, mCoexEnabled));
+        BatchSet(SPINEL_PROP_RADIO_COEX_ENABLE, SPINEL_DATATYPE_BOOL_S, mCoexEnabled);
     }
 
     if (mFemLnaGainSet)
     {
-        SuccessOrDie(Set(SPINEL_PROP_PHY_FEM_LNA_GAIN, SPINEL_DATATYPE_INT8_S, mFemLnaGain));
+        BatchSet(SPINEL_PROP_PHY_FEM_LNA_GAIN, SPINEL_DATATYPE_INT8_S, mFemLnaGain);
     }
 
+    SuccessOrDie(EndBatch());
+    SuccessOrDie(InsertSrcMatchOverflow(mSrcMatchShortEntryCount > 0, mSrcMatchExtEntryCount > 0));
+
 #if OPENTHREAD_POSIX_CONFIG_MAX_POWER_TABLE_ENABLE
     for (uint8_t channel = Radio::kChannelMin; channel <= Radio::kChannelMax; channel++)
     {
@@ -2376,6 +2977,7 @@ void RadioSpinel<InterfaceType>::LogSpinelFrame(const uint8_t *aFrame, uint16_t
     start += Snprintf(start, static_cast<uint32_t>(end - start), "%s, flg:0x%x, tid:%u, cmd:%s", prefix,
                       SPINEL_HEADER_GET_FLAG(header), SPINEL_HEADER_GET_TID(header), spinel_command_to_cstr(cmd));
     VerifyOrExit(cmd != SPINEL_CMD_RESET);
+    VerifyOrExit(cmd != SPINEL_CMD_PROP_VALUE_MULTI_SET && cmd != SPINEL_CMD_PROP_VALUES_ARE);
 
     start += Snprintf(start, static_cast<uint32_t>(end - start), ", key:%s", spinel_prop_key_to_cstr(key));
     VerifyOrExit(cmd != SPINEL_CMD_PROP_VALUE_GET);
@@ -900,6 +900,14 @@ otError NcpBase::HandleCommand(uint8_t aHeader)
         error = CommandHandler_PROP_VALUE_update(aHeader, command);
         break;
 
+    case SPINEL_CMD_PROP_VALUE_MULTI_GET:
+        error = CommandHandler_PROP_VALUE_MULTI_GET(aHeader);
+        break;
+
+    case SPINEL_CMD_PROP_VALUE_MULTI_SET:
+        error = CommandHandler_PROP_VALUE_MULTI_SET(aHeader);
+        break;
+
 #if OPENTHREAD_CONFIG_NCP_ENABLE_PEEK_POKE
     case SPINEL_CMD_PEEK:
         error = CommandHandler_PEEK(aHeader);
@@ -984,44 +992,56 @@ exit:
     return didHandle;
 }
 
-otError NcpBase::HandleCommandPropertySet(uint8_t aHeader, spinel_prop_key_t aKey)
+// Returns `true` and updates the `aError` if the property has a "set"
+// handler, or if it is a vendor property supported by the vendor hook.
+bool NcpBase::HandlePropertySetWithHandler(spinel_prop_key_t aKey, otError &aError)
 {
-    otError         error   = OT_ERROR_NONE;
-    PropertyHandler handler = FindSetPropertyHandler(aKey);
+    bool            didHandle = true;
+    PropertyHandler handler   = FindSetPropertyHandler(aKey);
 
     if (handler != nullptr)
     {
         mDisableStreamWrite = false;
-        error               = (this->*handler)();
+        aError              = (this->*handler)();
         mDisableStreamWrite = true;
+        ExitNow();
     }
-    else
-    {
-        // If there is no "set" handler, check if this property is one of the
-        // ones that require different treatment.
-
-        bool didHandle = HandlePropertySetForSpecialProperties(aHeader, aKey, error);
 
-        VerifyOrExit(!didHandle);
+    didHandle = false;
 
 #if OPENTHREAD_ENABLE_NCP_VENDOR_HOOK
-        if (aKey >= SPINEL_PROP_VENDOR__BEGIN && aKey < SPINEL_PROP_VENDOR__END)
-        {
-            mDisableStreamWrite = false;
-            error               = VendorSetPropertyHandler(aKey);
-            mDisableStreamWrite = true;
+    if (aKey >= SPINEL_PROP_VENDOR__BEGIN && aKey < SPINEL_PROP_VENDOR__END)
+    {
+        mDisableStreamWrite = false;
+        aError              = VendorSetPropertyHandler(aKey);
+        mDisableStreamWrite = true;
 
-            // An `OT_ERROR_NOT_FOUND` status from vendor handler indicates
-            // that it does not support the given property key. In that
-            // case, `didHandle` is set to `false` so a `LAST_STATUS` with
-            // `PROP_NOT_FOUND` is emitted. Otherwise, we fall through to
-            // prepare the response.
+        // An `OT_ERROR_NOT_FOUND` status from vendor handler indicates
+        // that it does not support the given property key. In that
+        // case, `didHandle` is set to `false` so a `LAST_STATUS` with
+        // `PROP_NOT_FOUND` is emitted.
 
-            didHandle = (error != OT_ERROR_NOT_FOUND);
-        }
+        didHandle = (aError != OT_ERROR_NOT_FOUND);
+    }
 #endif
 
-        VerifyOrExit(didHandle, error = PrepareLastStatusResponse(aHeader, SPINEL_STATUS_PROP_NOT_FOUND));
+exit:
+    return didHandle;
+}
+
+otError NcpBase::HandleCommandPropertySet(uint8_t aHeader, spinel_prop_key_t aKey)
+{
+    otError error = OT_ERROR_NONE;
+
+    if (!HandlePropertySetWithHandler(aKey, error))
+    {
+        // If there is no "set" handler, check if this property is one of the
+        // ones that require different treatment.
+
+        bool didHandle = HandlePropertySetForSpecialProperties(aHeader, aKey, error);
+
+        VerifyOrExit(!didHandle);
+        ExitNow(error = PrepareLastStatusResponse(aHeader, SPINEL_STATUS_PROP_NOT_FOUND));
     }
 
     if (error == OT_ERROR_NONE)
@@ -1162,6 +1182,33 @@ exit:
     return error;
 }
 
+// Writes one `t(iD)` entry of a `VALUES_ARE` frame: the property value if
+// `aStatus` is OK and the property has a "get" handler, otherwise the
+// `LAST_STATUS` with `aStatus`.
+otError NcpBase::WritePropertyValuesAreEntry(spinel_prop_key_t aPropKey, spinel_status_t aStatus)
+{
+    otError         error   = OT_ERROR_NONE;
+    PropertyHandler handler = (aStatus == SPINEL_STATUS_OK) ? FindGetPropertyHandler(aPropKey) : nullptr;
+
+    SuccessOrExit(error = mEncoder.OpenStruct());
+
+    if (handler != nullptr)
+    {
+        SuccessOrExit(error = mEncoder.WriteUintPacked(aPropKey));
+        SuccessOrExit(error = (this->*handler)());
+    }
+    else
+    {
+        SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_PROP_LAST_STATUS));
+        SuccessOrExit(error = mEncoder.WriteUintPacked(aStatus));
+    }
+
+    SuccessOrExit(error = mEncoder.CloseStruct());
+
+exit:
+    return error;
+}
+
 otError NcpBase::WritePropertyValueInsertedRemovedFrame(uint8_t           aHeader,
                                                         unsigned int      aResponseCommand,
                                                         spinel_prop_key_t aPropKey,
@@ -1264,6 +1311,135 @@ exit:
     return error;
 }
 
+otError NcpBase::CommandHandler_PROP_VALUE_MULTI_GET(uint8_t aHeader)
+{
+    otError           parseError    = OT_ERROR_NONE;
+    otError           responseError = OT_ERROR_NONE;
+    spinel_prop_key_t propKeys[kMaxMultiProperties];
+    uint8_t           count = 0;
+
+    while (!mDecoder.IsAllRead())
+    {
+        unsigned int propKey;
+
+        VerifyOrExit(count < kMaxMultiProperties, parseError = OT_ERROR_NO_BUFS);
+        SuccessOrExit(parseError = mDecoder.ReadUintPacked(propKey));
+        propKeys[count++] = static_cast<spinel_prop_key_t>(propKey);
+    }
+
+    SuccessOrExit(responseError = mEncoder.BeginFrame(aHeader, SPINEL_CMD_PROP_VALUES_ARE));
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        spinel_status_t status =
+            (FindGetPropertyHandler(propKeys[i]) != nullptr) ? SPINEL_STATUS_OK : SPINEL_STATUS_PROP_NOT_FOUND;
+
+        SuccessOrExit(responseError = WritePropertyValuesAreEntry(propKeys[i], status));
+    }
+
+    SuccessOrExit(responseError = mEncoder.EndFrame());
+
+exit:
+    if (parseError != OT_ERROR_NONE)
+    {
+        responseError = PrepareLastStatusResponse(aHeader, ThreadErrorToSpinelStatus(parseError));
+    }
+
+    return responseError;
+}
+
+otError NcpBase::CommandHandler_PROP_VALUE_MULTI_SET(uint8_t aHeader)
+{
+    // The whole frame is parsed first, so a malformed frame is rejected
+    // without setting any of its properties. The properties are then set
+    // in order the same way as by `VALUE_SET`, as a "set" handler may
+    // write other frames, and the `VALUES_ARE` response is written with
+    // the value (or the error status) of each property. The properties
+    // that require special treatment also write their own response frame
+    // (e.g. `VALUE_IS` for `HOST_POWER_STATE`) before the `VALUES_ARE`.
+
+    otError           parseError    = OT_ERROR_NONE;
+    otError           responseError = OT_ERROR_NONE;
+    spinel_prop_key_t propKeys[kMaxMultiProperties];
+    spinel_status_t   statuses[kMaxMultiProperties];
+    uint8_t           count = 0;
+
+    mDecoder.SavePosition();
+
+    while (!mDecoder.IsAllRead())
+    {
+        unsigned int propKey;
+
+        VerifyOrExit(count < kMaxMultiProperties, parseError = OT_ERROR_NO_BUFS);
+        SuccessOrExit(parseError = mDecoder.OpenStruct());
+        SuccessOrExit(parseError = mDecoder.ReadUintPacked(propKey));
+        SuccessOrExit(parseError = mDecoder.CloseStruct());
+        propKeys[count++] = static_cast<spinel_prop_key_t>(propKey);
+    }
+
+    SuccessOrExit(parseError = mDecoder.ResetToSaved());
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        otError      error = OT_ERROR_NONE;
+        unsigned int propKey;
+
+        IgnoreError(mDecoder.OpenStruct());
+        IgnoreError(mDecoder.ReadUintPacked(propKey));
+
+        if (HandlePropertySetWithHandler(propKeys[i], error) ||
+            HandlePropertySetForSpecialProperties(aHeader, propKeys[i], error))
+        {
+            statuses[i] = ThreadErrorToSpinelStatus(error);
+        }
+        else
+        {
+            statuses[i] = SPINEL_STATUS_PROP_NOT_FOUND;
+        }
+
+        IgnoreError(mDecoder.CloseStruct());
+    }
+
+    responseError = mEncoder.BeginFrame(aHeader, SPINEL_CMD_PROP_VALUES_ARE);
+
+    for (uint8_t i = 0; (i < count) && (responseError == OT_ERROR_NONE); i++)
+    {
+        responseError = WritePropertyValuesAreEntry(propKeys[i], statuses[i]);
+    }
+
+    if (responseError == OT_ERROR_NONE)
+    {
+        responseError = mEncoder.EndFrame();
+    }
+
+    // If the full response cannot be written now, instead prepare a
+    // `LAST_STATUS` update with the first error status (if any).
+
+    if (responseError != OT_ERROR_NONE)
+    {
+        spinel_status_t status = SPINEL_STATUS_OK;
+
+        for (uint8_t i = 0; i < count; i++)
+        {
+            if (statuses[i] != SPINEL_STATUS_OK)
+            {
+                status = statuses[i];
+                break;
+            }
+        }
+
+        responseError = PrepareLastStatusResponse(aHeader, status);
+    }
+
+exit:
+    if (parseError != OT_ERROR_NONE)
+    {
+        responseError = PrepareLastStatusResponse(aHeader, ThreadErrorToSpinelStatus(parseError));
+    }
+
+    return responseError;
+}
+
 #if OPENTHREAD_CONFIG_NCP_ENABLE_PEEK_POKE
 
 otError NcpBase::CommandHandler_PEEK(uint8_t aHeader)
@@ -1811,6 +1987,7 @@ template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_CAPS>(void)
 {
     otError error = OT_ERROR_NONE;
 
+    SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CAP_CMD_MULTI));
     SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CAP_COUNTERS));
     SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CAP_UNSOL_UPDATE_FILTER));
 
@@ -199,11 +199,13 @@ protected:
     static PropertyHandler FindRemovePropertyHandler(spinel_prop_key_t aKey);
 
     bool    HandlePropertySetForSpecialProperties(uint8_t aHeader, spinel_prop_key_t aKey, otError &aError);
+    bool    HandlePropertySetWithHandler(spinel_prop_key_t aKey, otError &aError);
     otError HandleCommandPropertySet(uint8_t aHeader, spinel_prop_key_t aKey);
     otError HandleCommandPropertyInsertRemove(uint8_t aHeader, spinel_prop_key_t aKey, unsigned int aCommand);
 
     otError WriteLastStatusFrame(uint8_t aHeader, spinel_status_t aLastStatus);
     otError WritePropertyValueIsFrame(uint8_t aHeader, spinel_prop_key_t aPropKey, bool aIsGetResponse = true);
+    otError WritePropertyValuesAreEntry(spinel_prop_key_t aPropKey, spinel_status_t aStatus);
     otError WritePropertyValueInsertedRemovedFrame(uint8_t           aHeader,
                                                    unsigned int      aResponseCommand,
                                                    spinel_prop_key_t aPropKey,
@@ -382,6 +384,8 @@ protected:
     otError CommandHandler_RESET(uint8_t aHeader);
     // Combined command handler for `VALUE_GET`, `VALUE_SET`, `VALUE_INSERT` and `VALUE_REMOVE`.
     otError CommandHandler_PROP_VALUE_update(uint8_t aHeader, unsigned int aCommand);
+    otError CommandHandler_PROP_VALUE_MULTI_GET(uint8_t aHeader);
+    otError CommandHandler_PROP_VALUE_MULTI_SET(uint8_t aHeader);
 #if OPENTHREAD_CONFIG_NCP_ENABLE_PEEK_POKE
     otError CommandHandler_PEEK(uint8_t aHeader);
     otError CommandHandler_POKE(uint8_t aHeader);
@@ -541,6 +545,7 @@ protected:
         kTxBufferSize       = OPENTHREAD_CONFIG_NCP_TX_BUFFER_SIZE, // Tx Buffer size (used by mTxFrameBuffer).
         kResponseQueueSize  = OPENTHREAD_CONFIG_NCP_SPINEL_RESPONSE_QUEUE_SIZE,
         kInvalidScanChannel = -1, // Invalid scan channel.
+        kMaxMultiProperties = 16, // Max number of properties in a `VALUE_MULTI_SET` command.
     };
 
     spinel_status_t mLastStatus;
@@ -49,6 +49,12 @@
 #endif
 #include <stdarg.h>
 #include <stdlib.h>
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+#include <inttypes.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/eventfd.h>
+#endif
 #include <sys/ioctl.h>
 #include <sys/resource.h>
 #include <sys/stat.h>
@@ -125,6 +131,10 @@
 
 #if OPENTHREAD_POSIX_CONFIG_RCP_BUS == OT_POSIX_RCP_BUS_UART
 
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE && OPENTHREAD_POSIX_VIRTUAL_TIME
+#error "OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE is not supported with virtual time"
+#endif
+
 namespace ot {
 namespace Posix {
 
@@ -134,7 +144,19 @@ HdlcInterface::HdlcInterface(ReceiveFrameCallback aCallback, void *aCallbackCont
     , mReceiveFrameBuffer(aFrameBuffer)
     , mSockFd(-1)
     , mBaudRate(0)
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+    , mRxEventFd(-1)
+    , mTxEventFd(-1)
+    , mIoThreadRunning(false)
+    , mIoThreadStop(false)
+    , mIoRxGarbageFrameCount(0)
+    , mIoTxFrameCount(0)
+    , mIoTxFrameByteCount(0)
+    , mIoTxGarbageFrameCount(0)
+    , mHdlcDecoder(mIoRxFrame, HandleHdlcFrame, this)
+#else
     , mHdlcDecoder(aFrameBuffer, HandleHdlcFrame, this)
+#endif
     , mRadioUrl(nullptr)
 {
     memset(&mInterfaceMetrics, 0, sizeof(mInterfaceMetrics));
@@ -170,13 +192,40 @@ otError HdlcInterface::Init(const Url::Url &aRadioUrl)
 
     mRadioUrl = &aRadioUrl;
 
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+    VerifyOrDie((mRxEventFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK)) != -1, OT_EXIT_ERROR_ERRNO);
+    VerifyOrDie((mTxEventFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK)) != -1, OT_EXIT_ERROR_ERRNO);
+    StartIoThread();
+#endif
+
 exit:
     return error;
 }
 
 HdlcInterface::~HdlcInterface(void) { Deinit(); }
 
-void HdlcInterface::Deinit(void) { CloseFile(); }
+void HdlcInterface::Deinit(void)
+{
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+    StopIoThread();
+#endif
+
+    CloseFile();
+
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+    if (mRxEventFd != -1)
+    {
+        close(mRxEventFd);
+        mRxEventFd = -1;
+    }
+
+    if (mTxEventFd != -1)
+    {
+        close(mTxEventFd);
+        mTxEventFd = -1;
+    }
+#endif
+}
 
 void HdlcInterface::Read(void)
 {
@@ -197,6 +246,40 @@ void HdlcInterface::Read(void)
 
 void HdlcInterface::Decode(const uint8_t *aBuffer, uint16_t aLength) { mHdlcDecoder.Decode(aBuffer, aLength); }
 
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+otError HdlcInterface::SendFrame(const uint8_t *aFrame, uint16_t aLength)
+{
+    otError  error = OT_ERROR_NONE;
+    uint64_t event = 1;
+
+    // The frame is HDLC encoded and written to the socket by the I/O thread,
+    // which counts it in the TX metrics once written.
+    error = mTxRing.Push(aFrame, aLength, otPlatTimeGet());
+
+    if (error == OT_ERROR_NONE)
+    {
+        VerifyOrDie(write(mTxEventFd, &event, sizeof(event)) == sizeof(event), OT_EXIT_ERROR_ERRNO);
+    }
+    else
+    {
+        mInterfaceMetrics.mTransferredFrameCount++;
+        mInterfaceMetrics.mTransferredGarbageFrameCount++;
+        otLogWarnPlat("RCP TX ring is full, dropping frame");
+    }
+
+    if ((error == OT_ERROR_NONE) && IsSpinelResetCommand(aFrame, aLength))
+    {
+        // Stopping the I/O thread flushes the reset command to the RCP.
+        StopIoThread();
+        mHdlcDecoder.Reset();
+        mIoRxFrame.Clear();
+        error = ResetConnection();
+        StartIoThread();
+    }
+
+    return error;
+}
+#else
 otError HdlcInterface::SendFrame(const uint8_t *aFrame, uint16_t aLength)
 {
     otError                            error = OT_ERROR_NONE;
@@ -218,6 +301,7 @@ exit:
 
     return error;
 }
+#endif // OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
 
 otError HdlcInterface::Write(const uint8_t *aFrame, uint16_t aLength)
 {
@@ -249,6 +333,9 @@ otError HdlcInterface::Write(const uint8_t *aFrame, uint16_t aLength)
 exit:
 #endif // OPENTHREAD_POSIX_VIRTUAL_TIME
 
+#if !OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+    // With the I/O thread, the TX metrics are updated by `SendFrame()` and
+    // `IoWriteFrames()` instead.
     mInterfaceMetrics.mTransferredFrameCount++;
     if (error == OT_ERROR_NONE)
     {
@@ -260,6 +347,7 @@ exit:
     {
         mInterfaceMetrics.mTransferredGarbageFrameCount++;
     }
+#endif
 
     return error;
 }
@@ -291,6 +379,30 @@ otError HdlcInterface::WaitForFrame(uint64_t aTimeoutUs)
         assert(false);
         break;
     }
+#elif OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+    struct pollfd   pollFd = {mRxEventFd, POLLIN, 0};
+    struct timespec timeoutSpec;
+    int             rval;
+
+    OT_UNUSED_VARIABLE(timeout);
+
+    timeoutSpec.tv_sec  = static_cast<time_t>(aTimeoutUs / US_PER_S);
+    timeoutSpec.tv_nsec = static_cast<long>((aTimeoutUs % US_PER_S) * 1000);
+
+    rval = ppoll(&pollFd, 1, &timeoutSpec, nullptr);
+
+    if (rval > 0)
+    {
+        ProcessRxRing();
+    }
+    else if (rval == 0)
+    {
+        ExitNow(error = OT_ERROR_RESPONSE_TIMEOUT);
+    }
+    else if (errno != EINTR)
+    {
+        DieNowWithMessage("wait response", OT_EXIT_FAILURE);
+    }
 #else  // OPENTHREAD_POSIX_VIRTUAL_TIME
     timeout.tv_sec = static_cast<time_t>(aTimeoutUs / US_PER_S);
     timeout.tv_usec = static_cast<suseconds_t>(aTimeoutUs % US_PER_S);
@@ -338,14 +450,19 @@ exit:
 void HdlcInterface::UpdateFdSet(void *aMainloopContext)
 {
     otSysMainloopContext *context = reinterpret_cast<otSysMainloopContext *>(aMainloopContext);
+    int                   fd      = mSockFd;
 
     assert(context != nullptr);
 
-    FD_SET(mSockFd, &context->mReadFdSet);
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+    fd = mRxEventFd;
+#endif
+
+    FD_SET(fd, &context->mReadFdSet);
 
-    if (context->mMaxFd < mSockFd)
+    if (context->mMaxFd < fd)
     {
-        context->mMaxFd = mSockFd;
+        context->mMaxFd = fd;
     }
 }
 
@@ -368,11 +485,18 @@ void HdlcInterface::Process(const void *aMainloopContext)
 
     assert(context != nullptr);
 
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+    if (FD_ISSET(mRxEventFd, &context->mReadFdSet))
+    {
+        ProcessRxRing();
+    }
+#else
     if (FD_ISSET(mSockFd, &context->mReadFdSet))
     {
         Read();
     }
 #endif
+#endif
 }
 
 otError HdlcInterface::WaitForWritable(void)
@@ -694,6 +818,237 @@ void HdlcInterface::HandleHdlcFrame(void *aContext, otError aError)
     static_cast<HdlcInterface *>(aContext)->HandleHdlcFrame(aError);
 }
 
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+void HdlcInterface::HandleHdlcFrame(otError aError)
+{
+    // Called on the I/O thread, the frame is passed to the mainloop thread
+    // which updates the RX metrics in `ProcessRxRing()`.
+    uint64_t event = 1;
+
+    if ((aError == OT_ERROR_NONE) &&
+        (mRxRing.Push(mIoRxFrame.GetFrame(), mIoRxFrame.GetLength(), otPlatTimeGet()) == OT_ERROR_NONE))
+    {
+        VerifyOrDie(write(mRxEventFd, &event, sizeof(event)) == sizeof(event), OT_EXIT_ERROR_ERRNO);
+    }
+    else
+    {
+        mIoRxGarbageFrameCount++;
+    }
+
+    mIoRxFrame.Clear();
+}
+
+void HdlcInterface::UpdateIoMetrics(void)
+{
+    uint32_t rxGarbageCount = mIoRxGarbageFrameCount.exchange(0);
+    uint32_t txCount        = mIoTxFrameCount.exchange(0);
+    uint64_t txByteCount    = mIoTxFrameByteCount.exchange(0);
+    uint32_t txGarbageCount = mIoTxGarbageFrameCount.exchange(0);
+
+    mInterfaceMetrics.mTransferredFrameCount += rxGarbageCount + txCount + txGarbageCount;
+    mInterfaceMetrics.mTransferredValidFrameCount += txCount;
+    mInterfaceMetrics.mTransferredGarbageFrameCount += rxGarbageCount + txGarbageCount;
+    mInterfaceMetrics.mTxFrameCount += txCount;
+    mInterfaceMetrics.mTxFrameByteCount += txByteCount;
+
+    if (rxGarbageCount > 0)
+    {
+        otLogWarnPlat("RCP I/O thread dropped %u received frames", static_cast<unsigned int>(rxGarbageCount));
+    }
+
+    if (txGarbageCount > 0)
+    {
+        otLogWarnPlat("RCP I/O thread failed to write %u frames", static_cast<unsigned int>(txGarbageCount));
+    }
+}
+
+void HdlcInterface::ProcessRxRing(void)
+{
+    uint8_t  frame[kMaxFrameSize];
+    uint64_t event;
+
+    IgnoreReturnValue(read(mRxEventFd, &event, sizeof(event)));
+
+    UpdateIoMetrics();
+
+    while (true)
+    {
+        uint16_t length = sizeof(frame);
+        uint64_t timestamp;
+        uint64_t age;
+        otError  error = mRxRing.Pop(frame, length, timestamp);
+
+        if (error == OT_ERROR_NOT_FOUND)
+        {
+            break;
+        }
+
+        mInterfaceMetrics.mTransferredFrameCount++;
+
+        if (error == OT_ERROR_NONE)
+        {
+            error = mReceiveFrameBuffer.WriteData(frame, length);
+        }
+
+        if (error != OT_ERROR_NONE)
+        {
+            mInterfaceMetrics.mTransferredGarbageFrameCount++;
+            mReceiveFrameBuffer.DiscardFrame();
+            otLogWarnPlat("Error receiving hdlc frame: %s", otThreadErrorToString(error));
+            continue;
+        }
+
+        age = otPlatTimeGet() - timestamp;
+
+        mInterfaceMetrics.mRxFrameCount++;
+        mInterfaceMetrics.mRxFrameByteCount += length;
+        mInterfaceMetrics.mTransferredValidFrameCount++;
+
+        otLogDebgPlat("Received hdlc frame, length:%u, age:%" PRIu64 "us", length, age);
+        mReceiveFrameCallback(mReceiveFrameContext);
+    }
+}
+
+void HdlcInterface::StartIoThread(void)
+{
+    sigset_t allSignals;
+    sigset_t oldSignals;
+
+    VerifyOrExit(!mIoThreadRunning);
+
+    mIoThreadStop = false;
+
+    // Signals are left to the mainloop thread, the I/O thread is created with
+    // all of them blocked.
+    sigfillset(&allSignals);
+    VerifyOrDie(pthread_sigmask(SIG_SETMASK, &allSignals, &oldSignals) == 0, OT_EXIT_FAILURE);
+    VerifyOrDie(pthread_create(&mIoThread, nullptr, IoThreadMain, this) == 0, OT_EXIT_FAILURE);
+    VerifyOrDie(pthread_sigmask(SIG_SETMASK, &oldSignals, nullptr) == 0, OT_EXIT_FAILURE);
+
+    mIoThreadRunning = true;
+
+exit:
+    return;
+}
+
+void HdlcInterface::StopIoThread(void)
+{
+    uint64_t event = 1;
+
+    VerifyOrExit(mIoThreadRunning);
+
+    mIoThreadStop = true;
+    VerifyOrDie(write(mTxEventFd, &event, sizeof(event)) == sizeof(event), OT_EXIT_ERROR_ERRNO);
+    VerifyOrDie(pthread_join(mIoThread, nullptr) == 0, OT_EXIT_FAILURE);
+
+    mIoThreadRunning = false;
+
+exit:
+    return;
+}
+
+void *HdlcInterface::IoThreadMain(void *aContext)
+{
+    static_cast<HdlcInterface *>(aContext)->IoThreadMain();
+    return nullptr;
+}
+
+void HdlcInterface::IoThreadMain(void)
+{
+    struct pollfd pollFds[2];
+
+    pollFds[0] = {mSockFd, POLLIN, 0};
+    pollFds[1] = {mTxEventFd, POLLIN, 0};
+
+    while (!mIoThreadStop)
+    {
+        int rval = poll(pollFds, OT_ARRAY_LENGTH(pollFds), -1);
+
+        if (rval < 0)
+        {
+            VerifyOrDie(errno == EINTR, OT_EXIT_ERROR_ERRNO);
+            continue;
+        }
+
+        if (pollFds[0].revents & (POLLIN | POLLHUP))
+        {
+            Read();
+        }
+        else if (pollFds[0].revents & (POLLERR | POLLNVAL))
+        {
+            DieNowWithMessage("NCP error", OT_EXIT_FAILURE);
+        }
+
+        if (pollFds[1].revents & POLLIN)
+        {
+            uint64_t event;
+
+            IgnoreReturnValue(read(mTxEventFd, &event, sizeof(event)));
+            IoWriteFrames();
+        }
+    }
+
+    IoWriteFrames();
+}
+
+void HdlcInterface::IoWriteFrames(void)
+{
+    uint8_t  frame[kMaxFrameSize];
+    uint64_t event   = 1;
+    bool     written = false;
+
+    while (true)
+    {
+        uint16_t length = sizeof(frame);
+        uint64_t timestamp;
+        otError  error = mTxRing.Pop(frame, length, timestamp);
+
+        if (error == OT_ERROR_NOT_FOUND)
+        {
+            break;
+        }
+
+        if (error == OT_ERROR_NONE)
+        {
+            error = IoWriteFrame(frame, length);
+        }
+
+        if (error == OT_ERROR_NONE)
+        {
+            mIoTxFrameCount++;
+            mIoTxFrameByteCount += length;
+        }
+        else
+        {
+            mIoTxGarbageFrameCount++;
+        }
+
+        written = true;
+    }
+
+    // Wake up the mainloop thread to update the TX metrics.
+    if (written)
+    {
+        VerifyOrDie(write(mRxEventFd, &event, sizeof(event)) == sizeof(event), OT_EXIT_ERROR_ERRNO);
+    }
+}
+
+otError HdlcInterface::IoWriteFrame(const uint8_t *aFrame, uint16_t aLength)
+{
+    otError                            error = OT_ERROR_NONE;
+    Spinel::FrameBuffer<kMaxFrameSize> encoderBuffer;
+    Hdlc::Encoder                      hdlcEncoder(encoderBuffer);
+
+    SuccessOrExit(error = hdlcEncoder.BeginFrame());
+    SuccessOrExit(error = hdlcEncoder.Encode(aFrame, aLength));
+    SuccessOrExit(error = hdlcEncoder.EndFrame());
+
+    error = Write(encoderBuffer.GetFrame(), encoderBuffer.GetLength());
+
+exit:
+    return error;
+}
+#else
 void HdlcInterface::HandleHdlcFrame(otError aError)
 {
     mInterfaceMetrics.mTransferredFrameCount++;
@@ -712,6 +1067,7 @@ void HdlcInterface::HandleHdlcFrame(otError aError)
         otLogWarnPlat("Error decoding hdlc frame: %s", otThreadErrorToString(aError));
     }
 }
+#endif // OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
 
 otError HdlcInterface::ResetConnection(void)
 {
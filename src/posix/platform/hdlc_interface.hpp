@@ -41,6 +41,14 @@
 #include "lib/spinel/openthread-spinel-config.h"
 #include "lib/spinel/spinel_interface.hpp"
 
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+#include <atomic>
+
+#include <pthread.h>
+
+#include "posix/platform/spsc_frame_ring.hpp"
+#endif
+
 namespace ot {
 namespace Posix {
 
@@ -91,7 +99,8 @@ public:
      * Encodes and sends a spinel frame to Radio Co-processor (RCP) over the socket.
      *
      * This is blocking call, i.e., if the socket is not writable, this method waits for it to become writable for
-     * up to `kMaxWaitTime` interval.
+     * up to `kMaxWaitTime` interval. With `OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE`, the frame is instead queued
+     * to the I/O thread (`OT_ERROR_NO_BUFS` if the queue is full) and this method does not block.
      *
      * @param[in] aFrame     A pointer to buffer containing the spinel frame to send.
      * @param[in] aLength    The length (number of bytes) in the frame.
@@ -211,6 +220,19 @@ private:
     static void HandleHdlcFrame(void *aContext, otError aError);
     void        HandleHdlcFrame(otError aError);
 
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+    typedef SpscFrameRing<OPENTHREAD_POSIX_CONFIG_RCP_IO_RING_SIZE> FrameRing;
+
+    void         StartIoThread(void);
+    void         StopIoThread(void);
+    static void *IoThreadMain(void *aContext);
+    void         IoThreadMain(void);
+    void         IoWriteFrames(void);
+    otError      IoWriteFrame(const uint8_t *aFrame, uint16_t aLength);
+    void         ProcessRxRing(void);
+    void         UpdateIoMetrics(void);
+#endif
+
     /**
      * Opens file specified by aRadioUrl.
      *
@@ -244,8 +266,27 @@ private:
     void                *mReceiveFrameContext;
     RxFrameBuffer       &mReceiveFrameBuffer;
 
-    int             mSockFd;
-    uint32_t        mBaudRate;
+    int      mSockFd;
+    uint32_t mBaudRate;
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+    // The I/O thread decodes into `mIoRxFrame` and passes the frames to the
+    // mainloop thread through `mRxRing`. `SendFrame()` passes the frames to
+    // the I/O thread through `mTxRing`. Each ring has one eventfd to wake up
+    // its consumer. The `mIo` counters are updated by the I/O thread and
+    // folded into `mInterfaceMetrics` by the mainloop thread.
+    Spinel::FrameBuffer<kMaxFrameSize> mIoRxFrame;
+    FrameRing                          mRxRing;
+    FrameRing                          mTxRing;
+    int                                mRxEventFd;
+    int                                mTxEventFd;
+    pthread_t                          mIoThread;
+    bool                               mIoThreadRunning;
+    std::atomic<bool>                  mIoThreadStop;
+    std::atomic<uint32_t>              mIoRxGarbageFrameCount;
+    std::atomic<uint32_t>              mIoTxFrameCount;
+    std::atomic<uint64_t>              mIoTxFrameByteCount;
+    std::atomic<uint32_t>              mIoTxGarbageFrameCount;
+#endif
     Hdlc::Decoder   mHdlcDecoder;
     const Url::Url *mRadioUrl;
 
@@ -29,13 +29,29 @@
 #include "posix/platform/mainloop.hpp"
 
 #include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+#include <sys/epoll.h>
+#include <unistd.h>
+#endif
 
 #include "core/common/code_utils.hpp"
+#include "posix/platform/platform-posix.h"
 
 namespace ot {
 namespace Posix {
 namespace Mainloop {
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+void Source::ProcessFd(int aFd, uint32_t aEvents, void *aContext)
+{
+    OT_UNUSED_VARIABLE(aFd);
+    OT_UNUSED_VARIABLE(aEvents);
+    OT_UNUSED_VARIABLE(aContext);
+}
+#endif
+
 void Manager::Add(Source &aSource)
 {
     assert(aSource.mNext == nullptr);
@@ -64,6 +80,21 @@ void Manager::Update(otSysMainloopContext &aContext)
     {
         source->Update(aContext);
     }
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    // All watched file descriptors are polled through the epoll file
+    // descriptor, so only it is added to the (select-based) context.
+
+    if (mEpollFd >= 0)
+    {
+        FD_SET(mEpollFd, &aContext.mReadFdSet);
+
+        if (aContext.mMaxFd < mEpollFd)
+        {
+            aContext.mMaxFd = mEpollFd;
+        }
+    }
+#endif
 }
 
 void Manager::Process(const otSysMainloopContext &aContext)
@@ -72,8 +103,125 @@ void Manager::Process(const otSysMainloopContext &aContext)
     {
         source->Process(aContext);
     }
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    if (mEpollFd >= 0 && FD_ISSET(mEpollFd, &aContext.mReadFdSet))
+    {
+        ProcessEpoll();
+    }
+#endif
+}
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+otError Manager::InitEpoll(void)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(mEpollFd < 0);
+
+    mEpollFd = epoll_create1(EPOLL_CLOEXEC);
+    VerifyOrExit(mEpollFd >= 0, error = OT_ERROR_FAILED);
+
+exit:
+    return error;
+}
+
+otError Manager::AddFd(int aFd, uint32_t aEvents, Source &aSource, void *aContext)
+{
+    otError            error = OT_ERROR_NONE;
+    struct epoll_event event;
+
+    assert(aFd >= 0);
+
+    SuccessOrExit(error = InitEpoll());
+
+    if (aFd >= mNumFdEntries)
+    {
+        int      numFdEntries = (aFd + 1 > 2 * mNumFdEntries) ? aFd + 1 : 2 * mNumFdEntries;
+        FdEntry *fdEntries    = static_cast<FdEntry *>(realloc(mFdEntries, sizeof(FdEntry) * numFdEntries));
+
+        VerifyOrExit(fdEntries != nullptr, error = OT_ERROR_NO_BUFS);
+        memset(&fdEntries[mNumFdEntries], 0, sizeof(FdEntry) * (numFdEntries - mNumFdEntries));
+
+        mFdEntries    = fdEntries;
+        mNumFdEntries = numFdEntries;
+    }
+
+    assert(mFdEntries[aFd].mSource == nullptr);
+
+    memset(&event, 0, sizeof(event));
+    event.events  = aEvents;
+    event.data.fd = aFd;
+
+    VerifyOrExit(epoll_ctl(mEpollFd, EPOLL_CTL_ADD, aFd, &event) == 0, error = OT_ERROR_FAILED);
+
+    mFdEntries[aFd].mSource  = &aSource;
+    mFdEntries[aFd].mContext = aContext;
+
+exit:
+    return error;
+}
+
+void Manager::RemoveFd(int aFd)
+{
+    VerifyOrExit(aFd >= 0 && aFd < mNumFdEntries && mFdEntries[aFd].mSource != nullptr);
+
+    if (epoll_ctl(mEpollFd, EPOLL_CTL_DEL, aFd, nullptr) != 0)
+    {
+        otLogWarnPlat("Failed to remove fd %d from epoll: %s", aFd, strerror(errno));
+    }
+
+    mFdEntries[aFd].mSource  = nullptr;
+    mFdEntries[aFd].mContext = nullptr;
+
+exit:
+    return;
+}
+
+void Manager::Deinit(void)
+{
+    if (mEpollFd >= 0)
+    {
+        close(mEpollFd);
+        mEpollFd = -1;
+    }
+
+    free(mFdEntries);
+    mFdEntries    = nullptr;
+    mNumFdEntries = 0;
 }
 
+void Manager::ProcessEpoll(void)
+{
+    struct epoll_event events[kMaxEpollEvents];
+    int                count;
+
+    count = epoll_wait(mEpollFd, events, kMaxEpollEvents, /* aTimeout */ 0);
+
+    if (count < 0)
+    {
+        VerifyOrDie(errno == EINTR, OT_EXIT_ERROR_ERRNO);
+        ExitNow();
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        int fd = events[i].data.fd;
+
+        // The file descriptor may have been removed while processing an
+        // earlier event in this batch.
+
+        if (fd < mNumFdEntries && mFdEntries[fd].mSource != nullptr)
+        {
+            mFdEntries[fd].mSource->ProcessFd(fd, events[i].events, mFdEntries[fd].mContext);
+        }
+    }
+
+exit:
+    return;
+}
+#endif // OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+
 Manager &Manager::Get(void)
 {
     static Manager sInstance;
@@ -84,3 +232,178 @@ Manager &Manager::Get(void)
 } // namespace Mainloop
 } // namespace Posix
 } // namespace ot
+
+#ifndef SELF_TEST
+#define SELF_TEST 0
+#endif
+
+#if SELF_TEST && OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+
+#include <fcntl.h>
+#include <sys/resource.h>
+
+void otLogCritPlat(const char *aFormat, ...) { OT_UNUSED_VARIABLE(aFormat); }
+
+void otLogWarnPlat(const char *aFormat, ...) { OT_UNUSED_VARIABLE(aFormat); }
+
+const char *otExitCodeToString(uint8_t aExitCode)
+{
+    OT_UNUSED_VARIABLE(aExitCode);
+    return "";
+}
+
+namespace {
+
+using ot::Posix::Mainloop::Manager;
+
+class TestSource : public ot::Posix::Mainloop::Source
+{
+public:
+    void Update(otSysMainloopContext &aContext) override { OT_UNUSED_VARIABLE(aContext); }
+    void Process(const otSysMainloopContext &aContext) override { OT_UNUSED_VARIABLE(aContext); }
+
+    void ProcessFd(int aFd, uint32_t aEvents, void *aContext) override
+    {
+        char byte;
+
+        assert(aEvents & EPOLLIN);
+        assert(read(aFd, &byte, sizeof(byte)) == sizeof(byte));
+
+        mCount++;
+        mLastFd      = aFd;
+        mLastContext = aContext;
+
+        if (mFdToRemove >= 0)
+        {
+            Manager::Get().RemoveFd(mFdToRemove);
+        }
+    }
+
+    int   mCount       = 0;
+    int   mLastFd      = -1;
+    void *mLastContext = nullptr;
+    int   mFdToRemove  = -1;
+};
+
+// Runs one mainloop iteration without blocking and returns the maximum
+// file descriptor added to the context.
+int RunMainloop(void)
+{
+    otSysMainloopContext context;
+
+    memset(&context, 0, sizeof(context));
+    FD_ZERO(&context.mReadFdSet);
+    FD_ZERO(&context.mWriteFdSet);
+    FD_ZERO(&context.mErrorFdSet);
+    context.mMaxFd = -1;
+
+    Manager::Get().Update(context);
+
+    if (context.mMaxFd >= 0)
+    {
+        assert(select(context.mMaxFd + 1, &context.mReadFdSet, &context.mWriteFdSet, &context.mErrorFdSet,
+                      &context.mTimeout) >= 0);
+        Manager::Get().Process(context);
+    }
+
+    return context.mMaxFd;
+}
+
+void WriteByte(int aFd)
+{
+    char byte = 0;
+
+    assert(write(aFd, &byte, sizeof(byte)) == sizeof(byte));
+}
+
+} // namespace
+
+int main()
+{
+    TestSource source;
+    int        pipe1[2];
+    int        pipe2[2];
+    int        context;
+
+    assert(pipe(pipe1) == 0);
+    assert(pipe(pipe2) == 0);
+
+    // verify no file descriptor is polled before one is watched
+    assert(RunMainloop() == -1);
+
+    // verify events are dispatched only for ready file descriptors
+    assert(Manager::Get().AddFd(pipe1[0], EPOLLIN, source, &context) == OT_ERROR_NONE);
+    assert(Manager::Get().AddFd(pipe2[0], EPOLLIN, source, nullptr) == OT_ERROR_NONE);
+    assert(RunMainloop() >= 0);
+    assert(source.mCount == 0);
+
+    WriteByte(pipe1[1]);
+    RunMainloop();
+    assert(source.mCount == 1);
+    assert(source.mLastFd == pipe1[0]);
+    assert(source.mLastContext == &context);
+
+    WriteByte(pipe2[1]);
+    RunMainloop();
+    assert(source.mCount == 2);
+    assert(source.mLastFd == pipe2[0]);
+    assert(source.mLastContext == nullptr);
+
+    // verify a removed file descriptor is no longer dispatched
+    Manager::Get().RemoveFd(pipe2[0]);
+    WriteByte(pipe2[1]);
+    RunMainloop();
+    assert(source.mCount == 2);
+
+    // verify a file descriptor removed while processing an earlier event
+    // of the same batch is not dispatched
+    assert(Manager::Get().AddFd(pipe2[0], EPOLLIN, source, nullptr) == OT_ERROR_NONE);
+    WriteByte(pipe1[1]);
+    source.mFdToRemove = pipe1[0];
+    RunMainloop();
+    assert(source.mCount == 3);
+    source.mFdToRemove = -1;
+    Manager::Get().RemoveFd(pipe1[0]);
+    Manager::Get().RemoveFd(pipe2[0]);
+
+    // verify file descriptors above FD_SETSIZE can be watched
+    {
+        struct rlimit limit;
+
+        if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur > FD_SETSIZE + 1)
+        {
+            int fd = fcntl(pipe1[0], F_DUPFD, FD_SETSIZE);
+
+            assert(fd >= FD_SETSIZE);
+            assert(Manager::Get().AddFd(fd, EPOLLIN, source, &context) == OT_ERROR_NONE);
+            WriteByte(pipe1[1]);
+            RunMainloop();
+            assert(source.mCount == 4);
+            assert(source.mLastFd == fd);
+            Manager::Get().RemoveFd(fd);
+            close(fd);
+        }
+    }
+
+    // verify deinit releases the epoll file descriptor and a later watch
+    // starts over
+    Manager::Get().Deinit();
+    assert(RunMainloop() == -1);
+    Manager::Get().Deinit();
+
+    assert(Manager::Get().AddFd(pipe1[0], EPOLLIN, source, &context) == OT_ERROR_NONE);
+    source.mCount = 0;
+    WriteByte(pipe1[1]);
+    RunMainloop();
+    assert(source.mCount == 1);
+    Manager::Get().RemoveFd(pipe1[0]);
+    Manager::Get().Deinit();
+
+    close(pipe1[0]);
+    close(pipe1[1]);
+    close(pipe2[0]);
+    close(pipe2[1]);
+
+    return 0;
+}
+#endif // SELF_TEST && OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
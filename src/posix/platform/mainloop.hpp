@@ -34,6 +34,10 @@
 #ifndef OT_POSIX_PLATFORM_MAINLOOP_HPP_
 #define OT_POSIX_PLATFORM_MAINLOOP_HPP_
 
+#include "openthread-posix-config.h"
+
+#include <stdint.h>
+
 #include <openthread/openthread-system.h>
 
 namespace ot {
@@ -65,6 +69,18 @@ public:
      */
     virtual void Process(const otSysMainloopContext &aContext) = 0;
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    /**
+     * Processes the events of a file descriptor watched with `Manager::AddFd()`.
+     *
+     * @param[in]   aFd         The file descriptor.
+     * @param[in]   aEvents     The ready events (`EPOLLIN`, `EPOLLOUT`, ...).
+     * @param[in]   aContext    The context given to `Manager::AddFd()`.
+     *
+     */
+    virtual void ProcessFd(int aFd, uint32_t aEvents, void *aContext);
+#endif
+
     /**
      * Marks destructor virtual method.
      *
@@ -122,8 +138,64 @@ public:
      */
     static Manager &Get(void);
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    /**
+     * Starts watching a file descriptor in the mainloop.
+     *
+     * The file descriptor stays watched until it is removed with `RemoveFd()`, and does not need to be added to the
+     * mainloop context. Its ready events are delivered to `aSource.ProcessFd()` from `Process()`.
+     *
+     * @param[in]   aFd         The file descriptor.
+     * @param[in]   aEvents     The events to watch (`EPOLLIN`, `EPOLLOUT`, ...).
+     * @param[in]   aSource     A reference to the event source to process the events.
+     * @param[in]   aContext    An arbitrary context passed to `aSource.ProcessFd()`.
+     *
+     * @retval OT_ERROR_NONE      Successfully started watching the file descriptor.
+     * @retval OT_ERROR_FAILED    Failed to add the file descriptor to the epoll instance.
+     * @retval OT_ERROR_NO_BUFS   Failed to allocate memory.
+     *
+     */
+    otError AddFd(int aFd, uint32_t aEvents, Source &aSource, void *aContext);
+
+    /**
+     * Stops watching a file descriptor in the mainloop.
+     *
+     * Must be called before the file descriptor is closed. Any pending events of the file descriptor are discarded.
+     *
+     * @param[in]   aFd         The file descriptor.
+     *
+     */
+    void RemoveFd(int aFd);
+
+    /**
+     * Releases the epoll file descriptor and the memory used to track the watched file descriptors.
+     *
+     * Must be called after all file descriptors are removed with `RemoveFd()`.
+     *
+     */
+    void Deinit(void);
+#endif
+
 private:
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    static constexpr int kMaxEpollEvents = 64;
+
+    struct FdEntry
+    {
+        Source *mSource;
+        void   *mContext;
+    };
+
+    otError InitEpoll(void);
+    void    ProcessEpoll(void);
+#endif
+
     Source *mSources = nullptr;
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    int      mEpollFd      = -1;
+    FdEntry *mFdEntries    = nullptr; // Indexed by file descriptor.
+    int      mNumFdEntries = 0;
+#endif
 };
 
 } // namespace Mainloop
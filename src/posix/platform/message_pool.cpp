@@ -0,0 +1,331 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the elastic message buffer pool of the POSIX platform.
+ */
+
+#include "posix/platform/message_pool.hpp"
+
+#if OPENTHREAD_POSIX_CONFIG_MESSAGE_POOL_ELASTIC_ENABLE
+
+#include <stdlib.h>
+
+#include <openthread/logging.h>
+
+#include "platform-posix.h"
+#include "common/code_utils.hpp"
+
+namespace ot {
+namespace Posix {
+
+MessagePool &MessagePool::Get(void)
+{
+    static MessagePool sInstance;
+
+    return sInstance;
+}
+
+MessagePool::MessagePool(void)
+    : mBufferStride(0)
+    , mMinNumSlabs(0)
+    , mMaxNumSlabs(kMaxBuffers / kSlabBuffers)
+    , mNumSlabs(0)
+    , mNumFreeBuffers(0)
+    , mPartialSlabs{nullptr, nullptr}
+    , mEmptySlabs{nullptr, nullptr}
+{
+}
+
+void MessagePool::Init(uint16_t aMinNumBuffers, size_t aBufferSize)
+{
+    static constexpr size_t kAlignment = alignof(max_align_t);
+
+    size_t bufferStride = sizeof(BufferHeader) + (aBufferSize + kAlignment - 1) / kAlignment * kAlignment;
+
+    // The pool outlives the OpenThread instance, so it may be
+    // initialized again, but the buffer size cannot change.
+    VerifyOrDie(mNumSlabs == 0 || mBufferStride == bufferStride, OT_EXIT_FAILURE);
+
+    mBufferStride = bufferStride;
+    mMinNumSlabs  = static_cast<uint16_t>((aMinNumBuffers + kSlabBuffers - 1) / kSlabBuffers);
+
+    if (mMaxNumSlabs < mMinNumSlabs)
+    {
+        mMaxNumSlabs = mMinNumSlabs;
+    }
+
+    while (mNumSlabs < mMinNumSlabs)
+    {
+        VerifyOrDie(AddSlab(), OT_EXIT_FAILURE);
+    }
+}
+
+otMessageBuffer *MessagePool::New(void)
+{
+    otMessageBuffer *buffer = nullptr;
+    Slab            *slab   = mPartialSlabs.mHead;
+
+    // Partially used slabs are filled first so that the others can
+    // become unused. Among the unused slabs the most recently
+    // emptied one is taken, which lets the oldest ones age out.
+
+    if (slab == nullptr)
+    {
+        if (mEmptySlabs.mHead == nullptr)
+        {
+            VerifyOrExit(AddSlab());
+        }
+
+        slab = mEmptySlabs.mHead;
+        mEmptySlabs.Remove(*slab);
+        mPartialSlabs.PushFront(*slab);
+    }
+
+    buffer             = slab->mFreeBuffers;
+    slab->mFreeBuffers = buffer->mNext;
+    slab->mNumFreeBuffers--;
+    mNumFreeBuffers--;
+
+    if (slab->mNumFreeBuffers == 0)
+    {
+        mPartialSlabs.Remove(*slab);
+    }
+
+    ReleaseIdleSlabs();
+
+exit:
+    return buffer;
+}
+
+void MessagePool::Free(otMessageBuffer *aBuffer)
+{
+    Slab &slab = *(reinterpret_cast<BufferHeader *>(aBuffer) - 1)->mSlab;
+
+    if (slab.mNumFreeBuffers == 0)
+    {
+        mPartialSlabs.PushFront(slab);
+    }
+
+    aBuffer->mNext    = slab.mFreeBuffers;
+    slab.mFreeBuffers = aBuffer;
+    slab.mNumFreeBuffers++;
+    mNumFreeBuffers++;
+
+    if (slab.mNumFreeBuffers == kSlabBuffers)
+    {
+        mPartialSlabs.Remove(slab);
+
+        if (mNumSlabs > mMaxNumSlabs)
+        {
+            RemoveSlab(slab);
+        }
+        else
+        {
+            slab.mEmptySince = otPlatTimeGet();
+            mEmptySlabs.PushFront(slab);
+        }
+    }
+
+    ReleaseIdleSlabs();
+}
+
+uint16_t MessagePool::GetFreeBufferCount(void) const
+{
+    uint32_t numFree = mNumFreeBuffers;
+
+    if (mNumSlabs < mMaxNumSlabs)
+    {
+        numFree += static_cast<uint32_t>(mMaxNumSlabs - mNumSlabs) * kSlabBuffers;
+    }
+
+    return static_cast<uint16_t>(numFree < UINT16_MAX ? numFree : UINT16_MAX);
+}
+
+void MessagePool::SetMaxBuffers(uint16_t aMaxBuffers)
+{
+    mMaxNumSlabs = aMaxBuffers / kSlabBuffers;
+
+    if (mMaxNumSlabs < mMinNumSlabs)
+    {
+        mMaxNumSlabs = mMinNumSlabs;
+    }
+
+    while ((mNumSlabs > mMaxNumSlabs) && (mEmptySlabs.mTail != nullptr))
+    {
+        Slab &slab = *mEmptySlabs.mTail;
+
+        mEmptySlabs.Remove(slab);
+        RemoveSlab(slab);
+    }
+
+    otLogInfoPlat("Message pool: max %u buffers", mMaxNumSlabs * kSlabBuffers);
+}
+
+void MessagePool::ReleaseIdleSlabs(void)
+{
+    // The oldest unused slab is at the tail of `mEmptySlabs`, so
+    // this only looks at a slab which is actually released.
+
+    while ((mNumSlabs > mMinNumSlabs) && (mEmptySlabs.mTail != nullptr) &&
+           (otPlatTimeGet() - mEmptySlabs.mTail->mEmptySince >= kReleaseDelay))
+    {
+        Slab &slab = *mEmptySlabs.mTail;
+
+        mEmptySlabs.Remove(slab);
+        RemoveSlab(slab);
+    }
+}
+
+bool MessagePool::AddSlab(void)
+{
+    Slab    *slab = nullptr;
+    uint8_t *cur;
+
+    VerifyOrExit(mNumSlabs < mMaxNumSlabs);
+
+    slab = static_cast<Slab *>(calloc(1, sizeof(Slab) + kSlabBuffers * mBufferStride));
+
+    if (slab == nullptr)
+    {
+        otLogWarnPlat("Message pool: failed to allocate %u buffers", kSlabBuffers);
+        ExitNow();
+    }
+
+    cur = reinterpret_cast<uint8_t *>(slab + 1);
+
+    for (uint16_t i = 0; i < kSlabBuffers; i++, cur += mBufferStride)
+    {
+        BufferHeader    *header = reinterpret_cast<BufferHeader *>(cur);
+        otMessageBuffer *buffer = reinterpret_cast<otMessageBuffer *>(header + 1);
+
+        header->mSlab      = slab;
+        buffer->mNext      = slab->mFreeBuffers;
+        slab->mFreeBuffers = buffer;
+    }
+
+    slab->mNumFreeBuffers = kSlabBuffers;
+    slab->mEmptySince     = otPlatTimeGet();
+
+    mNumSlabs++;
+    mNumFreeBuffers += kSlabBuffers;
+    mEmptySlabs.PushFront(*slab);
+
+    otLogDebgPlat("Message pool: grown to %u buffers", mNumSlabs * kSlabBuffers);
+
+exit:
+    return slab != nullptr;
+}
+
+void MessagePool::RemoveSlab(Slab &aSlab)
+{
+    mNumSlabs--;
+    mNumFreeBuffers -= kSlabBuffers;
+    free(&aSlab);
+
+    otLogDebgPlat("Message pool: shrunk to %u buffers", mNumSlabs * kSlabBuffers);
+}
+
+void MessagePool::SlabList::PushFront(Slab &aSlab)
+{
+    aSlab.mPrev = nullptr;
+    aSlab.mNext = mHead;
+
+    if (mHead != nullptr)
+    {
+        mHead->mPrev = &aSlab;
+    }
+    else
+    {
+        mTail = &aSlab;
+    }
+
+    mHead = &aSlab;
+}
+
+void MessagePool::SlabList::Remove(Slab &aSlab)
+{
+    if (aSlab.mPrev != nullptr)
+    {
+        aSlab.mPrev->mNext = aSlab.mNext;
+    }
+    else
+    {
+        mHead = aSlab.mNext;
+    }
+
+    if (aSlab.mNext != nullptr)
+    {
+        aSlab.mNext->mPrev = aSlab.mPrev;
+    }
+    else
+    {
+        mTail = aSlab.mPrev;
+    }
+
+    aSlab.mPrev = nullptr;
+    aSlab.mNext = nullptr;
+}
+
+} // namespace Posix
+} // namespace ot
+
+extern "C" {
+
+void otPlatMessagePoolInit(otInstance *aInstance, uint16_t aMinNumFreeBuffers, size_t aBufferSize)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    ot::Posix::MessagePool::Get().Init(aMinNumFreeBuffers, aBufferSize);
+}
+
+otMessageBuffer *otPlatMessagePoolNew(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    return ot::Posix::MessagePool::Get().New();
+}
+
+void otPlatMessagePoolFree(otInstance *aInstance, otMessageBuffer *aBuffer)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    ot::Posix::MessagePool::Get().Free(aBuffer);
+}
+
+uint16_t otPlatMessagePoolNumFreeBuffers(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    return ot::Posix::MessagePool::Get().GetFreeBufferCount();
+}
+
+} // extern "C"
+
+#endif // OPENTHREAD_POSIX_CONFIG_MESSAGE_POOL_ELASTIC_ENABLE
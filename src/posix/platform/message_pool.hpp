@@ -0,0 +1,172 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef OT_POSIX_PLATFORM_MESSAGE_POOL_HPP_
+#define OT_POSIX_PLATFORM_MESSAGE_POOL_HPP_
+
+#include "openthread-posix-config.h"
+
+#if OPENTHREAD_POSIX_CONFIG_MESSAGE_POOL_ELASTIC_ENABLE
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <openthread/platform/messagepool.h>
+
+#include "core/common/non_copyable.hpp"
+
+namespace ot {
+namespace Posix {
+
+/**
+ * Implements an elastic message buffer pool.
+ *
+ * Buffers are allocated from the heap in slabs of `OPENTHREAD_POSIX_CONFIG_MESSAGE_POOL_SLAB_BUFFERS` buffers. The
+ * pool keeps at least the number of buffers requested by OpenThread and grows on demand up to a maximum. A slab above
+ * the minimum is released once it has stayed unused for `OPENTHREAD_POSIX_CONFIG_MESSAGE_POOL_RELEASE_DELAY`, the
+ * check is done when a buffer is allocated or freed. Allocating and freeing a buffer are O(1).
+ *
+ */
+class MessagePool : private NonCopyable
+{
+public:
+    /**
+     * Returns the singleton object of this class.
+     *
+     */
+    static MessagePool &Get(void);
+
+    /**
+     * Initializes the pool and allocates the minimum number of buffers.
+     *
+     * @param[in] aMinNumBuffers  The minimum number of buffers the pool keeps.
+     * @param[in] aBufferSize     The size in bytes of a buffer.
+     *
+     */
+    void Init(uint16_t aMinNumBuffers, size_t aBufferSize);
+
+    /**
+     * Allocates a buffer, growing the pool by a slab if needed.
+     *
+     * @returns A pointer to the buffer or `nullptr` if the pool is at its maximum size and all buffers are in use.
+     *
+     */
+    otMessageBuffer *New(void);
+
+    /**
+     * Frees a buffer back to the pool.
+     *
+     * @param[in] aBuffer  The buffer to free.
+     *
+     */
+    void Free(otMessageBuffer *aBuffer);
+
+    /**
+     * Returns the number of buffers which can still be allocated.
+     *
+     * The count includes the buffers of the slabs the pool may still allocate before reaching its maximum, not only
+     * the free buffers of the slabs currently allocated. OpenThread uses it to decide whether a low priority message
+     * may take a buffer, so it must reflect how many buffers can be handed out before `New()` fails. It may over
+     * report if the heap itself runs out.
+     *
+     * @returns The number of buffers which can still be allocated.
+     *
+     */
+    uint16_t GetFreeBufferCount(void) const;
+
+    /**
+     * Returns the number of buffers currently allocated from the heap, whether in use or free.
+     *
+     * @returns The number of allocated buffers.
+     *
+     */
+    uint32_t GetAllocatedBufferCount(void) const { return static_cast<uint32_t>(mNumSlabs) * kSlabBuffers; }
+
+    /**
+     * Sets the maximum number of buffers.
+     *
+     * The maximum is rounded down to whole slabs and is never less than the minimum number of buffers. Slabs beyond
+     * the new maximum are released as soon as they are no longer used.
+     *
+     * @param[in] aMaxBuffers  The maximum number of buffers.
+     *
+     */
+    void SetMaxBuffers(uint16_t aMaxBuffers);
+
+private:
+    static constexpr uint16_t kSlabBuffers  = OPENTHREAD_POSIX_CONFIG_MESSAGE_POOL_SLAB_BUFFERS;
+    static constexpr uint16_t kMaxBuffers   = OPENTHREAD_POSIX_CONFIG_MESSAGE_POOL_MAX_BUFFERS;
+    static constexpr uint64_t kReleaseDelay = OPENTHREAD_POSIX_CONFIG_MESSAGE_POOL_RELEASE_DELAY * 1000ull; // in usec
+
+    static_assert(kSlabBuffers > 0, "MESSAGE_POOL_SLAB_BUFFERS must not be zero");
+    static_assert(kMaxBuffers >= kSlabBuffers, "MESSAGE_POOL_MAX_BUFFERS must hold at least one slab");
+
+    struct alignas(max_align_t) Slab
+    {
+        Slab            *mPrev;
+        Slab            *mNext;
+        otMessageBuffer *mFreeBuffers;
+        uint16_t         mNumFreeBuffers;
+        uint64_t         mEmptySince; // Time (in usec) the slab became unused.
+    };
+
+    struct SlabList
+    {
+        void PushFront(Slab &aSlab);
+        void Remove(Slab &aSlab);
+
+        Slab *mHead;
+        Slab *mTail;
+    };
+
+    // Precedes every buffer in a slab, so a freed buffer finds its slab in O(1).
+    struct alignas(max_align_t) BufferHeader
+    {
+        Slab *mSlab;
+    };
+
+    MessagePool(void);
+
+    bool AddSlab(void);
+    void RemoveSlab(Slab &aSlab);
+    void ReleaseIdleSlabs(void);
+
+    size_t   mBufferStride;   // Size of a buffer with its header.
+    uint16_t mMinNumSlabs;    // Slabs kept even when unused.
+    uint16_t mMaxNumSlabs;    // Ceiling on the pool size.
+    uint16_t mNumSlabs;       // Slabs currently allocated.
+    uint32_t mNumFreeBuffers; // Free buffers in allocated slabs.
+    SlabList mPartialSlabs;   // Slabs with both used and free buffers.
+    SlabList mEmptySlabs;     // Unused slabs, most recently emptied first.
+};
+
+} // namespace Posix
+} // namespace ot
+
+#endif // OPENTHREAD_POSIX_CONFIG_MESSAGE_POOL_ELASTIC_ENABLE
+#endif // OT_POSIX_PLATFORM_MESSAGE_POOL_HPP_
@@ -135,6 +135,26 @@
  */
 #define OPENTHREAD_CONFIG_NCP_HDLC_ENABLE 1
 
+/**
+ * @def OPENTHREAD_SPINEL_CONFIG_HDLC_SLICE_BY_4_FCS_ENABLE
+ *
+ * Define as 1 to calculate the HDLC FCS four bytes at a time.
+ *
+ */
+#ifndef OPENTHREAD_SPINEL_CONFIG_HDLC_SLICE_BY_4_FCS_ENABLE
+#define OPENTHREAD_SPINEL_CONFIG_HDLC_SLICE_BY_4_FCS_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_SPINEL_CONFIG_MAX_PENDING_REQUESTS
+ *
+ * The maximum number of spinel property updates which the host keeps in flight without waiting for their responses.
+ *
+ */
+#ifndef OPENTHREAD_SPINEL_CONFIG_MAX_PENDING_REQUESTS
+#define OPENTHREAD_SPINEL_CONFIG_MAX_PENDING_REQUESTS 8
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_PLATFORM_RADIO_COEX_ENABLE
  *
@@ -145,6 +165,18 @@
 #define OPENTHREAD_CONFIG_PLATFORM_RADIO_COEX_ENABLE 1
 #endif
 
+#if OPENTHREAD_POSIX_CONFIG_MESSAGE_POOL_ELASTIC_ENABLE
+
+#ifndef OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
+#define OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT 1
+#endif
+
+#ifndef OPENTHREAD_CONFIG_MESSAGE_PRIORITY_RESERVE
+#define OPENTHREAD_CONFIG_MESSAGE_PRIORITY_RESERVE 16
+#endif
+
+#endif
+
 #if OPENTHREAD_POSIX_CONFIG_DAEMON_ENABLE
 
 #ifndef OPENTHREAD_CONFIG_PLATFORM_NETIF_ENABLE
@@ -115,6 +115,54 @@
 #define OPENTHREAD_POSIX_CONFIG_MAX_POWER_TABLE_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_MESSAGE_POOL_ELASTIC_ENABLE
+ *
+ * Define as 1 to allocate message buffers in slabs from the heap instead of using the fixed size OpenThread pool.
+ *
+ * The pool never shrinks below OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS, grows on demand up to
+ * OPENTHREAD_POSIX_CONFIG_MESSAGE_POOL_MAX_BUFFERS buffers and releases slabs which stayed unused for
+ * OPENTHREAD_POSIX_CONFIG_MESSAGE_POOL_RELEASE_DELAY.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_MESSAGE_POOL_ELASTIC_ENABLE
+#define OPENTHREAD_POSIX_CONFIG_MESSAGE_POOL_ELASTIC_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_MESSAGE_POOL_SLAB_BUFFERS
+ *
+ * The number of message buffers the elastic message pool allocates (and releases) at once.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_MESSAGE_POOL_SLAB_BUFFERS
+#define OPENTHREAD_POSIX_CONFIG_MESSAGE_POOL_SLAB_BUFFERS 64
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_MESSAGE_POOL_MAX_BUFFERS
+ *
+ * The default maximum number of message buffers of the elastic message pool.
+ *
+ * Can be changed at run-time with the `message_buffers_max` key in the product configuration file.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_MESSAGE_POOL_MAX_BUFFERS
+#define OPENTHREAD_POSIX_CONFIG_MESSAGE_POOL_MAX_BUFFERS 4096
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_MESSAGE_POOL_RELEASE_DELAY
+ *
+ * The time in milliseconds a slab above the minimum must stay unused before the elastic message pool releases it.
+ *
+ * The delay keeps a load hovering around a slab boundary from allocating and releasing a slab on every message.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_MESSAGE_POOL_RELEASE_DELAY
+#define OPENTHREAD_POSIX_CONFIG_MESSAGE_POOL_RELEASE_DELAY 10000
+#endif
+
 /**
  * @def OPENTHREAD_POSIX_CONFIG_MAX_MULTICAST_FORWARDING_CACHE_TABLE
  *
@@ -383,4 +431,50 @@
 #ifndef OPENTHREAD_POSIX_CONFIG_RCP_TIME_SYNC_INTERVAL
 #define OPENTHREAD_POSIX_CONFIG_RCP_TIME_SYNC_INTERVAL (60 * 1000 * 1000)
 #endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+ *
+ * Define as 1 to enable the epoll-based mainloop mode (Linux only).
+ *
+ * Mainloop sources can then watch file descriptors once with `Mainloop::Manager::AddFd()` instead of adding them to
+ * the `otSysMainloopContext` fd sets in every iteration. All watched file descriptors are polled through a single
+ * epoll file descriptor, and only the ready ones are dispatched.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+#define OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE 0
+#endif
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE && !defined(__linux__)
+#error "OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE is only supported on Linux"
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+ *
+ * Define as 1 to read, decode and write the frames of the HDLC (UART) RCP interface on a dedicated I/O thread (Linux
+ * only).
+ *
+ * The frames are exchanged with the OpenThread mainloop thread through lock-free single-producer/single-consumer
+ * rings, with an eventfd to wake up the mainloop, so RCP frames keep being read while the mainloop is busy.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+#define OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE 0
+#endif
+
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE && !defined(__linux__)
+#error "OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE is only supported on Linux"
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_RCP_IO_RING_SIZE
+ *
+ * The size in bytes of each of the RX and TX frame rings of the RCP I/O thread (must be a power of two).
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_RCP_IO_RING_SIZE
+#define OPENTHREAD_POSIX_CONFIG_RCP_IO_RING_SIZE 16384
+#endif
 #endif // OPENTHREAD_PLATFORM_CONFIG_H_
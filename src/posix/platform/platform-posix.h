@@ -164,6 +164,15 @@ void platformRadioInit(const char *aUrl);
  */
 void platformRadioDeinit(void);
 
+/**
+ * Logs the time taken by a phase of the RCP bring-up and starts the next phase.
+ *
+ * @param[in]     aPhase       A pointer to the null-terminated name of the phase.
+ * @param[inout]  aPhaseStart  A pointer to the start time of the phase, set to the current time.
+ *
+ */
+void platformRadioLogBringUpPhase(const char *aPhase, uint64_t *aPhaseStart);
+
 /**
  * Inputs a received radio frame.
  *
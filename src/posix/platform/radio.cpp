@@ -210,6 +210,11 @@ void *Radio::GetSpinelInstance(void) { return &sRadioSpinel; }
 
 void platformRadioDeinit(void) { sRadioSpinel.Deinit(); }
 
+void platformRadioLogBringUpPhase(const char *aPhase, uint64_t *aPhaseStart)
+{
+    sRadioSpinel.LogBringUpPhase(aPhase, *aPhaseStart);
+}
+
 void otPlatRadioGetIeeeEui64(otInstance *aInstance, uint8_t *aIeeeEui64)
 {
     OT_UNUSED_VARIABLE(aInstance);
@@ -318,7 +323,7 @@ bool otPlatRadioGetPromiscuous(otInstance *aInstance)
 void platformRadioUpdateFdSet(otSysMainloopContext *aContext)
 {
     uint64_t now      = otPlatTimeGet();
-    uint64_t deadline = sRadioSpinel.GetNextRadioTimeRecalcStart();
+    uint64_t deadline = OT_MIN(sRadioSpinel.GetNextRadioTimeRecalcStart(), sRadioSpinel.GetPendingRequestsDeadline());
 
     if (sRadioSpinel.IsTransmitting())
     {
@@ -427,6 +432,18 @@ void otPlatRadioClearSrcMatchExtEntries(otInstance *aInstance)
     SuccessOrDie(sRadioSpinel.ClearSrcMatchExtEntries());
 }
 
+void otPlatRadioBeginSrcMatchUpdate(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    sRadioSpinel.BeginSrcMatchUpdate();
+}
+
+otError otPlatRadioCommitSrcMatchUpdate(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    return sRadioSpinel.CommitSrcMatchUpdate();
+}
+
 otError otPlatRadioEnergyScan(otInstance *aInstance, uint8_t aScanChannel, uint16_t aScanDuration)
 {
     OT_UNUSED_VARIABLE(aInstance);
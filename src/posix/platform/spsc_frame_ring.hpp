@@ -0,0 +1,195 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for a lock-free single-producer/single-consumer frame ring.
+ */
+
+#ifndef OT_POSIX_PLATFORM_SPSC_FRAME_RING_HPP_
+#define OT_POSIX_PLATFORM_SPSC_FRAME_RING_HPP_
+
+#include <atomic>
+
+#include <stdint.h>
+#include <string.h>
+
+#include <openthread/error.h>
+
+#include "core/common/code_utils.hpp"
+#include "core/common/non_copyable.hpp"
+
+namespace ot {
+namespace Posix {
+
+/**
+ * Implements a lock-free ring of variable-length frames between two threads.
+ *
+ * One thread (the producer) may call `Push()` while another thread (the consumer) calls `Pop()` and `IsEmpty()`,
+ * without any locking. Each frame is stored along with a timestamp given by the producer.
+ *
+ * @tparam kSize  The size of the ring buffer in bytes (must be a power of two).
+ *
+ */
+template <uint32_t kSize> class SpscFrameRing : private NonCopyable
+{
+    static_assert((kSize & (kSize - 1)) == 0, "kSize must be a power of two");
+
+public:
+    /**
+     * Initializes the `SpscFrameRing` as empty.
+     *
+     */
+    SpscFrameRing(void)
+        : mHead(0)
+        , mTail(0)
+    {
+    }
+
+    /**
+     * Pushes a frame into the ring (producer only).
+     *
+     * @param[in] aFrame      A pointer to the frame.
+     * @param[in] aLength     The frame length.
+     * @param[in] aTimestamp  The timestamp of the frame.
+     *
+     * @retval OT_ERROR_NONE     Successfully pushed the frame.
+     * @retval OT_ERROR_NO_BUFS  Insufficient space in the ring for the frame.
+     *
+     */
+    otError Push(const uint8_t *aFrame, uint16_t aLength, uint64_t aTimestamp)
+    {
+        otError  error = OT_ERROR_NONE;
+        uint32_t head  = mHead.load(std::memory_order_relaxed);
+        uint32_t tail  = mTail.load(std::memory_order_acquire);
+
+        VerifyOrExit(kSize - (head - tail) >= kHeaderSize + aLength, error = OT_ERROR_NO_BUFS);
+
+        WriteBytes(head, &aLength, sizeof(aLength));
+        WriteBytes(head + sizeof(aLength), &aTimestamp, sizeof(aTimestamp));
+        WriteBytes(head + kHeaderSize, aFrame, aLength);
+
+        mHead.store(head + kHeaderSize + aLength, std::memory_order_release);
+
+    exit:
+        return error;
+    }
+
+    /**
+     * Pops the oldest frame from the ring (consumer only).
+     *
+     * @param[out]    aFrame      A pointer to a buffer to output the frame.
+     * @param[in,out] aLength     On entry, the size of @p aFrame. On exit, the frame length.
+     * @param[out]    aTimestamp  A reference to output the timestamp of the frame.
+     *
+     * @retval OT_ERROR_NONE       Successfully popped the frame.
+     * @retval OT_ERROR_NOT_FOUND  The ring is empty.
+     * @retval OT_ERROR_NO_BUFS    The frame is larger than @p aLength. The frame is dropped.
+     *
+     */
+    otError Pop(uint8_t *aFrame, uint16_t &aLength, uint64_t &aTimestamp)
+    {
+        otError  error = OT_ERROR_NONE;
+        uint32_t tail  = mTail.load(std::memory_order_relaxed);
+        uint32_t head  = mHead.load(std::memory_order_acquire);
+        uint16_t length;
+
+        VerifyOrExit(head != tail, error = OT_ERROR_NOT_FOUND);
+
+        ReadBytes(tail, &length, sizeof(length));
+        ReadBytes(tail + sizeof(length), &aTimestamp, sizeof(aTimestamp));
+
+        if (length <= aLength)
+        {
+            ReadBytes(tail + kHeaderSize, aFrame, length);
+        }
+        else
+        {
+            error = OT_ERROR_NO_BUFS;
+        }
+
+        aLength = length;
+        mTail.store(tail + kHeaderSize + length, std::memory_order_release);
+
+    exit:
+        return error;
+    }
+
+    /**
+     * Indicates whether the ring is empty (consumer only).
+     *
+     * @retval TRUE   The ring is empty.
+     * @retval FALSE  The ring is not empty.
+     *
+     */
+    bool IsEmpty(void) const
+    {
+        return mHead.load(std::memory_order_acquire) == mTail.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Removes all frames from the ring.
+     *
+     * Must only be called when neither the producer nor the consumer is using the ring.
+     *
+     */
+    void Clear(void) { mTail.store(mHead.load()); }
+
+private:
+    static constexpr uint32_t kHeaderSize = sizeof(uint16_t) + sizeof(uint64_t);
+
+    void WriteBytes(uint32_t aPosition, const void *aData, uint32_t aLength)
+    {
+        uint32_t offset = aPosition & (kSize - 1);
+        uint32_t first  = (aLength < kSize - offset) ? aLength : kSize - offset;
+
+        memcpy(&mBuffer[offset], aData, first);
+        memcpy(&mBuffer[0], static_cast<const uint8_t *>(aData) + first, aLength - first);
+    }
+
+    void ReadBytes(uint32_t aPosition, void *aData, uint32_t aLength) const
+    {
+        uint32_t offset = aPosition & (kSize - 1);
+        uint32_t first  = (aLength < kSize - offset) ? aLength : kSize - offset;
+
+        memcpy(aData, &mBuffer[offset], first);
+        memcpy(static_cast<uint8_t *>(aData) + first, &mBuffer[0], aLength - first);
+    }
+
+    // `mHead` and `mTail` are free-running positions, only written by
+    // the producer and the consumer respectively.
+
+    std::atomic<uint32_t> mHead;
+    std::atomic<uint32_t> mTail;
+    uint8_t               mBuffer[kSize];
+};
+
+} // namespace Posix
+} // namespace ot
+
+#endif // OT_POSIX_PLATFORM_SPSC_FRAME_RING_HPP_
@@ -42,6 +42,9 @@
 #include <openthread/border_router.h>
 #include <openthread/heap.h>
 #include <openthread/tasklet.h>
+#if OPENTHREAD_FTD
+#include <openthread/thread_ftd.h>
+#endif
 #include <openthread/platform/alarm-milli.h>
 #include <openthread/platform/infra_if.h>
 #include <openthread/platform/otns.h>
@@ -49,10 +52,12 @@
 
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
+#include "posix/platform/config_file.hpp"
 #include "posix/platform/daemon.hpp"
 #include "posix/platform/firewall.hpp"
 #include "posix/platform/infra_if.hpp"
 #include "posix/platform/mainloop.hpp"
+#include "posix/platform/message_pool.hpp"
 #include "posix/platform/radio_url.hpp"
 #include "posix/platform/udp.hpp"
 
@@ -80,6 +85,67 @@ static void processStateChange(otChangedFlags aFlags, void *aContext)
 }
 #endif
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_DYNAMIC_SIZE_ENABLE
+static void setUpAddressCacheSize(void)
+{
+    // Sets the EID cache size from the product configuration file
+    // (e.g., "address_cache_entries=512"), if present.
+
+    static const char kKeyAddressCacheEntries[] = "address_cache_entries";
+
+    ot::Posix::ConfigFile productConfigFile(OPENTHREAD_POSIX_CONFIG_PRODUCT_CONFIG_FILE);
+    int                   iterator = 0;
+    char                  value[16];
+    char                 *end;
+    unsigned long         size;
+    otError               error = OT_ERROR_NONE;
+
+    VerifyOrExit(productConfigFile.Get(kKeyAddressCacheEntries, iterator, value, sizeof(value)) == OT_ERROR_NONE);
+
+    size = strtoul(value, &end, 0);
+    VerifyOrExit(*end == '\0' && size <= UINT16_MAX, error = OT_ERROR_INVALID_ARGS);
+
+    error = otThreadSetCacheSize(gInstance, static_cast<uint16_t>(size));
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        otLogWarnPlat("Failed to set address cache size \"%s\": %s", value, otThreadErrorToString(error));
+    }
+}
+#endif
+
+#if OPENTHREAD_POSIX_CONFIG_MESSAGE_POOL_ELASTIC_ENABLE
+static void setUpMessagePoolSize(void)
+{
+    // Sets the maximum number of message buffers from the product
+    // configuration file (e.g., "message_buffers_max=16384"), if present.
+
+    static const char kKeyMessageBuffersMax[] = "message_buffers_max";
+
+    ot::Posix::ConfigFile productConfigFile(OPENTHREAD_POSIX_CONFIG_PRODUCT_CONFIG_FILE);
+    int                   iterator = 0;
+    char                  value[16];
+    char                 *end;
+    unsigned long         size;
+
+    VerifyOrExit(productConfigFile.Get(kKeyMessageBuffersMax, iterator, value, sizeof(value)) == OT_ERROR_NONE);
+
+    size = strtoul(value, &end, 0);
+
+    if (*end != '\0' || size > UINT16_MAX)
+    {
+        otLogWarnPlat("Invalid message buffers max \"%s\"", value);
+        ExitNow();
+    }
+
+    ot::Posix::MessagePool::Get().SetMaxBuffers(static_cast<uint16_t>(size));
+
+exit:
+    return;
+}
+#endif
+
 static const char *get802154RadioUrl(otPlatformConfig *aPlatformConfig)
 {
     const char *radioUrl = nullptr;
@@ -123,12 +189,15 @@ static const char *getTrelRadioUrl(otPlatformConfig *aPlatformConfig)
 
 void platformInit(otPlatformConfig *aPlatformConfig)
 {
+    uint64_t phaseStart = otPlatTimeGet();
+
 #if OPENTHREAD_POSIX_CONFIG_BACKTRACE_ENABLE
     platformBacktraceInit();
 #endif
 
     platformAlarmInit(aPlatformConfig->mSpeedUpFactor, aPlatformConfig->mRealTimeSignal);
     platformRadioInit(get802154RadioUrl(aPlatformConfig));
+    platformRadioLogBringUpPhase("radio init", &phaseStart);
 
     // For Dry-Run option, only init the radio.
     VerifyOrExit(!aPlatformConfig->mDryRun);
@@ -160,6 +229,8 @@ void platformInit(otPlatformConfig *aPlatformConfig)
 #endif
 #endif
 
+    platformRadioLogBringUpPhase("platform init", &phaseStart);
+
 exit:
     return;
 }
@@ -188,6 +259,14 @@ void platformSetUp(void)
     ot::Posix::Daemon::Get().SetUp();
 #endif
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_DYNAMIC_SIZE_ENABLE
+    setUpAddressCacheSize();
+#endif
+
+#if OPENTHREAD_POSIX_CONFIG_MESSAGE_POOL_ELASTIC_ENABLE
+    setUpMessagePoolSize();
+#endif
+
 #if OPENTHREAD_CONFIG_PLATFORM_NETIF_ENABLE || OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
     SuccessOrDie(otSetStateChangedCallback(gInstance, processStateChange, gInstance));
 #endif
@@ -198,15 +277,23 @@ exit:
 
 otInstance *otSysInit(otPlatformConfig *aPlatformConfig)
 {
+    uint64_t startTime = otPlatTimeGet();
+    uint64_t phaseStart;
+
     OT_ASSERT(gInstance == nullptr);
 
     platformInit(aPlatformConfig);
 
-    gDryRun   = aPlatformConfig->mDryRun;
-    gInstance = otInstanceInitSingle();
+    phaseStart = otPlatTimeGet();
+    gDryRun    = aPlatformConfig->mDryRun;
+    gInstance  = otInstanceInitSingle();
     OT_ASSERT(gInstance != nullptr);
+    platformRadioLogBringUpPhase("instance init", &phaseStart);
 
     platformSetUp();
+    platformRadioLogBringUpPhase("platform set up", &phaseStart);
+
+    otLogNotePlat("RCP bring-up: done in %" PRIu64 " us", otPlatTimeGet() - startTime);
 
     return gInstance;
 }
@@ -279,6 +366,9 @@ void otSysDeinit(void)
     otInstanceFinalize(gInstance);
     gInstance = nullptr;
     platformDeinit();
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    ot::Posix::Mainloop::Manager::Get().Deinit();
+#endif
 }
 
 #if OPENTHREAD_POSIX_VIRTUAL_TIME
@@ -47,6 +47,9 @@
 #include <string.h>
 #include <sys/select.h>
 #include <unistd.h>
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+#include <sys/epoll.h>
+#endif
 
 #include <openthread/udp.h>
 #include <openthread/platform/udp.h>
@@ -232,6 +235,16 @@ otError otPlatUdpSocket(otUdpSocket *aUdpSocket)
 
     aUdpSocket->mHandle = FdToHandle(fd);
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    error = ot::Posix::Udp::Get().WatchSocket(*aUdpSocket);
+
+    if (error != OT_ERROR_NONE)
+    {
+        close(fd);
+        aUdpSocket->mHandle = nullptr;
+    }
+#endif
+
 exit:
     return error;
 }
@@ -246,6 +259,9 @@ otError otPlatUdpClose(otUdpSocket *aUdpSocket)
     VerifyOrExit(aUdpSocket->mHandle != nullptr);
 
     fd = FdFromHandle(aUdpSocket->mHandle);
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    ot::Posix::Mainloop::Manager::Get().RemoveFd(fd);
+#endif
     VerifyOrExit(0 == close(fd), error = OT_ERROR_FAILED);
 
     aUdpSocket->mHandle = nullptr;
@@ -536,6 +552,13 @@ namespace Posix {
 
 void Udp::Update(otSysMainloopContext &aContext)
 {
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    // The sockets are watched by the mainloop, but only while the
+    // Thread network interface is known, as in the select-based mode.
+    OT_UNUSED_VARIABLE(aContext);
+
+    SetSocketsWatched(gNetifIndex != 0);
+#else
     VerifyOrExit(gNetifIndex != 0);
 
     for (otUdpSocket *socket = otUdpGetSockets(gInstance); socket != nullptr; socket = socket->mNext)
@@ -558,6 +581,7 @@ void Udp::Update(otSysMainloopContext &aContext)
 
 exit:
     return;
+#endif
 }
 
 void Udp::Init(const char *aIfName)
@@ -586,6 +610,10 @@ void Udp::TearDown(void) { Mainloop::Manager::Get().Remove(*this); }
 void Udp::Deinit(void)
 {
     // TODO All platform sockets should be closed
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    // Closing the sockets with the instance already stopped watching them.
+    mSocketsWatched = false;
+#endif
 }
 
 Udp &Udp::Get(void)
@@ -595,51 +623,101 @@ Udp &Udp::Get(void)
     return sInstance;
 }
 
-void Udp::Process(const otSysMainloopContext &aContext)
+bool Udp::Receive(otUdpSocket &aSocket, int aFd)
 {
     otMessageSettings msgSettings = {false, OT_MESSAGE_PRIORITY_NORMAL};
+    bool              received    = false;
+    otMessageInfo     messageInfo;
+    otMessage        *message = nullptr;
+    uint8_t           payload[kMaxUdpSize];
+    uint16_t          length = sizeof(payload);
+
+    memset(&messageInfo, 0, sizeof(messageInfo));
+    messageInfo.mSockPort = aSocket.mSockName.mPort;
+
+    SuccessOrExit(receivePacket(aFd, payload, length, messageInfo));
+
+    message = otUdpNewMessage(gInstance, &msgSettings);
+    VerifyOrExit(message != nullptr);
 
+    SuccessOrExit(otMessageAppend(message, payload, length));
+
+    aSocket.mHandler(aSocket.mContext, message, &messageInfo);
+    received = true;
+
+exit:
+    if (message != nullptr)
+    {
+        otMessageFree(message);
+    }
+
+    return received;
+}
+
+void Udp::Process(const otSysMainloopContext &aContext)
+{
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    OT_UNUSED_VARIABLE(aContext);
+#else
     for (otUdpSocket *socket = otUdpGetSockets(gInstance); socket != nullptr; socket = socket->mNext)
     {
         int fd = FdFromHandle(socket->mHandle);
 
-        if (fd > 0 && FD_ISSET(fd, &aContext.mReadFdSet))
+        // only process one socket a time
+        if (fd > 0 && FD_ISSET(fd, &aContext.mReadFdSet) && Receive(*socket, fd))
         {
-            otMessageInfo messageInfo;
-            otMessage    *message = nullptr;
-            uint8_t       payload[kMaxUdpSize];
-            uint16_t      length = sizeof(payload);
+            break;
+        }
+    }
+#endif
+}
 
-            memset(&messageInfo, 0, sizeof(messageInfo));
-            messageInfo.mSockPort = socket->mSockName.mPort;
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+void Udp::ProcessFd(int aFd, uint32_t aEvents, void *aContext)
+{
+    OT_UNUSED_VARIABLE(aEvents);
 
-            if (OT_ERROR_NONE != receivePacket(fd, payload, length, messageInfo))
-            {
-                continue;
-            }
+    IgnoreReturnValue(Receive(*static_cast<otUdpSocket *>(aContext), aFd));
+}
 
-            message = otUdpNewMessage(gInstance, &msgSettings);
+otError Udp::WatchSocket(otUdpSocket &aSocket)
+{
+    otError error = OT_ERROR_NONE;
 
-            if (message == nullptr)
-            {
-                continue;
-            }
+    VerifyOrExit(mSocketsWatched);
+    error = Mainloop::Manager::Get().AddFd(FdFromHandle(aSocket.mHandle), EPOLLIN, *this, &aSocket);
 
-            if (otMessageAppend(message, payload, length) != OT_ERROR_NONE)
-            {
-                otMessageFree(message);
-                continue;
-            }
+exit:
+    return error;
+}
 
-            socket->mHandler(socket->mContext, message, &messageInfo);
-            otMessageFree(message);
-            // only process one socket a time
-            break;
+void Udp::SetSocketsWatched(bool aWatched)
+{
+    VerifyOrExit(aWatched != mSocketsWatched);
+
+    mSocketsWatched = aWatched;
+
+    for (otUdpSocket *socket = otUdpGetSockets(gInstance); socket != nullptr; socket = socket->mNext)
+    {
+        if (socket->mHandle == nullptr)
+        {
+            continue;
+        }
+
+        if (!aWatched)
+        {
+            Mainloop::Manager::Get().RemoveFd(FdFromHandle(socket->mHandle));
+        }
+        else if (WatchSocket(*socket) != OT_ERROR_NONE)
+        {
+            otLogWarnPlat("Failed to watch UDP socket %d", FdFromHandle(socket->mHandle));
         }
     }
 
+exit:
     return;
 }
+#endif
 
 } // namespace Posix
 } // namespace ot
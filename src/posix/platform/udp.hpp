@@ -28,6 +28,8 @@
 #ifndef OT_POSIX_PLATFORM_UDP_HPP_
 #define OT_POSIX_PLATFORM_UDP_HPP_
 
+#include <openthread/udp.h>
+
 #include "core/common/non_copyable.hpp"
 #include "posix/platform/mainloop.hpp"
 
@@ -45,6 +47,18 @@ public:
     void Deinit(void);
     void Update(otSysMainloopContext &aContext) override;
     void Process(const otSysMainloopContext &aContext) override;
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    void    ProcessFd(int aFd, uint32_t aEvents, void *aContext) override;
+    otError WatchSocket(otUdpSocket &aSocket);
+#endif
+
+private:
+    bool Receive(otUdpSocket &aSocket, int aFd);
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    void SetSocketsWatched(bool aWatched);
+
+    bool mSocketsWatched = false;
+#endif
 };
 
 } // namespace Posix
@@ -0,0 +1,281 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "test_platform.h"
+
+#include <openthread/config.h>
+#include <openthread/thread_ftd.h>
+
+#include "test_util.h"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "thread/address_resolver.hpp"
+
+namespace ot {
+
+static constexpr uint16_t kSnoopRloc16 = 0x0400;
+
+static Ip6::Address GetEid(uint16_t aIndex)
+{
+    Ip6::Address eid;
+
+    SuccessOrQuit(eid.FromString("fd00::"));
+    eid.mFields.m16[7] = Encoding::BigEndian::HostSwap16(aIndex);
+
+    return eid;
+}
+
+static void Snoop(Instance &aInstance, uint16_t aIndex)
+{
+    aInstance.Get<AddressResolver>().UpdateSnoopedCacheEntry(GetEid(aIndex), kSnoopRloc16,
+                                                             aInstance.Get<Mac::Mac>().GetShortAddress());
+}
+
+static uint16_t GetNumCacheEntries(Instance &aInstance)
+{
+    uint16_t                   numEntries = 0;
+    AddressResolver::Iterator  iterator;
+    AddressResolver::EntryInfo info;
+
+    iterator.Clear();
+
+    while (aInstance.Get<AddressResolver>().GetNextCacheEntry(info, iterator) == kErrorNone)
+    {
+        numEntries++;
+    }
+
+    return numEntries;
+}
+
+static bool IsCached(Instance &aInstance, uint16_t aIndex)
+{
+    bool                       found = false;
+    AddressResolver::Iterator  iterator;
+    AddressResolver::EntryInfo info;
+
+    iterator.Clear();
+
+    while (aInstance.Get<AddressResolver>().GetNextCacheEntry(info, iterator) == kErrorNone)
+    {
+        if (AsCoreType(&info.mTarget) == GetEid(aIndex))
+        {
+            found = true;
+            break;
+        }
+    }
+
+    return found;
+}
+
+void TestAddressCacheRemove(void)
+{
+    // Removes entries at the head, middle and tail of the snooped
+    // list (entries are added at the head), so that the list and
+    // previous entry of a removed entry are validated.
+
+    static constexpr uint16_t kNumEntries = 6;
+
+    Instance *instance = testInitInstance();
+
+    printf("TestAddressCacheRemove() ");
+
+    VerifyOrQuit(instance != nullptr);
+
+    instance->Get<Mac::Mac>().SetShortAddress(0x0800);
+
+    for (uint16_t i = 1; i <= kNumEntries; i++)
+    {
+        Snoop(*instance, i);
+    }
+
+    VerifyOrQuit(GetNumCacheEntries(*instance) == kNumEntries);
+
+    instance->Get<AddressResolver>().RemoveEntryForAddress(GetEid(kNumEntries));
+    instance->Get<AddressResolver>().RemoveEntryForAddress(GetEid(3));
+    instance->Get<AddressResolver>().RemoveEntryForAddress(GetEid(1));
+
+    // Removing an EID which is not cached does nothing.
+    instance->Get<AddressResolver>().RemoveEntryForAddress(GetEid(3));
+
+    VerifyOrQuit(GetNumCacheEntries(*instance) == kNumEntries - 3);
+    VerifyOrQuit(!IsCached(*instance, 1));
+    VerifyOrQuit(IsCached(*instance, 2));
+    VerifyOrQuit(!IsCached(*instance, 3));
+    VerifyOrQuit(IsCached(*instance, 4));
+    VerifyOrQuit(IsCached(*instance, 5));
+    VerifyOrQuit(!IsCached(*instance, kNumEntries));
+
+    // Add back a removed entry (at the head) and update an existing
+    // one, then remove all entries.
+
+    Snoop(*instance, 3);
+    Snoop(*instance, 4);
+
+    VerifyOrQuit(GetNumCacheEntries(*instance) == kNumEntries - 2);
+
+    for (uint16_t i = 1; i <= kNumEntries; i++)
+    {
+        instance->Get<AddressResolver>().RemoveEntryForAddress(GetEid(i));
+    }
+
+    VerifyOrQuit(GetNumCacheEntries(*instance) == 0);
+
+    testFreeInstance(instance);
+
+    printf(" --> PASSED\n");
+}
+
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_DYNAMIC_SIZE_ENABLE
+
+void TestAddressCacheResize(void)
+{
+    Instance *instance = testInitInstance();
+    uint16_t  numNonEvictable;
+
+    printf("TestAddressCacheResize() ");
+
+    VerifyOrQuit(instance != nullptr);
+
+    instance->Get<Mac::Mac>().SetShortAddress(0x0800);
+
+    VerifyOrQuit(otThreadSetCacheSize(instance, 0) == OT_ERROR_INVALID_ARGS);
+    VerifyOrQuit(otThreadSetCacheSize(instance, 0x8000) == OT_ERROR_INVALID_ARGS);
+
+    SuccessOrQuit(otThreadSetCacheSize(instance, 4));
+    VerifyOrQuit(otThreadGetCacheSize(instance) == 4);
+
+    // Fill up the cache. The first snooped entries cannot be evicted
+    // until their timeout.
+
+    for (uint16_t i = 1; i <= 4; i++)
+    {
+        Snoop(*instance, i);
+    }
+
+    VerifyOrQuit(GetNumCacheEntries(*instance) == 4);
+    VerifyOrQuit(otThreadGetCacheCounters(instance)->mEvictions == 0);
+
+    // A new entry evicts the oldest evictable snooped entry.
+
+    numNonEvictable = OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_MAX_SNOOP_ENTRIES;
+
+    Snoop(*instance, 5);
+
+    VerifyOrQuit(GetNumCacheEntries(*instance) == 4);
+    VerifyOrQuit(otThreadGetCacheCounters(instance)->mEvictions == 1);
+    VerifyOrQuit(IsCached(*instance, 5));
+    VerifyOrQuit(!IsCached(*instance, numNonEvictable + 1));
+
+    for (uint16_t i = 1; i <= numNonEvictable; i++)
+    {
+        VerifyOrQuit(IsCached(*instance, i));
+    }
+
+    // Growing the cache removes all existing entries.
+
+    SuccessOrQuit(otThreadSetCacheSize(instance, 8));
+    VerifyOrQuit(otThreadGetCacheSize(instance) == 8);
+    VerifyOrQuit(GetNumCacheEntries(*instance) == 0);
+
+    otThreadResetCacheCounters(instance);
+
+    for (uint16_t i = 1; i <= 8; i++)
+    {
+        Snoop(*instance, i);
+    }
+
+    VerifyOrQuit(GetNumCacheEntries(*instance) == 8);
+    VerifyOrQuit(otThreadGetCacheCounters(instance)->mEvictions == 0);
+
+    Snoop(*instance, 9);
+
+    VerifyOrQuit(GetNumCacheEntries(*instance) == 8);
+    VerifyOrQuit(otThreadGetCacheCounters(instance)->mEvictions == 1);
+    VerifyOrQuit(IsCached(*instance, 9));
+
+    // Shrinking the cache also removes all entries, and then evicts
+    // at the new, smaller size.
+
+    SuccessOrQuit(otThreadSetCacheSize(instance, 3));
+    VerifyOrQuit(otThreadGetCacheSize(instance) == 3);
+    VerifyOrQuit(GetNumCacheEntries(*instance) == 0);
+
+    for (uint16_t i = 1; i <= 4; i++)
+    {
+        Snoop(*instance, i);
+    }
+
+    VerifyOrQuit(GetNumCacheEntries(*instance) == 3);
+    VerifyOrQuit(otThreadGetCacheCounters(instance)->mEvictions == 2);
+    VerifyOrQuit(IsCached(*instance, 4));
+
+    // The size cannot be changed while Thread is enabled.
+
+    SuccessOrQuit(otIp6SetEnabled(instance, true));
+    SuccessOrQuit(otThreadSetEnabled(instance, true));
+    VerifyOrQuit(otThreadSetCacheSize(instance, 16) == OT_ERROR_INVALID_STATE);
+    VerifyOrQuit(otThreadGetCacheSize(instance) == 3);
+    SuccessOrQuit(otThreadSetEnabled(instance, false));
+
+    SuccessOrQuit(otThreadSetCacheSize(instance, 16));
+    VerifyOrQuit(otThreadGetCacheSize(instance) == 16);
+
+    testFreeInstance(instance);
+
+    printf(" --> PASSED\n");
+}
+
+#else
+
+void TestAddressCacheResize(void)
+{
+    Instance *instance = testInitInstance();
+
+    printf("TestAddressCacheResize() ");
+
+    VerifyOrQuit(instance != nullptr);
+
+    VerifyOrQuit(otThreadSetCacheSize(instance, 8) == OT_ERROR_NOT_IMPLEMENTED);
+    VerifyOrQuit(otThreadGetCacheSize(instance) == OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES);
+
+    testFreeInstance(instance);
+
+    printf(" --> PASSED\n");
+}
+
+#endif // OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_DYNAMIC_SIZE_ENABLE
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestAddressCacheRemove();
+    ot::TestAddressCacheResize();
+
+    printf("All tests passed\n");
+    return 0;
+}
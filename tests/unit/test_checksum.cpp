@@ -464,8 +464,178 @@ public:
         VerifyOrQuit(checksum.GetValue() == kTestVectorChecksum);
         VerifyOrQuit(checksum.GetValue() == CalculateChecksum(kTestVector, sizeof(kTestVector)), );
     }
+
+    static void TestAddData(void)
+    {
+        // Verify the word-at-a-time `AddData()` against the reference
+        // implementation for all lengths, buffer alignments and split
+        // points (an odd split point makes the second `AddData()` call
+        // start at an odd index).
+
+        constexpr uint16_t kMaxLength    = 300;
+        constexpr uint8_t  kMaxAlignment = 8;
+
+        uint8_t buffer[kMaxLength + kMaxAlignment];
+
+        Random::NonCrypto::FillBuffer(buffer, sizeof(buffer));
+
+        for (uint8_t alignment = 0; alignment < kMaxAlignment; alignment++)
+        {
+            const uint8_t *data = &buffer[alignment];
+
+            for (uint16_t length = 0; length <= kMaxLength; length++)
+            {
+                uint16_t expected = CalculateChecksum(data, length);
+
+                for (uint16_t split = 0; split <= length; split++)
+                {
+                    Checksum checksum;
+
+                    checksum.AddData(data, split);
+                    checksum.AddData(data + split, length - split);
+                    VerifyOrQuit(checksum.GetValue() == expected);
+                }
+            }
+        }
+
+        // Verify all-ones data, which maximizes the carries.
+
+        memset(buffer, 0xff, sizeof(buffer));
+
+        for (uint16_t length = 0; length <= kMaxLength; length++)
+        {
+            Checksum checksum;
+
+            checksum.AddData(buffer, length);
+            VerifyOrQuit(checksum.GetValue() == CalculateChecksum(buffer, length));
+        }
+    }
 };
 
+void TestUpdateChecksumField(void)
+{
+    // Verify that an incremental update (RFC 1624) of the checksum after
+    // changing a 16-bit word gives a valid checksum.
+
+    constexpr uint16_t kLength        = 64;
+    constexpr uint16_t kNumIterations = 2000;
+
+    for (uint16_t iter = 0; iter < kNumIterations; iter++)
+    {
+        uint8_t  buffer[kLength];
+        uint16_t index = Random::NonCrypto::GetUint16InRange(1, kLength / sizeof(uint16_t)) * sizeof(uint16_t);
+        uint16_t oldWord;
+        uint16_t newWord;
+        uint16_t checksum;
+
+        Random::NonCrypto::FillBuffer(buffer, sizeof(buffer));
+
+        // Also exercise the all-zero and all-one old word values.
+
+        switch (iter % 4)
+        {
+        case 0:
+            Encoding::BigEndian::WriteUint16(0, &buffer[index]);
+            break;
+        case 1:
+            Encoding::BigEndian::WriteUint16(0xffff, &buffer[index]);
+            break;
+        default:
+            break;
+        }
+
+        // The first word holds the checksum field.
+
+        Encoding::BigEndian::WriteUint16(0, buffer);
+        checksum = static_cast<uint16_t>(~CalculateChecksum(buffer, sizeof(buffer)));
+        Encoding::BigEndian::WriteUint16(checksum, buffer);
+        VerifyOrQuit(CalculateChecksum(buffer, sizeof(buffer)) == 0xffff);
+
+        oldWord = Encoding::BigEndian::ReadUint16(&buffer[index]);
+        newWord = Random::NonCrypto::GetUint16();
+        Encoding::BigEndian::WriteUint16(newWord, &buffer[index]);
+
+        checksum = Checksum::UpdateChecksumField(checksum, oldWord, newWord);
+        Encoding::BigEndian::WriteUint16(checksum, buffer);
+
+        VerifyOrQuit(checksum != 0);
+        VerifyOrQuit(CalculateChecksum(buffer, sizeof(buffer)) == 0xffff);
+    }
+}
+
+void TestTranslatedMessageChecksum(void)
+{
+    constexpr uint16_t kMaxSize = kBufferSize * 3 + 24;
+
+    const char *kIp6SourceAddress = "fd00:1122:3344:5566:7788:99aa:bbcc:ddee";
+    const char *kIp6DestAddress   = "64:ff9b::5741:2b15";
+    const char *kIp4SourceAddress = "192.168.123.1";
+    const char *kIp4DestAddress   = "87.65.43.21";
+
+    const uint8_t kProtos[] = {Ip6::kProtoUdp, Ip6::kProtoTcp};
+
+    Instance    *instance = static_cast<Instance *>(testInitInstance());
+    Ip6::Address ip6Source;
+    Ip6::Address ip6Dest;
+    Ip4::Address ip4Source;
+    Ip4::Address ip4Dest;
+
+    VerifyOrQuit(instance != nullptr);
+
+    SuccessOrQuit(ip6Source.FromString(kIp6SourceAddress));
+    SuccessOrQuit(ip6Dest.FromString(kIp6DestAddress));
+    SuccessOrQuit(ip4Source.FromString(kIp4SourceAddress));
+    SuccessOrQuit(ip4Dest.FromString(kIp4DestAddress));
+
+    for (uint8_t proto : kProtos)
+    {
+        uint16_t minSize = (proto == Ip6::kProtoUdp) ? sizeof(Ip6::Udp::Header) : sizeof(Ip6::Tcp::Header);
+        uint16_t checksumOffset =
+            (proto == Ip6::kProtoUdp) ? Ip6::Udp::Header::kChecksumFieldOffset : Ip6::Tcp::Header::kChecksumFieldOffset;
+
+        for (uint16_t size = minSize; size <= kMaxSize; size++)
+        {
+            Message *message = instance->Get<Ip6::Ip6>().NewMessage(0);
+            uint8_t  buffer[kMaxSize];
+            uint16_t checksum;
+
+            VerifyOrQuit(message != nullptr, "Ip6::NewMesssage() failed");
+
+            Random::NonCrypto::FillBuffer(buffer, size);
+            SuccessOrQuit(message->AppendBytes(buffer, size));
+            message->Write(checksumOffset, static_cast<uint16_t>(0));
+
+            // IPv6 -> IPv4
+
+            Checksum::UpdateMessageChecksum(*message, ip6Source, ip6Dest, proto);
+            VerifyOrQuit(CalculateChecksum(ip6Source, ip6Dest, proto, *message) == 0xffff);
+
+            Checksum::UpdateTranslatedMessageChecksum(*message, ip6Source, ip6Dest, ip4Source, ip4Dest, proto);
+            VerifyOrQuit(CalculateChecksum(ip4Source, ip4Dest, proto, *message) == 0xffff);
+
+            // IPv4 -> IPv6
+
+            Checksum::UpdateTranslatedMessageChecksum(*message, ip4Dest, ip4Source, ip6Dest, ip6Source, proto);
+            VerifyOrQuit(CalculateChecksum(ip6Dest, ip6Source, proto, *message) == 0xffff);
+
+            SuccessOrQuit(message->Read(checksumOffset, checksum));
+            VerifyOrQuit(checksum != 0);
+
+            if (proto == Ip6::kProtoUdp)
+            {
+                // A zero UDP checksum in the IPv4 datagram must be
+                // calculated over the whole message.
+
+                message->Write(checksumOffset, static_cast<uint16_t>(0));
+                Checksum::UpdateTranslatedMessageChecksum(*message, ip4Dest, ip4Source, ip6Dest, ip6Source, proto);
+                VerifyOrQuit(CalculateChecksum(ip6Dest, ip6Source, proto, *message) == 0xffff);
+            }
+
+            message->Free();
+        }
+    }
+}
+
 } // namespace ot
 
 int main(void)
@@ -476,6 +646,9 @@ int main(void)
     ot::TestTcp4MessageChecksum();
     ot::TestUdp4MessageChecksum();
     ot::TestIcmp4MessageChecksum();
+    ot::ChecksumTester::TestAddData();
+    ot::TestUpdateChecksumField();
+    ot::TestTranslatedMessageChecksum();
     printf("All tests passed\n");
     return 0;
 }
@@ -393,11 +393,179 @@ void TestChildTable(void)
     testFreeInstance(sInstance);
 }
 
+static uint32_t sRandomState = 0x2468ace1;
+
+static uint32_t GetRandom(void)
+{
+    // xorshift32
+    sRandomState ^= sRandomState << 13;
+    sRandomState ^= sRandomState >> 17;
+    sRandomState ^= sRandomState << 5;
+
+    return sRandomState;
+}
+
+// Finds a child the same way as a linear search of the child table
+// (first matching child in table order).
+static Child *FindChildInTable(ChildTable &aTable, const Child::AddressMatcher &aMatcher)
+{
+    Child *child = nullptr;
+
+    for (uint16_t index = 0; index < aTable.GetMaxChildrenAllowed(); index++)
+    {
+        if (aTable.GetChildAtIndex(index)->Matches(aMatcher))
+        {
+            child = aTable.GetChildAtIndex(index);
+            break;
+        }
+    }
+
+    return child;
+}
+
+static bool HasSleepyChildInTable(ChildTable &aTable, const Ip6::Address &aAddress)
+{
+    bool hasChild = false;
+
+    for (uint16_t index = 0; index < aTable.GetMaxChildrenAllowed(); index++)
+    {
+        const Child &child = *aTable.GetChildAtIndex(index);
+
+        if (child.IsStateValidOrRestoring() && !child.IsRxOnWhenIdle() && child.HasIp6Address(aAddress))
+        {
+            hasChild = true;
+            break;
+        }
+    }
+
+    return hasChild;
+}
+
+void TestChildTableLookups(void)
+{
+    // Children share a small set of RLOC16s, extended addresses and
+    // IPv6 addresses, so lookups see duplicates and stale entries.
+
+    static constexpr uint16_t kNumRloc16s    = 8;
+    static constexpr uint16_t kNumAddresses  = 8;
+    static constexpr uint16_t kNumSteps      = 3000;
+    static constexpr uint8_t  kNumChildState = 8;
+
+    static const Child::State kStates[kNumChildState] = {
+        Child::kStateInvalid,
+        Child::kStateRestored,
+        Child::kStateParentRequest,
+        Child::kStateParentResponse,
+        Child::kStateChildIdRequest,
+        Child::kStateLinkRequest,
+        Child::kStateChildUpdateRequest,
+        Child::kStateValid,
+    };
+
+    const Child::StateFilter kFilters[] = {
+        Child::kInStateValid,
+        Child::kInStateValidOrRestoring,
+        Child::kInStateChildIdRequest,
+        Child::kInStateValidOrAttaching,
+        Child::kInStateInvalid,
+        Child::kInStateAnyExceptInvalid,
+        Child::kInStateAnyExceptValidOrRestoring,
+        Child::kInStateAny,
+    };
+
+    ChildTable     *table;
+    Mac::ExtAddress extAddresses[kNumAddresses];
+    Ip6::Address    ip6Addresses[kNumAddresses];
+    Ip6::Address    meshLocalAddresses[kNumAddresses];
+
+    printf("TestChildTableLookups()");
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    table = &sInstance->Get<ChildTable>();
+
+    for (uint16_t i = 0; i < kNumAddresses; i++)
+    {
+        extAddresses[i].Clear();
+        extAddresses[i].m8[7] = static_cast<uint8_t>(i);
+
+        SuccessOrQuit(ip6Addresses[i].FromString("fd00:1234::"));
+        ip6Addresses[i].mFields.m8[15] = static_cast<uint8_t>(i + 1);
+
+        meshLocalAddresses[i].SetPrefix(sInstance->Get<Mle::MleRouter>().GetMeshLocalPrefix());
+        meshLocalAddresses[i].GetIid().Clear();
+        meshLocalAddresses[i].GetIid().mFields.m8[7] = static_cast<uint8_t>(i + 1);
+    }
+
+    for (uint16_t step = 0; step < kNumSteps; step++)
+    {
+        Child   &child = *table->GetChildAtIndex(static_cast<uint16_t>(GetRandom() % table->GetMaxChildrenAllowed()));
+        uint16_t index = static_cast<uint16_t>(GetRandom() % kNumAddresses);
+
+        switch (GetRandom() % 7)
+        {
+        case 0:
+            child.Clear();
+            break;
+        case 1:
+            child.SetState(kStates[GetRandom() % kNumChildState]);
+            break;
+        case 2:
+            child.SetRloc16(static_cast<uint16_t>(0x8000 + GetRandom() % kNumRloc16s));
+            break;
+        case 3:
+            child.SetExtAddress(extAddresses[index]);
+            break;
+        case 4:
+            IgnoreError(child.AddIp6Address((GetRandom() % 2) ? ip6Addresses[index] : meshLocalAddresses[index]));
+            break;
+        case 5:
+            IgnoreError(child.RemoveIp6Address((GetRandom() % 2) ? ip6Addresses[index] : meshLocalAddresses[index]));
+            break;
+        case 6:
+            child.SetDeviceMode(
+                Mle::DeviceMode(static_cast<uint8_t>((GetRandom() % 2) ? Mle::DeviceMode::kModeRxOnWhenIdle : 0)));
+            break;
+        }
+
+        for (Child::StateFilter filter : kFilters)
+        {
+            for (uint16_t i = 0; i < kNumRloc16s; i++)
+            {
+                uint16_t rloc16 = 0x8000 + i;
+
+                VerifyOrQuit(table->FindChild(rloc16, filter) ==
+                             FindChildInTable(*table, Child::AddressMatcher(rloc16, filter)));
+            }
+
+            for (const Mac::ExtAddress &extAddress : extAddresses)
+            {
+                VerifyOrQuit(table->FindChild(extAddress, filter) ==
+                             FindChildInTable(*table, Child::AddressMatcher(extAddress, filter)));
+            }
+        }
+
+        for (uint16_t i = 0; i < kNumAddresses; i++)
+        {
+            VerifyOrQuit(table->HasSleepyChildWithAddress(ip6Addresses[i]) ==
+                         HasSleepyChildInTable(*table, ip6Addresses[i]));
+            VerifyOrQuit(table->HasSleepyChildWithAddress(meshLocalAddresses[i]) ==
+                         HasSleepyChildInTable(*table, meshLocalAddresses[i]));
+        }
+    }
+
+    testFreeInstance(sInstance);
+
+    printf(" -- PASS\n");
+}
+
 } // namespace ot
 
 int main(void)
 {
     ot::TestChildTable();
+    ot::TestChildTableLookups();
     printf("\nAll tests passed.\n");
     return 0;
 }
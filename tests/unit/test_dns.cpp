@@ -27,6 +27,7 @@
  */
 
 #include <string.h>
+#include <time.h>
 
 #include <openthread/config.h>
 
@@ -1423,12 +1424,307 @@ void TestDnsTxtEntry(void)
     testFreeInstance(instance);
 }
 
+void TestDnsNameCompressor(void)
+{
+    enum
+    {
+        kHeaderOffset = 10,
+        kNameSize     = 256,
+    };
+
+    struct TestName
+    {
+        const char *mFirstLabel;
+        const char *mName;
+        uint16_t    mEncodedLength;
+        const char *mExpectedFirstLabel;
+        const char *mExpectedName;
+    };
+
+    static const TestName kTestNames[] = {
+        {nullptr, "_srv._udp.default.service.arpa", 32, nullptr, "_srv._udp.default.service.arpa."},
+        {nullptr, "host.default.service.arpa", 5 + 2, nullptr, "host.default.service.arpa."},
+        {"Human.Readable", "_srv._udp.default.service.arpa", 15 + 2, "Human.Readable",
+         "_srv._udp.default.service.arpa."},
+        {"HUMAN.readable", "_SRV._udp.default.service.arpa.", 2, "Human.Readable", "_srv._udp.default.service.arpa."},
+        {nullptr, "_Srv._UDP.default.service.arpa.", 2, nullptr, "_srv._udp.default.service.arpa."},
+        {nullptr, "sub._sub._srv._udp.default.service.arpa", 4 + 5 + 2, nullptr,
+         "sub._sub._srv._udp.default.service.arpa."},
+        {"Other", "_srv._udp.default.service.arpa", 6 + 2, "Other", "_srv._udp.default.service.arpa."},
+        {nullptr, "host.default.service.arpa", 2, nullptr, "host.default.service.arpa."},
+        {nullptr, "host.example.com", 5 + 8 + 5, nullptr, "host.example.com."},
+        {nullptr, "", 1, nullptr, "."},
+        {nullptr, ".", 1, nullptr, "."},
+        {nullptr, nullptr, 1, nullptr, "."},
+    };
+
+    static const char *kInvalidNames[] = {"bad..name", ".bad.name", "bad.name..", "..",
+                                          "a123456789b123456789c123456789d123456789e123456789f123456789g1234.arpa"};
+
+    Instance           *instance;
+    MessagePool        *messagePool;
+    Message            *message;
+    Dns::NameCompressor compressor;
+    uint16_t            offset;
+    uint16_t            length;
+    char                label[Dns::Name::kMaxLabelSize];
+    uint8_t             labelLength;
+    char                name[kNameSize];
+
+    printf("================================================================\n");
+    printf("TestDnsNameCompressor()\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+    messagePool = &instance->Get<MessagePool>();
+    VerifyOrQuit((message = messagePool->Allocate(Message::kTypeIp6)) != nullptr);
+
+    SuccessOrQuit(message->SetLength(kHeaderOffset + sizeof(Dns::Header)));
+    message->SetOffset(kHeaderOffset);
+
+    for (const TestName &test : kTestNames)
+    {
+        offset = message->GetLength();
+        SuccessOrQuit(compressor.AppendName(test.mFirstLabel, test.mName, *message));
+        length = message->GetLength() - offset;
+
+        printf("\"%s\" \"%s\" -> %u bytes (%u entries)\n", test.mFirstLabel == nullptr ? "" : test.mFirstLabel,
+               test.mName == nullptr ? "(null)" : test.mName, length, compressor.GetNumEntries());
+
+        VerifyOrQuit(length == test.mEncodedLength, "Compressed name length does not match expected value");
+
+        if (test.mExpectedFirstLabel != nullptr)
+        {
+            labelLength = sizeof(label);
+            SuccessOrQuit(Dns::Name::ReadLabel(*message, offset, label, labelLength));
+            VerifyOrQuit(strcmp(label, test.mExpectedFirstLabel) == 0, "Read label does not match the first label");
+        }
+
+        SuccessOrQuit(Dns::Name::ReadName(*message, offset, name, sizeof(name)));
+        VerifyOrQuit(strcmp(name, test.mExpectedName) == 0, "Read name does not match the appended name");
+    }
+
+    printf("----------------------------------------------------------------\n");
+    printf("Invalid names\n");
+
+    for (const char *invalidName : kInvalidNames)
+    {
+        length = message->GetLength();
+        VerifyOrQuit(compressor.AppendName(invalidName, *message) == kErrorInvalidArgs);
+        VerifyOrQuit(message->GetLength() == length, "Invalid name modified the message");
+    }
+
+    VerifyOrQuit(compressor.AppendName("", "_srv._udp.default.service.arpa", *message) == kErrorInvalidArgs);
+
+    printf("----------------------------------------------------------------\n");
+    printf("Names added from message\n");
+
+    compressor.Clear();
+    VerifyOrQuit(compressor.GetNumEntries() == 0);
+
+    SuccessOrQuit(message->SetLength(kHeaderOffset + sizeof(Dns::Header)));
+
+    // Append "F.ISI.ARPA" without the compressor and a compressed
+    // "FOO.F.ISI.ARPA" referring to it, then add the latter.
+
+    offset = message->GetLength();
+    SuccessOrQuit(Dns::Name::AppendName("F.ISI.ARPA", *message));
+    SuccessOrQuit(Dns::Name::AppendLabel("FOO", *message));
+    SuccessOrQuit(Dns::Name::AppendPointerLabel(offset - kHeaderOffset, *message));
+
+    SuccessOrQuit(compressor.AddName(*message, offset + 12));
+    VerifyOrQuit(compressor.GetNumEntries() == 4);
+
+    offset = message->GetLength();
+    SuccessOrQuit(compressor.AppendName("foo.f.isi.arpa", *message));
+    VerifyOrQuit(message->GetLength() - offset == 2);
+
+    offset = message->GetLength();
+    SuccessOrQuit(compressor.AppendName("BAR.isi.arpa", *message));
+    VerifyOrQuit(message->GetLength() - offset == 4 + 2);
+    SuccessOrQuit(Dns::Name::ReadName(*message, offset, name, sizeof(name)));
+    VerifyOrQuit(strcmp(name, "BAR.ISI.ARPA.") == 0);
+
+    message->Free();
+    testFreeInstance(instance);
+}
+
+void BenchmarkDnsNameCompressor(void)
+{
+    // Builds a browse response with 50 service instances (PTR answers
+    // and SRV/AAAA additional records, with five instances per host)
+    // and compares the size with the uncompressed encoding.
+
+    enum : uint16_t
+    {
+        kNumInstances         = 50,
+        kInstancesPerHost     = 5,
+        kNumIterations        = 200,
+        kNameSize             = 64,
+        kNameEncodingOverhead = 2, // First label length byte and root label.
+    };
+
+    static const char kServiceName[] = "_printer._tcp.default.service.arpa";
+    static const char kDomainName[]  = "default.service.arpa";
+
+    Instance    *instance;
+    MessagePool *messagePool;
+    Message     *message = nullptr;
+    uint32_t     uncompressedLength;
+    clock_t      start;
+    double       duration;
+
+    printf("================================================================\n");
+    printf("BenchmarkDnsNameCompressor()\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+    messagePool = &instance->Get<MessagePool>();
+
+    start = clock();
+
+    for (uint16_t iteration = 0; iteration < kNumIterations; iteration++)
+    {
+        Dns::NameCompressor compressor;
+        Dns::Header         header;
+        Dns::Question       question(Dns::ResourceRecord::kTypePtr);
+
+        if (message != nullptr)
+        {
+            message->Free();
+        }
+
+        VerifyOrQuit((message = messagePool->Allocate(Message::kTypeIp6)) != nullptr);
+
+        header.Clear();
+        header.SetType(Dns::Header::kTypeResponse);
+        header.SetQuestionCount(1);
+        header.SetAnswerCount(kNumInstances);
+        header.SetAdditionalRecordCount(kNumInstances + kNumInstances / kInstancesPerHost);
+        SuccessOrQuit(message->Append(header));
+
+        uncompressedLength = sizeof(header);
+
+        SuccessOrQuit(compressor.AppendName(kServiceName, *message));
+        SuccessOrQuit(message->Append(question));
+        uncompressedLength += sizeof(kServiceName) + 1 + sizeof(question);
+
+        for (uint16_t i = 0; i < kNumInstances; i++)
+        {
+            Dns::PtrRecord ptrRecord;
+            char           instanceLabel[kNameSize];
+            uint16_t       offset;
+
+            snprintf(instanceLabel, sizeof(instanceLabel), "Printer %u", i);
+
+            ptrRecord.Init();
+            ptrRecord.SetTtl(120);
+
+            SuccessOrQuit(compressor.AppendName(kServiceName, *message));
+            offset = message->GetLength();
+            SuccessOrQuit(message->Append(ptrRecord));
+            SuccessOrQuit(compressor.AppendName(instanceLabel, kServiceName, *message));
+            ptrRecord.SetLength(message->GetLength() - offset - sizeof(Dns::ResourceRecord));
+            message->Write(offset, ptrRecord);
+
+            uncompressedLength += sizeof(kServiceName) + 1 + sizeof(ptrRecord);
+            uncompressedLength += strlen(instanceLabel) + sizeof(kServiceName) + kNameEncodingOverhead;
+        }
+
+        for (uint16_t i = 0; i < kNumInstances; i++)
+        {
+            Dns::SrvRecord srvRecord;
+            char           instanceLabel[kNameSize];
+            char           hostName[kNameSize];
+            uint16_t       offset;
+
+            snprintf(instanceLabel, sizeof(instanceLabel), "Printer %u", i);
+            snprintf(hostName, sizeof(hostName), "host%u.%s", i / kInstancesPerHost, kDomainName);
+
+            srvRecord.Init();
+            srvRecord.SetTtl(120);
+            srvRecord.SetPort(631);
+
+            SuccessOrQuit(compressor.AppendName(instanceLabel, kServiceName, *message));
+            offset = message->GetLength();
+            SuccessOrQuit(message->Append(srvRecord));
+            SuccessOrQuit(compressor.AppendName(hostName, *message));
+            srvRecord.SetLength(message->GetLength() - offset - sizeof(Dns::ResourceRecord));
+            message->Write(offset, srvRecord);
+
+            uncompressedLength += strlen(instanceLabel) + sizeof(kServiceName) + kNameEncodingOverhead;
+            uncompressedLength += sizeof(srvRecord) + strlen(hostName) + kNameEncodingOverhead;
+        }
+
+        for (uint16_t i = 0; i < kNumInstances / kInstancesPerHost; i++)
+        {
+            Dns::AaaaRecord aaaaRecord;
+            char            hostName[kNameSize];
+
+            snprintf(hostName, sizeof(hostName), "host%u.%s", i, kDomainName);
+
+            aaaaRecord.Init();
+            aaaaRecord.SetTtl(120);
+
+            SuccessOrQuit(compressor.AppendName(hostName, *message));
+            SuccessOrQuit(message->Append(aaaaRecord));
+
+            uncompressedLength += strlen(hostName) + kNameEncodingOverhead + sizeof(aaaaRecord);
+        }
+    }
+
+    duration = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+
+    // Verify the last response parses back to the expected records.
+
+    {
+        Dns::Header header;
+        uint16_t    offset = sizeof(header);
+
+        SuccessOrQuit(message->Read(0, header));
+        SuccessOrQuit(Dns::Name::CompareName(*message, offset, kServiceName));
+        offset += sizeof(Dns::Question);
+
+        for (uint16_t i = 0; i < kNumInstances; i++)
+        {
+            Dns::PtrRecord ptrRecord;
+            char           label[Dns::Name::kMaxLabelSize];
+            char           expectedLabel[kNameSize];
+            char           name[Dns::Name::kMaxNameSize];
+
+            snprintf(expectedLabel, sizeof(expectedLabel), "Printer %u", i);
+
+            SuccessOrQuit(Dns::Name::CompareName(*message, offset, kServiceName));
+            SuccessOrQuit(message->Read(offset, ptrRecord));
+            offset += sizeof(ptrRecord);
+            SuccessOrQuit(ptrRecord.ReadPtrName(*message, offset, label, sizeof(label), name, sizeof(name)));
+            VerifyOrQuit(strcmp(label, expectedLabel) == 0);
+            VerifyOrQuit(strcmp(name, "_printer._tcp.default.service.arpa.") == 0);
+        }
+
+        SuccessOrQuit(Dns::ResourceRecord::ParseRecords(*message, offset, header.GetAdditionalRecordCount()));
+        VerifyOrQuit(offset == message->GetLength());
+    }
+
+    printf("BenchmarkDnsNameCompressor: %u instances, %u responses in %.3f sec (%.2f usec/response)\n", kNumInstances,
+           kNumIterations, duration, duration * 1000000 / kNumIterations);
+    printf("  uncompressed: %lu bytes, compressed: %u bytes (%lu%%)\n", static_cast<unsigned long>(uncompressedLength),
+           message->GetLength(), static_cast<unsigned long>(message->GetLength() * 100UL / uncompressedLength));
+
+    message->Free();
+    testFreeInstance(instance);
+}
+
 } // namespace ot
 
 int main(void)
 {
     ot::TestDnsName();
     ot::TestDnsCompressedName();
+    ot::TestDnsNameCompressor();
+    ot::BenchmarkDnsNameCompressor();
     ot::TestHeaderAndResourceRecords();
     ot::TestDnsTxtEntry();
 
@@ -531,6 +531,14 @@ void TestDnsClient(void)
 
     heapAllocations = sHeapAllocatedPtrs.GetLength();
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    // This test changes the DNS-SD server behavior (using its test
+    // modes) between queries, so the client cache is disabled here.
+    // The cache is validated separately by `TestDnsClientCache()`.
+
+    SuccessOrQuit(dnsClient->SetCacheSize(0));
+#endif
+
     PrepareService1(service1);
     PrepareService2(service2);
 
@@ -898,12 +906,696 @@ void TestDnsClient(void)
     Log("End of TestDnsClient");
 }
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
+uint32_t GetDnsServerResponseCount(const Dns::ServiceDiscovery::Server &aServer)
+{
+    const Dns::ServiceDiscovery::Server::Counters &counters = aServer.GetCounters();
+
+    return counters.mSuccessResponse + counters.mServerFailureResponse + counters.mFormatErrorResponse +
+           counters.mNameErrorResponse + counters.mNotImplementedResponse + counters.mOtherResponse;
+}
+
+uint16_t GetDnsClientCacheEntryCount(const Dns::Client &aClient)
+{
+    Dns::Client::CacheIterator  iterator = 0;
+    Dns::Client::CacheEntryInfo entryInfo;
+    uint16_t                    count = 0;
+
+    while (aClient.GetNextCacheEntry(iterator, entryInfo) == kErrorNone)
+    {
+        Log("   %s type:%u ttl:%lu%s", entryInfo.mName, entryInfo.mType, ToUlong(entryInfo.mTtl),
+            entryInfo.mIsNegative ? " negative" : "");
+        count++;
+    }
+
+    return count;
+}
+
+void TestDnsClientCache(void)
+{
+    static const char kUnknownService[] = "_unknown._udp.default.service.arpa.";
+
+    Srp::Server                   *srpServer;
+    Srp::Client                   *srpClient;
+    Srp::Client::Service           service1;
+    Srp::Client::Service           service2;
+    Dns::Client                   *dnsClient;
+    Dns::Client::QueryConfig       queryConfig;
+    Dns::Client::CacheIterator     iterator;
+    Dns::Client::CacheEntryInfo    entryInfo;
+    Dns::ServiceDiscovery::Server *dnsServer;
+    uint32_t                       responseCount;
+    uint32_t                       ttl;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestDnsClientCache");
+
+    InitTest();
+
+    srpServer = &sInstance->Get<Srp::Server>();
+    srpClient = &sInstance->Get<Srp::Client>();
+    dnsClient = &sInstance->Get<Dns::Client>();
+    dnsServer = &sInstance->Get<Dns::ServiceDiscovery::Server>();
+
+    PrepareService1(service1);
+    PrepareService2(service2);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start SRP server and client, and register two services.
+
+    SuccessOrQuit(srpServer->SetAddressMode(Srp::Server::kAddressModeUnicast));
+    srpServer->SetEnabled(true);
+    AdvanceTime(10000);
+    VerifyOrQuit(srpServer->GetState() == Srp::Server::kStateRunning);
+
+    srpClient->EnableAutoStartMode(nullptr, nullptr);
+    AdvanceTime(2000);
+    VerifyOrQuit(srpClient->IsRunning());
+
+    SuccessOrQuit(srpClient->SetHostName(kHostName));
+    SuccessOrQuit(srpClient->EnableAutoHostAddress());
+    SuccessOrQuit(srpClient->AddService(service1));
+    SuccessOrQuit(srpClient->AddService(service2));
+    AdvanceTime(2 * 1000);
+
+    VerifyOrQuit(service1.GetState() == Srp::Client::kRegistered);
+    VerifyOrQuit(service2.GetState() == Srp::Client::kRegistered);
+
+    VerifyOrQuit(dnsClient->GetCacheSize() == OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES);
+    dnsClient->FlushCache();
+    VerifyOrQuit(GetDnsClientCacheEntryCount(*dnsClient) == 0);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Browse twice, validate the second one is answered from cache.
+
+    Log("Browse(%s)", kService1FullName);
+    responseCount = GetDnsServerResponseCount(*dnsServer);
+    sBrowseInfo.Reset();
+    SuccessOrQuit(dnsClient->Browse(kService1FullName, BrowseCallback, sInstance));
+    AdvanceTime(100);
+    VerifyOrQuit(sBrowseInfo.mCallbackCount == 1);
+    SuccessOrQuit(sBrowseInfo.mError);
+    VerifyOrQuit(sBrowseInfo.mNumInstances == 1);
+    VerifyOrQuit(GetDnsServerResponseCount(*dnsServer) == responseCount + 1);
+    VerifyOrQuit(GetDnsClientCacheEntryCount(*dnsClient) == 1);
+
+    iterator = 0;
+    SuccessOrQuit(dnsClient->GetNextCacheEntry(iterator, entryInfo));
+    VerifyOrQuit(strcmp(entryInfo.mName, kService1FullName) == 0);
+    VerifyOrQuit(entryInfo.mType == OT_DNS_CACHE_ENTRY_BROWSE);
+    VerifyOrQuit(!entryInfo.mIsNegative);
+    VerifyOrQuit(entryInfo.mTtl > 0);
+    VerifyOrQuit(entryInfo.mTtl <= OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_TTL);
+    VerifyOrQuit(dnsClient->GetNextCacheEntry(iterator, entryInfo) == kErrorNotFound);
+
+    Log("Browse(%s) again", kService1FullName);
+    sBrowseInfo.Reset();
+    SuccessOrQuit(dnsClient->Browse(kService1FullName, BrowseCallback, sInstance));
+    AdvanceTime(100);
+    VerifyOrQuit(sBrowseInfo.mCallbackCount == 1);
+    SuccessOrQuit(sBrowseInfo.mError);
+    VerifyOrQuit(sBrowseInfo.mNumInstances == 1);
+    VerifyOrQuit(GetDnsServerResponseCount(*dnsServer) == responseCount + 1);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Resolve service twice, validate TTLs of cached response are aged.
+
+    Log("ResolveService(%s,%s)", kInstance1Label, kService1FullName);
+    queryConfig.Clear();
+    queryConfig.mServiceMode = static_cast<otDnsServiceMode>(Dns::Client::QueryConfig::kServiceModeSrvTxt);
+
+    responseCount = GetDnsServerResponseCount(*dnsServer);
+    sResolveServiceInfo.Reset();
+    SuccessOrQuit(
+        dnsClient->ResolveService(kInstance1Label, kService1FullName, ServiceCallback, sInstance, &queryConfig));
+    AdvanceTime(100);
+    VerifyOrQuit(sResolveServiceInfo.mCallbackCount == 1);
+    SuccessOrQuit(sResolveServiceInfo.mError);
+    VerifyOrQuit(GetDnsServerResponseCount(*dnsServer) == responseCount + 1);
+    ttl = sResolveServiceInfo.mInfo.mTtl;
+
+    AdvanceTime(10 * 1000);
+
+    Log("ResolveService(%s,%s) again after 10 seconds", kInstance1Label, kService1FullName);
+    sResolveServiceInfo.Reset();
+    SuccessOrQuit(
+        dnsClient->ResolveService(kInstance1Label, kService1FullName, ServiceCallback, sInstance, &queryConfig));
+    AdvanceTime(100);
+    VerifyOrQuit(sResolveServiceInfo.mCallbackCount == 1);
+    SuccessOrQuit(sResolveServiceInfo.mError);
+    VerifyOrQuit(sResolveServiceInfo.mInfo.mPort == service1.mPort);
+    VerifyOrQuit(sResolveServiceInfo.mInfo.mTtl + 10 == ttl);
+    VerifyOrQuit(GetDnsServerResponseCount(*dnsServer) == responseCount + 1);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Validate negative caching and its expiration.
+
+    Log("Browse() for unknown service");
+    responseCount = GetDnsServerResponseCount(*dnsServer);
+    sBrowseInfo.Reset();
+    SuccessOrQuit(dnsClient->Browse(kUnknownService, BrowseCallback, sInstance));
+    AdvanceTime(100);
+    VerifyOrQuit(sBrowseInfo.mCallbackCount == 1);
+    VerifyOrQuit(sBrowseInfo.mError == kErrorNotFound);
+    VerifyOrQuit(GetDnsServerResponseCount(*dnsServer) == responseCount + 1);
+
+    Log("Browse() for unknown service again");
+    sBrowseInfo.Reset();
+    SuccessOrQuit(dnsClient->Browse(kUnknownService, BrowseCallback, sInstance));
+    AdvanceTime(100);
+    VerifyOrQuit(sBrowseInfo.mCallbackCount == 1);
+    VerifyOrQuit(sBrowseInfo.mError == kErrorNotFound);
+    VerifyOrQuit(GetDnsServerResponseCount(*dnsServer) == responseCount + 1);
+
+    VerifyOrQuit(GetDnsClientCacheEntryCount(*dnsClient) == 3);
+
+    iterator = 0;
+    SuccessOrQuit(dnsClient->GetNextCacheEntry(iterator, entryInfo));
+    SuccessOrQuit(dnsClient->GetNextCacheEntry(iterator, entryInfo));
+    SuccessOrQuit(dnsClient->GetNextCacheEntry(iterator, entryInfo));
+    VerifyOrQuit(strcmp(entryInfo.mName, kUnknownService) == 0);
+    VerifyOrQuit(entryInfo.mIsNegative);
+    VerifyOrQuit(entryInfo.mTtl <= OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_NEGATIVE_TTL);
+
+    AdvanceTime((OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_NEGATIVE_TTL + 1) * 1000);
+    VerifyOrQuit(GetDnsClientCacheEntryCount(*dnsClient) == 2);
+
+    Log("Browse() for unknown service after negative entry expired");
+    sBrowseInfo.Reset();
+    SuccessOrQuit(dnsClient->Browse(kUnknownService, BrowseCallback, sInstance));
+    AdvanceTime(100);
+    VerifyOrQuit(sBrowseInfo.mCallbackCount == 1);
+    VerifyOrQuit(sBrowseInfo.mError == kErrorNotFound);
+    VerifyOrQuit(GetDnsServerResponseCount(*dnsServer) == responseCount + 2);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Validate flushing the cache.
+
+    Log("Flush cache");
+    dnsClient->FlushCache();
+    VerifyOrQuit(GetDnsClientCacheEntryCount(*dnsClient) == 0);
+
+    responseCount = GetDnsServerResponseCount(*dnsServer);
+    sBrowseInfo.Reset();
+    SuccessOrQuit(dnsClient->Browse(kService1FullName, BrowseCallback, sInstance));
+    AdvanceTime(100);
+    VerifyOrQuit(sBrowseInfo.mCallbackCount == 1);
+    SuccessOrQuit(sBrowseInfo.mError);
+    VerifyOrQuit(GetDnsServerResponseCount(*dnsServer) == responseCount + 1);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Validate changing the cache size.
+
+    Log("Set cache size to one");
+    VerifyOrQuit(dnsClient->SetCacheSize(OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES + 1) == kErrorInvalidArgs);
+    SuccessOrQuit(dnsClient->SetCacheSize(1));
+    VerifyOrQuit(dnsClient->GetCacheSize() == 1);
+
+    sBrowseInfo.Reset();
+    SuccessOrQuit(dnsClient->Browse(kService2FullName, BrowseCallback, sInstance));
+    AdvanceTime(100);
+    VerifyOrQuit(sBrowseInfo.mCallbackCount == 1);
+    SuccessOrQuit(sBrowseInfo.mError);
+    VerifyOrQuit(GetDnsClientCacheEntryCount(*dnsClient) == 1);
+
+    iterator = 0;
+    SuccessOrQuit(dnsClient->GetNextCacheEntry(iterator, entryInfo));
+    VerifyOrQuit(strcmp(entryInfo.mName, kService2FullName) == 0);
+
+    Log("Disable cache");
+    SuccessOrQuit(dnsClient->SetCacheSize(0));
+    VerifyOrQuit(GetDnsClientCacheEntryCount(*dnsClient) == 0);
+
+    responseCount = GetDnsServerResponseCount(*dnsServer);
+    sBrowseInfo.Reset();
+    SuccessOrQuit(dnsClient->Browse(kService2FullName, BrowseCallback, sInstance));
+    AdvanceTime(100);
+    VerifyOrQuit(sBrowseInfo.mCallbackCount == 1);
+    VerifyOrQuit(GetDnsServerResponseCount(*dnsServer) == responseCount + 1);
+    VerifyOrQuit(GetDnsClientCacheEntryCount(*dnsClient) == 0);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Validate the least recently used entries are removed when
+    // message buffers are low.
+
+    Log("Enable cache and browse with low message buffers");
+    SuccessOrQuit(dnsClient->SetCacheSize(OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES));
+
+    sBrowseInfo.Reset();
+    SuccessOrQuit(dnsClient->Browse(kService1FullName, BrowseCallback, sInstance));
+    AdvanceTime(100);
+    VerifyOrQuit(sBrowseInfo.mCallbackCount == 1);
+    SuccessOrQuit(sBrowseInfo.mError);
+    VerifyOrQuit(GetDnsClientCacheEntryCount(*dnsClient) == 1);
+
+    {
+        MessageQueue heldMessages;
+
+        while (sInstance->Get<MessagePool>().GetFreeBufferCount() > OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MIN_FREE_BUFFERS)
+        {
+            Message *message = sInstance->Get<MessagePool>().Allocate(Message::kTypeOther);
+
+            VerifyOrQuit(message != nullptr);
+            heldMessages.Enqueue(*message);
+        }
+
+        sBrowseInfo.Reset();
+        SuccessOrQuit(dnsClient->Browse(kService2FullName, BrowseCallback, sInstance));
+        AdvanceTime(100);
+        VerifyOrQuit(sBrowseInfo.mCallbackCount == 1);
+        SuccessOrQuit(sBrowseInfo.mError);
+
+        iterator = 0;
+        while (dnsClient->GetNextCacheEntry(iterator, entryInfo) == kErrorNone)
+        {
+            VerifyOrQuit(strcmp(entryInfo.mName, kService1FullName) != 0);
+        }
+
+        heldMessages.DequeueAndFreeAll();
+    }
+
+    dnsClient->FlushCache();
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Finalize OT instance and validate all heap allocations are freed.
+
+    srpServer->SetEnabled(false);
+    AdvanceTime(100);
+
+    Log("Finalizing OT instance");
+    FinalizeTest();
+
+    VerifyOrQuit(sHeapAllocatedPtrs.IsEmpty());
+
+    Log("End of TestDnsClientCache");
+}
+
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static constexpr uint16_t kNumBrowseHosts = 4;
+
+struct MultipleHostsBrowseInfo
+{
+    uint16_t mCallbackCount;
+    Error    mError;
+    uint16_t mNumInstances;
+    uint8_t  mNumHostAddresses[kNumBrowseHosts];
+};
+
+static MultipleHostsBrowseInfo sMultipleHostsBrowseInfo;
+
+void MultipleHostsBrowseCallback(otError aError, const otDnsBrowseResponse *aResponse, void *aContext)
+{
+    const Dns::Client::BrowseResponse &response = AsCoreType(aResponse);
+    char                               label[Dns::Name::kMaxLabelSize];
+    char                               hostName[Dns::Name::kMaxNameSize];
+    Ip6::Address                       address;
+    uint32_t                           ttl;
+
+    Log("MultipleHostsBrowseCallback");
+    Log("   Error: %s", ErrorToString(aError));
+
+    VerifyOrQuit(aContext == sInstance);
+
+    sMultipleHostsBrowseInfo.mCallbackCount++;
+    sMultipleHostsBrowseInfo.mError = aError;
+
+    SuccessOrExit(aError);
+
+    while (response.GetServiceInstance(sMultipleHostsBrowseInfo.mNumInstances, label, sizeof(label)) == kErrorNone)
+    {
+        sMultipleHostsBrowseInfo.mNumInstances++;
+    }
+
+    for (uint16_t i = 0; i < kNumBrowseHosts; i++)
+    {
+        snprintf(hostName, sizeof(hostName), "host-%u.default.service.arpa.", i);
+
+        while (response.GetHostAddress(hostName, sMultipleHostsBrowseInfo.mNumHostAddresses[i], address, ttl) ==
+               kErrorNone)
+        {
+            sMultipleHostsBrowseInfo.mNumHostAddresses[i]++;
+        }
+    }
+
+exit:
+    return;
+}
+
+void TestDnssdServerBrowseMultipleHosts(void)
+{
+    // Registers two services on each of several hosts and validates
+    // that a browse response includes the addresses of every host
+    // exactly once in its additional section.
+
+    static const char kServiceName[]     = "_many._udp";
+    static const char kFullServiceName[] = "_many._udp.default.service.arpa.";
+
+    Srp::Server             *srpServer;
+    Srp::Client             *srpClient;
+    Srp::Client::Service     services[2];
+    Dns::Client             *dnsClient;
+    const Srp::Server::Host *host;
+    char                     hostName[Dns::Name::kMaxLabelSize];
+    char                     instanceLabels[2][Dns::Name::kMaxLabelSize];
+    char                     fullName[Dns::Name::kMaxNameSize];
+    uint8_t                  numAddresses;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestDnssdServerBrowseMultipleHosts");
+
+    InitTest();
+
+    srpServer = &sInstance->Get<Srp::Server>();
+    srpClient = &sInstance->Get<Srp::Client>();
+    dnsClient = &sInstance->Get<Dns::Client>();
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    SuccessOrQuit(dnsClient->SetCacheSize(0));
+#endif
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start SRP server and client.
+
+    SuccessOrQuit(srpServer->SetAddressMode(Srp::Server::kAddressModeUnicast));
+    srpServer->SetEnabled(true);
+    AdvanceTime(10000);
+    VerifyOrQuit(srpServer->GetState() == Srp::Server::kStateRunning);
+
+    srpClient->EnableAutoStartMode(nullptr, nullptr);
+    AdvanceTime(2000);
+    VerifyOrQuit(srpClient->IsRunning());
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Register the hosts one after the other. The client host info is
+    // cleared (without removing it on server) before the next host is
+    // registered, so the server keeps all of them.
+
+    for (uint16_t i = 0; i < kNumBrowseHosts; i++)
+    {
+        snprintf(hostName, sizeof(hostName), "host-%u", i);
+
+        srpClient->ClearHostAndServices();
+        SuccessOrQuit(srpClient->SetHostName(hostName));
+        SuccessOrQuit(srpClient->EnableAutoHostAddress());
+
+        for (uint8_t j = 0; j < 2; j++)
+        {
+            snprintf(instanceLabels[j], sizeof(instanceLabels[j]), "inst-%u-%u", i, j);
+
+            memset(&services[j], 0, sizeof(services[j]));
+            services[j].mName         = kServiceName;
+            services[j].mInstanceName = instanceLabels[j];
+            services[j].mPort         = 1000 + i;
+
+            SuccessOrQuit(srpClient->AddService(services[j]));
+        }
+
+        AdvanceTime(2 * 1000);
+
+        VerifyOrQuit(services[0].GetState() == Srp::Client::kRegistered);
+        VerifyOrQuit(services[1].GetState() == Srp::Client::kRegistered);
+    }
+
+    snprintf(fullName, sizeof(fullName), "host-0.default.service.arpa.");
+    host = srpServer->FindHost(fullName);
+    VerifyOrQuit(host != nullptr);
+    IgnoreReturnValue(host->GetAddresses(numAddresses));
+    VerifyOrQuit(numAddresses > 0);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Browse the service. Every host has the same addresses.
+
+    memset(&sMultipleHostsBrowseInfo, 0, sizeof(sMultipleHostsBrowseInfo));
+    Log("Browse(%s)", kFullServiceName);
+    SuccessOrQuit(dnsClient->Browse(kFullServiceName, MultipleHostsBrowseCallback, sInstance));
+    AdvanceTime(100);
+
+    VerifyOrQuit(sMultipleHostsBrowseInfo.mCallbackCount == 1);
+    SuccessOrQuit(sMultipleHostsBrowseInfo.mError);
+    VerifyOrQuit(sMultipleHostsBrowseInfo.mNumInstances == 2 * kNumBrowseHosts);
+
+    for (uint16_t i = 0; i < kNumBrowseHosts; i++)
+    {
+        VerifyOrQuit(sMultipleHostsBrowseInfo.mNumHostAddresses[i] == numAddresses);
+    }
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Finalize OT instance and validate all heap allocations are freed.
+
+    srpClient->ClearHostAndServices();
+    srpServer->SetEnabled(false);
+    AdvanceTime(100);
+
+    Log("Finalizing OT instance");
+    FinalizeTest();
+
+    VerifyOrQuit(sHeapAllocatedPtrs.IsEmpty());
+
+    Log("End of TestDnssdServerBrowseMultipleHosts");
+}
+
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+
+void TestDnssdServerAnswerCache(void)
+{
+    static const char kInstance3Label[] = "srv-instance-3";
+
+    Srp::Server                   *srpServer;
+    Srp::Client                   *srpClient;
+    Srp::Client::Service           service1;
+    Srp::Client::Service           service2;
+    Srp::Client::Service           service3;
+    Dns::Client                   *dnsClient;
+    Dns::Client::QueryConfig       queryConfig;
+    Dns::ServiceDiscovery::Server *dnsServer;
+    uint32_t                       resolvedBySrp;
+    uint32_t                       resolvedByCache;
+    uint32_t                       ttl;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestDnssdServerAnswerCache");
+
+    InitTest();
+
+    srpServer = &sInstance->Get<Srp::Server>();
+    srpClient = &sInstance->Get<Srp::Client>();
+    dnsClient = &sInstance->Get<Dns::Client>();
+    dnsServer = &sInstance->Get<Dns::ServiceDiscovery::Server>();
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    SuccessOrQuit(dnsClient->SetCacheSize(0));
+#endif
+
+    PrepareService1(service1);
+    PrepareService2(service2);
+    PrepareService1(service3);
+    service3.mInstanceName  = kInstance3Label;
+    service3.mSubTypeLabels = nullptr;
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start SRP server and client, and register two services.
+
+    SuccessOrQuit(srpServer->SetAddressMode(Srp::Server::kAddressModeUnicast));
+    srpServer->SetEnabled(true);
+    AdvanceTime(10000);
+    VerifyOrQuit(srpServer->GetState() == Srp::Server::kStateRunning);
+
+    srpClient->EnableAutoStartMode(nullptr, nullptr);
+    AdvanceTime(2000);
+    VerifyOrQuit(srpClient->IsRunning());
+
+    SuccessOrQuit(srpClient->SetHostName(kHostName));
+    SuccessOrQuit(srpClient->EnableAutoHostAddress());
+    SuccessOrQuit(srpClient->AddService(service1));
+    SuccessOrQuit(srpClient->AddService(service2));
+    AdvanceTime(2 * 1000);
+
+    VerifyOrQuit(service1.GetState() == Srp::Client::kRegistered);
+    VerifyOrQuit(service2.GetState() == Srp::Client::kRegistered);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Browse twice, validate the second one is answered from cache.
+
+    resolvedBySrp   = dnsServer->GetCounters().mResolvedBySrp;
+    resolvedByCache = dnsServer->GetCounters().mResolvedByCache;
+
+    for (uint8_t iteration = 0; iteration < 2; iteration++)
+    {
+        Log("Browse(%s)", kService1FullName);
+        sBrowseInfo.Reset();
+        SuccessOrQuit(dnsClient->Browse(kService1FullName, BrowseCallback, sInstance));
+        AdvanceTime(100);
+        VerifyOrQuit(sBrowseInfo.mCallbackCount == 1);
+        SuccessOrQuit(sBrowseInfo.mError);
+        VerifyOrQuit(sBrowseInfo.mNumInstances == 1);
+    }
+
+    VerifyOrQuit(dnsServer->GetCounters().mResolvedBySrp == resolvedBySrp + 2);
+    VerifyOrQuit(dnsServer->GetCounters().mResolvedByCache == resolvedByCache + 1);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Resolve service twice, validate TTLs of the cached answer are aged.
+
+    queryConfig.Clear();
+    queryConfig.mServiceMode = static_cast<otDnsServiceMode>(Dns::Client::QueryConfig::kServiceModeSrvTxtSeparate);
+
+    Log("ResolveService(%s,%s)", kInstance1Label, kService1FullName);
+    sResolveServiceInfo.Reset();
+    SuccessOrQuit(
+        dnsClient->ResolveService(kInstance1Label, kService1FullName, ServiceCallback, sInstance, &queryConfig));
+    AdvanceTime(100);
+    VerifyOrQuit(sResolveServiceInfo.mCallbackCount == 1);
+    SuccessOrQuit(sResolveServiceInfo.mError);
+    VerifyOrQuit(dnsServer->GetCounters().mResolvedByCache == resolvedByCache + 1);
+    ttl = sResolveServiceInfo.mInfo.mTtl;
+
+    AdvanceTime(10 * 1000);
+
+    Log("ResolveService(%s,%s) again after 10 seconds", kInstance1Label, kService1FullName);
+    sResolveServiceInfo.Reset();
+    SuccessOrQuit(
+        dnsClient->ResolveService(kInstance1Label, kService1FullName, ServiceCallback, sInstance, &queryConfig));
+    AdvanceTime(100);
+    VerifyOrQuit(sResolveServiceInfo.mCallbackCount == 1);
+    SuccessOrQuit(sResolveServiceInfo.mError);
+    VerifyOrQuit(sResolveServiceInfo.mInfo.mPort == service1.mPort);
+    VerifyOrQuit(sResolveServiceInfo.mInfo.mTtl + 10 == ttl);
+    VerifyOrQuit(dnsServer->GetCounters().mResolvedByCache == resolvedByCache + 3);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Register a new instance of the same service, validate the cached
+    // browse answer is invalidated.
+
+    Log("Add service %s", kInstance3Label);
+    SuccessOrQuit(srpClient->AddService(service3));
+    AdvanceTime(2 * 1000);
+    VerifyOrQuit(service3.GetState() == Srp::Client::kRegistered);
+
+    resolvedByCache = dnsServer->GetCounters().mResolvedByCache;
+
+    Log("Browse(%s) after adding a service", kService1FullName);
+    sBrowseInfo.Reset();
+    SuccessOrQuit(dnsClient->Browse(kService1FullName, BrowseCallback, sInstance));
+    AdvanceTime(100);
+    VerifyOrQuit(sBrowseInfo.mCallbackCount == 1);
+    SuccessOrQuit(sBrowseInfo.mError);
+    VerifyOrQuit(sBrowseInfo.mNumInstances == 2);
+    VerifyOrQuit(dnsServer->GetCounters().mResolvedByCache == resolvedByCache);
+
+    Log("Browse(%s) again", kService1FullName);
+    sBrowseInfo.Reset();
+    SuccessOrQuit(dnsClient->Browse(kService1FullName, BrowseCallback, sInstance));
+    AdvanceTime(100);
+    VerifyOrQuit(sBrowseInfo.mCallbackCount == 1);
+    VerifyOrQuit(sBrowseInfo.mNumInstances == 2);
+    VerifyOrQuit(dnsServer->GetCounters().mResolvedByCache == resolvedByCache + 1);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Browse a different service twice, then remove the new instance
+    // and validate the cached browse answer is invalidated.
+
+    Log("Browse(%s) twice", kService2FullName);
+
+    for (uint8_t iteration = 0; iteration < 2; iteration++)
+    {
+        sBrowseInfo.Reset();
+        SuccessOrQuit(dnsClient->Browse(kService2FullName, BrowseCallback, sInstance));
+        AdvanceTime(100);
+        VerifyOrQuit(sBrowseInfo.mCallbackCount == 1);
+        VerifyOrQuit(sBrowseInfo.mNumInstances == 1);
+    }
+
+    VerifyOrQuit(dnsServer->GetCounters().mResolvedByCache == resolvedByCache + 2);
+
+    Log("Remove service %s", kInstance3Label);
+    SuccessOrQuit(srpClient->RemoveService(service3));
+    AdvanceTime(2 * 1000);
+
+    resolvedByCache = dnsServer->GetCounters().mResolvedByCache;
+
+    sBrowseInfo.Reset();
+    SuccessOrQuit(dnsClient->Browse(kService1FullName, BrowseCallback, sInstance));
+    AdvanceTime(100);
+    VerifyOrQuit(sBrowseInfo.mCallbackCount == 1);
+    VerifyOrQuit(sBrowseInfo.mNumInstances == 1);
+    VerifyOrQuit(dnsServer->GetCounters().mResolvedByCache == resolvedByCache);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Validate the cache is cleared when test mode changes.
+
+    dnsServer->SetTestMode(Dns::ServiceDiscovery::Server::kTestModeDisabled);
+
+    sBrowseInfo.Reset();
+    SuccessOrQuit(dnsClient->Browse(kService1FullName, BrowseCallback, sInstance));
+    AdvanceTime(100);
+    VerifyOrQuit(sBrowseInfo.mCallbackCount == 1);
+    VerifyOrQuit(dnsServer->GetCounters().mResolvedByCache == resolvedByCache);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Validate the cache is flushed when message buffers are low.
+
+    {
+        MessageQueue heldMessages;
+
+        Log("Browse(%s) with low message buffers", kService2FullName);
+
+        while (sInstance->Get<MessagePool>().GetFreeBufferCount() >
+               OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_MIN_FREE_BUFFERS)
+        {
+            Message *message = sInstance->Get<MessagePool>().Allocate(Message::kTypeOther);
+
+            VerifyOrQuit(message != nullptr);
+            heldMessages.Enqueue(*message);
+        }
+
+        sBrowseInfo.Reset();
+        SuccessOrQuit(dnsClient->Browse(kService2FullName, BrowseCallback, sInstance));
+        AdvanceTime(100);
+        VerifyOrQuit(sBrowseInfo.mCallbackCount == 1);
+        SuccessOrQuit(sBrowseInfo.mError);
+
+        heldMessages.DequeueAndFreeAll();
+    }
+
+    sBrowseInfo.Reset();
+    SuccessOrQuit(dnsClient->Browse(kService1FullName, BrowseCallback, sInstance));
+    AdvanceTime(100);
+    VerifyOrQuit(sBrowseInfo.mCallbackCount == 1);
+    VerifyOrQuit(dnsServer->GetCounters().mResolvedByCache == resolvedByCache);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Finalize OT instance.
+
+    srpServer->SetEnabled(false);
+    AdvanceTime(100);
+
+    Log("Finalizing OT instance");
+    FinalizeTest();
+
+    VerifyOrQuit(sHeapAllocatedPtrs.IsEmpty());
+
+    Log("End of TestDnssdServerAnswerCache");
+}
+
+#endif // OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+
 #endif // ENABLE_DNS_TEST
 
 int main(void)
 {
 #if ENABLE_DNS_TEST
     TestDnsClient();
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    TestDnsClientCache();
+#endif
+    TestDnssdServerBrowseMultipleHosts();
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+    TestDnssdServerAnswerCache();
+#endif
     printf("All tests passed\n");
 #else
     printf("DNS_CLIENT or DSNSSD_SERVER feature is not enabled\n");
@@ -183,6 +183,39 @@ void TestFlash(void)
         VerifyOrQuit(length == key, "Get() did not return expected length");
         VerifyOrQuit(memcmp(readBuffer, writeBuffer, length) == 0, "Get() did not return expected value");
     }
+
+    // Test swap with records of maximum length (padded on flash)
+
+    flash.Wipe();
+
+    for (uint32_t i = 0; i < sizeof(writeBuffer); i++)
+    {
+        writeBuffer[i] = i & 0xff;
+    }
+
+    for (uint16_t index = 0; index < 256; index++)
+    {
+        uint16_t length = 255;
+
+        if ((index % 4) == 0)
+        {
+            IgnoreError(flash.Delete(0, -1));
+        }
+
+        SuccessOrQuit(flash.Add(0, writeBuffer, length));
+        SuccessOrQuit(flash.Set(1, writeBuffer, index & 0xf));
+    }
+
+    for (uint16_t index = 0; index < 4; index++)
+    {
+        uint16_t length = 255;
+
+        SuccessOrQuit(flash.Get(0, index, readBuffer, &length));
+        VerifyOrQuit(length == 255, "Get() did not return expected length");
+        VerifyOrQuit(memcmp(readBuffer, writeBuffer, length) == 0, "Get() did not return expected value");
+    }
+
+    VerifyOrQuit(flash.Get(0, 4, nullptr, nullptr) == kErrorNotFound);
 #endif // OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
 }
 
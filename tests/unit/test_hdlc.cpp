@@ -27,11 +27,13 @@
  */
 
 #include <ctype.h>
+#include <time.h>
 
 #include "common/code_utils.hpp"
 #include "common/instance.hpp"
 #include "lib/hdlc/hdlc.hpp"
 #include "lib/spinel/multi_frame_buffer.hpp"
+#include "lib/spinel/openthread-spinel-config.h"
 
 #include "test_util.h"
 
@@ -642,6 +644,234 @@ void TestFuzzEncoderDecoder(void)
     printf(" -- PASS\n");
 }
 
+uint16_t CalculateFcs(const uint8_t *aData, uint16_t aLength)
+{
+    // Bit-by-bit reference implementation of the HDLC FCS (RFC 1662).
+
+    uint16_t fcs = 0xffff;
+
+    while (aLength--)
+    {
+        fcs ^= *aData++;
+
+        for (uint8_t bit = 0; bit < 8; bit++)
+        {
+            fcs = (fcs & 1) ? ((fcs >> 1) ^ 0x8408) : (fcs >> 1);
+        }
+    }
+
+    return fcs ^ 0xffff;
+}
+
+uint16_t EncodeReference(const uint8_t *aData, uint16_t aLength, uint8_t *aOutput)
+{
+    // Reference byte-at-a-time HDLC-lite encoding of a frame.
+
+    uint16_t fcs    = CalculateFcs(aData, aLength);
+    uint8_t  fcsBytes[] = {static_cast<uint8_t>(fcs & 0xff), static_cast<uint8_t>(fcs >> 8)};
+    uint16_t length = 0;
+
+    aOutput[length++] = kFlagSequence;
+
+    for (uint16_t i = 0; i < aLength + sizeof(fcsBytes); i++)
+    {
+        uint8_t byte = (i < aLength) ? aData[i] : fcsBytes[i - aLength];
+
+        switch (byte)
+        {
+        case kFlagXOn:
+        case kFlagXOff:
+        case kFlagSequence:
+        case kEscapeSequence:
+        case kFlagSpecial:
+            aOutput[length++] = kEscapeSequence;
+            aOutput[length++] = byte ^ 0x20;
+            break;
+        default:
+            aOutput[length++] = byte;
+            break;
+        }
+    }
+
+    aOutput[length++] = kFlagSequence;
+
+    return length;
+}
+
+struct SplitDecoderContext
+{
+    Spinel::FrameBuffer<kBufferSize> *mDecoderBuffer;
+    const uint8_t (*mFrames)[kMaxFrameLength];
+    const uint16_t *mFrameLengths;
+    uint16_t        mNumDecoded;
+};
+
+void ProcessSplitDecodedFrame(void *aContext, otError aError)
+{
+    SplitDecoderContext &context = *static_cast<SplitDecoderContext *>(aContext);
+
+    SuccessOrQuit(aError);
+    VerifyOrQuit(context.mDecoderBuffer->GetLength() == context.mFrameLengths[context.mNumDecoded]);
+    VerifyOrQuit(memcmp(context.mDecoderBuffer->GetFrame(), context.mFrames[context.mNumDecoded],
+                        context.mDecoderBuffer->GetLength()) == 0);
+
+    context.mNumDecoded++;
+    context.mDecoderBuffer->Clear();
+}
+
+void TestEncoderDecoderBlocks(void)
+{
+    static constexpr uint16_t kNumFrames    = 8;
+    static constexpr uint16_t kNumIteration = 2000;
+
+    static uint8_t  frames[kNumFrames][kMaxFrameLength];
+    static uint8_t  stream[kNumFrames * (2 * kMaxFrameLength + 8) + 16];
+    uint16_t        frameLengths[kNumFrames];
+    uint8_t         reference[2 * kMaxFrameLength + 8];
+    uint16_t        referenceLength;
+
+    Spinel::FrameBuffer<kBufferSize> encoderBuffer;
+    Spinel::FrameBuffer<kBufferSize> decoderBuffer;
+    SplitDecoderContext              context;
+    Hdlc::Encoder                    encoder(encoderBuffer);
+    Hdlc::Decoder                    decoder(decoderBuffer, ProcessSplitDecodedFrame, &context);
+
+    printf("Testing Hdlc::Encoder and Hdlc::Decoder with blocks of data");
+
+    context.mDecoderBuffer = &decoderBuffer;
+    context.mFrames        = frames;
+    context.mFrameLengths  = frameLengths;
+
+    for (uint32_t iter = 0; iter < kNumIteration; iter++)
+    {
+        uint32_t streamLength = GetRandom(16);
+
+        for (uint32_t i = 0; i < streamLength; i++)
+        {
+            do
+            {
+                stream[i] = static_cast<uint8_t>(GetRandom(256));
+            } while (stream[i] == kFlagSequence);
+        }
+
+        // Randomly mix escaped bytes into the frames, encode them in
+        // randomly sized blocks and verify the encoded frame against the
+        // reference encoding.
+
+        for (uint16_t n = 0; n < kNumFrames; n++)
+        {
+            uint16_t length = static_cast<uint16_t>(GetRandom(kMaxFrameLength));
+            uint32_t specialsRatio = GetRandom(4);
+
+            for (uint16_t i = 0; i < length; i++)
+            {
+                frames[n][i] = (GetRandom(8) < specialsRatio) ? sHdlcSpecials[GetRandom(sizeof(sHdlcSpecials))]
+                                                              : static_cast<uint8_t>(GetRandom(256));
+            }
+
+            frameLengths[n] = length;
+
+            encoderBuffer.Clear();
+            SuccessOrQuit(encoder.BeginFrame());
+
+            for (uint16_t offset = 0; offset < length;)
+            {
+                uint16_t blockLength = static_cast<uint16_t>(GetRandom(length - offset) + 1);
+
+                SuccessOrQuit(encoder.Encode(&frames[n][offset], blockLength));
+                offset += blockLength;
+            }
+
+            SuccessOrQuit(encoder.EndFrame());
+
+            referenceLength = EncodeReference(frames[n], length, reference);
+            VerifyOrQuit(encoderBuffer.GetLength() == referenceLength, "Encoded frame length is incorrect");
+            VerifyOrQuit(memcmp(encoderBuffer.GetFrame(), reference, referenceLength) == 0,
+                         "Encoded frame content is incorrect");
+
+            memcpy(&stream[streamLength], encoderBuffer.GetFrame(), encoderBuffer.GetLength());
+            streamLength += encoderBuffer.GetLength();
+        }
+
+        // Feed the frames back to back (with some leading noise) to the
+        // decoder in randomly sized blocks.
+
+        decoder.Reset();
+        decoderBuffer.Clear();
+        context.mNumDecoded = 0;
+
+        for (uint32_t offset = 0; offset < streamLength;)
+        {
+            uint16_t blockLength = static_cast<uint16_t>(GetRandom(Min<uint32_t>(streamLength - offset, 600)) + 1);
+
+            decoder.Decode(&stream[offset], blockLength);
+            offset += blockLength;
+        }
+
+        VerifyOrQuit(context.mNumDecoded == kNumFrames, "Decoder::Decode() missed a frame");
+    }
+
+    printf(" -- PASS\n");
+}
+
+static uint64_t GetNowInNsec(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return static_cast<uint64_t>(now.tv_sec) * 1000000000ull + static_cast<uint64_t>(now.tv_nsec);
+}
+
+void BenchmarkEncoderDecoder(void)
+{
+    static constexpr uint16_t kFrameLength  = 1280;
+    static constexpr uint32_t kNumIteration = 20000;
+
+    static Spinel::FrameBuffer<2 * kFrameLength + 8> encoderBuffer;
+    static Spinel::FrameBuffer<2 * kFrameLength + 8> decoderBuffer;
+    static uint8_t                                   frame[kFrameLength];
+
+    DecoderContext decoderContext;
+    Hdlc::Encoder  encoder(encoderBuffer);
+    Hdlc::Decoder  decoder(decoderBuffer, ProcessDecodedFrame, &decoderContext);
+    uint64_t       startTime;
+    uint64_t       encodeTime = 0;
+    uint64_t       decodeTime = 0;
+
+    printf("BenchmarkEncoderDecoder()\n");
+
+    for (uint16_t i = 0; i < kFrameLength; i++)
+    {
+        frame[i] = static_cast<uint8_t>(GetRandom(256));
+    }
+
+    for (uint32_t iter = 0; iter < kNumIteration; iter++)
+    {
+        encoderBuffer.Clear();
+        decoderBuffer.Clear();
+
+        startTime = GetNowInNsec();
+        SuccessOrQuit(encoder.BeginFrame());
+        SuccessOrQuit(encoder.Encode(frame, kFrameLength));
+        SuccessOrQuit(encoder.EndFrame());
+        encodeTime += GetNowInNsec() - startTime;
+
+        decoderContext.mWasCalled = false;
+
+        startTime = GetNowInNsec();
+        decoder.Decode(encoderBuffer.GetFrame(), encoderBuffer.GetLength());
+        decodeTime += GetNowInNsec() - startTime;
+
+        VerifyOrQuit(decoderContext.mWasCalled && (decoderContext.mError == OT_ERROR_NONE));
+    }
+
+    printf("  %u-byte frames: encode %6.1f MB/s, decode %6.1f MB/s (slice-by-4 FCS %s)\n", kFrameLength,
+           static_cast<double>(kFrameLength) * kNumIteration * 1000 / encodeTime,
+           static_cast<double>(kFrameLength) * kNumIteration * 1000 / decodeTime,
+           OPENTHREAD_SPINEL_CONFIG_HDLC_SLICE_BY_4_FCS_ENABLE ? "enabled" : "disabled");
+}
+
 } // namespace Ncp
 } // namespace ot
 
@@ -651,6 +881,8 @@ int main(void)
     ot::Ncp::TestSpinelMultiFrameBuffer();
     ot::Ncp::TestEncoderDecoder();
     ot::Ncp::TestFuzzEncoderDecoder();
+    ot::Ncp::TestEncoderDecoderBlocks();
+    ot::Ncp::BenchmarkEncoderDecoder();
     printf("\nAll tests passed.\n");
     return 0;
 }
@@ -31,7 +31,9 @@
 #include "core/utils/heap.hpp"
 
 #include <stdlib.h>
+#include <time.h>
 
+#include "common/code_utils.hpp"
 #include "common/debug.hpp"
 #include "crypto/aes_ccm.hpp"
 
@@ -167,10 +169,282 @@ void TestAllocateMultiple(void)
     }
 }
 
+/**
+ * Verifies the heap usage statistics.
+ *
+ */
+void TestStats(void)
+{
+    ot::Utils::Heap        heap;
+    ot::Utils::Heap::Stats stats;
+    void                  *small;
+    void                  *large;
+
+    heap.GetStats(stats);
+    VerifyOrQuit(stats.mCapacity == heap.GetCapacity());
+    VerifyOrQuit(stats.mFreeSize == heap.GetFreeSize());
+    VerifyOrQuit(stats.mLargestFreeBlock == stats.mFreeSize);
+    VerifyOrQuit(stats.mNumFreeBlocks == 1);
+    VerifyOrQuit(stats.mFragmentation == 0);
+    VerifyOrQuit(stats.mPeakUsedSize == 0);
+    VerifyOrQuit(stats.mNumAllocFailures == 0);
+
+    small = heap.CAlloc(1, 20);
+    large = heap.CAlloc(1, 1000);
+    VerifyOrQuit(small != nullptr && large != nullptr);
+
+    heap.GetStats(stats);
+    VerifyOrQuit(stats.mPeakUsedSize == stats.mCapacity - stats.mFreeSize);
+
+    VerifyOrQuit(heap.CAlloc(1, heap.GetCapacity()) == nullptr);
+    heap.GetStats(stats);
+    VerifyOrQuit(stats.mNumAllocFailures == 1);
+
+#if OPENTHREAD_CONFIG_HEAP_SLAB_ENABLE
+    {
+        ot::Utils::Heap::SlabStats slabStats;
+
+        SuccessOrQuit(heap.GetSlabStats(0, slabStats));
+        VerifyOrQuit(slabStats.mObjectSize == 16);
+        SuccessOrQuit(heap.GetSlabStats(1, slabStats));
+        VerifyOrQuit(slabStats.mObjectSize == 32);
+        VerifyOrQuit(slabStats.mNumPages == 1);
+        VerifyOrQuit(slabStats.mNumObjectsInUse == 1);
+        VerifyOrQuit(slabStats.mPeakObjectsInUse == 1);
+        VerifyOrQuit(slabStats.mNumAllocs == 1);
+        SuccessOrQuit(heap.GetSlabStats(7, slabStats));
+        VerifyOrQuit(slabStats.mObjectSize == 256);
+        VerifyOrQuit(heap.GetSlabStats(8, slabStats) == ot::kErrorNotFound);
+    }
+#endif
+
+    // Freeing the first block leaves two free blocks.
+    heap.Free(small);
+    heap.GetStats(stats);
+    VerifyOrQuit(stats.mNumFreeBlocks == 2);
+    VerifyOrQuit(stats.mLargestFreeBlock < stats.mFreeSize);
+    VerifyOrQuit(stats.mFragmentation > 0);
+
+    heap.Free(large);
+    VerifyOrQuit(heap.IsClean());
+
+    heap.GetStats(stats);
+    VerifyOrQuit(stats.mPeakUsedSize > 0);
+    heap.ResetPeakUsage();
+    heap.GetStats(stats);
+    VerifyOrQuit(stats.mPeakUsedSize == 0);
+
+#if OPENTHREAD_CONFIG_HEAP_SLAB_ENABLE
+    {
+        ot::Utils::Heap::SlabStats slabStats;
+
+        SuccessOrQuit(heap.GetSlabStats(1, slabStats));
+        VerifyOrQuit(slabStats.mNumPages == 0);
+        VerifyOrQuit(slabStats.mNumObjectsInUse == 0);
+        VerifyOrQuit(slabStats.mPeakObjectsInUse == 0);
+    }
+#endif
+
+    printf("TestStats passed\n");
+}
+
+/**
+ * Replays the allocation pattern of an SRP server with churning registrations, and reports the heap usage.
+ *
+ * Each registration allocates a host (name, addresses, key) and a few services (names, TXT data). Registrations are
+ * removed and replaced at random, while a large DTLS-like buffer is allocated from time to time.
+ *
+ */
+void TestSrpChurnSoak(void)
+{
+    static constexpr uint16_t kMaxHosts           = 32;
+    static constexpr uint16_t kMaxServicesPerHost = 3;
+    static constexpr size_t   kHeapSizePerHost    = 2048; // Keeps the live data at about half of the heap.
+    static constexpr uint16_t kAllocsPerHost      = 4 + 3 * kMaxServicesPerHost;
+    static constexpr uint32_t kNumIterations      = 100000;
+    static constexpr size_t   kLargeBufferSize    = 4096;
+
+    struct Registration
+    {
+        void *mAllocs[kAllocsPerHost];
+    };
+
+    ot::Utils::Heap        heap;
+    ot::Utils::Heap::Stats stats;
+    Registration           registrations[kMaxHosts];
+    uint16_t               numHosts;
+    void                  *largeBuffer      = nullptr;
+    uint32_t               numFailures      = 0;
+    uint32_t               numLargeFailures = 0;
+    uint32_t               numAllocs        = 0;
+    size_t                 minLargestFree   = heap.GetCapacity();
+    uint8_t                maxFragmentation = 0;
+    clock_t                start;
+
+    numHosts = static_cast<uint16_t>(OT_MIN(heap.GetCapacity() / kHeapSizePerHost, kMaxHosts));
+    VerifyOrQuit(numHosts > 0);
+
+    memset(registrations, 0, sizeof(registrations));
+    srand(0);
+    start = clock();
+
+    for (uint32_t iteration = 0; iteration < kNumIterations; iteration++)
+    {
+        Registration &registration = registrations[static_cast<size_t>(rand()) % numHosts];
+        uint16_t      numServices  = 1 + static_cast<uint16_t>(rand()) % kMaxServicesPerHost;
+        size_t        sizes[kAllocsPerHost];
+        uint16_t      numSizes = 0;
+
+        // Remove the previous registration of the host (lease expiry or
+        // update), then register it again with new sizes.
+
+        for (void *&alloc : registration.mAllocs)
+        {
+            heap.Free(alloc);
+            alloc = nullptr;
+        }
+
+        sizes[numSizes++] = 96;                                         // Host
+        sizes[numSizes++] = 16 + static_cast<size_t>(rand()) % 48;      // Host name
+        sizes[numSizes++] = 16 * (1 + static_cast<size_t>(rand()) % 4); // Addresses
+        sizes[numSizes++] = 72;                                         // Key record
+
+        for (uint16_t i = 0; i < numServices; i++)
+        {
+            sizes[numSizes++] = 120;                                   // Service
+            sizes[numSizes++] = 24 + static_cast<size_t>(rand()) % 64; // Instance name
+            sizes[numSizes++] = 8 + static_cast<size_t>(rand()) % 240; // TXT data
+        }
+
+        for (uint16_t i = 0; i < numSizes; i++)
+        {
+            registration.mAllocs[i] = heap.CAlloc(1, sizes[i]);
+            numAllocs++;
+
+            if (registration.mAllocs[i] == nullptr)
+            {
+                numFailures++;
+            }
+        }
+
+        if (iteration % 64 == 0)
+        {
+            if (largeBuffer == nullptr)
+            {
+                largeBuffer = heap.CAlloc(1, kLargeBufferSize);
+                numLargeFailures += (largeBuffer == nullptr) ? 1 : 0;
+            }
+            else
+            {
+                heap.Free(largeBuffer);
+                largeBuffer = nullptr;
+            }
+        }
+
+        heap.GetStats(stats);
+
+        if (stats.mLargestFreeBlock < minLargestFree)
+        {
+            minLargestFree = stats.mLargestFreeBlock;
+        }
+
+        if (stats.mFragmentation > maxFragmentation)
+        {
+            maxFragmentation = stats.mFragmentation;
+        }
+    }
+
+    printf("TestSrpChurnSoak: %u hosts, %lu allocations in %.3f sec\n", numHosts, static_cast<unsigned long>(numAllocs),
+           static_cast<double>(clock() - start) / CLOCKS_PER_SEC);
+
+    heap.GetStats(stats);
+    printf("  capacity: %lu, free: %lu, peak used: %lu\n", static_cast<unsigned long>(stats.mCapacity),
+           static_cast<unsigned long>(stats.mFreeSize), static_cast<unsigned long>(stats.mPeakUsedSize));
+    printf("  free blocks: %u, largest free block: %lu (min %lu), fragmentation: %u%% (max %u%%)\n",
+           stats.mNumFreeBlocks, static_cast<unsigned long>(stats.mLargestFreeBlock),
+           static_cast<unsigned long>(minLargestFree), stats.mFragmentation, maxFragmentation);
+    printf("  failed allocations: %lu, failed large buffer allocations: %lu\n", static_cast<unsigned long>(numFailures),
+           static_cast<unsigned long>(numLargeFailures));
+
+#if OPENTHREAD_CONFIG_HEAP_SLAB_ENABLE
+    for (uint8_t index = 0;; index++)
+    {
+        ot::Utils::Heap::SlabStats slabStats;
+
+        if (heap.GetSlabStats(index, slabStats) != ot::kErrorNone)
+        {
+            break;
+        }
+
+        printf("  slab %3u: pages: %u, in use: %u, peak: %u, allocs: %lu\n", slabStats.mObjectSize,
+               slabStats.mNumPages, slabStats.mNumObjectsInUse, slabStats.mPeakObjectsInUse,
+               static_cast<unsigned long>(slabStats.mNumAllocs));
+
+        VerifyOrQuit(slabStats.mNumObjectsInUse <= slabStats.mPeakObjectsInUse);
+        VerifyOrQuit(slabStats.mNumObjectsInUse <= slabStats.mNumPages * OPENTHREAD_CONFIG_HEAP_SLAB_OBJECTS_PER_PAGE);
+    }
+#endif
+
+    // The live data is kept at about half of the heap, so neither the
+    // registrations nor the large buffer may fail, i.e. the heap must
+    // not fragment to the point where 4 KB of contiguous memory cannot
+    // be found.
+
+    VerifyOrQuit(numFailures == 0, "TestSrpChurnSoak allocation failed");
+    VerifyOrQuit(numLargeFailures == 0, "TestSrpChurnSoak large buffer allocation failed");
+    VerifyOrQuit(stats.mNumAllocFailures == 0);
+    VerifyOrQuit(stats.mFreeSize <= stats.mCapacity);
+    VerifyOrQuit(stats.mPeakUsedSize >= stats.mCapacity - stats.mFreeSize);
+    VerifyOrQuit(stats.mPeakUsedSize <= stats.mCapacity);
+    VerifyOrQuit(stats.mLargestFreeBlock <= stats.mFreeSize);
+    VerifyOrQuit(minLargestFree > 0);
+
+    for (Registration &registration : registrations)
+    {
+        for (void *alloc : registration.mAllocs)
+        {
+            heap.Free(alloc);
+        }
+    }
+
+    heap.Free(largeBuffer);
+
+    VerifyOrQuit(heap.IsClean(), "TestSrpChurnSoak heap not clean after freeing all!");
+
+    // Once all is freed, the heap is back to a single free block (and
+    // the slab pages are all released).
+
+    heap.GetStats(stats);
+    VerifyOrQuit(stats.mFreeSize == stats.mCapacity);
+    VerifyOrQuit(stats.mNumFreeBlocks == 1);
+    VerifyOrQuit(stats.mLargestFreeBlock == stats.mFreeSize);
+    VerifyOrQuit(stats.mFragmentation == 0);
+
+#if OPENTHREAD_CONFIG_HEAP_SLAB_ENABLE
+    for (uint8_t index = 0;; index++)
+    {
+        ot::Utils::Heap::SlabStats slabStats;
+
+        if (heap.GetSlabStats(index, slabStats) != ot::kErrorNone)
+        {
+            break;
+        }
+
+        VerifyOrQuit(slabStats.mNumPages == 0);
+        VerifyOrQuit(slabStats.mNumObjectsInUse == 0);
+        VerifyOrQuit((slabStats.mNumAllocs == 0) || (slabStats.mPeakObjectsInUse > 0));
+    }
+#endif
+
+    printf("TestSrpChurnSoak passed\n");
+}
+
 void RunTimerTests(void)
 {
     TestAllocateSingle();
     TestAllocateMultiple();
+    TestStats();
+    TestSrpChurnSoak();
 }
 
 #endif // !OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
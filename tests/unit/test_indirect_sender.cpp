@@ -0,0 +1,249 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "test_util.h"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "common/message.hpp"
+#include "thread/child_table.hpp"
+#include "thread/indirect_sender.hpp"
+
+namespace ot {
+
+static Instance *sInstance;
+
+class UnitTester
+{
+public:
+    static Message *AllocateMessage(Message::Type aType, Message::Priority aPriority)
+    {
+        Message *message = sInstance->Get<MessagePool>().Allocate(aType);
+
+        VerifyOrQuit(message != nullptr);
+        SuccessOrQuit(message->SetPriority(aPriority));
+
+        return message;
+    }
+
+#if OPENTHREAD_CONFIG_INDIRECT_SENDER_MESSAGE_INDEX_ENABLE
+    static void TestMessageIndex(void)
+    {
+        static IndirectSender::MessageIndex index;
+
+        Message *msg1;
+        Message *msg2;
+        Message *msg3;
+
+        printf("TestMessageIndex");
+
+        sInstance = testInitInstance();
+        VerifyOrQuit(sInstance != nullptr);
+
+        msg1 = AllocateMessage(Message::kTypeIp6, Message::kPriorityNormal);
+        msg2 = AllocateMessage(Message::kTypeIp6, Message::kPriorityHigh);
+        msg3 = AllocateMessage(Message::kTypeSupervision, Message::kPriorityNormal);
+
+        index.Clear();
+
+        // Enqueue: the highest priority message is picked first, and
+        // the supervision-only lookup skips the data messages.
+
+        index.Add(0, *msg1);
+        index.Add(0, *msg2);
+        index.Add(0, *msg3);
+        index.Add(1, *msg1);
+
+        VerifyOrQuit(index.IsIndexed(0));
+        VerifyOrQuit(index.IsIndexed(1));
+        VerifyOrQuit(index.Find(0, /* aSupervisionTypeOnly */ false) == msg2);
+        VerifyOrQuit(index.Find(0, /* aSupervisionTypeOnly */ true) == msg3);
+        VerifyOrQuit(index.Find(1, /* aSupervisionTypeOnly */ false) == msg1);
+        VerifyOrQuit(index.Find(1, /* aSupervisionTypeOnly */ true) == nullptr);
+
+        // Poll: once the current message is sent, the earliest added
+        // among the remaining ones is picked next.
+
+        index.Remove(0, *msg2);
+        VerifyOrQuit(index.Find(0, /* aSupervisionTypeOnly */ false) == msg1);
+
+        // Drop: removing a message for one child keeps it for the other.
+
+        index.Remove(0, *msg1);
+        VerifyOrQuit(index.Find(0, /* aSupervisionTypeOnly */ false) == msg3);
+        VerifyOrQuit(index.Find(1, /* aSupervisionTypeOnly */ false) == msg1);
+
+        VerifyOrQuit(index.Pop(0) == msg3);
+        VerifyOrQuit(index.Pop(0) == nullptr);
+        VerifyOrQuit(index.Find(0, /* aSupervisionTypeOnly */ false) == nullptr);
+
+        // Pool exhaustion: child 1 already uses one entry, fill up the
+        // rest. The next add marks child 1 as unindexed and releases
+        // all its entries.
+
+        for (uint16_t i = 1; i < OPENTHREAD_CONFIG_INDIRECT_SENDER_MESSAGE_INDEX_ENTRIES; i++)
+        {
+            index.Add(1, *msg1);
+            VerifyOrQuit(index.IsIndexed(1));
+        }
+
+        index.Add(1, *msg2);
+        VerifyOrQuit(!index.IsIndexed(1));
+        VerifyOrQuit(index.Find(1, /* aSupervisionTypeOnly */ false) == nullptr);
+
+        // Other children are still indexed using the released entries.
+
+        index.Add(0, *msg2);
+        VerifyOrQuit(index.IsIndexed(0));
+        VerifyOrQuit(index.Find(0, /* aSupervisionTypeOnly */ false) == msg2);
+
+        // Unindexed fallback: adds are ignored until the child is
+        // cleared (all its messages are gone), then it is indexed again.
+
+        index.Add(1, *msg3);
+        VerifyOrQuit(!index.IsIndexed(1));
+        VerifyOrQuit(index.Find(1, /* aSupervisionTypeOnly */ true) == nullptr);
+
+        index.Clear(1);
+        VerifyOrQuit(index.IsIndexed(1));
+
+        index.Add(1, *msg3);
+        VerifyOrQuit(index.Find(1, /* aSupervisionTypeOnly */ true) == msg3);
+
+        index.Clear();
+        VerifyOrQuit(index.Find(0, /* aSupervisionTypeOnly */ false) == nullptr);
+        VerifyOrQuit(index.Find(1, /* aSupervisionTypeOnly */ false) == nullptr);
+
+        msg1->Free();
+        msg2->Free();
+        msg3->Free();
+
+        testFreeInstance(sInstance);
+
+        printf(" -- PASS\n");
+    }
+#endif // OPENTHREAD_CONFIG_INDIRECT_SENDER_MESSAGE_INDEX_ENABLE
+
+    static void TestRemoveMessageFromSleepyChildren(void)
+    {
+        IndirectSender *indirectSender;
+        Child          *child1;
+        Child          *child2;
+        Message        *message;
+        Mac::ExtAddress extAddress;
+
+        printf("TestRemoveMessageFromSleepyChildren");
+
+        sInstance = testInitInstance();
+        VerifyOrQuit(sInstance != nullptr);
+
+        indirectSender = &sInstance->Get<IndirectSender>();
+
+        child1 = sInstance->Get<ChildTable>().GetNewChild();
+        VerifyOrQuit(child1 != nullptr);
+        child1->SetState(Child::kStateValid);
+        child1->SetDeviceMode(Mle::DeviceMode(0));
+        child1->SetRloc16(0x0001);
+        extAddress.GenerateRandom();
+        child1->SetExtAddress(extAddress);
+
+        child2 = sInstance->Get<ChildTable>().GetNewChild();
+        VerifyOrQuit(child2 != nullptr);
+        child2->SetState(Child::kStateValid);
+        child2->SetDeviceMode(Mle::DeviceMode(0));
+        child2->SetRloc16(0x0002);
+        extAddress.GenerateRandom();
+        child2->SetExtAddress(extAddress);
+
+        message = AllocateMessage(Message::kTypeSupervision, Message::kPriorityNormal);
+
+        indirectSender->AddMessageForSleepyChild(*message, *child1);
+        indirectSender->AddMessageForSleepyChild(*message, *child2);
+
+        VerifyOrQuit(message->IsChildPending());
+        VerifyOrQuit(child1->GetIndirectMessageCount() == 1);
+        VerifyOrQuit(child2->GetIndirectMessageCount() == 1);
+#if OPENTHREAD_CONFIG_INDIRECT_SENDER_MESSAGE_INDEX_ENABLE
+        // Without the index, the send queue is scanned (the message is
+        // not queued there in this test).
+        VerifyOrQuit(indirectSender->FindIndirectMessage(*child1) == message);
+        VerifyOrQuit(indirectSender->FindIndirectMessage(*child2) == message);
+
+        // Unindexing the message only removes it from the index, the
+        // children still have it pending.
+
+        indirectSender->UnindexMessage(*message);
+
+        VerifyOrQuit(message->IsChildPending());
+        VerifyOrQuit(child1->GetIndirectMessageCount() == 1);
+        VerifyOrQuit(child2->GetIndirectMessageCount() == 1);
+        VerifyOrQuit(indirectSender->mMessageIndex.Find(sInstance->Get<ChildTable>().GetChildIndex(*child1),
+                                                        /* aSupervisionTypeOnly */ false) == nullptr);
+        VerifyOrQuit(indirectSender->mMessageIndex.Find(sInstance->Get<ChildTable>().GetChildIndex(*child2),
+                                                        /* aSupervisionTypeOnly */ false) == nullptr);
+#endif
+
+        // Dropping the message must clear it from every child (and the
+        // message index) so that nothing refers to it once freed.
+
+        indirectSender->RemoveMessageFromSleepyChildren(*message);
+
+        VerifyOrQuit(!message->IsChildPending());
+        VerifyOrQuit(child1->GetIndirectMessageCount() == 0);
+        VerifyOrQuit(child2->GetIndirectMessageCount() == 0);
+        VerifyOrQuit(indirectSender->FindIndirectMessage(*child1) == nullptr);
+        VerifyOrQuit(indirectSender->FindIndirectMessage(*child2) == nullptr);
+#if OPENTHREAD_CONFIG_INDIRECT_SENDER_MESSAGE_INDEX_ENABLE
+        VerifyOrQuit(indirectSender->mMessageIndex.Find(sInstance->Get<ChildTable>().GetChildIndex(*child1),
+                                                        /* aSupervisionTypeOnly */ false) == nullptr);
+        VerifyOrQuit(indirectSender->mMessageIndex.Find(sInstance->Get<ChildTable>().GetChildIndex(*child2),
+                                                        /* aSupervisionTypeOnly */ false) == nullptr);
+#endif
+
+        message->Free();
+
+        testFreeInstance(sInstance);
+
+        printf(" -- PASS\n");
+    }
+};
+
+} // namespace ot
+
+int main(void)
+{
+#if OPENTHREAD_CONFIG_INDIRECT_SENDER_MESSAGE_INDEX_ENABLE
+    ot::UnitTester::TestMessageIndex();
+#endif
+    ot::UnitTester::TestRemoveMessageFromSleepyChildren();
+
+    printf("\nAll tests passed.\n");
+    return 0;
+}
@@ -0,0 +1,731 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+#include <openthread/dataset_ftd.h>
+#include <openthread/thread.h>
+
+#include "test_util.h"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "thread/lowpan.hpp"
+#include "thread/mesh_forwarder.hpp"
+
+namespace ot {
+
+static Instance *sInstance;
+
+static uint32_t sNow = 0;
+static uint32_t sAlarmTime;
+static bool     sAlarmOn = false;
+
+static otRadioFrame sRadioTxFrame;
+static uint8_t      sRadioTxFramePsdu[OT_RADIO_FRAME_MAX_SIZE];
+static bool         sRadioTxOngoing = false;
+
+extern "C" {
+
+otRadioCaps otPlatRadioGetCaps(otInstance *) { return OT_RADIO_CAPS_ACK_TIMEOUT | OT_RADIO_CAPS_CSMA_BACKOFF; }
+
+otError otPlatRadioTransmit(otInstance *, otRadioFrame *)
+{
+    sRadioTxOngoing = true;
+
+    return OT_ERROR_NONE;
+}
+
+otRadioFrame *otPlatRadioGetTransmitBuffer(otInstance *) { return &sRadioTxFrame; }
+
+void otPlatAlarmMilliStop(otInstance *) { sAlarmOn = false; }
+
+void otPlatAlarmMilliStartAt(otInstance *, uint32_t aT0, uint32_t aDt)
+{
+    sAlarmOn   = true;
+    sAlarmTime = aT0 + aDt;
+}
+
+uint32_t otPlatAlarmMilliGetNow(void) { return sNow; }
+
+} // extern "C"
+
+static void ProcessRadioTxAndTasklets(void)
+{
+    do
+    {
+        if (sRadioTxOngoing)
+        {
+            sRadioTxOngoing = false;
+            otPlatRadioTxStarted(sInstance, &sRadioTxFrame);
+            otPlatRadioTxDone(sInstance, &sRadioTxFrame, nullptr, OT_ERROR_NONE);
+        }
+
+        otTaskletsProcess(sInstance);
+    } while (otTaskletsArePending(sInstance));
+}
+
+static void AdvanceTime(uint32_t aDuration)
+{
+    uint32_t time = sNow + aDuration;
+
+    while (sAlarmOn && TimeMilli(sAlarmTime) <= TimeMilli(time))
+    {
+        ProcessRadioTxAndTasklets();
+        sNow     = sAlarmTime;
+        sAlarmOn = false;
+        otPlatAlarmMilliFired(sInstance);
+    }
+
+    ProcessRadioTxAndTasklets();
+    sNow = time;
+}
+
+class UnitTester
+{
+public:
+    // Each test datagram is an IPv6 header (link-local addresses elided
+    // from the MAC addresses, no next header) followed by a payload sent
+    // in three fragments of `kFragmentPayloadLength` bytes each.
+
+    static constexpr uint16_t kFragmentPayloadLength = 8;
+    static constexpr uint16_t kSecondOffset          = sizeof(Ip6::Header) + kFragmentPayloadLength;
+    static constexpr uint16_t kThirdOffset           = kSecondOffset + kFragmentPayloadLength;
+    static constexpr uint16_t kDatagramSize          = kThirdOffset + kFragmentPayloadLength;
+    static constexpr uint32_t kTimeout               = TimeMilli::SecToMsec(MeshForwarder::kReassemblyTimeout);
+
+    static void InitTest(void)
+    {
+        sNow      = 0;
+        sAlarmOn  = false;
+        sInstance = testInitInstance();
+        VerifyOrQuit(sInstance != nullptr);
+
+        memset(&sRadioTxFrame, 0, sizeof(sRadioTxFrame));
+        sRadioTxFrame.mPsdu = sRadioTxFramePsdu;
+        sRadioTxOngoing     = false;
+
+        sInstance->Get<Mac::Mac>().SetRxOnWhenIdle(true);
+        sInstance->Get<MeshForwarder>().ResetCounters();
+        sInstance->Get<MeshForwarder>().ResetReassemblyCounters();
+    }
+
+    static const otReassemblyCounters &GetReassemblyCounters(void)
+    {
+        return sInstance->Get<MeshForwarder>().GetReassemblyCounters();
+    }
+
+    static uint32_t GetRxSuccess(void) { return sInstance->Get<MeshForwarder>().GetCounters().mRxSuccess; }
+
+    static void SendFragment(uint8_t aSource, uint16_t aTag, uint16_t aOffset)
+    {
+        static const uint8_t kIphc[] = {0x7b, 0x33, Ip6::kProtoNone};
+
+        uint8_t         frame[sizeof(Lowpan::FragmentHeader::NextFrag) + sizeof(kIphc) + kFragmentPayloadLength];
+        uint16_t        length;
+        FrameData       frameData;
+        Mac::Addresses  macAddrs;
+        Mac::ExtAddress extAddress;
+        ThreadLinkInfo  linkInfo;
+
+        if (aOffset == 0)
+        {
+            Lowpan::FragmentHeader::FirstFrag header;
+
+            header.Init(kDatagramSize, aTag);
+            memcpy(frame, &header, sizeof(header));
+            length = sizeof(header);
+            memcpy(frame + length, kIphc, sizeof(kIphc));
+            length += sizeof(kIphc);
+        }
+        else
+        {
+            Lowpan::FragmentHeader::NextFrag header;
+
+            header.Init(kDatagramSize, aTag, aOffset);
+            memcpy(frame, &header, sizeof(header));
+            length = sizeof(header);
+        }
+
+        memset(frame + length, static_cast<uint8_t>(aOffset), kFragmentPayloadLength);
+        length += kFragmentPayloadLength;
+
+        frameData.Init(frame, length);
+
+        extAddress.Clear();
+        extAddress.m8[7] = aSource;
+        macAddrs.mSource.SetExtended(extAddress);
+        extAddress.m8[7] = 0xff;
+        macAddrs.mDestination.SetExtended(extAddress);
+
+        linkInfo.Clear();
+        linkInfo.mLinkSecurity = true;
+
+        sInstance->Get<MeshForwarder>().HandleFragment(frameData, macAddrs, linkInfo);
+    }
+
+    static void SendDatagram(uint8_t aSource, uint16_t aTag)
+    {
+        SendFragment(aSource, aTag, 0);
+        SendFragment(aSource, aTag, kSecondOffset);
+        SendFragment(aSource, aTag, kThirdOffset);
+    }
+
+    static void TestReassemblyInOrder(void)
+    {
+        printf("TestReassemblyInOrder");
+
+        InitTest();
+
+        SendFragment(1, 100, 0);
+        VerifyOrQuit(GetReassemblyCounters().mCurrentDatagrams == 1);
+        SendFragment(1, 100, kSecondOffset);
+        VerifyOrQuit(GetReassemblyCounters().mCurrentDatagrams == 1);
+        SendFragment(1, 100, kThirdOffset);
+        VerifyOrQuit(GetReassemblyCounters().mCurrentDatagrams == 0);
+        VerifyOrQuit(GetRxSuccess() == 1);
+
+        // Interleaved datagrams from two senders using the same tag.
+
+        SendFragment(1, 200, 0);
+        SendFragment(2, 200, 0);
+        VerifyOrQuit(GetReassemblyCounters().mCurrentDatagrams == 2);
+        SendFragment(2, 200, kSecondOffset);
+        SendFragment(1, 200, kSecondOffset);
+        SendFragment(1, 200, kThirdOffset);
+        SendFragment(2, 200, kThirdOffset);
+        VerifyOrQuit(GetReassemblyCounters().mCurrentDatagrams == 0);
+        VerifyOrQuit(GetReassemblyCounters().mMaxDatagrams == 2);
+        VerifyOrQuit(GetReassemblyCounters().mDroppedFragments == 0);
+        VerifyOrQuit(GetRxSuccess() == 3);
+        VerifyOrQuit(!sInstance->Get<MeshForwarder>().mReassemblyTimer.IsRunning());
+
+        testFreeInstance(sInstance);
+
+        printf(" -- PASS\n");
+    }
+
+    static void TestReassemblyDuplicateAndOutOfOrder(void)
+    {
+        printf("TestReassemblyDuplicateAndOutOfOrder");
+
+        InitTest();
+
+        // A next fragment without a matching first fragment is dropped.
+
+        SendFragment(1, 300, kSecondOffset);
+        VerifyOrQuit(GetReassemblyCounters().mDroppedFragments == 1);
+        VerifyOrQuit(GetReassemblyCounters().mCurrentDatagrams == 0);
+
+        // A duplicate next fragment is dropped, and so is one for an
+        // already completed datagram.
+
+        SendFragment(1, 300, 0);
+        SendFragment(1, 300, kSecondOffset);
+        SendFragment(1, 300, kSecondOffset);
+        VerifyOrQuit(GetReassemblyCounters().mDroppedFragments == 2);
+        SendFragment(1, 300, kThirdOffset);
+        VerifyOrQuit(GetRxSuccess() == 1);
+        SendFragment(1, 300, kThirdOffset);
+        VerifyOrQuit(GetReassemblyCounters().mDroppedFragments == 3);
+        VerifyOrQuit(GetRxSuccess() == 1);
+
+        // An out-of-order next fragment is dropped and the datagram
+        // keeps waiting for the expected offset.
+
+        SendFragment(1, 301, 0);
+        SendFragment(1, 301, kThirdOffset);
+        VerifyOrQuit(GetReassemblyCounters().mDroppedFragments == 4);
+        VerifyOrQuit(GetReassemblyCounters().mCurrentDatagrams == 1);
+        SendFragment(1, 301, kSecondOffset);
+        SendFragment(1, 301, kThirdOffset);
+        VerifyOrQuit(GetReassemblyCounters().mCurrentDatagrams == 0);
+        VerifyOrQuit(GetRxSuccess() == 2);
+
+        testFreeInstance(sInstance);
+
+        printf(" -- PASS\n");
+    }
+
+    static void TestReassemblyTimeout(void)
+    {
+        printf("TestReassemblyTimeout");
+
+        InitTest();
+
+        SendFragment(1, 400, 0);
+        AdvanceTime(kTimeout / 2);
+        SendFragment(2, 401, 0);
+        VerifyOrQuit(GetReassemblyCounters().mCurrentDatagrams == 2);
+
+        // The older datagram expires first.
+
+        AdvanceTime(kTimeout / 2);
+        VerifyOrQuit(GetReassemblyCounters().mTimeouts == 1);
+        VerifyOrQuit(GetReassemblyCounters().mCurrentDatagrams == 1);
+
+        SendFragment(1, 400, kSecondOffset);
+        VerifyOrQuit(GetReassemblyCounters().mDroppedFragments == 1);
+
+        AdvanceTime(kTimeout / 2);
+        VerifyOrQuit(GetReassemblyCounters().mTimeouts == 2);
+        VerifyOrQuit(GetReassemblyCounters().mCurrentDatagrams == 0);
+        VerifyOrQuit(!sInstance->Get<MeshForwarder>().mReassemblyTimer.IsRunning());
+
+        // A received next fragment restarts the timeout of its datagram,
+        // so a younger datagram without progress now expires first.
+
+        SendFragment(1, 402, 0);
+        AdvanceTime(kTimeout / 4);
+        SendFragment(2, 403, 0);
+        AdvanceTime(kTimeout / 4);
+        SendFragment(1, 402, kSecondOffset);
+
+        AdvanceTime(kTimeout / 2);
+        VerifyOrQuit(GetReassemblyCounters().mTimeouts == 2);
+        AdvanceTime(kTimeout / 4);
+        VerifyOrQuit(GetReassemblyCounters().mTimeouts == 3);
+        VerifyOrQuit(GetReassemblyCounters().mCurrentDatagrams == 1);
+
+        SendFragment(1, 402, kThirdOffset);
+        VerifyOrQuit(GetReassemblyCounters().mCurrentDatagrams == 0);
+        VerifyOrQuit(GetRxSuccess() == 1);
+        VerifyOrQuit(!sInstance->Get<MeshForwarder>().mReassemblyTimer.IsRunning());
+
+        testFreeInstance(sInstance);
+
+        printf(" -- PASS\n");
+    }
+
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_6LOWPAN_FRAGMENT_FORWARDING_ENABLE
+    // A forwarded test datagram is a UDP datagram from a mesh-local
+    // address to the RLOC of a neighboring router. The first fragment
+    // carries the IPv6 header inline along with the UDP header and the
+    // first `kFragmentPayloadLength` bytes of the UDP payload.
+
+    static constexpr uint16_t kFwdFirstPayloadLength = sizeof(Ip6::Udp::Header) + kFragmentPayloadLength;
+    static constexpr uint16_t kFwdSecondOffset       = sizeof(Ip6::Header) + kFwdFirstPayloadLength;
+    static constexpr uint16_t kFwdThirdOffset        = kFwdSecondOffset + kFragmentPayloadLength;
+    static constexpr uint16_t kFwdDatagramSize       = kFwdThirdOffset + kFragmentPayloadLength;
+    static constexpr uint8_t  kMaxForwardedFrames    = 8;
+
+    static Router *sNeighbor;
+
+    static void InitForwardingTest(void)
+    {
+        otOperationalDataset     dataset;
+        otOperationalDatasetTlvs datasetTlvs;
+        Mac::ExtAddress          extAddress;
+        uint8_t                  routerId;
+
+        InitTest();
+
+        SuccessOrQuit(otDatasetCreateNewNetwork(sInstance, &dataset));
+        SuccessOrQuit(otDatasetConvertToTlvs(&dataset, &datasetTlvs));
+        SuccessOrQuit(otDatasetSetActiveTlvs(sInstance, &datasetTlvs));
+
+        SuccessOrQuit(otIp6SetEnabled(sInstance, true));
+        SuccessOrQuit(otThreadSetEnabled(sInstance, true));
+
+        AdvanceTime(10000);
+        VerifyOrQuit(otThreadGetDeviceRole(sInstance) == OT_DEVICE_ROLE_LEADER);
+
+        // Add a neighboring router to forward the datagrams to.
+
+        routerId  = (Mle::RouterIdFromRloc16(Get<Mle::Mle>().GetRloc16()) + 1) % (Mle::kMaxRouterId + 1);
+        sNeighbor = sInstance->Get<RouterTable>().Allocate(routerId);
+        VerifyOrQuit(sNeighbor != nullptr);
+
+        extAddress.Clear();
+        extAddress.m8[7] = 1;
+        sNeighbor->SetExtAddress(extAddress);
+        sNeighbor->SetState(Neighbor::kStateValid);
+        sNeighbor->SetLinkQualityOut(kLinkQuality3);
+        sNeighbor->GetLinkInfo().AddRss(-20);
+
+        VerifyOrQuit(sInstance->Get<Mle::MleRouter>().GetNextHop(sNeighbor->GetRloc16()) == sNeighbor->GetRloc16());
+
+        sInstance->Get<MeshForwarder>().ResetCounters();
+        sInstance->Get<MeshForwarder>().ResetReassemblyCounters();
+        CollectForwardedFrames(nullptr);
+    }
+
+    static void FinalizeForwardingTest(void)
+    {
+        SuccessOrQuit(otThreadSetEnabled(sInstance, false));
+        SuccessOrQuit(otIp6SetEnabled(sInstance, false));
+        SuccessOrQuit(otInstanceErasePersistentInfo(sInstance));
+        testFreeInstance(sInstance);
+    }
+
+    static void SendForwardFragment(uint16_t aTag, uint16_t aOffset)
+    {
+        static constexpr uint16_t kIphcLength = 3 + 2 * sizeof(Ip6::Address);
+
+        uint8_t        frame[sizeof(Lowpan::FragmentHeader::FirstFrag) + kIphcLength + kFwdFirstPayloadLength];
+        uint16_t       length;
+        FrameData      frameData;
+        Mac::Addresses macAddrs;
+        ThreadLinkInfo linkInfo;
+
+        if (aOffset == 0)
+        {
+            Lowpan::FragmentHeader::FirstFrag header;
+            Ip6::Address                      address;
+            Ip6::Udp::Header                  udpHeader;
+
+            header.Init(kFwdDatagramSize, aTag);
+            memcpy(frame, &header, sizeof(header));
+            length = sizeof(header);
+
+            // IPHC with TF elided, inline Next Header, HLIM 64 and
+            // both addresses carried inline.
+
+            frame[length++] = 0x7a;
+            frame[length++] = 0x00;
+            frame[length++] = Ip6::kProtoUdp;
+
+            address.SetToRoutingLocator(sInstance->Get<Mle::Mle>().GetMeshLocalPrefix(), 0x5801);
+            memcpy(frame + length, &address, sizeof(address));
+            length += sizeof(address);
+
+            address.SetToRoutingLocator(sInstance->Get<Mle::Mle>().GetMeshLocalPrefix(), sNeighbor->GetRloc16());
+            memcpy(frame + length, &address, sizeof(address));
+            length += sizeof(address);
+
+            udpHeader.Clear();
+            udpHeader.SetSourcePort(1234);
+            udpHeader.SetDestinationPort(5678);
+            udpHeader.SetLength(kFwdDatagramSize - sizeof(Ip6::Header));
+            memcpy(frame + length, &udpHeader, sizeof(udpHeader));
+            length += sizeof(udpHeader);
+        }
+        else
+        {
+            Lowpan::FragmentHeader::NextFrag header;
+
+            header.Init(kFwdDatagramSize, aTag, aOffset);
+            memcpy(frame, &header, sizeof(header));
+            length = sizeof(header);
+        }
+
+        memset(frame + length, static_cast<uint8_t>(aOffset), kFragmentPayloadLength);
+        length += kFragmentPayloadLength;
+
+        frameData.Init(frame, length);
+
+        macAddrs.mSource.SetExtended(sNeighbor->GetExtAddress());
+        macAddrs.mDestination.SetExtended(sInstance->Get<Mac::Mac>().GetExtAddress());
+
+        linkInfo.Clear();
+        linkInfo.mLinkSecurity = true;
+
+        sInstance->Get<MeshForwarder>().HandleFragment(frameData, macAddrs, linkInfo);
+    }
+
+    static uint8_t CollectForwardedFrames(uint16_t *aOffsets)
+    {
+        // Removes the forwarded frames from the send queue, returning
+        // their number and the datagram offset of each of them.
+
+        MeshForwarder &meshForwarder = Get<MeshForwarder>();
+        uint8_t        count         = 0;
+        Message       *next;
+
+        for (Message *message = meshForwarder.mSendQueue.GetHead(); message != nullptr; message = next)
+        {
+            Lowpan::MeshHeader     meshHeader;
+            Lowpan::FragmentHeader fragmentHeader;
+            uint16_t               meshHeaderLength;
+            uint16_t               fragmentHeaderLength;
+
+            next = message->GetNext();
+
+            if (message->GetType() != Message::kType6lowpan)
+            {
+                continue;
+            }
+
+            SuccessOrQuit(meshHeader.ParseFrom(*message, meshHeaderLength));
+            VerifyOrQuit(meshHeader.GetDestination() == sNeighbor->GetRloc16());
+            SuccessOrQuit(fragmentHeader.ParseFrom(*message, meshHeaderLength, fragmentHeaderLength));
+            VerifyOrQuit(fragmentHeader.GetDatagramSize() == kFwdDatagramSize);
+
+            VerifyOrQuit(count < kMaxForwardedFrames);
+
+            if (aOffsets != nullptr)
+            {
+                aOffsets[count] = fragmentHeader.GetDatagramOffset();
+            }
+
+            count++;
+            meshForwarder.DequeueAndFreeFromSendQueue(*message);
+        }
+
+        return count;
+    }
+
+    template <typename Type> static Type &Get(void) { return sInstance->Get<Type>(); }
+
+    static void TestForwardingInOrder(void)
+    {
+        uint16_t offsets[kMaxForwardedFrames];
+
+        printf("TestForwardingInOrder");
+
+        InitForwardingTest();
+
+        SendForwardFragment(100, 0);
+        VerifyOrQuit(CollectForwardedFrames(offsets) == 1);
+        VerifyOrQuit(offsets[0] == 0);
+        VerifyOrQuit(GetReassemblyCounters().mForwardedDatagrams == 1);
+        VerifyOrQuit(GetReassemblyCounters().mCurrentDatagrams == 0);
+
+        SendForwardFragment(100, kFwdSecondOffset);
+        VerifyOrQuit(CollectForwardedFrames(offsets) == 1);
+        VerifyOrQuit(offsets[0] == kFwdSecondOffset);
+
+        SendForwardFragment(100, kFwdThirdOffset);
+        VerifyOrQuit(CollectForwardedFrames(offsets) == 1);
+        VerifyOrQuit(offsets[0] == kFwdThirdOffset);
+
+        // The entry is released once the last fragment is forwarded,
+        // so a retransmitted last fragment is not forwarded again.
+
+        SendForwardFragment(100, kFwdThirdOffset);
+        VerifyOrQuit(CollectForwardedFrames(offsets) == 0);
+        VerifyOrQuit(GetReassemblyCounters().mDroppedFragments == 1);
+        VerifyOrQuit(GetReassemblyCounters().mCurrentDatagrams == 0);
+        VerifyOrQuit(GetRxSuccess() == 0);
+
+        FinalizeForwardingTest();
+
+        printf(" -- PASS\n");
+    }
+
+    static void TestForwardingDuplicate(void)
+    {
+        uint16_t offsets[kMaxForwardedFrames];
+
+        printf("TestForwardingDuplicate");
+
+        InitForwardingTest();
+
+        SendForwardFragment(200, 0);
+        SendForwardFragment(200, 0);
+        VerifyOrQuit(CollectForwardedFrames(offsets) == 1);
+        VerifyOrQuit(GetReassemblyCounters().mForwardedDatagrams == 1);
+        VerifyOrQuit(GetReassemblyCounters().mDroppedFragments == 1);
+
+        SendForwardFragment(200, kFwdSecondOffset);
+        SendForwardFragment(200, kFwdSecondOffset);
+        VerifyOrQuit(CollectForwardedFrames(offsets) == 1);
+        VerifyOrQuit(offsets[0] == kFwdSecondOffset);
+        VerifyOrQuit(GetReassemblyCounters().mDroppedFragments == 2);
+
+        SendForwardFragment(200, kFwdThirdOffset);
+        VerifyOrQuit(CollectForwardedFrames(offsets) == 1);
+        VerifyOrQuit(offsets[0] == kFwdThirdOffset);
+
+        VerifyOrQuit(GetReassemblyCounters().mCurrentDatagrams == 0);
+
+        FinalizeForwardingTest();
+
+        printf(" -- PASS\n");
+    }
+
+    static void TestForwardingOutOfOrder(void)
+    {
+        uint16_t offsets[kMaxForwardedFrames];
+
+        printf("TestForwardingOutOfOrder");
+
+        InitForwardingTest();
+
+        SendForwardFragment(300, 0);
+        VerifyOrQuit(CollectForwardedFrames(offsets) == 1);
+
+        // A fragment past the expected offset is dropped and the entry
+        // keeps waiting for the expected one.
+
+        SendForwardFragment(300, kFwdThirdOffset);
+        VerifyOrQuit(CollectForwardedFrames(offsets) == 0);
+        VerifyOrQuit(GetReassemblyCounters().mDroppedFragments == 1);
+
+        SendForwardFragment(300, kFwdSecondOffset);
+        VerifyOrQuit(CollectForwardedFrames(offsets) == 1);
+        VerifyOrQuit(offsets[0] == kFwdSecondOffset);
+
+        // A fragment before the expected offset overlaps one already
+        // forwarded and is dropped.
+
+        SendForwardFragment(300, kFwdSecondOffset - 8);
+        VerifyOrQuit(CollectForwardedFrames(offsets) == 0);
+        VerifyOrQuit(GetReassemblyCounters().mDroppedFragments == 2);
+
+        SendForwardFragment(300, kFwdThirdOffset);
+        VerifyOrQuit(CollectForwardedFrames(offsets) == 1);
+        VerifyOrQuit(offsets[0] == kFwdThirdOffset);
+
+        VerifyOrQuit(GetReassemblyCounters().mCurrentDatagrams == 0);
+
+        FinalizeForwardingTest();
+
+        printf(" -- PASS\n");
+    }
+
+    static void TestForwardingTimeout(void)
+    {
+        uint16_t offsets[kMaxForwardedFrames];
+
+        printf("TestForwardingTimeout");
+
+        InitForwardingTest();
+
+        SendForwardFragment(400, 0);
+        VerifyOrQuit(CollectForwardedFrames(offsets) == 1);
+
+        // A received fragment restarts the entry lifetime.
+
+        AdvanceTime(kTimeout - 1000);
+        SendForwardFragment(400, kFwdSecondOffset);
+        VerifyOrQuit(CollectForwardedFrames(offsets) == 1);
+
+        // Once the entry expires, the remaining fragment is no longer
+        // forwarded, and is dropped since there is nothing to
+        // reassemble it into either.
+
+        AdvanceTime(kTimeout + 1000);
+        SendForwardFragment(400, kFwdThirdOffset);
+        VerifyOrQuit(CollectForwardedFrames(offsets) == 0);
+        VerifyOrQuit(GetReassemblyCounters().mDroppedFragments == 1);
+
+        // The expired entry is reused for a new datagram.
+
+        for (uint16_t i = 0; i < OPENTHREAD_CONFIG_6LOWPAN_FRAGMENT_FORWARDING_ENTRIES; i++)
+        {
+            SendForwardFragment(500 + i, 0);
+        }
+
+        VerifyOrQuit(CollectForwardedFrames(offsets) == OPENTHREAD_CONFIG_6LOWPAN_FRAGMENT_FORWARDING_ENTRIES);
+        VerifyOrQuit(GetReassemblyCounters().mForwardedDatagrams ==
+                     1 + OPENTHREAD_CONFIG_6LOWPAN_FRAGMENT_FORWARDING_ENTRIES);
+
+        FinalizeForwardingTest();
+
+        printf(" -- PASS\n");
+    }
+#endif // OPENTHREAD_FTD && OPENTHREAD_CONFIG_6LOWPAN_FRAGMENT_FORWARDING_ENABLE
+
+#if OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_ENABLE
+    static void TestReassemblyIndex(void)
+    {
+        static constexpr uint16_t kIndexSize = OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_SIZE;
+
+        printf("TestReassemblyIndex");
+
+        InitTest();
+
+        // A next fragment only matches a datagram from the same sender.
+
+        SendFragment(1, 500, 0);
+        SendFragment(2, 500, kSecondOffset);
+        VerifyOrQuit(GetReassemblyCounters().mDroppedFragments == 1);
+        SendFragment(1, 500, kSecondOffset);
+        SendFragment(1, 500, kThirdOffset);
+        VerifyOrQuit(GetRxSuccess() == 1);
+
+        // Once the index is full, the datagram that has waited longest
+        // for its next fragment is dropped.
+
+        for (uint16_t i = 0; i < kIndexSize; i++)
+        {
+            SendFragment(1, 600 + i, 0);
+            AdvanceTime(1);
+        }
+
+        VerifyOrQuit(GetReassemblyCounters().mCurrentDatagrams == kIndexSize);
+        VerifyOrQuit(GetReassemblyCounters().mDroppedDatagrams == 0);
+
+        SendFragment(1, 600 + kIndexSize, 0);
+        VerifyOrQuit(GetReassemblyCounters().mCurrentDatagrams == kIndexSize);
+        VerifyOrQuit(GetReassemblyCounters().mDroppedDatagrams == 1);
+
+        SendFragment(1, 600, kSecondOffset);
+        VerifyOrQuit(GetReassemblyCounters().mDroppedFragments == 2);
+
+        for (uint16_t i = 1; i <= kIndexSize; i++)
+        {
+            SendFragment(1, 600 + i, kSecondOffset);
+            SendFragment(1, 600 + i, kThirdOffset);
+        }
+
+        VerifyOrQuit(GetReassemblyCounters().mCurrentDatagrams == 0);
+        VerifyOrQuit(GetRxSuccess() == 1 + kIndexSize);
+
+        // Completed datagrams free their index slots.
+
+        for (uint16_t i = 0; i < kIndexSize; i++)
+        {
+            SendDatagram(3, 700 + i);
+        }
+
+        VerifyOrQuit(GetReassemblyCounters().mDroppedDatagrams == 1);
+        VerifyOrQuit(GetRxSuccess() == 1 + 2 * kIndexSize);
+
+        testFreeInstance(sInstance);
+
+        printf(" -- PASS\n");
+    }
+#endif
+};
+
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_6LOWPAN_FRAGMENT_FORWARDING_ENABLE
+Router *UnitTester::sNeighbor;
+#endif
+
+} // namespace ot
+
+int main(void)
+{
+    ot::UnitTester::TestReassemblyInOrder();
+    ot::UnitTester::TestReassemblyDuplicateAndOutOfOrder();
+    ot::UnitTester::TestReassemblyTimeout();
+#if OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_ENABLE
+    ot::UnitTester::TestReassemblyIndex();
+#endif
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_6LOWPAN_FRAGMENT_FORWARDING_ENABLE
+    ot::UnitTester::TestForwardingInOrder();
+    ot::UnitTester::TestForwardingDuplicate();
+    ot::UnitTester::TestForwardingOutOfOrder();
+    ot::UnitTester::TestForwardingTimeout();
+#endif
+
+    printf("\nAll tests passed.\n");
+    return 0;
+}
@@ -31,6 +31,7 @@
 #include "common/instance.hpp"
 #include "common/message.hpp"
 #include "common/random.hpp"
+#include "common/string.hpp"
 
 #include "test_platform.h"
 #include "test_util.hpp"
@@ -398,12 +399,327 @@ void TestAppender(void)
     testFreeInstance(instance);
 }
 
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+void TestSharedBuffers(void)
+{
+    static constexpr uint16_t kNumMessages = 3;
+    static constexpr uint16_t kMaxSize     = kBufferSize * 4;
+    static constexpr uint16_t kNumSteps    = 2000;
+
+    Instance    *instance;
+    MessagePool *messagePool;
+    Message     *messages[kNumMessages];
+    uint8_t      shadows[kNumMessages][kMaxSize + kBufferSize];
+    uint16_t     lengths[kNumMessages];
+    uint8_t      writeBuffer[kMaxSize + kBufferSize];
+    uint8_t      readBuffer[kMaxSize + kBufferSize];
+    uint16_t     numFreeBuffers;
+    uint8_t      bufferCount;
+    uint8_t      byte;
+
+    printf("TestSharedBuffers\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    messagePool = &instance->Get<MessagePool>();
+    messagePool->ResetSharedBufferCounters();
+    numFreeBuffers = messagePool->GetFreeBufferCount();
+
+    Random::NonCrypto::FillBuffer(writeBuffer, sizeof(writeBuffer));
+
+    // A clone only allocates its head buffer and shares all others.
+
+    VerifyOrQuit((messages[0] = messagePool->Allocate(Message::kTypeIp6)) != nullptr);
+    SuccessOrQuit(messages[0]->AppendBytes(writeBuffer, kMaxSize));
+    bufferCount = messages[0]->GetBufferCount();
+    VerifyOrQuit(messagePool->GetFreeBufferCount() == numFreeBuffers - bufferCount);
+
+    VerifyOrQuit((messages[1] = messages[0]->Clone()) != nullptr);
+    VerifyOrQuit(messagePool->GetFreeBufferCount() == numFreeBuffers - bufferCount - 1);
+    VerifyOrQuit(messagePool->GetSharedBufferCount() == bufferCount - 1U);
+    VerifyOrQuit(messagePool->GetCopyOnWriteBufferCount() == 0);
+    VerifyOrQuit(messages[1]->GetLength() == kMaxSize);
+    VerifyOrQuit(messages[1]->CompareBytes(0, writeBuffer, kMaxSize));
+
+    // Writing to the header region (head buffer) does not copy.
+
+    messages[1]->Write<uint8_t>(0, 0x5a);
+    VerifyOrQuit(messagePool->GetCopyOnWriteBufferCount() == 0);
+    VerifyOrQuit(messages[0]->CompareBytes(0, writeBuffer, kMaxSize));
+
+    // Writing to the last byte copies all shared buffers of the clone.
+
+    messages[1]->Write<uint8_t>(kMaxSize - 1, 0xa5);
+    VerifyOrQuit(messagePool->GetCopyOnWriteBufferCount() == bufferCount - 1U);
+    VerifyOrQuit(messages[0]->CompareBytes(0, writeBuffer, kMaxSize));
+    VerifyOrQuit(messages[1]->CompareBytes(1, writeBuffer + 1, kMaxSize - 2));
+    VerifyOrQuit(messagePool->GetFreeBufferCount() == numFreeBuffers - 2 * bufferCount);
+
+    messages[0]->Free();
+    messages[1]->Free();
+    VerifyOrQuit(messagePool->GetFreeBufferCount() == numFreeBuffers);
+
+    // The buffers needed to copy the shared ones are held back: regular
+    // allocations run out before them, and writing into the shared
+    // buffers still gets its copies once the pool is otherwise full.
+
+    VerifyOrQuit((messages[0] = messagePool->Allocate(Message::kTypeIp6)) != nullptr);
+    SuccessOrQuit(messages[0]->AppendBytes(writeBuffer, kMaxSize));
+    VerifyOrQuit((messages[1] = messages[0]->Clone()) != nullptr);
+    VerifyOrQuit(messagePool->GetSharedBufferCount() == 2 * (bufferCount - 1U));
+
+    VerifyOrQuit((messages[2] = messagePool->Allocate(Message::kTypeIp6)) != nullptr);
+
+    while (messages[2]->AppendBytes(writeBuffer, kBufferSize) == kErrorNone)
+    {
+    }
+
+    VerifyOrQuit(messagePool->GetFreeBufferCount() == bufferCount - 1U);
+    VerifyOrQuit(messages[0]->Clone() == nullptr);
+
+    messages[1]->Write<uint8_t>(kMaxSize - 1, 0xa5);
+    messages[0]->Write<uint8_t>(kMaxSize - 1, 0x5a);
+    VerifyOrQuit(messagePool->GetFreeBufferCount() == 0);
+    VerifyOrQuit(messagePool->GetCopyOnWriteBufferCount() == 2 * (bufferCount - 1U));
+    VerifyOrQuit(messages[0]->CompareBytes(0, writeBuffer, kMaxSize - 1));
+    VerifyOrQuit(messages[1]->CompareBytes(0, writeBuffer, kMaxSize - 1));
+    SuccessOrQuit(messages[0]->Read(kMaxSize - 1, byte));
+    VerifyOrQuit(byte == 0x5a);
+    SuccessOrQuit(messages[1]->Read(kMaxSize - 1, byte));
+    VerifyOrQuit(byte == 0xa5);
+
+    messages[1]->Free();
+    messages[2]->Free();
+    VerifyOrQuit(messagePool->GetFreeBufferCount() == numFreeBuffers - bufferCount);
+
+    // When the free buffers cannot cover the ones to hold back (plus
+    // the configured reserve), the clone copies the buffers instead.
+
+    VerifyOrQuit((messages[2] = messagePool->Allocate(Message::kTypeIp6)) != nullptr);
+
+    while (messagePool->GetFreeBufferCount() > bufferCount + OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_RESERVE - 1)
+    {
+        SuccessOrQuit(messages[2]->AppendBytes(writeBuffer, 1));
+    }
+
+    VerifyOrQuit((messages[1] = messages[0]->Clone()) != nullptr);
+    VerifyOrQuit(messagePool->GetSharedBufferCount() == 2 * (bufferCount - 1U));
+    VerifyOrQuit(messages[1]->GetBufferCount() == bufferCount);
+    VerifyOrQuit(messages[1]->CompareBytes(0, writeBuffer, kMaxSize - 1));
+
+    messages[0]->Free();
+    messages[1]->Free();
+    messages[2]->Free();
+    VerifyOrQuit(messagePool->GetFreeBufferCount() == numFreeBuffers);
+
+    // Randomly clone, write, resize and free messages and compare
+    // their content against a shadow copy.
+
+    for (uint16_t i = 0; i < kNumMessages; i++)
+    {
+        messages[i] = nullptr;
+    }
+
+    for (uint16_t step = 0; step < kNumSteps; step++)
+    {
+        uint16_t index  = Random::NonCrypto::GetUint16InRange(0, kNumMessages);
+        uint16_t other  = Random::NonCrypto::GetUint16InRange(0, kNumMessages);
+        uint16_t offset = 0;
+        uint16_t length = 0;
+
+        if (messages[index] == nullptr)
+        {
+            if ((messages[other] != nullptr) && (other != index))
+            {
+                length = Random::NonCrypto::GetUint16InRange(0, lengths[other] + 1);
+                VerifyOrQuit((messages[index] = messages[other]->Clone(length)) != nullptr);
+                memcpy(shadows[index], shadows[other], length);
+            }
+            else
+            {
+                length = Random::NonCrypto::GetUint16InRange(0, kMaxSize);
+                VerifyOrQuit((messages[index] = messagePool->Allocate(Message::kTypeIp6)) != nullptr);
+                SuccessOrQuit(messages[index]->AppendBytes(writeBuffer, length));
+                memcpy(shadows[index], writeBuffer, length);
+            }
+
+            lengths[index] = length;
+        }
+        else
+        {
+            if (lengths[index] > 0)
+            {
+                offset = Random::NonCrypto::GetUint16InRange(0, lengths[index]);
+                length = Random::NonCrypto::GetUint16InRange(0, lengths[index] - offset + 1);
+            }
+
+            switch (Random::NonCrypto::GetUint8InRange(0, 5))
+            {
+            case 0:
+                messages[index]->WriteBytes(offset, writeBuffer + step % kBufferSize, length);
+                memcpy(shadows[index] + offset, writeBuffer + step % kBufferSize, length);
+                break;
+
+            case 1:
+                length = Random::NonCrypto::GetUint16InRange(0, kMaxSize);
+                SuccessOrQuit(messages[index]->SetLength(length));
+
+                if (length > lengths[index])
+                {
+                    messages[index]->WriteBytes(lengths[index], writeBuffer, length - lengths[index]);
+                    memcpy(shadows[index] + lengths[index], writeBuffer, length - lengths[index]);
+                }
+
+                lengths[index] = length;
+                break;
+
+            case 2:
+                length = Random::NonCrypto::GetUint16InRange(0, kBufferSize);
+
+                if (lengths[index] + length > kMaxSize)
+                {
+                    break;
+                }
+
+                SuccessOrQuit(messages[index]->InsertHeader(offset, length));
+                messages[index]->WriteBytes(offset, writeBuffer, length);
+                memmove(shadows[index] + offset + length, shadows[index] + offset, lengths[index] - offset);
+                memcpy(shadows[index] + offset, writeBuffer, length);
+                lengths[index] += length;
+                break;
+
+            case 3:
+                messages[index]->RemoveHeader(offset, length);
+                memmove(shadows[index] + length, shadows[index], offset);
+                memmove(shadows[index], shadows[index] + length, lengths[index] - length);
+                lengths[index] -= length;
+                break;
+
+            default:
+                messages[index]->Free();
+                messages[index] = nullptr;
+                break;
+            }
+        }
+
+        for (uint16_t i = 0; i < kNumMessages; i++)
+        {
+            if (messages[i] != nullptr)
+            {
+                VerifyOrQuit(messages[i]->GetLength() == lengths[i]);
+                VerifyOrQuit(messages[i]->ReadBytes(0, readBuffer, lengths[i]) == lengths[i]);
+                VerifyOrQuit(memcmp(readBuffer, shadows[i], lengths[i]) == 0);
+            }
+        }
+    }
+
+    printf("  shared: %lu, copy-on-write: %lu\n", ToUlong(messagePool->GetSharedBufferCount()),
+           ToUlong(messagePool->GetCopyOnWriteBufferCount()));
+
+    for (Message *message : messages)
+    {
+        FreeMessage(message);
+    }
+
+    VerifyOrQuit(messagePool->GetFreeBufferCount() == numFreeBuffers);
+
+    testFreeInstance(instance);
+}
+#endif // OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+
+#if OPENTHREAD_CONFIG_MESSAGE_BUFFER_USAGE_ENABLE
+void TestBufferUsage(void)
+{
+    static constexpr uint16_t kLength = kBufferSize * 2;
+
+    Instance    *instance;
+    MessagePool *messagePool;
+    Message     *message;
+    Message     *message2;
+    uint8_t      writeBuffer[kLength];
+    uint16_t     numBuffers;
+
+    printf("TestBufferUsage\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    messagePool = &instance->Get<MessagePool>();
+    messagePool->ResetMaxBufferUsages();
+
+    for (uint8_t origin = 0; origin < Message::kNumOrigins; origin++)
+    {
+        VerifyOrQuit(messagePool->GetBufferUsage(static_cast<Message::Origin>(origin)).mNumBuffers == 0);
+        VerifyOrQuit(messagePool->GetBufferUsage(static_cast<Message::Origin>(origin)).mMaxBuffers == 0);
+    }
+
+    Random::NonCrypto::FillBuffer(writeBuffer, sizeof(writeBuffer));
+
+    // New messages are accounted to `kOriginOther` and every buffer added later follows.
+
+    VerifyOrQuit((message = messagePool->Allocate(Message::kTypeIp6)) != nullptr);
+    VerifyOrQuit(message->GetOrigin() == Message::kOriginOther);
+    VerifyOrQuit(messagePool->GetBufferUsage(Message::kOriginOther).mNumBuffers == 1);
+
+    SuccessOrQuit(message->AppendBytes(writeBuffer, kLength));
+    numBuffers = message->GetBufferCount();
+    VerifyOrQuit(numBuffers > 1);
+    VerifyOrQuit(messagePool->GetBufferUsage(Message::kOriginOther).mNumBuffers == numBuffers);
+
+    SuccessOrQuit(message->PrependBytes(writeBuffer, kBufferSize));
+    VerifyOrQuit(messagePool->GetBufferUsage(Message::kOriginOther).mNumBuffers == message->GetBufferCount());
+
+    // Changing the origin moves all buffers of the message.
+
+    numBuffers = message->GetBufferCount();
+    message->SetOrigin(Message::kOriginCoap);
+    VerifyOrQuit(messagePool->GetBufferUsage(Message::kOriginOther).mNumBuffers == 0);
+    VerifyOrQuit(messagePool->GetBufferUsage(Message::kOriginCoap).mNumBuffers == numBuffers);
+    VerifyOrQuit(messagePool->GetBufferUsage(Message::kOriginCoap).mMaxBuffers == numBuffers);
+
+    // A clone is accounted to the origin of the original message.
+
+    VerifyOrQuit((message2 = message->Clone()) != nullptr);
+    VerifyOrQuit(message2->GetOrigin() == Message::kOriginCoap);
+    VerifyOrQuit(messagePool->GetBufferUsage(Message::kOriginCoap).mNumBuffers ==
+                 message->GetBufferCount() + message2->GetBufferCount());
+
+    // Shrinking and freeing release the buffers, the peak stays until reset.
+
+    SuccessOrQuit(message->SetLength(0));
+    VerifyOrQuit(messagePool->GetBufferUsage(Message::kOriginCoap).mNumBuffers ==
+                 message->GetBufferCount() + message2->GetBufferCount());
+
+    message->Free();
+    message2->Free();
+    VerifyOrQuit(messagePool->GetBufferUsage(Message::kOriginCoap).mNumBuffers == 0);
+    VerifyOrQuit(messagePool->GetBufferUsage(Message::kOriginCoap).mMaxBuffers >= 2 * numBuffers);
+
+    messagePool->ResetMaxBufferUsages();
+    VerifyOrQuit(messagePool->GetBufferUsage(Message::kOriginCoap).mMaxBuffers == 0);
+
+    VerifyOrQuit(StringMatch(Message::OriginToString(Message::kOriginLowpan), "6lo"));
+    VerifyOrQuit(StringMatch(Message::OriginToString(Message::kOriginSrp), "srp"));
+    VerifyOrQuit(StringMatch(otMessageOriginToString(static_cast<otMessageOrigin>(Message::kNumOrigins)), "invalid"));
+    VerifyOrQuit(StringMatch(otMessageOriginToString(static_cast<otMessageOrigin>(0xff)), "invalid"));
+
+    testFreeInstance(instance);
+}
+#endif // OPENTHREAD_CONFIG_MESSAGE_BUFFER_USAGE_ENABLE
+
 } // namespace ot
 
 int main(void)
 {
     ot::TestMessage();
     ot::TestAppender();
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+    ot::TestSharedBuffers();
+#endif
+#if OPENTHREAD_CONFIG_MESSAGE_BUFFER_USAGE_ENABLE
+    ot::TestBufferUsage();
+#endif
     printf("All tests passed\n");
     return 0;
 }
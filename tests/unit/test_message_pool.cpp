@@ -0,0 +1,254 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <openthread/platform/time.h>
+
+#include "test_util.h"
+#include "common/code_utils.hpp"
+#include "posix/platform/message_pool.hpp"
+
+namespace ot {
+namespace Posix {
+
+static constexpr uint16_t kSlabBuffers  = OPENTHREAD_POSIX_CONFIG_MESSAGE_POOL_SLAB_BUFFERS;
+static constexpr uint16_t kMaxBuffers   = OPENTHREAD_POSIX_CONFIG_MESSAGE_POOL_MAX_BUFFERS;
+static constexpr uint64_t kReleaseDelay = OPENTHREAD_POSIX_CONFIG_MESSAGE_POOL_RELEASE_DELAY * 1000ull;
+static constexpr uint16_t kMinBuffers   = kSlabBuffers + 1; // Rounded up to two slabs.
+static constexpr uint16_t kMinCapacity  = 2 * kSlabBuffers;
+static constexpr size_t   kBufferSize   = 64;
+
+static_assert(kMaxBuffers >= 6 * kSlabBuffers, "the test needs at least six slabs");
+
+static uint64_t         sNow = 1;
+static otMessageBuffer *sBuffers[kMaxBuffers];
+
+extern "C" uint64_t otPlatTimeGet(void) { return sNow; }
+
+static uint32_t RoundUpToSlabs(uint32_t aNumBuffers)
+{
+    return (aNumBuffers + kSlabBuffers - 1) / kSlabBuffers * kSlabBuffers;
+}
+
+static void AllocateBuffers(uint16_t aNumBuffers)
+{
+    MessagePool &pool = MessagePool::Get();
+
+    for (uint16_t i = 0; i < aNumBuffers; i++)
+    {
+        sBuffers[i] = pool.New();
+        VerifyOrQuit(sBuffers[i] != nullptr);
+        memset(sBuffers[i], static_cast<int>(i), kBufferSize);
+    }
+
+    for (uint16_t i = 0; i < aNumBuffers; i++)
+    {
+        const uint8_t *bytes = reinterpret_cast<const uint8_t *>(sBuffers[i]);
+
+        for (size_t j = 0; j < kBufferSize; j++)
+        {
+            VerifyOrQuit(bytes[j] == i, "buffers overlap");
+        }
+    }
+}
+
+static void FreeBuffers(uint16_t aNumBuffers)
+{
+    for (uint16_t i = 0; i < aNumBuffers; i++)
+    {
+        MessagePool::Get().Free(sBuffers[aNumBuffers - 1 - i]);
+    }
+}
+
+// Allocates and frees a buffer so that the pool gets a chance to release idle slabs.
+static void Touch(void) { MessagePool::Get().Free(MessagePool::Get().New()); }
+
+void TestGrowAndCeiling(void)
+{
+    MessagePool &pool = MessagePool::Get();
+
+    printf("TestGrowAndCeiling");
+
+    pool.Init(kMinBuffers, kBufferSize);
+    VerifyOrQuit(pool.GetAllocatedBufferCount() == kMinCapacity);
+
+    // The free count includes the slabs not yet allocated.
+    VerifyOrQuit(pool.GetFreeBufferCount() == kMaxBuffers);
+
+    for (uint16_t i = 0; i < kMaxBuffers; i++)
+    {
+        sBuffers[i] = pool.New();
+        VerifyOrQuit(sBuffers[i] != nullptr);
+        VerifyOrQuit(pool.GetAllocatedBufferCount() == OT_MAX(kMinCapacity, RoundUpToSlabs(i + 1u)));
+        VerifyOrQuit(pool.GetFreeBufferCount() == kMaxBuffers - i - 1);
+    }
+
+    VerifyOrQuit(pool.New() == nullptr);
+    VerifyOrQuit(pool.GetFreeBufferCount() == 0);
+
+    FreeBuffers(kMaxBuffers);
+    AllocateBuffers(kMaxBuffers);
+    FreeBuffers(kMaxBuffers);
+
+    // Unused slabs are kept until they have been idle long enough.
+    VerifyOrQuit(pool.GetAllocatedBufferCount() == kMaxBuffers);
+    VerifyOrQuit(pool.GetFreeBufferCount() == kMaxBuffers);
+
+    sNow += kReleaseDelay;
+    Touch();
+    VerifyOrQuit(pool.GetAllocatedBufferCount() == kMinCapacity);
+    VerifyOrQuit(pool.GetFreeBufferCount() == kMaxBuffers);
+
+    printf(" -- PASS\n");
+}
+
+void TestIdleRelease(void)
+{
+    MessagePool &pool = MessagePool::Get();
+
+    printf("TestIdleRelease");
+
+    AllocateBuffers(kMaxBuffers);
+    FreeBuffers(kMaxBuffers);
+    VerifyOrQuit(pool.GetAllocatedBufferCount() == kMaxBuffers);
+
+    sNow += kReleaseDelay - 1;
+    Touch();
+    VerifyOrQuit(pool.GetAllocatedBufferCount() == kMaxBuffers);
+
+    // Use three slabs again, the others stay idle.
+    AllocateBuffers(3 * kSlabBuffers);
+    FreeBuffers(3 * kSlabBuffers);
+
+    // Only the slabs idle for the whole delay are released.
+    sNow += 1;
+    Touch();
+    VerifyOrQuit(pool.GetAllocatedBufferCount() == 3 * kSlabBuffers);
+
+    sNow += kReleaseDelay - 2;
+    Touch();
+    VerifyOrQuit(pool.GetAllocatedBufferCount() == 3 * kSlabBuffers);
+
+    sNow += 1;
+    Touch();
+    VerifyOrQuit(pool.GetAllocatedBufferCount() == kMinCapacity);
+
+    // The minimum is kept however long the pool is unused.
+    sNow += 100 * kReleaseDelay;
+    Touch();
+    VerifyOrQuit(pool.GetAllocatedBufferCount() == kMinCapacity);
+
+    printf(" -- PASS\n");
+}
+
+void TestHysteresis(void)
+{
+    MessagePool     &pool = MessagePool::Get();
+    otMessageBuffer *extra;
+
+    printf("TestHysteresis");
+
+    // A load hovering around a slab boundary reuses the same slab.
+    AllocateBuffers(kMinCapacity);
+    extra = pool.New();
+    VerifyOrQuit(extra != nullptr);
+    VerifyOrQuit(pool.GetAllocatedBufferCount() == kMinCapacity + kSlabBuffers);
+
+    for (uint16_t i = 0; i < 100; i++)
+    {
+        pool.Free(extra);
+        VerifyOrQuit(pool.GetAllocatedBufferCount() == kMinCapacity + kSlabBuffers);
+
+        sNow += kReleaseDelay / 2;
+        VerifyOrQuit(pool.New() == extra);
+        VerifyOrQuit(pool.GetAllocatedBufferCount() == kMinCapacity + kSlabBuffers);
+    }
+
+    pool.Free(extra);
+    FreeBuffers(kMinCapacity);
+
+    sNow += kReleaseDelay;
+    Touch();
+    VerifyOrQuit(pool.GetAllocatedBufferCount() == kMinCapacity);
+
+    printf(" -- PASS\n");
+}
+
+void TestSetMaxBuffers(void)
+{
+    MessagePool &pool = MessagePool::Get();
+
+    printf("TestSetMaxBuffers");
+
+    // Unused slabs beyond a lowered ceiling are released right away.
+    AllocateBuffers(kMaxBuffers);
+    FreeBuffers(kMaxBuffers);
+    pool.SetMaxBuffers(kMinCapacity);
+    VerifyOrQuit(pool.GetAllocatedBufferCount() == kMinCapacity);
+    VerifyOrQuit(pool.GetFreeBufferCount() == kMinCapacity);
+
+    // Slabs in use are released as soon as they become unused.
+    pool.SetMaxBuffers(kMaxBuffers);
+    AllocateBuffers(kMaxBuffers);
+    pool.SetMaxBuffers(kMinCapacity);
+    VerifyOrQuit(pool.GetAllocatedBufferCount() == kMaxBuffers);
+    VerifyOrQuit(pool.GetFreeBufferCount() == 0);
+    FreeBuffers(kMaxBuffers);
+    VerifyOrQuit(pool.GetAllocatedBufferCount() == kMinCapacity);
+
+    AllocateBuffers(kMinCapacity);
+    VerifyOrQuit(pool.New() == nullptr);
+    FreeBuffers(kMinCapacity);
+
+    // The ceiling is rounded down to whole slabs and never below the minimum.
+    pool.SetMaxBuffers(kMinCapacity + kSlabBuffers - 1);
+    VerifyOrQuit(pool.GetFreeBufferCount() == kMinCapacity);
+    pool.SetMaxBuffers(1);
+    VerifyOrQuit(pool.GetFreeBufferCount() == kMinCapacity);
+
+    pool.SetMaxBuffers(kMaxBuffers);
+    VerifyOrQuit(pool.GetFreeBufferCount() == kMaxBuffers);
+
+    printf(" -- PASS\n");
+}
+
+} // namespace Posix
+} // namespace ot
+
+int main(void)
+{
+    ot::Posix::TestGrowAndCeiling();
+    ot::Posix::TestIdleRelease();
+    ot::Posix::TestHysteresis();
+    ot::Posix::TestSetMaxBuffers();
+
+    printf("\nAll tests passed.\n");
+    return 0;
+}
@@ -46,6 +46,38 @@ namespace BorderRouter {
 
 static ot::Instance *sInstance;
 
+static uint32_t sNow = 0;
+static uint32_t sAlarmTime;
+static bool     sAlarmOn = false;
+
+extern "C" {
+
+void otPlatAlarmMilliStop(otInstance *) { sAlarmOn = false; }
+
+void otPlatAlarmMilliStartAt(otInstance *, uint32_t aT0, uint32_t aDt)
+{
+    sAlarmOn   = true;
+    sAlarmTime = aT0 + aDt;
+}
+
+uint32_t otPlatAlarmMilliGetNow(void) { return sNow; }
+
+} // extern "C"
+
+void AdvanceTime(uint32_t aDuration)
+{
+    uint32_t time = sNow + aDuration;
+
+    while (sAlarmOn && TimeMilli(sAlarmTime) <= TimeMilli(time))
+    {
+        sNow     = sAlarmTime;
+        sAlarmOn = false;
+        otPlatAlarmMilliFired(sInstance);
+    }
+
+    sNow = time;
+}
+
 void DumpMessageInHex(const char *prefix, const uint8_t *aBuf, size_t aBufLen)
 {
     // This function dumps all packets the output of this function can be imported to packet analyser for debugging.
@@ -141,6 +173,7 @@ void TestCase4To6(const char *aTestName,
     printf("  ... PASS\n");
 }
 
+#if !OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
 void TestNat64(void)
 {
     Ip6::Prefix  nat64prefix;
@@ -296,6 +329,434 @@ void TestNat64(void)
 
     testFreeInstance(sInstance);
 }
+#endif // !OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+
+uint16_t GetNumMappings(uint8_t &aLastIp6Byte)
+{
+    Nat64::Translator::AddressMappingIterator iterator;
+    otNat64AddressMapping                     mapping;
+    uint16_t                                  numMappings = 0;
+
+    sInstance->Get<Nat64::Translator>().InitAddressMappingIterator(iterator);
+
+    while (sInstance->Get<Nat64::Translator>().GetNextAddressMapping(iterator, mapping) == kErrorNone)
+    {
+        aLastIp6Byte = mapping.mIp6.mFields.m8[15];
+        numMappings++;
+    }
+
+    return numMappings;
+}
+
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+void TestNat64PortTranslation(void)
+{
+    Ip6::Prefix                               nat64prefix;
+    Ip4::Cidr                                 nat64cidr;
+    Nat64::Translator::AddressMappingIterator iterator;
+    otNat64AddressMapping                     mapping;
+    uint16_t                                  numMappings = 0;
+
+    sInstance = testInitInstance();
+
+    {
+        const uint8_t ip6Address[] = {0xfd, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                                      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+        const uint8_t ip4Address[] = {192, 168, 123, 1};
+
+        nat64cidr.Set(ip4Address, 32);
+        nat64prefix.Set(ip6Address, 96);
+        SuccessOrQuit(sInstance->Get<Nat64::Translator>().SetIp4Cidr(nat64cidr));
+        sInstance->Get<Nat64::Translator>().SetNat64Prefix(nat64prefix);
+    }
+
+    // Hosts share the single IPv4 address. A host keeps its port (or ICMP echo identifier) unless it is used by
+    // another host, in which case it is translated to a port from the dynamic range.
+
+    {
+        // fd02::1               fd01::ac10:f3c5       UDP      52     43981 → 4660 Len=4
+        const uint8_t kIp6Packet[] = {
+            0x60, 0x08, 0x6e, 0x38, 0x00, 0x0c, 0x11, 0x40, 0xfd, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfd, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            172,  16,   243,  197,  0xab, 0xcd, 0x12, 0x34, 0x00, 0x0c, 0xe3, 0x31, 0x61, 0x62, 0x63, 0x64,
+        };
+        // 192.168.123.1         172.16.243.197        UDP      32     43981 → 4660 Len=4
+        const uint8_t kIp4Packet[] = {0x45, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x40, 0x11, 0x9f,
+                                      0x4d, 192,  168,  123,  1,    172,  16,   243,  197,  0xab, 0xcd,
+                                      0x12, 0x34, 0x00, 0x0c, 0xa1, 0x8d, 0x61, 0x62, 0x63, 0x64};
+
+        TestCase6To4("v6 udp datagram keeps port", kIp6Packet, Nat64::Translator::kForward, kIp4Packet,
+                     sizeof(kIp4Packet));
+    }
+
+    {
+        // fd02::2               fd01::ac10:f3c5       UDP      52     43981 → 4660 Len=4
+        const uint8_t kIp6Packet[] = {
+            0x60, 0x08, 0x6e, 0x38, 0x00, 0x0c, 0x11, 0x40, 0xfd, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xfd, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            172,  16,   243,  197,  0xab, 0xcd, 0x12, 0x34, 0x00, 0x0c, 0xe3, 0x30, 0x61, 0x62, 0x63, 0x64,
+        };
+        // 192.168.123.1         172.16.243.197        UDP      32     49152 → 4660 Len=4
+        const uint8_t kIp4Packet[] = {
+            0x45, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x40, 0x11, 0x9f,
+            0x4d, 192,  168,  123,  1,    172,  16,   243,  197,  0xc0, 0x00,
+            0x12, 0x34, 0x00, 0x0c, 0x8d, 0x5a, 0x61, 0x62, 0x63, 0x64,
+        };
+
+        TestCase6To4("v6 udp datagram with port in use", kIp6Packet, Nat64::Translator::kForward, kIp4Packet,
+                     sizeof(kIp4Packet));
+    }
+
+    {
+        // 172.16.243.197        192.168.123.1         UDP      32     4660 → 49152 Len=4
+        const uint8_t kIp4Packet[] = {
+            0x45, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x11, 0xa0,
+            0x4d, 172,  16,   243,  197,  192,  168,  123,  1,    0x12, 0x34,
+            0xc0, 0x00, 0x00, 0x0c, 0x8d, 0x5a, 0x61, 0x62, 0x63, 0x64,
+        };
+        // fd01::ac10:f3c5       fd02::2               UDP      52     4660 → 43981 Len=4
+        const uint8_t kIp6Packet[] = {
+            0x60, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x11, 0x3f, 0xfd, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 172,  16,   243,  197,  0xfd, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x02, 0x12, 0x34, 0xab, 0xcd, 0x00, 0x0c, 0xe3, 0x30, 0x61, 0x62, 0x63, 0x64,
+        };
+
+        TestCase4To6("v4 udp datagram to translated port", kIp4Packet, Nat64::Translator::kForward, kIp6Packet,
+                     sizeof(kIp6Packet));
+    }
+
+    {
+        // 172.16.243.197        192.168.123.1         UDP      32     4660 → 43981 Len=4
+        const uint8_t kIp4Packet[] = {
+            0x45, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x11, 0xa0,
+            0x4d, 172,  16,   243,  197,  192,  168,  123,  1,    0x12, 0x34,
+            0xab, 0xcd, 0x00, 0x0c, 0xa1, 0x8d, 0x61, 0x62, 0x63, 0x64,
+        };
+        // fd01::ac10:f3c5       fd02::1               UDP      52     4660 → 43981 Len=4
+        const uint8_t kIp6Packet[] = {
+            0x60, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x11, 0x3f, 0xfd, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 172,  16,   243,  197,  0xfd, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x01, 0x12, 0x34, 0xab, 0xcd, 0x00, 0x0c, 0xe3, 0x31, 0x61, 0x62, 0x63, 0x64,
+        };
+
+        TestCase4To6("v4 udp datagram to kept port", kIp4Packet, Nat64::Translator::kForward, kIp6Packet,
+                     sizeof(kIp6Packet));
+    }
+
+    {
+        // 172.16.243.197        192.168.123.1         UDP      32     43981 → 4660 Len=4
+        const uint8_t kIp4Packet[] = {0x45, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x11, 0xa0,
+                                      0x4d, 172,  16,   243,  197,  192,  168,  123,  1,    0xab, 0xcd,
+                                      0x12, 0x34, 0x00, 0x0c, 0xa1, 0x8d, 0x61, 0x62, 0x63, 0x64};
+
+        TestCase4To6("v4 udp datagram to unmapped port", kIp4Packet, Nat64::Translator::kDrop, nullptr, 0);
+    }
+
+    {
+        // fd02::1               fd01::ac10:f3c5       TCP      64     43981 → 4660 [ACK] Seq=1 Ack=1 Win=1 Len=4
+        const uint8_t kIp6Packet[] = {
+            0x60, 0x08, 0x6e, 0x38, 0x00, 0x18, 0x06, 0x40, 0xfd, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfd, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 172,  16,   243,  197,  0xab, 0xcd, 0x12, 0x34, 0x87, 0x65, 0x43, 0x21,
+            0x12, 0x34, 0x56, 0x78, 0x50, 0x10, 0x00, 0x01, 0x5f, 0xf8, 0x00, 0x00, 0x61, 0x62, 0x63, 0x64,
+        };
+        // 192.168.123.1         172.16.243.197        TCP      44     43981 → 4660 [ACK] Seq=1 Ack=1 Win=1 Len=4
+        const uint8_t kIp4Packet[] = {0x45, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x06, 0x9f,
+                                      0x4c, 192,  168,  123,  1,    172,  16,   243,  197,  0xab, 0xcd,
+                                      0x12, 0x34, 0x87, 0x65, 0x43, 0x21, 0x12, 0x34, 0x56, 0x78, 0x50,
+                                      0x10, 0x00, 0x01, 0x1e, 0x54, 0x00, 0x00, 0x61, 0x62, 0x63, 0x64};
+
+        TestCase6To4("v6 tcp datagram keeps port", kIp6Packet, Nat64::Translator::kForward, kIp4Packet,
+                     sizeof(kIp4Packet));
+    }
+
+    {
+        // fd02::2               fd01::ac10:f3c5       TCP      64     43981 → 4660 [ACK] Seq=1 Ack=1 Win=1 Len=4
+        const uint8_t kIp6Packet[] = {
+            0x60, 0x08, 0x6e, 0x38, 0x00, 0x18, 0x06, 0x40, 0xfd, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xfd, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 172,  16,   243,  197,  0xab, 0xcd, 0x12, 0x34, 0x87, 0x65, 0x43, 0x21,
+            0x12, 0x34, 0x56, 0x78, 0x50, 0x10, 0x00, 0x01, 0x5f, 0xf7, 0x00, 0x00, 0x61, 0x62, 0x63, 0x64,
+        };
+        // 192.168.123.1         172.16.243.197        TCP      44     49153 → 4660 [ACK] Seq=1 Ack=1 Win=1 Len=4
+        const uint8_t kIp4Packet[] = {
+            0x45, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x06, 0x9f,
+            0x4c, 192,  168,  123,  1,    172,  16,   243,  197,  0xc0, 0x01,
+            0x12, 0x34, 0x87, 0x65, 0x43, 0x21, 0x12, 0x34, 0x56, 0x78, 0x50,
+            0x10, 0x00, 0x01, 0x0a, 0x20, 0x00, 0x00, 0x61, 0x62, 0x63, 0x64,
+        };
+
+        TestCase6To4("v6 tcp datagram with port in use", kIp6Packet, Nat64::Translator::kForward, kIp4Packet,
+                     sizeof(kIp4Packet));
+    }
+
+    {
+        // 172.16.243.197        192.168.123.1         TCP      44     4660 → 49153 [ACK] Seq=1 Ack=1 Win=1 Len=4
+        const uint8_t kIp4Packet[] = {
+            0x45, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x06, 0xa0,
+            0x4c, 172,  16,   243,  197,  192,  168,  123,  1,    0x12, 0x34,
+            0xc0, 0x01, 0x87, 0x65, 0x43, 0x21, 0x12, 0x34, 0x56, 0x78, 0x50,
+            0x10, 0x00, 0x01, 0x0a, 0x20, 0x00, 0x00, 0x61, 0x62, 0x63, 0x64,
+        };
+        // fd01::ac10:f3c5       fd02::2               TCP      64     4660 → 43981 [ACK] Seq=1 Ack=1 Win=1 Len=4
+        const uint8_t kIp6Packet[] = {
+            0x60, 0x00, 0x00, 0x00, 0x00, 0x18, 0x06, 0x3f, 0xfd, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 172,  16,   243,  197,  0xfd, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 0x34, 0xab, 0xcd, 0x87, 0x65, 0x43, 0x21,
+            0x12, 0x34, 0x56, 0x78, 0x50, 0x10, 0x00, 0x01, 0x5f, 0xf7, 0x00, 0x00, 0x61, 0x62, 0x63, 0x64,
+        };
+
+        TestCase4To6("v4 tcp datagram to translated port", kIp4Packet, Nat64::Translator::kForward, kIp6Packet,
+                     sizeof(kIp6Packet));
+    }
+
+    {
+        // fd02::1         fd01::ac10:f3c5     ICMPv6   52     Echo (ping) request id=0xaabb, seq=1, hop limit=64
+        const uint8_t kIp6Packet[] = {
+            0x60, 0x08, 0x6e, 0x38, 0x00, 0x0c, 0x3a, 0x40, 0xfd, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfd, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            172,  16,   243,  197,  0x80, 0x00, 0x76, 0x59, 0xaa, 0xbb, 0x00, 0x01, 0x61, 0x62, 0x63, 0x64,
+        };
+        // 192.168.123.1   172.16.243.197      ICMP     32     Echo (ping) request  id=0xaabb, seq=1/256, ttl=63
+        const uint8_t kIp4Packet[] = {0x45, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0x9f,
+                                      0x5d, 192,  168,  123,  1,    172,  16,   243,  197,  0x08, 0x00,
+                                      0x88, 0x7c, 0xaa, 0xbb, 0x00, 0x01, 0x61, 0x62, 0x63, 0x64};
+
+        TestCase6To4("v6 icmp ping request keeps id", kIp6Packet, Nat64::Translator::kForward, kIp4Packet,
+                     sizeof(kIp4Packet));
+    }
+
+    {
+        // fd02::2         fd01::ac10:f3c5     ICMPv6   52     Echo (ping) request id=0xaabb, seq=1, hop limit=64
+        const uint8_t kIp6Packet[] = {
+            0x60, 0x08, 0x6e, 0x38, 0x00, 0x0c, 0x3a, 0x40, 0xfd, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xfd, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            172,  16,   243,  197,  0x80, 0x00, 0x76, 0x58, 0xaa, 0xbb, 0x00, 0x01, 0x61, 0x62, 0x63, 0x64,
+        };
+        // 192.168.123.1   172.16.243.197      ICMP     32     Echo (ping) request  id=0xc002, seq=1/256, ttl=64
+        const uint8_t kIp4Packet[] = {
+            0x45, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0x9f,
+            0x5d, 192,  168,  123,  1,    172,  16,   243,  197,  0x08, 0x00,
+            0x73, 0x35, 0xc0, 0x02, 0x00, 0x01, 0x61, 0x62, 0x63, 0x64,
+        };
+
+        TestCase6To4("v6 icmp ping request with id in use", kIp6Packet, Nat64::Translator::kForward, kIp4Packet,
+                     sizeof(kIp4Packet));
+    }
+
+    {
+        // 172.16.243.197        192.168.123.1         ICMP     32     Echo (ping) reply    id=0xc002, seq=1/256, ttl=63
+        const uint8_t kIp4Packet[] = {
+            0x45, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x01, 0xa0,
+            0x5d, 172,  16,   243,  197,  192,  168,  123,  1,    0x00, 0x00,
+            0x7b, 0x35, 0xc0, 0x02, 0x00, 0x01, 0x61, 0x62, 0x63, 0x64,
+        };
+        // fd01::ac10:f3c5       fd02::2               ICMPv6   52     Echo (ping) reply id=0xaabb, seq=1, hop limit=63
+        const uint8_t kIp6Packet[] = {
+            0x60, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x3a, 0x3f, 0xfd, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 172,  16,   243,  197,  0xfd, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x02, 0x81, 0x00, 0x75, 0x58, 0xaa, 0xbb, 0x00, 0x01, 0x61, 0x62, 0x63, 0x64,
+        };
+
+        TestCase4To6("v4 icmp ping response to translated id", kIp4Packet, Nat64::Translator::kForward, kIp6Packet,
+                     sizeof(kIp6Packet));
+    }
+
+    // Each host has its own mapping for each protocol, and the mappings of fd02::2 use translated ports.
+
+    sInstance->Get<Nat64::Translator>().InitAddressMappingIterator(iterator);
+
+    while (sInstance->Get<Nat64::Translator>().GetNextAddressMapping(iterator, mapping) == kErrorNone)
+    {
+        numMappings++;
+
+        if (mapping.mIp6.mFields.m8[15] == 2)
+        {
+            VerifyOrQuit(mapping.mIp4Port >= 0xc000 && mapping.mIp4Port <= 0xc002);
+            VerifyOrQuit(mapping.mIp6Port == 0xabcd || mapping.mIp6Port == 0xaabb);
+        }
+        else
+        {
+            VerifyOrQuit(mapping.mIp4Port == mapping.mIp6Port);
+        }
+    }
+
+    VerifyOrQuit(numMappings == 6);
+
+    testFreeInstance(sInstance);
+}
+
+bool HasMappingForIp6Port(uint16_t aPort)
+{
+    Nat64::Translator::AddressMappingIterator iterator;
+    otNat64AddressMapping                     mapping;
+    bool                                      found = false;
+
+    sInstance->Get<Nat64::Translator>().InitAddressMappingIterator(iterator);
+
+    while (sInstance->Get<Nat64::Translator>().GetNextAddressMapping(iterator, mapping) == kErrorNone)
+    {
+        found |= (mapping.mIp6Port == aPort);
+    }
+
+    return found;
+}
+
+Nat64::Translator::Result TranslateUdpFromPort(uint16_t aPort)
+{
+    // fd02::1               fd01::ac10:f3c5       UDP      52     aPort → 4660 Len=4
+    const uint8_t kIp6Packet[] = {
+        0x60, 0x08, 0x6e, 0x38, 0x00, 0x0c, 0x11, 0x40, 0xfd, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfd, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        172,  16,   243,  197,  0xab, 0xcd, 0x12, 0x34, 0x00, 0x0c, 0xe3, 0x31, 0x61, 0x62, 0x63, 0x64,
+    };
+    static constexpr uint16_t kSourcePortOffset = sizeof(Ip6::Header);
+
+    Message                  *msg = sInstance->Get<Ip6::Ip6>().NewMessage(0);
+    Nat64::Translator::Result result;
+
+    VerifyOrQuit(msg != nullptr);
+    SuccessOrQuit(msg->AppendBytes(kIp6Packet, sizeof(kIp6Packet)));
+    msg->Write(kSourcePortOffset, Encoding::BigEndian::HostSwap16(aPort));
+
+    result = sInstance->Get<Nat64::Translator>().TranslateFromIp6(*msg);
+    msg->Free();
+
+    return result;
+}
+
+void TestNat64PortTranslationPoolFull(void)
+{
+    static constexpr uint16_t kPoolSize  = Nat64::Translator::kAddressMappingPoolSize;
+    static constexpr uint16_t kFirstPort = 1000;
+
+    Ip6::Prefix nat64prefix;
+    Ip4::Cidr   nat64cidr;
+    uint8_t     lastIp6Byte;
+
+    sNow      = 0;
+    sAlarmOn  = false;
+    sInstance = testInitInstance();
+
+    {
+        const uint8_t ip6Address[] = {0xfd, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                                      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+        const uint8_t ip4Address[] = {192, 168, 123, 1};
+
+        nat64cidr.Set(ip4Address, 32);
+        nat64prefix.Set(ip6Address, 96);
+        SuccessOrQuit(sInstance->Get<Nat64::Translator>().SetIp4Cidr(nat64cidr));
+        sInstance->Get<Nat64::Translator>().SetNat64Prefix(nat64prefix);
+    }
+
+    {
+        // fd02::1         fd01::ac10:f3c5     ICMPv6   52     Destination Unreachable (Port unreachable)
+        const uint8_t kIp6Packet[] = {
+            0x60, 0x08, 0x6e, 0x38, 0x00, 0x0c, 0x3a, 0x40, 0xfd, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfd, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            172,  16,   243,  197,  0x01, 0x04, 0x00, 0x00, 0xaa, 0xbb, 0x00, 0x01, 0x61, 0x62, 0x63, 0x64,
+        };
+
+        // Unsupported ICMPv6 messages must not take a mapping.
+        TestCase6To4("v6 icmp unsupported type", kIp6Packet, Nat64::Translator::kDrop, nullptr, 0);
+        VerifyOrQuit(GetNumMappings(lastIp6Byte) == 0);
+    }
+
+    // Fill the mapping pool with flows from different ports.
+
+    for (uint16_t i = 0; i < kPoolSize; i++)
+    {
+        AdvanceTime(1);
+        VerifyOrQuit(TranslateUdpFromPort(kFirstPort + i) == Nat64::Translator::kForward);
+    }
+
+    VerifyOrQuit(GetNumMappings(lastIp6Byte) == kPoolSize);
+
+    // Using the first flow again makes the second one the least recently used.
+
+    AdvanceTime(1);
+    VerifyOrQuit(TranslateUdpFromPort(kFirstPort) == Nat64::Translator::kForward);
+    VerifyOrQuit(GetNumMappings(lastIp6Byte) == kPoolSize);
+
+    // New flows are still translated while no mapping has expired, evicting the least recently used ones.
+
+    for (uint16_t i = 0; i < 2; i++)
+    {
+        AdvanceTime(1);
+        VerifyOrQuit(TranslateUdpFromPort(kFirstPort + kPoolSize + i) == Nat64::Translator::kForward);
+        VerifyOrQuit(GetNumMappings(lastIp6Byte) == kPoolSize);
+        VerifyOrQuit(HasMappingForIp6Port(kFirstPort + kPoolSize + i));
+    }
+
+    VerifyOrQuit(HasMappingForIp6Port(kFirstPort));
+    VerifyOrQuit(!HasMappingForIp6Port(kFirstPort + 1));
+    VerifyOrQuit(!HasMappingForIp6Port(kFirstPort + 2));
+    VerifyOrQuit(HasMappingForIp6Port(kFirstPort + 3));
+
+    testFreeInstance(sInstance);
+}
+#endif // OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+
+void TestNat64MappingExpiry(void)
+{
+    static constexpr uint32_t kIdleTimeout = Nat64::Translator::kAddressMappingIdleTimeoutMsec;
+
+    Ip6::Prefix nat64prefix;
+    Ip4::Cidr   nat64cidr;
+    uint8_t     lastIp6Byte;
+
+    // fd02::1               fd01::ac10:f3c5       UDP      52     43981 → 4660 Len=4
+    const uint8_t kIp6Packet1[] = {
+        0x60, 0x08, 0x6e, 0x38, 0x00, 0x0c, 0x11, 0x40, 0xfd, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfd, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        172,  16,   243,  197,  0xab, 0xcd, 0x12, 0x34, 0x00, 0x0c, 0xe3, 0x31, 0x61, 0x62, 0x63, 0x64,
+    };
+    // fd02::2               fd01::ac10:f3c5       UDP      52     43981 → 4660 Len=4
+    const uint8_t kIp6Packet2[] = {
+        0x60, 0x08, 0x6e, 0x38, 0x00, 0x0c, 0x11, 0x40, 0xfd, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xfd, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        172,  16,   243,  197,  0xab, 0xcd, 0x12, 0x34, 0x00, 0x0c, 0xe3, 0x30, 0x61, 0x62, 0x63, 0x64,
+    };
+
+    sNow      = 0;
+    sAlarmOn  = false;
+    sInstance = testInitInstance();
+
+    {
+        const uint8_t ip6Address[] = {0xfd, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                                      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+        const uint8_t ip4Address[] = {192, 168, 123, 0};
+
+        nat64cidr.Set(ip4Address, 24);
+        nat64prefix.Set(ip6Address, 96);
+        SuccessOrQuit(sInstance->Get<Nat64::Translator>().SetIp4Cidr(nat64cidr));
+        sInstance->Get<Nat64::Translator>().SetNat64Prefix(nat64prefix);
+    }
+
+    TestCase6To4("create mapping for fd02::1", kIp6Packet1, Nat64::Translator::kForward, nullptr, 0);
+    VerifyOrQuit(GetNumMappings(lastIp6Byte) == 1);
+
+    AdvanceTime(kIdleTimeout / 2);
+    TestCase6To4("create mapping for fd02::2", kIp6Packet2, Nat64::Translator::kForward, nullptr, 0);
+    VerifyOrQuit(GetNumMappings(lastIp6Byte) == 2);
+
+    // Sending from fd02::1 again restarts its idle timeout, so it now expires after fd02::2.
+
+    AdvanceTime(kIdleTimeout / 4);
+    TestCase6To4("refresh mapping for fd02::1", kIp6Packet1, Nat64::Translator::kForward, nullptr, 0);
+
+    AdvanceTime(kIdleTimeout / 4 + 1);
+    VerifyOrQuit(GetNumMappings(lastIp6Byte) == 2);
+
+    AdvanceTime(kIdleTimeout / 2 - 1);
+    VerifyOrQuit(GetNumMappings(lastIp6Byte) == 1);
+    VerifyOrQuit(lastIp6Byte == 1);
+
+    AdvanceTime(kIdleTimeout / 4);
+    VerifyOrQuit(GetNumMappings(lastIp6Byte) == 0);
+
+    testFreeInstance(sInstance);
+}
 
 } // namespace BorderRouter
 } // namespace ot
@@ -305,7 +766,13 @@ void TestNat64(void)
 int main(void)
 {
 #if OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    ot::BorderRouter::TestNat64PortTranslation();
+    ot::BorderRouter::TestNat64PortTranslationPoolFull();
+#else
     ot::BorderRouter::TestNat64();
+#endif
+    ot::BorderRouter::TestNat64MappingExpiry();
     printf("All tests passed\n");
 #else  // OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
     printf("NAT64 is not enabled\n");
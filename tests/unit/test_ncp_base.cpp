@@ -0,0 +1,327 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <string.h>
+
+#include <openthread/link.h>
+
+#include "test_util.hpp"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "lib/spinel/spinel.h"
+#include "ncp/ncp_base.hpp"
+
+namespace ot {
+namespace Ncp {
+
+enum
+{
+    kHeader     = SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0 | 1, ///< Header of the commands (tid 1).
+    kMaxEntries = 8,                                            ///< Max number of entries in a `VALUES_ARE`.
+};
+
+static constexpr spinel_prop_key_t kUnknownProp = SPINEL_PROP_VENDOR__BEGIN;
+
+class TestNcp : public NcpBase
+{
+public:
+    explicit TestNcp(Instance *aInstance)
+        : NcpBase(aInstance)
+    {
+        DiscardFrames();
+    }
+
+    void DiscardFrames(void)
+    {
+        while (mTxFrameBuffer.OutFrameBegin() == OT_ERROR_NONE)
+        {
+            SuccessOrQuit(mTxFrameBuffer.OutFrameRemove());
+        }
+    }
+
+    uint16_t ReadFrame(uint8_t *aFrame, uint16_t aMaxLength)
+    {
+        uint16_t length;
+
+        SkipUnsolicitedFrames();
+        SuccessOrQuit(mTxFrameBuffer.OutFrameBegin());
+        length = mTxFrameBuffer.OutFrameGetLength();
+        VerifyOrQuit(length <= aMaxLength);
+        VerifyOrQuit(mTxFrameBuffer.OutFrameRead(length, aFrame) == length);
+        SuccessOrQuit(mTxFrameBuffer.OutFrameRemove());
+
+        return length;
+    }
+
+    bool HasFrame(void)
+    {
+        SkipUnsolicitedFrames();
+        return !mTxFrameBuffer.IsEmpty();
+    }
+
+private:
+    // Removes the unsolicited frames (tid 0), e.g. the reset notification,
+    // from the head of the tx buffer.
+    void SkipUnsolicitedFrames(void)
+    {
+        uint8_t header;
+
+        while ((mTxFrameBuffer.OutFrameBegin() == OT_ERROR_NONE) &&
+               (mTxFrameBuffer.OutFrameRead(sizeof(header), &header) == sizeof(header)) &&
+               (SPINEL_HEADER_GET_TID(header) == 0))
+        {
+            SuccessOrQuit(mTxFrameBuffer.OutFrameRemove());
+        }
+    }
+};
+
+struct ValuesAreEntry
+{
+    spinel_prop_key_t mKey;
+    const uint8_t    *mValue;
+    spinel_size_t     mValueLength;
+};
+
+static uint8_t sFrame[SPINEL_FRAME_MAX_SIZE];
+
+// Reads the `VALUES_ARE` response and returns the number of its entries.
+static uint8_t ReadValuesAre(TestNcp &aNcp, ValuesAreEntry *aEntries)
+{
+    uint16_t       length = aNcp.ReadFrame(sFrame, sizeof(sFrame));
+    const uint8_t *cur    = sFrame;
+    uint8_t        header;
+    unsigned int   command;
+    spinel_ssize_t unpacked;
+    uint8_t        count = 0;
+
+    unpacked = spinel_datatype_unpack(cur, length, "Ci", &header, &command);
+    VerifyOrQuit(unpacked > 0);
+    VerifyOrQuit(header == kHeader);
+    VerifyOrQuit(command == SPINEL_CMD_PROP_VALUES_ARE);
+    cur += unpacked;
+    length -= static_cast<uint16_t>(unpacked);
+
+    while (length > 0)
+    {
+        VerifyOrQuit(count < kMaxEntries);
+        unpacked = spinel_datatype_unpack(cur, length, "t(iD)", &aEntries[count].mKey, &aEntries[count].mValue,
+                                          &aEntries[count].mValueLength);
+        VerifyOrQuit(unpacked > 0);
+        cur += unpacked;
+        length -= static_cast<uint16_t>(unpacked);
+        count++;
+    }
+
+    return count;
+}
+
+static void VerifyStatusEntry(const ValuesAreEntry &aEntry, spinel_status_t aStatus)
+{
+    unsigned int status;
+
+    VerifyOrQuit(aEntry.mKey == SPINEL_PROP_LAST_STATUS);
+    VerifyOrQuit(spinel_datatype_unpack(aEntry.mValue, aEntry.mValueLength, "i", &status) > 0);
+    VerifyOrQuit(status == static_cast<unsigned int>(aStatus));
+}
+
+static void VerifyLastStatus(TestNcp &aNcp, spinel_status_t aStatus)
+{
+    uint16_t          length = aNcp.ReadFrame(sFrame, sizeof(sFrame));
+    uint8_t           header;
+    unsigned int      command;
+    spinel_prop_key_t key;
+    unsigned int      status;
+
+    VerifyOrQuit(spinel_datatype_unpack(sFrame, length, "Ciii", &header, &command, &key, &status) > 0);
+    VerifyOrQuit(header == kHeader);
+    VerifyOrQuit(command == SPINEL_CMD_PROP_VALUE_IS);
+    VerifyOrQuit(key == SPINEL_PROP_LAST_STATUS);
+    VerifyOrQuit(status == static_cast<unsigned int>(aStatus));
+}
+
+void TestMultiGet(void)
+{
+    Instance      *instance = testInitInstance();
+    TestNcp        ncp(instance);
+    ValuesAreEntry entries[kMaxEntries];
+    spinel_ssize_t length;
+    unsigned int   major;
+    unsigned int   minor;
+    unsigned int   channel;
+
+    printf("TestMultiGet");
+
+    SuccessOrQuit(otLinkSetChannel(instance, 15));
+
+    length = spinel_datatype_pack(sFrame, sizeof(sFrame), "Ciiii", kHeader, SPINEL_CMD_PROP_VALUE_MULTI_GET,
+                                  SPINEL_PROP_PROTOCOL_VERSION, kUnknownProp, SPINEL_PROP_PHY_CHAN);
+    VerifyOrQuit(length > 0);
+    ncp.HandleReceive(sFrame, static_cast<uint16_t>(length));
+
+    VerifyOrQuit(ReadValuesAre(ncp, entries) == 3);
+
+    VerifyOrQuit(entries[0].mKey == SPINEL_PROP_PROTOCOL_VERSION);
+    VerifyOrQuit(spinel_datatype_unpack(entries[0].mValue, entries[0].mValueLength, "ii", &major, &minor) > 0);
+    VerifyOrQuit(major == SPINEL_PROTOCOL_VERSION_THREAD_MAJOR && minor == SPINEL_PROTOCOL_VERSION_THREAD_MINOR);
+
+    VerifyStatusEntry(entries[1], SPINEL_STATUS_PROP_NOT_FOUND);
+
+    VerifyOrQuit(entries[2].mKey == SPINEL_PROP_PHY_CHAN);
+    VerifyOrQuit(spinel_datatype_unpack(entries[2].mValue, entries[2].mValueLength, "i", &channel) > 0);
+    VerifyOrQuit(channel == 15);
+
+    VerifyOrQuit(!ncp.HasFrame());
+
+    // A truncated key makes the whole command fail.
+
+    length = spinel_datatype_pack(sFrame, sizeof(sFrame), "Cii", kHeader, SPINEL_CMD_PROP_VALUE_MULTI_GET,
+                                  SPINEL_PROP_PHY_CHAN);
+    VerifyOrQuit(length > 0);
+    sFrame[length++] = 0x80;
+    ncp.HandleReceive(sFrame, static_cast<uint16_t>(length));
+
+    VerifyLastStatus(ncp, SPINEL_STATUS_PARSE_ERROR);
+    VerifyOrQuit(!ncp.HasFrame());
+
+    testFreeInstance(instance);
+
+    printf(" -- PASS\n");
+}
+
+void TestMultiSet(void)
+{
+    Instance      *instance = testInitInstance();
+    TestNcp        ncp(instance);
+    ValuesAreEntry entries[kMaxEntries];
+    spinel_ssize_t length;
+    unsigned int   channel;
+    uint16_t       panId;
+
+    printf("TestMultiSet");
+
+    SuccessOrQuit(otLinkSetChannel(instance, 11));
+
+    length = spinel_datatype_pack(sFrame, sizeof(sFrame), "Cit(ii)t(iS)t(iC)", kHeader,
+                                  SPINEL_CMD_PROP_VALUE_MULTI_SET, SPINEL_PROP_PHY_CHAN, 15, SPINEL_PROP_MAC_15_4_PANID,
+                                  0x1234, kUnknownProp, 1);
+    VerifyOrQuit(length > 0);
+    ncp.HandleReceive(sFrame, static_cast<uint16_t>(length));
+
+    VerifyOrQuit(ReadValuesAre(ncp, entries) == 3);
+
+    VerifyOrQuit(entries[0].mKey == SPINEL_PROP_PHY_CHAN);
+    VerifyOrQuit(spinel_datatype_unpack(entries[0].mValue, entries[0].mValueLength, "i", &channel) > 0);
+    VerifyOrQuit(channel == 15);
+
+    VerifyOrQuit(entries[1].mKey == SPINEL_PROP_MAC_15_4_PANID);
+    VerifyOrQuit(spinel_datatype_unpack(entries[1].mValue, entries[1].mValueLength, "S", &panId) > 0);
+    VerifyOrQuit(panId == 0x1234);
+
+    VerifyStatusEntry(entries[2], SPINEL_STATUS_PROP_NOT_FOUND);
+
+    VerifyOrQuit(otLinkGetChannel(instance) == 15);
+    VerifyOrQuit(otLinkGetPanId(instance) == 0x1234);
+    VerifyOrQuit(!ncp.HasFrame());
+
+    // An invalid value only fails its own property.
+
+    length = spinel_datatype_pack(sFrame, sizeof(sFrame), "Cit(ii)t(iS)", kHeader, SPINEL_CMD_PROP_VALUE_MULTI_SET,
+                                  SPINEL_PROP_PHY_CHAN, 5, SPINEL_PROP_MAC_15_4_PANID, 0x5678);
+    VerifyOrQuit(length > 0);
+    ncp.HandleReceive(sFrame, static_cast<uint16_t>(length));
+
+    VerifyOrQuit(ReadValuesAre(ncp, entries) == 2);
+    VerifyStatusEntry(entries[0], SPINEL_STATUS_INVALID_ARGUMENT);
+    VerifyOrQuit(entries[1].mKey == SPINEL_PROP_MAC_15_4_PANID);
+
+    VerifyOrQuit(otLinkGetChannel(instance) == 15);
+    VerifyOrQuit(otLinkGetPanId(instance) == 0x5678);
+
+    // A property that requires special treatment writes its own
+    // response before the `VALUES_ARE` one.
+
+    length = spinel_datatype_pack(sFrame, sizeof(sFrame), "Cit(iC)t(ii)", kHeader, SPINEL_CMD_PROP_VALUE_MULTI_SET,
+                                  SPINEL_PROP_HOST_POWER_STATE, SPINEL_HOST_POWER_STATE_ONLINE, SPINEL_PROP_PHY_CHAN,
+                                  20);
+    VerifyOrQuit(length > 0);
+    ncp.HandleReceive(sFrame, static_cast<uint16_t>(length));
+
+    {
+        uint16_t          frameLength = ncp.ReadFrame(sFrame, sizeof(sFrame));
+        uint8_t           header;
+        unsigned int      command;
+        spinel_prop_key_t key;
+        uint8_t           powerState;
+
+        VerifyOrQuit(spinel_datatype_unpack(sFrame, frameLength, "CiiC", &header, &command, &key, &powerState) > 0);
+        VerifyOrQuit(header == kHeader);
+        VerifyOrQuit(command == SPINEL_CMD_PROP_VALUE_IS);
+        VerifyOrQuit(key == SPINEL_PROP_HOST_POWER_STATE);
+        VerifyOrQuit(powerState == SPINEL_HOST_POWER_STATE_ONLINE);
+    }
+
+    VerifyOrQuit(ReadValuesAre(ncp, entries) == 2);
+    VerifyOrQuit(entries[0].mKey == SPINEL_PROP_HOST_POWER_STATE);
+    VerifyOrQuit(entries[1].mKey == SPINEL_PROP_PHY_CHAN);
+    VerifyOrQuit(otLinkGetChannel(instance) == 20);
+
+    // A malformed entry makes the whole command fail, without setting
+    // any of the properties before it.
+
+    length = spinel_datatype_pack(sFrame, sizeof(sFrame), "Cit(ii)", kHeader, SPINEL_CMD_PROP_VALUE_MULTI_SET,
+                                  SPINEL_PROP_PHY_CHAN, 25);
+    VerifyOrQuit(length > 0);
+
+    // The length of the next struct is larger than the rest of the frame.
+    sFrame[length++] = 10;
+    sFrame[length++] = 0;
+    sFrame[length++] = SPINEL_PROP_MAC_15_4_PANID;
+    ncp.HandleReceive(sFrame, static_cast<uint16_t>(length));
+
+    VerifyLastStatus(ncp, SPINEL_STATUS_PARSE_ERROR);
+    VerifyOrQuit(!ncp.HasFrame());
+    VerifyOrQuit(otLinkGetChannel(instance) == 20);
+
+    testFreeInstance(instance);
+
+    printf(" -- PASS\n");
+}
+
+} // namespace Ncp
+} // namespace ot
+
+int main(void)
+{
+    ot::Ncp::TestMultiGet();
+    ot::Ncp::TestMultiSet();
+
+    printf("\nAll tests passed.\n");
+    return 0;
+}
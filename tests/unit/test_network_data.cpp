@@ -922,6 +922,326 @@ void TestNetworkDataDsnSrpAnycastSeqNumSelection(void)
     testFreeInstance(instance);
 }
 
+void TestNetworkDataRouteLookup(void)
+{
+    // Verifies that the route, context and on-mesh lookups (which
+    // use the prefix table compiled when the Network Data changes)
+    // match a linear scan of the Network Data TLVs.
+
+    class TestLeader : public Leader
+    {
+    public:
+        void Populate(const uint8_t *aTlvs, uint8_t aTlvsLength)
+        {
+            memcpy(GetBytes(), aTlvs, aTlvsLength);
+            SetLength(aTlvsLength);
+            SignalNetDataChanged();
+        }
+
+        int Compare(int8_t aFirstPreference, uint16_t aFirstRloc, int8_t aSecondPreference, uint16_t aSecondRloc)
+        {
+            int result = ThreeWayCompare(aFirstPreference, aSecondPreference);
+
+            VerifyOrExit(result == 0);
+            result = ThreeWayCompare(GetInstance().Get<RouterTable>().GetPathCost(aSecondRloc),
+                                     GetInstance().Get<RouterTable>().GetPathCost(aFirstRloc));
+            VerifyOrExit(result == 0);
+            result = ThreeWayCompare(Mle::IsActiveRouter(aFirstRloc), Mle::IsActiveRouter(aSecondRloc));
+
+        exit:
+            return result;
+        }
+
+        Error ScanRouteLookup(const Ip6::Address &aSource, const Ip6::Address &aDestination, uint16_t &aRloc16)
+        {
+            Error            error = kErrorNoRoute;
+            TlvIterator      tlvIterator(GetTlvsStart(), GetTlvsEnd());
+            const PrefixTlv *prefixTlv;
+
+            while ((prefixTlv = tlvIterator.Iterate<PrefixTlv>()) != nullptr)
+            {
+                if (!Matches(*prefixTlv, aSource))
+                {
+                    continue;
+                }
+
+                if (ScanExternalRouteLookup(prefixTlv->GetDomainId(), aDestination, aRloc16) == kErrorNone)
+                {
+                    ExitNow(error = kErrorNone);
+                }
+
+                if (ScanDefaultRouteLookup(*prefixTlv, aRloc16) == kErrorNone)
+                {
+                    ExitNow(error = kErrorNone);
+                }
+            }
+
+        exit:
+            return error;
+        }
+
+        Error ScanGetContext(const Ip6::Address &aAddress, Lowpan::Context &aContext)
+        {
+            TlvIterator      tlvIterator(GetTlvsStart(), GetTlvsEnd());
+            const PrefixTlv *prefixTlv;
+
+            aContext.mPrefix.SetLength(0);
+
+            while ((prefixTlv = tlvIterator.Iterate<PrefixTlv>()) != nullptr)
+            {
+                const ContextTlv *contextTlv = prefixTlv->FindSubTlv<ContextTlv>();
+
+                if (!Matches(*prefixTlv, aAddress) || (contextTlv == nullptr))
+                {
+                    continue;
+                }
+
+                if (prefixTlv->GetPrefixLength() > aContext.mPrefix.GetLength())
+                {
+                    prefixTlv->CopyPrefixTo(aContext.mPrefix);
+                    aContext.mContextId    = contextTlv->GetContextId();
+                    aContext.mCompressFlag = contextTlv->IsCompress();
+                }
+            }
+
+            return (aContext.mPrefix.GetLength() > 0) ? kErrorNone : kErrorNotFound;
+        }
+
+        bool ScanIsOnMesh(const Ip6::Address &aAddress)
+        {
+            TlvIterator      tlvIterator(GetTlvsStart(), GetTlvsEnd());
+            const PrefixTlv *prefixTlv;
+
+            while ((prefixTlv = tlvIterator.Iterate<PrefixTlv>()) != nullptr)
+            {
+                TlvIterator            subTlvIterator(*prefixTlv);
+                const BorderRouterTlv *brTlv;
+
+                if (!Matches(*prefixTlv, aAddress))
+                {
+                    continue;
+                }
+
+                while ((brTlv = subTlvIterator.Iterate<BorderRouterTlv>()) != nullptr)
+                {
+                    for (const BorderRouterEntry *entry = brTlv->GetFirstEntry(); entry <= brTlv->GetLastEntry();
+                         entry                          = entry->GetNext())
+                    {
+                        if (entry->IsOnMesh())
+                        {
+                            return true;
+                        }
+                    }
+                }
+            }
+
+            return false;
+        }
+
+    private:
+        static bool Matches(const PrefixTlv &aPrefixTlv, const Ip6::Address &aAddress)
+        {
+            Ip6::Prefix prefix;
+
+            aPrefixTlv.CopyPrefixTo(prefix);
+            return aAddress.MatchesPrefix(prefix);
+        }
+
+        Error ScanExternalRouteLookup(uint8_t aDomainId, const Ip6::Address &aDestination, uint16_t &aRloc16)
+        {
+            Error                error           = kErrorNoRoute;
+            TlvIterator          tlvIterator(GetTlvsStart(), GetTlvsEnd());
+            const PrefixTlv     *prefixTlv;
+            const HasRouteEntry *bestRouteEntry  = nullptr;
+            uint8_t              bestMatchLength = 0;
+
+            while ((prefixTlv = tlvIterator.Iterate<PrefixTlv>()) != nullptr)
+            {
+                TlvIterator        subTlvIterator(*prefixTlv);
+                const HasRouteTlv *hasRoute;
+                uint8_t            prefixLength = prefixTlv->GetPrefixLength();
+
+                if (!Matches(*prefixTlv, aDestination) || (prefixTlv->GetDomainId() != aDomainId))
+                {
+                    continue;
+                }
+
+                if ((bestRouteEntry != nullptr) && (prefixLength <= bestMatchLength))
+                {
+                    continue;
+                }
+
+                while ((hasRoute = subTlvIterator.Iterate<HasRouteTlv>()) != nullptr)
+                {
+                    for (const HasRouteEntry *entry = hasRoute->GetFirstEntry(); entry <= hasRoute->GetLastEntry();
+                         entry                      = entry->GetNext())
+                    {
+                        if ((bestRouteEntry == nullptr) || (prefixLength > bestMatchLength) ||
+                            Compare(entry->GetPreference(), entry->GetRloc(), bestRouteEntry->GetPreference(),
+                                    bestRouteEntry->GetRloc()) > 0)
+                        {
+                            bestRouteEntry  = entry;
+                            bestMatchLength = prefixLength;
+                        }
+                    }
+                }
+            }
+
+            if (bestRouteEntry != nullptr)
+            {
+                aRloc16 = bestRouteEntry->GetRloc();
+                error   = kErrorNone;
+            }
+
+            return error;
+        }
+
+        Error ScanDefaultRouteLookup(const PrefixTlv &aPrefixTlv, uint16_t &aRloc16)
+        {
+            Error                    error = kErrorNoRoute;
+            TlvIterator              subTlvIterator(aPrefixTlv);
+            const BorderRouterTlv   *brTlv;
+            const BorderRouterEntry *route = nullptr;
+
+            while ((brTlv = subTlvIterator.Iterate<BorderRouterTlv>()) != nullptr)
+            {
+                for (const BorderRouterEntry *entry = brTlv->GetFirstEntry(); entry <= brTlv->GetLastEntry();
+                     entry                          = entry->GetNext())
+                {
+                    if (entry->IsDefaultRoute() &&
+                        ((route == nullptr) ||
+                         Compare(entry->GetPreference(), entry->GetRloc(), route->GetPreference(), route->GetRloc()) >
+                             0))
+                    {
+                        route = entry;
+                    }
+                }
+            }
+
+            if (route != nullptr)
+            {
+                aRloc16 = route->GetRloc();
+                error   = kErrorNone;
+            }
+
+            return error;
+        }
+    };
+
+    struct TestInfo
+    {
+        const uint8_t *mNetworkData;
+        uint8_t        mNetworkDataLength;
+    };
+
+    // Prefixes (in order) with their sub-TLVs:
+    //
+    //  fd00:1::/64       BR { 0x2800 med default+on-mesh, 0x6c01 high default, 0x4c00 high default+on-mesh },
+    //                    Context { id:1, compress }
+    //  2001:db8::/32     Has Route { 0x5000 med, 0x5401 high }
+    //  2001:db8:1::/48   Has Route { 0x5800 low }
+    //  2001:db8:1::/48   (domain 1) Has Route { 0x5c00 high }
+    //  ::/0              Has Route { 0x2800 med, 0x2c00 med }
+    //  fd00:2::/64       (domain 1) BR { 0x7000 low default }, Context { id:2 }
+    //  fd00:1::/32       BR { 0x7400 slaac }, Context { id:3, compress }
+    //  2001:db8:1:2::/64 (domain 1) Has Route { 0x6000 med }
+
+    const uint8_t kNetworkData1[] = {
+        0x03, 0x1c, 0x00, 0x40, 0xfd, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0c, 0x28, 0x00, 0x03, 0x00,
+        0x6c, 0x01, 0x42, 0x00, 0x4c, 0x00, 0x43, 0x00, 0x07, 0x02, 0x11, 0x40, 0x03, 0x0e, 0x00, 0x20, 0x20, 0x01,
+        0x0d, 0xb8, 0x01, 0x06, 0x50, 0x00, 0x00, 0x54, 0x01, 0x40, 0x03, 0x0d, 0x00, 0x30, 0x20, 0x01, 0x0d, 0xb8,
+        0x00, 0x01, 0x01, 0x03, 0x58, 0x00, 0xc0, 0x03, 0x0d, 0x01, 0x30, 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x01, 0x01,
+        0x03, 0x5c, 0x00, 0x40, 0x03, 0x0a, 0x00, 0x00, 0x01, 0x06, 0x28, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x03, 0x14,
+        0x01, 0x40, 0xfd, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x05, 0x04, 0x70, 0x00, 0xc2, 0x00, 0x07, 0x02,
+        0x02, 0x40, 0x03, 0x10, 0x00, 0x20, 0xfd, 0x00, 0x00, 0x01, 0x05, 0x04, 0x74, 0x00, 0x10, 0x00, 0x07, 0x02,
+        0x13, 0x20, 0x03, 0x0f, 0x01, 0x40, 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x01, 0x00, 0x02, 0x01, 0x03, 0x60, 0x00,
+        0x00,
+    };
+
+    // Prefixes (in order) with their sub-TLVs:
+    //
+    //  fd00:2::/64       (domain 1) BR { 0x7000 low default }, Context { id:2 }
+    //  2001:db8:1:2::/64 (domain 1) Has Route { 0x6000 med }
+
+    const uint8_t kNetworkData2[] = {
+        0x03, 0x14, 0x01, 0x40, 0xfd, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x05, 0x04, 0x70,
+        0x00, 0xc2, 0x00, 0x07, 0x02, 0x02, 0x40, 0x03, 0x0f, 0x01, 0x40, 0x20, 0x01, 0x0d, 0xb8,
+        0x00, 0x01, 0x00, 0x02, 0x01, 0x03, 0x60, 0x00, 0x00,
+    };
+
+    const TestInfo kTests[] = {
+        {kNetworkData1, sizeof(kNetworkData1)},
+        {kNetworkData2, sizeof(kNetworkData2)},
+        {kNetworkData1, 0},
+    };
+
+    const char *kAddresses[] = {
+        "fd00:1::1",     "fd00:1:0:1::1",   "fd00:2::1",     "fd00:3::1", "2001:db8::1",
+        "2001:db8:1::1", "2001:db8:1:2::1", "2001:db8:2::1", "3000::1",   "::1",
+    };
+
+    ot::Instance *instance;
+    uint16_t      numRoutes = 0;
+
+    printf("\n\n-------------------------------------------------");
+    printf("\nTestNetworkDataRouteLookup()\n");
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr);
+
+    for (const TestInfo &test : kTests)
+    {
+        TestLeader &leader = reinterpret_cast<TestLeader &>(instance->Get<Leader>());
+
+        leader.Populate(test.mNetworkData, test.mNetworkDataLength);
+
+        for (const char *addressString : kAddresses)
+        {
+            Ip6::Address    address;
+            Lowpan::Context context;
+            Lowpan::Context scanContext;
+            Error           error;
+
+            SuccessOrQuit(address.FromString(addressString));
+
+            error = leader.GetContext(address, context);
+            VerifyOrQuit(error == leader.ScanGetContext(address, scanContext));
+
+            if (error == kErrorNone)
+            {
+                VerifyOrQuit(context.mPrefix == scanContext.mPrefix);
+                VerifyOrQuit(context.mContextId == scanContext.mContextId);
+                VerifyOrQuit(context.mCompressFlag == scanContext.mCompressFlag);
+            }
+
+            VerifyOrQuit(leader.IsOnMesh(address) == leader.ScanIsOnMesh(address));
+
+            for (const char *destinationString : kAddresses)
+            {
+                Ip6::Address destination;
+                uint16_t     rloc16;
+                uint16_t     scanRloc16;
+
+                SuccessOrQuit(destination.FromString(destinationString));
+
+                error = leader.RouteLookup(address, destination, rloc16);
+                VerifyOrQuit(error == leader.ScanRouteLookup(address, destination, scanRloc16));
+
+                if (error == kErrorNone)
+                {
+                    printf("\n %s -> %s : 0x%04x", addressString, destinationString, rloc16);
+                    VerifyOrQuit(rloc16 == scanRloc16);
+                    numRoutes++;
+                }
+            }
+        }
+    }
+
+    VerifyOrQuit(numRoutes > 0);
+
+    testFreeInstance(instance);
+}
+
 } // namespace NetworkData
 } // namespace ot
 
@@ -933,6 +1253,7 @@ int main(void)
 #endif
     ot::NetworkData::TestNetworkDataDsnSrpServices();
     ot::NetworkData::TestNetworkDataDsnSrpAnycastSeqNumSelection();
+    ot::NetworkData::TestNetworkDataRouteLookup();
 
     printf("\nAll tests passed\n");
     return 0;
@@ -38,7 +38,7 @@
 
 enum
 {
-    FLASH_SWAP_SIZE = 2048,
+    FLASH_SWAP_SIZE = 8192,
     FLASH_SWAP_NUM  = 2,
 };
 
@@ -88,6 +88,37 @@ OT_TOOL_WEAK void *otPlatCAlloc(size_t aNum, size_t aSize) { return calloc(aNum,
 OT_TOOL_WEAK void otPlatFree(void *aPtr) { free(aPtr); }
 #endif
 
+#if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
+static uint16_t sNumFreeMessageBuffers;
+static size_t   sMessageBufferSize;
+
+OT_TOOL_WEAK void otPlatMessagePoolInit(otInstance *, uint16_t aMinNumFreeBuffers, size_t aBufferSize)
+{
+    sNumFreeMessageBuffers = aMinNumFreeBuffers;
+    sMessageBufferSize     = aBufferSize;
+}
+
+OT_TOOL_WEAK otMessageBuffer *otPlatMessagePoolNew(otInstance *)
+{
+    otMessageBuffer *buffer = nullptr;
+
+    VerifyOrExit(sNumFreeMessageBuffers > 0);
+    VerifyOrExit((buffer = static_cast<otMessageBuffer *>(calloc(1, sMessageBufferSize))) != nullptr);
+    sNumFreeMessageBuffers--;
+
+exit:
+    return buffer;
+}
+
+OT_TOOL_WEAK void otPlatMessagePoolFree(otInstance *, otMessageBuffer *aBuffer)
+{
+    free(aBuffer);
+    sNumFreeMessageBuffers++;
+}
+
+OT_TOOL_WEAK uint16_t otPlatMessagePoolNumFreeBuffers(otInstance *) { return sNumFreeMessageBuffers; }
+#endif
+
 OT_TOOL_WEAK void otTaskletsSignalPending(otInstance *) {}
 
 OT_TOOL_WEAK void otPlatAlarmMilliStop(otInstance *) {}
@@ -164,8 +195,30 @@ OT_TOOL_WEAK otError otPlatRadioEnergyScan(otInstance *, uint8_t, uint16_t) { re
 
 OT_TOOL_WEAK otError otPlatRadioSetTransmitPower(otInstance *, int8_t) { return OT_ERROR_NOT_IMPLEMENTED; }
 
+OT_TOOL_WEAK otError otPlatRadioGetTransmitPower(otInstance *, int8_t *) { return OT_ERROR_NOT_IMPLEMENTED; }
+
+OT_TOOL_WEAK otError otPlatRadioGetCcaEnergyDetectThreshold(otInstance *, int8_t *) { return OT_ERROR_NOT_IMPLEMENTED; }
+
 OT_TOOL_WEAK int8_t otPlatRadioGetReceiveSensitivity(otInstance *) { return -100; }
 
+OT_TOOL_WEAK otError otPlatRadioSetCoexEnabled(otInstance *, bool) { return OT_ERROR_NOT_IMPLEMENTED; }
+
+OT_TOOL_WEAK bool otPlatRadioIsCoexEnabled(otInstance *) { return false; }
+
+OT_TOOL_WEAK otError otPlatRadioGetCoexMetrics(otInstance *, otRadioCoexMetrics *) { return OT_ERROR_NOT_IMPLEMENTED; }
+
+OT_TOOL_WEAK otError otPlatRadioAddCalibratedPower(otInstance *, uint8_t, int16_t, const uint8_t *, uint16_t)
+{
+    return OT_ERROR_NOT_IMPLEMENTED;
+}
+
+OT_TOOL_WEAK otError otPlatRadioClearCalibratedPowers(otInstance *) { return OT_ERROR_NOT_IMPLEMENTED; }
+
+OT_TOOL_WEAK otError otPlatRadioSetChannelTargetPower(otInstance *, uint8_t, int16_t)
+{
+    return OT_ERROR_NOT_IMPLEMENTED;
+}
+
 OT_TOOL_WEAK otError otPlatEntropyGet(uint8_t *aOutput, uint16_t aOutputLength)
 {
     otError error = OT_ERROR_NONE;
@@ -240,7 +293,7 @@ OT_TOOL_WEAK otError otPlatSettingsGet(otInstance *, uint16_t aKey, int aIndex,
         return OT_ERROR_NOT_FOUND;
     }
 
-    if (aIndex > setting->second.size())
+    if (aIndex >= setting->second.size())
     {
         return OT_ERROR_NOT_FOUND;
     }
@@ -294,6 +347,12 @@ OT_TOOL_WEAK otError otPlatSettingsDelete(otInstance *, uint16_t aKey, int aInde
         return OT_ERROR_NOT_FOUND;
     }
 
+    if (aIndex == -1)
+    {
+        settings.erase(setting);
+        return OT_ERROR_NONE;
+    }
+
     if (aIndex >= setting->second.size())
     {
         return OT_ERROR_NOT_FOUND;
@@ -37,6 +37,7 @@
 #include <openthread/platform/dso_transport.h>
 #include <openthread/platform/entropy.h>
 #include <openthread/platform/logging.h>
+#include <openthread/platform/messagepool.h>
 #include <openthread/platform/misc.h>
 #include <openthread/platform/radio.h>
 
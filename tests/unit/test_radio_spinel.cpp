@@ -0,0 +1,708 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include <openthread/platform/time.h>
+
+#include "common/code_utils.hpp"
+#include "lib/spinel/radio_spinel.hpp"
+#include "lib/spinel/spinel.h"
+
+#include "test_util.h"
+
+namespace ot {
+namespace Spinel {
+
+enum
+{
+    kRcpMaxShortEntries = 3,  ///< Size of the source match short address table of the fake RCP.
+    kRcpMaxExtEntries   = 2,  ///< Size of the source match extended address table of the fake RCP.
+    kRcpMaxCalibrations = 2,  ///< Size of the calibrated power table of the fake RCP.
+    kRcpMaxTargetPower  = 30, ///< Max target power (in 0.01 dBm) accepted by the fake RCP.
+    kMaxResponses       = 16, ///< Max number of responses queued by the fake RCP.
+};
+
+static const uint8_t kRcpEui64[] = {0x18, 0xb4, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01};
+
+static uint64_t sNow;
+
+/**
+ * The state of the fake RCP.
+ *
+ * The fake RCP answers every spinel command as soon as it is sent, the responses are queued and delivered by
+ * `FakeInterface::WaitForFrame()` in order, as a real RCP would do.
+ *
+ */
+struct FakeRcp
+{
+    bool         mSupportsMultiCmd;
+    bool         mSrcMatchEnabled;
+    uint16_t     mPanId;
+    uint16_t     mShortEntries[kRcpMaxShortEntries];
+    uint8_t      mShortEntryCount;
+    otExtAddress mExtEntries[kRcpMaxExtEntries];
+    uint8_t      mExtEntryCount;
+    uint8_t      mCalibrationCount;
+    int16_t      mTargetPower;
+    uint16_t     mCommandCount;
+    uint16_t     mMultiSetCount;
+    uint8_t      mResponses[kMaxResponses][SPINEL_FRAME_MAX_SIZE];
+    uint16_t     mResponseLengths[kMaxResponses];
+    uint8_t      mResponseHead;
+    uint8_t      mResponseCount;
+};
+
+static FakeRcp sRcp;
+
+static void InitFakeRcp(bool aSupportsMultiCmd)
+{
+    memset(&sRcp, 0, sizeof(sRcp));
+    sRcp.mSupportsMultiCmd = aSupportsMultiCmd;
+}
+
+static uint8_t *NewResponse(void)
+{
+    VerifyOrQuit(sRcp.mResponseCount < kMaxResponses);
+
+    return sRcp.mResponses[(sRcp.mResponseHead + sRcp.mResponseCount) % kMaxResponses];
+}
+
+static void QueueResponse(spinel_ssize_t aLength)
+{
+    VerifyOrQuit(aLength > 0);
+
+    sRcp.mResponseLengths[(sRcp.mResponseHead + sRcp.mResponseCount) % kMaxResponses] =
+        static_cast<uint16_t>(aLength);
+    sRcp.mResponseCount++;
+}
+
+static void QueueStatus(uint8_t aHeader, spinel_status_t aStatus)
+{
+    QueueResponse(spinel_datatype_pack(NewResponse(), SPINEL_FRAME_MAX_SIZE, "Ciii", aHeader, SPINEL_CMD_PROP_VALUE_IS,
+                                       SPINEL_PROP_LAST_STATUS, aStatus));
+}
+
+static spinel_status_t InsertShortEntry(uint16_t aShortAddress)
+{
+    spinel_status_t status = SPINEL_STATUS_OK;
+
+    for (uint8_t i = 0; i < sRcp.mShortEntryCount; i++)
+    {
+        VerifyOrExit(sRcp.mShortEntries[i] != aShortAddress);
+    }
+
+    VerifyOrExit(sRcp.mShortEntryCount < kRcpMaxShortEntries, status = SPINEL_STATUS_NOMEM);
+    sRcp.mShortEntries[sRcp.mShortEntryCount++] = aShortAddress;
+
+exit:
+    return status;
+}
+
+static spinel_status_t InsertExtEntry(const uint8_t *aExtAddress)
+{
+    spinel_status_t status = SPINEL_STATUS_OK;
+
+    for (uint8_t i = 0; i < sRcp.mExtEntryCount; i++)
+    {
+        VerifyOrExit(memcmp(sRcp.mExtEntries[i].m8, aExtAddress, OT_EXT_ADDRESS_SIZE) != 0);
+    }
+
+    VerifyOrExit(sRcp.mExtEntryCount < kRcpMaxExtEntries, status = SPINEL_STATUS_NOMEM);
+    memcpy(sRcp.mExtEntries[sRcp.mExtEntryCount++].m8, aExtAddress, OT_EXT_ADDRESS_SIZE);
+
+exit:
+    return status;
+}
+
+static void RemoveShortEntry(uint16_t aShortAddress)
+{
+    for (uint8_t i = 0; i < sRcp.mShortEntryCount; i++)
+    {
+        if (sRcp.mShortEntries[i] == aShortAddress)
+        {
+            sRcp.mShortEntries[i] = sRcp.mShortEntries[--sRcp.mShortEntryCount];
+            break;
+        }
+    }
+}
+
+static void RemoveExtEntry(const uint8_t *aExtAddress)
+{
+    for (uint8_t i = 0; i < sRcp.mExtEntryCount; i++)
+    {
+        if (memcmp(sRcp.mExtEntries[i].m8, aExtAddress, OT_EXT_ADDRESS_SIZE) == 0)
+        {
+            sRcp.mExtEntries[i] = sRcp.mExtEntries[--sRcp.mExtEntryCount];
+            break;
+        }
+    }
+}
+
+static spinel_status_t UpdateProperty(uint32_t          aCommand,
+                                      spinel_prop_key_t aKey,
+                                      const uint8_t    *aValue,
+                                      uint16_t          aLength)
+{
+    spinel_status_t status = SPINEL_STATUS_OK;
+
+    switch (aKey)
+    {
+    case SPINEL_PROP_MAC_15_4_PANID:
+        VerifyOrExit(aLength >= sizeof(uint16_t), status = SPINEL_STATUS_PARSE_ERROR);
+        sRcp.mPanId = static_cast<uint16_t>(aValue[0] | (aValue[1] << 8));
+        break;
+
+    case SPINEL_PROP_MAC_SRC_MATCH_ENABLED:
+        VerifyOrExit(aLength >= sizeof(uint8_t), status = SPINEL_STATUS_PARSE_ERROR);
+        sRcp.mSrcMatchEnabled = (aValue[0] != 0);
+        break;
+
+    case SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES:
+        if (aCommand == SPINEL_CMD_PROP_VALUE_SET)
+        {
+            sRcp.mShortEntryCount = 0;
+        }
+
+        for (uint16_t offset = 0; offset + sizeof(uint16_t) <= aLength; offset += sizeof(uint16_t))
+        {
+            uint16_t shortAddress = static_cast<uint16_t>(aValue[offset] | (aValue[offset + 1] << 8));
+
+            if (aCommand == SPINEL_CMD_PROP_VALUE_REMOVE)
+            {
+                RemoveShortEntry(shortAddress);
+            }
+            else
+            {
+                SuccessOrExit(status = InsertShortEntry(shortAddress));
+            }
+        }
+        break;
+
+    case SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES:
+        if (aCommand == SPINEL_CMD_PROP_VALUE_SET)
+        {
+            sRcp.mExtEntryCount = 0;
+        }
+
+        for (uint16_t offset = 0; offset + OT_EXT_ADDRESS_SIZE <= aLength; offset += OT_EXT_ADDRESS_SIZE)
+        {
+            if (aCommand == SPINEL_CMD_PROP_VALUE_REMOVE)
+            {
+                RemoveExtEntry(&aValue[offset]);
+            }
+            else
+            {
+                SuccessOrExit(status = InsertExtEntry(&aValue[offset]));
+            }
+        }
+        break;
+
+    case SPINEL_PROP_PHY_CALIBRATED_POWER:
+        if (aCommand == SPINEL_CMD_PROP_VALUE_SET)
+        {
+            sRcp.mCalibrationCount = 0;
+        }
+        else
+        {
+            VerifyOrExit(sRcp.mCalibrationCount < kRcpMaxCalibrations, status = SPINEL_STATUS_NOMEM);
+            sRcp.mCalibrationCount++;
+        }
+        break;
+
+    case SPINEL_PROP_PHY_CHAN_TARGET_POWER:
+    {
+        int16_t targetPower;
+
+        VerifyOrExit(aLength >= sizeof(uint8_t) + sizeof(int16_t), status = SPINEL_STATUS_PARSE_ERROR);
+        targetPower = static_cast<int16_t>(aValue[1] | (aValue[2] << 8));
+        VerifyOrExit(targetPower <= kRcpMaxTargetPower, status = SPINEL_STATUS_INVALID_ARGUMENT);
+        sRcp.mTargetPower = targetPower;
+        break;
+    }
+
+    default:
+        break;
+    }
+
+exit:
+    return status;
+}
+
+static void HandleGet(uint8_t aHeader, spinel_prop_key_t aKey)
+{
+    uint8_t *response = NewResponse();
+
+    switch (aKey)
+    {
+    case SPINEL_PROP_PROTOCOL_VERSION:
+        QueueResponse(spinel_datatype_pack(response, SPINEL_FRAME_MAX_SIZE, "Ciiii", aHeader, SPINEL_CMD_PROP_VALUE_IS,
+                                           aKey, SPINEL_PROTOCOL_VERSION_THREAD_MAJOR,
+                                           SPINEL_PROTOCOL_VERSION_THREAD_MINOR));
+        break;
+
+    case SPINEL_PROP_NCP_VERSION:
+        QueueResponse(spinel_datatype_pack(response, SPINEL_FRAME_MAX_SIZE, "CiiU", aHeader, SPINEL_CMD_PROP_VALUE_IS,
+                                           aKey, "FAKE-RCP/1.0"));
+        break;
+
+    case SPINEL_PROP_HWADDR:
+        QueueResponse(spinel_datatype_pack(response, SPINEL_FRAME_MAX_SIZE, "CiiE", aHeader, SPINEL_CMD_PROP_VALUE_IS,
+                                           aKey, kRcpEui64));
+        break;
+
+    case SPINEL_PROP_CAPS:
+        if (sRcp.mSupportsMultiCmd)
+        {
+            QueueResponse(spinel_datatype_pack(response, SPINEL_FRAME_MAX_SIZE, "Ciiiii", aHeader,
+                                               SPINEL_CMD_PROP_VALUE_IS, aKey, SPINEL_CAP_CONFIG_RADIO,
+                                               SPINEL_CAP_MAC_RAW, SPINEL_CAP_CMD_MULTI));
+        }
+        else
+        {
+            QueueResponse(spinel_datatype_pack(response, SPINEL_FRAME_MAX_SIZE, "Ciiii", aHeader,
+                                               SPINEL_CMD_PROP_VALUE_IS, aKey, SPINEL_CAP_CONFIG_RADIO,
+                                               SPINEL_CAP_MAC_RAW));
+        }
+        break;
+
+    case SPINEL_PROP_PHY_RX_SENSITIVITY:
+        QueueResponse(spinel_datatype_pack(response, SPINEL_FRAME_MAX_SIZE, "Ciic", aHeader, SPINEL_CMD_PROP_VALUE_IS,
+                                           aKey, -100));
+        break;
+
+    default:
+        QueueStatus(aHeader, SPINEL_STATUS_PROP_NOT_FOUND);
+        break;
+    }
+}
+
+static void HandleMultiSet(uint8_t aHeader, const uint8_t *aEntries, spinel_size_t aLength)
+{
+    uint8_t       *response = NewResponse();
+    spinel_ssize_t length;
+
+    length = spinel_datatype_pack(response, SPINEL_FRAME_MAX_SIZE, "Ci", aHeader, SPINEL_CMD_PROP_VALUES_ARE);
+    VerifyOrQuit(length > 0);
+
+    sRcp.mMultiSetCount++;
+
+    while (aLength > 0)
+    {
+        spinel_prop_key_t key;
+        const uint8_t    *value;
+        spinel_size_t     valueLength;
+        spinel_ssize_t    unpacked;
+        spinel_ssize_t    packed;
+        spinel_status_t   status;
+
+        unpacked = spinel_datatype_unpack(aEntries, aLength, "t(iD)", &key, &value, &valueLength);
+        VerifyOrQuit(unpacked > 0);
+
+        status = UpdateProperty(SPINEL_CMD_PROP_VALUE_SET, key, value, static_cast<uint16_t>(valueLength));
+
+        if (status == SPINEL_STATUS_OK)
+        {
+            packed = spinel_datatype_pack(response + length, SPINEL_FRAME_MAX_SIZE - static_cast<spinel_size_t>(length),
+                                          "t(iD)", key, value, valueLength);
+        }
+        else
+        {
+            packed = spinel_datatype_pack(response + length, SPINEL_FRAME_MAX_SIZE - static_cast<spinel_size_t>(length),
+                                          "t(ii)", SPINEL_PROP_LAST_STATUS, status);
+        }
+
+        VerifyOrQuit(packed > 0);
+        length += packed;
+        aEntries += unpacked;
+        aLength -= static_cast<spinel_size_t>(unpacked);
+    }
+
+    QueueResponse(length);
+}
+
+static void HandleCommand(const uint8_t *aFrame, uint16_t aLength)
+{
+    uint8_t           header;
+    unsigned int      command;
+    spinel_prop_key_t key;
+    const uint8_t    *value;
+    spinel_size_t     valueLength;
+    spinel_status_t   status;
+    spinel_ssize_t    unpacked;
+
+    unpacked = spinel_datatype_unpack(aFrame, aLength, "Ci", &header, &command);
+    VerifyOrQuit(unpacked > 0);
+
+    sRcp.mCommandCount++;
+
+    switch (command)
+    {
+    case SPINEL_CMD_RESET:
+        QueueStatus(SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0, SPINEL_STATUS_RESET_SOFTWARE);
+        break;
+
+    case SPINEL_CMD_PROP_VALUE_GET:
+        VerifyOrQuit(spinel_datatype_unpack(aFrame, aLength, "Cii", &header, &command, &key) > 0);
+        HandleGet(header, key);
+        break;
+
+    case SPINEL_CMD_PROP_VALUE_SET:
+    case SPINEL_CMD_PROP_VALUE_INSERT:
+    case SPINEL_CMD_PROP_VALUE_REMOVE:
+        unpacked = spinel_datatype_unpack(aFrame, aLength, "CiiD", &header, &command, &key, &value, &valueLength);
+        VerifyOrQuit(unpacked > 0);
+        status = UpdateProperty(command, key, value, static_cast<uint16_t>(valueLength));
+
+        if (status == SPINEL_STATUS_OK)
+        {
+            // `VALUE_IS`, `VALUE_INSERTED` and `VALUE_REMOVED` follow `VALUE_SET`, `VALUE_INSERT` and `VALUE_REMOVE`.
+            QueueResponse(spinel_datatype_pack(NewResponse(), SPINEL_FRAME_MAX_SIZE, "CiiD", header,
+                                               command + (SPINEL_CMD_PROP_VALUE_IS - SPINEL_CMD_PROP_VALUE_SET), key,
+                                               value, valueLength));
+        }
+        else
+        {
+            QueueStatus(header, status);
+        }
+        break;
+
+    case SPINEL_CMD_PROP_VALUE_MULTI_SET:
+        HandleMultiSet(header, aFrame + unpacked, static_cast<spinel_size_t>(aLength - unpacked));
+        break;
+
+    default:
+        QueueStatus(header, SPINEL_STATUS_INVALID_COMMAND);
+        break;
+    }
+}
+
+/**
+ * The spinel interface of the fake RCP.
+ *
+ */
+class FakeInterface
+{
+public:
+    FakeInterface(SpinelInterface::ReceiveFrameCallback aCallback,
+                  void                                 *aCallbackContext,
+                  SpinelInterface::RxFrameBuffer       &aFrameBuffer)
+        : mReceiveFrameCallback(aCallback)
+        , mReceiveFrameContext(aCallbackContext)
+        , mReceiveFrameBuffer(aFrameBuffer)
+    {
+    }
+
+    otError SendFrame(const uint8_t *aFrame, uint16_t aLength)
+    {
+        HandleCommand(aFrame, aLength);
+        return OT_ERROR_NONE;
+    }
+
+    otError WaitForFrame(uint64_t aTimeoutUs)
+    {
+        otError        error = OT_ERROR_NONE;
+        const uint8_t *response;
+        uint16_t       length;
+
+        if (sRcp.mResponseCount == 0)
+        {
+            sNow += aTimeoutUs;
+            ExitNow(error = OT_ERROR_RESPONSE_TIMEOUT);
+        }
+
+        response = sRcp.mResponses[sRcp.mResponseHead];
+        length   = sRcp.mResponseLengths[sRcp.mResponseHead];
+
+        sRcp.mResponseHead = (sRcp.mResponseHead + 1) % kMaxResponses;
+        sRcp.mResponseCount--;
+
+        for (uint16_t i = 0; i < length; i++)
+        {
+            SuccessOrQuit(mReceiveFrameBuffer.WriteByte(response[i]));
+        }
+
+        mReceiveFrameCallback(mReceiveFrameContext);
+
+    exit:
+        return error;
+    }
+
+    otError  HardwareReset(void) { return OT_ERROR_NOT_IMPLEMENTED; }
+    uint32_t GetBusSpeed(void) const { return 0; }
+    void     Deinit(void) {}
+
+private:
+    SpinelInterface::ReceiveFrameCallback mReceiveFrameCallback;
+    void                                 *mReceiveFrameContext;
+    SpinelInterface::RxFrameBuffer       &mReceiveFrameBuffer;
+};
+
+static RadioSpinel<FakeInterface> sRadioSpinel;
+
+static void InitRadioSpinel(bool aSupportsMultiCmd)
+{
+    InitFakeRcp(aSupportsMultiCmd);
+    sRadioSpinel.Init(/* aResetRadio */ true, /* aSkipRcpCompatibilityCheck */ true);
+    VerifyOrQuit(sRcp.mResponseCount == 0);
+}
+
+static void FinalizeRadioSpinel(void)
+{
+    VerifyOrQuit(sRadioSpinel.GetRadioSpinelMetrics()->mSpinelParseErrorCount == 0);
+    sRadioSpinel.Deinit();
+}
+
+static bool RcpHasShortEntry(uint16_t aShortAddress)
+{
+    bool found = false;
+
+    for (uint8_t i = 0; i < sRcp.mShortEntryCount; i++)
+    {
+        found |= (sRcp.mShortEntries[i] == aShortAddress);
+    }
+
+    return found;
+}
+
+static bool RcpHasExtEntry(const otExtAddress &aExtAddress)
+{
+    bool found = false;
+
+    for (uint8_t i = 0; i < sRcp.mExtEntryCount; i++)
+    {
+        found |= (memcmp(sRcp.mExtEntries[i].m8, aExtAddress.m8, OT_EXT_ADDRESS_SIZE) == 0);
+    }
+
+    return found;
+}
+
+static otExtAddress ExtAddress(uint8_t aIndex)
+{
+    otExtAddress extAddress;
+
+    memset(extAddress.m8, 0xa0, sizeof(extAddress.m8));
+    extAddress.m8[OT_EXT_ADDRESS_SIZE - 1] = aIndex;
+
+    return extAddress;
+}
+
+void TestSrcMatchNoBufs(void)
+{
+    printf("TestSrcMatchNoBufs");
+
+    InitRadioSpinel(/* aSupportsMultiCmd */ true);
+
+    // Short address table
+
+    SuccessOrQuit(sRadioSpinel.SetPanId(0x1234));
+    SuccessOrQuit(sRadioSpinel.EnableSrcMatch(true));
+
+    for (uint16_t i = 0; i < kRcpMaxShortEntries; i++)
+    {
+        SuccessOrQuit(sRadioSpinel.AddSrcMatchShortEntry(0x1000 + i));
+    }
+
+    VerifyOrQuit(sRcp.mPanId == 0x1234);
+    VerifyOrQuit(sRcp.mSrcMatchEnabled);
+    VerifyOrQuit(sRcp.mShortEntryCount == kRcpMaxShortEntries);
+
+    // The RCP table is full, the `NO_BUFS` of the RCP must be returned
+    // to the caller, and the entry must not be kept by the host.
+
+    VerifyOrQuit(sRadioSpinel.AddSrcMatchShortEntry(0x2000) == OT_ERROR_NO_BUFS);
+    VerifyOrQuit(!RcpHasShortEntry(0x2000));
+
+    SuccessOrQuit(sRadioSpinel.ClearSrcMatchShortEntry(0x1001));
+    VerifyOrQuit(!RcpHasShortEntry(0x1001));
+    SuccessOrQuit(sRadioSpinel.AddSrcMatchShortEntry(0x2000));
+    VerifyOrQuit(RcpHasShortEntry(0x2000));
+
+    // A rejected entry must not be restored when the whole table is
+    // set again by a batched update.
+
+    VerifyOrQuit(sRadioSpinel.AddSrcMatchShortEntry(0x3000) == OT_ERROR_NO_BUFS);
+    sRadioSpinel.BeginSrcMatchUpdate();
+    SuccessOrQuit(sRadioSpinel.ClearSrcMatchShortEntry(0x1000));
+    SuccessOrQuit(sRadioSpinel.CommitSrcMatchUpdate());
+    VerifyOrQuit(sRcp.mShortEntryCount == kRcpMaxShortEntries - 1);
+    VerifyOrQuit(RcpHasShortEntry(0x1002) && RcpHasShortEntry(0x2000));
+
+    SuccessOrQuit(sRadioSpinel.ClearSrcMatchShortEntries());
+    VerifyOrQuit(sRcp.mShortEntryCount == 0);
+
+    // Extended address table
+
+    for (uint8_t i = 0; i < kRcpMaxExtEntries; i++)
+    {
+        SuccessOrQuit(sRadioSpinel.AddSrcMatchExtEntry(ExtAddress(i)));
+    }
+
+    VerifyOrQuit(sRadioSpinel.AddSrcMatchExtEntry(ExtAddress(kRcpMaxExtEntries)) == OT_ERROR_NO_BUFS);
+    VerifyOrQuit(sRcp.mExtEntryCount == kRcpMaxExtEntries);
+
+    SuccessOrQuit(sRadioSpinel.ClearSrcMatchExtEntry(ExtAddress(0)));
+    VerifyOrQuit(!RcpHasExtEntry(ExtAddress(0)));
+    SuccessOrQuit(sRadioSpinel.AddSrcMatchExtEntry(ExtAddress(kRcpMaxExtEntries)));
+    VerifyOrQuit(RcpHasExtEntry(ExtAddress(kRcpMaxExtEntries)));
+
+    SuccessOrQuit(sRadioSpinel.ClearSrcMatchExtEntries());
+    VerifyOrQuit(sRcp.mExtEntryCount == 0);
+
+    FinalizeRadioSpinel();
+
+    printf(" -- PASS\n");
+}
+
+#if OPENTHREAD_CONFIG_PLATFORM_POWER_CALIBRATION_ENABLE
+void TestPowerCalibrationErrors(void)
+{
+    static const uint8_t kRawPowerSetting[] = {0x01, 0x02};
+
+    printf("TestPowerCalibrationErrors");
+
+    InitRadioSpinel(/* aSupportsMultiCmd */ true);
+
+    for (uint8_t i = 0; i < kRcpMaxCalibrations; i++)
+    {
+        SuccessOrQuit(sRadioSpinel.AddCalibratedPower(11 + i, 10, kRawPowerSetting, sizeof(kRawPowerSetting)));
+    }
+
+    // The errors of the RCP must be returned to the caller.
+
+    VerifyOrQuit(sRadioSpinel.AddCalibratedPower(20, 10, kRawPowerSetting, sizeof(kRawPowerSetting)) ==
+                 OT_ERROR_NO_BUFS);
+    VerifyOrQuit(sRcp.mCalibrationCount == kRcpMaxCalibrations);
+
+    SuccessOrQuit(sRadioSpinel.ClearCalibratedPowers());
+    VerifyOrQuit(sRcp.mCalibrationCount == 0);
+
+    SuccessOrQuit(sRadioSpinel.SetChannelTargetPower(11, kRcpMaxTargetPower));
+    VerifyOrQuit(sRcp.mTargetPower == kRcpMaxTargetPower);
+    VerifyOrQuit(sRadioSpinel.SetChannelTargetPower(11, kRcpMaxTargetPower + 1) == OT_ERROR_INVALID_ARGS);
+    VerifyOrQuit(sRcp.mTargetPower == kRcpMaxTargetPower);
+
+    FinalizeRadioSpinel();
+
+    printf(" -- PASS\n");
+}
+#endif
+
+static void TestBatch(bool aSupportsMultiCmd)
+{
+    uint16_t commandCount;
+
+    printf("TestBatch(%s)", aSupportsMultiCmd ? "multi" : "single");
+
+    InitRadioSpinel(aSupportsMultiCmd);
+
+    // `Enable()` sets three properties in a batch, then gets the RX
+    // sensitivity.
+
+    SuccessOrQuit(sRadioSpinel.SetPanId(0x1234));
+    sRcp.mPanId  = 0;
+    commandCount = sRcp.mCommandCount;
+    SuccessOrQuit(sRadioSpinel.Enable(nullptr));
+    VerifyOrQuit(sRcp.mPanId == 0x1234);
+
+    if (aSupportsMultiCmd)
+    {
+        VerifyOrQuit(sRcp.mMultiSetCount == 1);
+        VerifyOrQuit(sRcp.mCommandCount == commandCount + 2);
+    }
+    else
+    {
+        VerifyOrQuit(sRcp.mMultiSetCount == 0);
+        VerifyOrQuit(sRcp.mCommandCount == commandCount + 4);
+    }
+
+    // The batched src match update is only sent on commit, the tables
+    // before the src match state.
+
+    commandCount = sRcp.mCommandCount;
+    sRadioSpinel.BeginSrcMatchUpdate();
+    SuccessOrQuit(sRadioSpinel.AddSrcMatchShortEntry(0x1000));
+    SuccessOrQuit(sRadioSpinel.AddSrcMatchShortEntry(0x1001));
+    SuccessOrQuit(sRadioSpinel.AddSrcMatchExtEntry(ExtAddress(0)));
+    SuccessOrQuit(sRadioSpinel.EnableSrcMatch(true));
+    VerifyOrQuit(sRcp.mCommandCount == commandCount);
+
+    SuccessOrQuit(sRadioSpinel.CommitSrcMatchUpdate());
+    VerifyOrQuit(sRcp.mSrcMatchEnabled);
+    VerifyOrQuit(sRcp.mShortEntryCount == 2 && RcpHasShortEntry(0x1000) && RcpHasShortEntry(0x1001));
+    VerifyOrQuit(sRcp.mExtEntryCount == 1 && RcpHasExtEntry(ExtAddress(0)));
+
+    if (aSupportsMultiCmd)
+    {
+        VerifyOrQuit(sRcp.mMultiSetCount == 2);
+        VerifyOrQuit(sRcp.mCommandCount == commandCount + 1);
+    }
+    else
+    {
+        VerifyOrQuit(sRcp.mMultiSetCount == 0);
+        VerifyOrQuit(sRcp.mCommandCount == commandCount + 3);
+    }
+
+    // A failure of the RCP to set one of the batched properties must be
+    // returned by the commit.
+
+    sRadioSpinel.BeginSrcMatchUpdate();
+
+    for (uint16_t i = 0; i < kRcpMaxShortEntries; i++)
+    {
+        SuccessOrQuit(sRadioSpinel.AddSrcMatchShortEntry(0x2000 + i));
+    }
+
+    VerifyOrQuit(sRadioSpinel.CommitSrcMatchUpdate() == OT_ERROR_NO_BUFS);
+
+    FinalizeRadioSpinel();
+
+    printf(" -- PASS\n");
+}
+
+void TestBatchWithMultiCmd(void) { TestBatch(/* aSupportsMultiCmd */ true); }
+
+void TestBatchWithoutMultiCmd(void) { TestBatch(/* aSupportsMultiCmd */ false); }
+
+} // namespace Spinel
+} // namespace ot
+
+extern "C" uint64_t otPlatTimeGet(void) { return ot::Spinel::sNow++; }
+
+int main(void)
+{
+    ot::Spinel::TestSrcMatchNoBufs();
+#if OPENTHREAD_CONFIG_PLATFORM_POWER_CALIBRATION_ENABLE
+    ot::Spinel::TestPowerCalibrationErrors();
+#endif
+    ot::Spinel::TestBatchWithMultiCmd();
+    ot::Spinel::TestBatchWithoutMultiCmd();
+
+    printf("\nAll tests passed.\n");
+    return 0;
+}
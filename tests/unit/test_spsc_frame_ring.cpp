@@ -0,0 +1,280 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+#include <thread>
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "posix/platform/spsc_frame_ring.hpp"
+
+#include "test_util.h"
+
+namespace ot {
+namespace Posix {
+
+static constexpr uint32_t kRingSize   = 64;
+static constexpr uint16_t kHeaderSize = sizeof(uint16_t) + sizeof(uint64_t);
+
+typedef SpscFrameRing<kRingSize> TestRing;
+
+static void FillFrame(uint8_t *aFrame, uint16_t aLength, uint32_t aSeed)
+{
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        aFrame[i] = static_cast<uint8_t>(aSeed + i);
+    }
+}
+
+static bool CheckFrame(const uint8_t *aFrame, uint16_t aLength, uint32_t aSeed)
+{
+    bool matches = true;
+
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        if (aFrame[i] != static_cast<uint8_t>(aSeed + i))
+        {
+            matches = false;
+            break;
+        }
+    }
+
+    return matches;
+}
+
+void TestSpscFrameRingEmpty(void)
+{
+    TestRing ring;
+    uint8_t  frame[kRingSize];
+    uint16_t length = sizeof(frame);
+    uint64_t timestamp;
+
+    printf("TestSpscFrameRingEmpty");
+
+    VerifyOrQuit(ring.IsEmpty());
+    VerifyOrQuit(ring.Pop(frame, length, timestamp) == OT_ERROR_NOT_FOUND);
+
+    // A zero-length frame still takes a ring entry.
+    SuccessOrQuit(ring.Push(frame, 0, 7));
+    VerifyOrQuit(!ring.IsEmpty());
+    SuccessOrQuit(ring.Pop(frame, length, timestamp));
+    VerifyOrQuit(length == 0);
+    VerifyOrQuit(timestamp == 7);
+    VerifyOrQuit(ring.IsEmpty());
+
+    printf(" -- PASS\n");
+}
+
+void TestSpscFrameRingFull(void)
+{
+    static constexpr uint16_t kFrameLength = kRingSize / 2 - kHeaderSize;
+
+    TestRing ring;
+    uint8_t  frame[kRingSize];
+    uint16_t length;
+    uint64_t timestamp;
+
+    printf("TestSpscFrameRingFull");
+
+    // Two frames fill the ring exactly.
+    FillFrame(frame, kFrameLength, 1);
+    SuccessOrQuit(ring.Push(frame, kFrameLength, 1));
+    FillFrame(frame, kFrameLength, 2);
+    SuccessOrQuit(ring.Push(frame, kFrameLength, 2));
+
+    VerifyOrQuit(ring.Push(frame, 0, 3) == OT_ERROR_NO_BUFS);
+
+    // A frame larger than the whole ring never fits.
+    {
+        TestRing emptyRing;
+
+        VerifyOrQuit(emptyRing.Push(frame, kRingSize - kHeaderSize + 1, 0) == OT_ERROR_NO_BUFS);
+        SuccessOrQuit(emptyRing.Push(frame, kRingSize - kHeaderSize, 0));
+    }
+
+    // Popping one frame makes room for another one of the same size.
+    length = sizeof(frame);
+    SuccessOrQuit(ring.Pop(frame, length, timestamp));
+    VerifyOrQuit(length == kFrameLength);
+    VerifyOrQuit(timestamp == 1);
+    VerifyOrQuit(CheckFrame(frame, length, 1));
+
+    FillFrame(frame, kFrameLength, 3);
+    SuccessOrQuit(ring.Push(frame, kFrameLength, 3));
+    VerifyOrQuit(ring.Push(frame, 0, 4) == OT_ERROR_NO_BUFS);
+
+    for (uint32_t seed = 2; seed <= 3; seed++)
+    {
+        length = sizeof(frame);
+        SuccessOrQuit(ring.Pop(frame, length, timestamp));
+        VerifyOrQuit(length == kFrameLength);
+        VerifyOrQuit(timestamp == seed);
+        VerifyOrQuit(CheckFrame(frame, length, seed));
+    }
+
+    VerifyOrQuit(ring.IsEmpty());
+
+    // A frame larger than the output buffer is dropped.
+    FillFrame(frame, kFrameLength, 5);
+    SuccessOrQuit(ring.Push(frame, kFrameLength, 5));
+    FillFrame(frame, 4, 6);
+    SuccessOrQuit(ring.Push(frame, 4, 6));
+
+    length = kFrameLength - 1;
+    VerifyOrQuit(ring.Pop(frame, length, timestamp) == OT_ERROR_NO_BUFS);
+    VerifyOrQuit(length == kFrameLength);
+
+    length = sizeof(frame);
+    SuccessOrQuit(ring.Pop(frame, length, timestamp));
+    VerifyOrQuit(length == 4);
+    VerifyOrQuit(timestamp == 6);
+    VerifyOrQuit(CheckFrame(frame, length, 6));
+
+    // Clearing drops all frames.
+    SuccessOrQuit(ring.Push(frame, 4, 7));
+    ring.Clear();
+    VerifyOrQuit(ring.IsEmpty());
+
+    printf(" -- PASS\n");
+}
+
+void TestSpscFrameRingWraparound(void)
+{
+    TestRing ring;
+    uint8_t  frame[kRingSize];
+    uint16_t length;
+    uint64_t timestamp;
+    uint32_t pushed = 0;
+    uint32_t popped = 0;
+
+    printf("TestSpscFrameRingWraparound");
+
+    // Frame lengths not dividing the ring size make the header and the
+    // payload of the frames wrap around at every possible offset.
+
+    while (popped < 1000)
+    {
+        uint16_t pushLength = static_cast<uint16_t>(pushed % 13);
+
+        FillFrame(frame, pushLength, pushed);
+
+        if (ring.Push(frame, pushLength, pushed) == OT_ERROR_NONE)
+        {
+            pushed++;
+            continue;
+        }
+
+        length = sizeof(frame);
+        SuccessOrQuit(ring.Pop(frame, length, timestamp));
+        VerifyOrQuit(length == popped % 13);
+        VerifyOrQuit(timestamp == popped);
+        VerifyOrQuit(CheckFrame(frame, length, popped));
+        popped++;
+    }
+
+    while (popped < pushed)
+    {
+        length = sizeof(frame);
+        SuccessOrQuit(ring.Pop(frame, length, timestamp));
+        VerifyOrQuit(timestamp == popped);
+        VerifyOrQuit(CheckFrame(frame, length, popped));
+        popped++;
+    }
+
+    VerifyOrQuit(ring.IsEmpty());
+
+    printf(" -- PASS\n");
+}
+
+void TestSpscFrameRingTwoThreads(void)
+{
+    static constexpr uint32_t kNumFrames      = 200000;
+    static constexpr uint16_t kMaxFrameLength = 40;
+
+    SpscFrameRing<256> ring;
+    uint32_t           popped = 0;
+
+    printf("TestSpscFrameRingTwoThreads");
+
+    std::thread producer([&ring]() {
+        uint8_t frame[kMaxFrameLength];
+
+        for (uint32_t seq = 0; seq < kNumFrames; seq++)
+        {
+            uint16_t length = static_cast<uint16_t>(seq % (kMaxFrameLength + 1));
+
+            FillFrame(frame, length, seq);
+
+            while (ring.Push(frame, length, seq) != OT_ERROR_NONE)
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    while (popped < kNumFrames)
+    {
+        uint8_t  frame[kMaxFrameLength];
+        uint16_t length = sizeof(frame);
+        uint64_t timestamp;
+        otError  error = ring.Pop(frame, length, timestamp);
+
+        if (error == OT_ERROR_NOT_FOUND)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        SuccessOrQuit(error);
+        VerifyOrQuit(timestamp == popped);
+        VerifyOrQuit(length == popped % (kMaxFrameLength + 1));
+        VerifyOrQuit(CheckFrame(frame, length, popped));
+        popped++;
+    }
+
+    producer.join();
+    VerifyOrQuit(ring.IsEmpty());
+
+    printf(" -- PASS\n");
+}
+
+} // namespace Posix
+} // namespace ot
+
+int main(void)
+{
+    ot::Posix::TestSpscFrameRingEmpty();
+    ot::Posix::TestSpscFrameRingFull();
+    ot::Posix::TestSpscFrameRingWraparound();
+    ot::Posix::TestSpscFrameRingTwoThreads();
+
+    printf("All tests passed\n");
+    return 0;
+}
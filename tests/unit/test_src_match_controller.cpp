@@ -0,0 +1,468 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <string.h>
+
+#include <openthread/config.h>
+
+#include "test_util.h"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "thread/child_table.hpp"
+#include "thread/src_match_controller.hpp"
+
+namespace ot {
+
+enum
+{
+    kMaxShortEntries  = 3,  ///< Size of the short address table of the fake radio.
+    kMaxExtEntries    = 2,  ///< Size of the extended address table of the fake radio.
+    kMaxStagedEntries = 16, ///< Max number of entries of each table staged by a batch.
+};
+
+/**
+ * A source match table of the fake radio.
+ *
+ */
+struct FakeSrcMatchTable
+{
+    bool         mEnabled;
+    uint16_t     mShortEntries[kMaxStagedEntries];
+    uint8_t      mShortEntryCount;
+    otExtAddress mExtEntries[kMaxStagedEntries];
+    uint8_t      mExtEntryCount;
+};
+
+/**
+ * The state of the fake radio.
+ *
+ * When batching, the changes between `otPlatRadioBeginSrcMatchUpdate()` and `otPlatRadioCommitSrcMatchUpdate()` are
+ * staged without checking the size of the tables. A commit that does not fit (or that is made to fail) applies only
+ * part of the changes, as an RCP which fails in the middle of the update would do. When not batching, the begin and
+ * commit do nothing, the same as the default implementations, and every change is applied immediately.
+ *
+ */
+struct FakeRadio
+{
+    bool              mBatching;
+    bool              mInBatch;
+    bool              mFailCommit;
+    bool              mClearedWhileEnabled;
+    uint16_t          mCommitCount;
+    FakeSrcMatchTable mTable;
+    FakeSrcMatchTable mStaged;
+};
+
+static FakeRadio sRadio;
+static Instance *sInstance;
+
+static void InitFakeRadio(bool aBatching)
+{
+    memset(&sRadio, 0, sizeof(sRadio));
+    sRadio.mBatching = aBatching;
+}
+
+static FakeSrcMatchTable &GetCurrentTable(void) { return sRadio.mInBatch ? sRadio.mStaged : sRadio.mTable; }
+
+static bool HasShortEntry(const FakeSrcMatchTable &aTable, uint16_t aShortAddress)
+{
+    bool found = false;
+
+    for (uint8_t i = 0; i < aTable.mShortEntryCount; i++)
+    {
+        found |= (aTable.mShortEntries[i] == aShortAddress);
+    }
+
+    return found;
+}
+
+static bool HasExtEntry(const FakeSrcMatchTable &aTable, const otExtAddress &aExtAddress)
+{
+    bool found = false;
+
+    for (uint8_t i = 0; i < aTable.mExtEntryCount; i++)
+    {
+        found |= (memcmp(aTable.mExtEntries[i].m8, aExtAddress.m8, sizeof(otExtAddress)) == 0);
+    }
+
+    return found;
+}
+
+extern "C" {
+
+void otPlatRadioBeginSrcMatchUpdate(otInstance *)
+{
+    VerifyOrExit(sRadio.mBatching);
+    VerifyOrQuit(!sRadio.mInBatch);
+
+    sRadio.mInBatch = true;
+    sRadio.mStaged  = sRadio.mTable;
+
+exit:
+    return;
+}
+
+otError otPlatRadioCommitSrcMatchUpdate(otInstance *)
+{
+    otError            error = OT_ERROR_NONE;
+    FakeSrcMatchTable &table = sRadio.mTable;
+
+    VerifyOrExit(sRadio.mBatching);
+    VerifyOrQuit(sRadio.mInBatch);
+
+    sRadio.mInBatch = false;
+    sRadio.mCommitCount++;
+
+    if (sRadio.mStaged.mShortEntryCount > kMaxShortEntries || sRadio.mStaged.mExtEntryCount > kMaxExtEntries)
+    {
+        error = OT_ERROR_NO_BUFS;
+    }
+    else if (sRadio.mFailCommit)
+    {
+        error = OT_ERROR_FAILED;
+    }
+
+    table = sRadio.mStaged;
+
+    if (error != OT_ERROR_NONE)
+    {
+        // Only the entries that fit are applied, in order, and the
+        // last one of each table is dropped as the radio failed while
+        // adding it.
+
+        table.mShortEntryCount = OT_MIN(table.mShortEntryCount, static_cast<uint8_t>(kMaxShortEntries));
+        table.mExtEntryCount   = OT_MIN(table.mExtEntryCount, static_cast<uint8_t>(kMaxExtEntries));
+
+        if (table.mShortEntryCount > 0)
+        {
+            table.mShortEntryCount--;
+        }
+
+        if (table.mExtEntryCount > 0)
+        {
+            table.mExtEntryCount--;
+        }
+    }
+
+exit:
+    return error;
+}
+
+void otPlatRadioEnableSrcMatch(otInstance *, bool aEnable) { GetCurrentTable().mEnabled = aEnable; }
+
+otError otPlatRadioAddSrcMatchShortEntry(otInstance *, uint16_t aShortAddress)
+{
+    otError            error = OT_ERROR_NONE;
+    FakeSrcMatchTable &table = GetCurrentTable();
+
+    VerifyOrExit(!HasShortEntry(table, aShortAddress));
+    VerifyOrExit(table.mShortEntryCount < (sRadio.mInBatch ? kMaxStagedEntries : kMaxShortEntries),
+                 error = OT_ERROR_NO_BUFS);
+    table.mShortEntries[table.mShortEntryCount++] = aShortAddress;
+
+exit:
+    return error;
+}
+
+otError otPlatRadioAddSrcMatchExtEntry(otInstance *, const otExtAddress *aExtAddress)
+{
+    otError            error = OT_ERROR_NONE;
+    FakeSrcMatchTable &table = GetCurrentTable();
+
+    VerifyOrExit(!HasExtEntry(table, *aExtAddress));
+    VerifyOrExit(table.mExtEntryCount < (sRadio.mInBatch ? kMaxStagedEntries : kMaxExtEntries),
+                 error = OT_ERROR_NO_BUFS);
+    table.mExtEntries[table.mExtEntryCount++] = *aExtAddress;
+
+exit:
+    return error;
+}
+
+otError otPlatRadioClearSrcMatchShortEntry(otInstance *, uint16_t aShortAddress)
+{
+    otError            error = OT_ERROR_NOT_FOUND;
+    FakeSrcMatchTable &table = GetCurrentTable();
+
+    for (uint8_t i = 0; i < table.mShortEntryCount; i++)
+    {
+        if (table.mShortEntries[i] == aShortAddress)
+        {
+            table.mShortEntries[i] = table.mShortEntries[--table.mShortEntryCount];
+            error                  = OT_ERROR_NONE;
+            break;
+        }
+    }
+
+    return error;
+}
+
+otError otPlatRadioClearSrcMatchExtEntry(otInstance *, const otExtAddress *aExtAddress)
+{
+    otError            error = OT_ERROR_NOT_FOUND;
+    FakeSrcMatchTable &table = GetCurrentTable();
+
+    for (uint8_t i = 0; i < table.mExtEntryCount; i++)
+    {
+        if (memcmp(table.mExtEntries[i].m8, aExtAddress->m8, sizeof(otExtAddress)) == 0)
+        {
+            table.mExtEntries[i] = table.mExtEntries[--table.mExtEntryCount];
+            error                = OT_ERROR_NONE;
+            break;
+        }
+    }
+
+    return error;
+}
+
+void otPlatRadioClearSrcMatchShortEntries(otInstance *)
+{
+    // Clearing the table while source matching is enabled would clear
+    // the "frame pending" bit in the acks sent to all sleepy children.
+    sRadio.mClearedWhileEnabled |= GetCurrentTable().mEnabled;
+    GetCurrentTable().mShortEntryCount = 0;
+}
+
+void otPlatRadioClearSrcMatchExtEntries(otInstance *)
+{
+    sRadio.mClearedWhileEnabled |= GetCurrentTable().mEnabled;
+    GetCurrentTable().mExtEntryCount = 0;
+}
+
+} // extern "C"
+
+static Child *sChildren[kMaxShortEntries + 2];
+
+static void InitTest(bool aBatching)
+{
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    InitFakeRadio(aBatching);
+
+    for (uint8_t i = 0; i < GetArrayLength(sChildren); i++)
+    {
+        Mac::ExtAddress extAddress;
+
+        sChildren[i] = sInstance->Get<ChildTable>().GetNewChild();
+        VerifyOrQuit(sChildren[i] != nullptr);
+
+        memset(extAddress.m8, 0xa0, sizeof(extAddress.m8));
+        extAddress.m8[0] = i;
+
+        sChildren[i]->SetState(Child::kStateValid);
+        sChildren[i]->SetRloc16(0x1000 + i);
+        sChildren[i]->SetExtAddress(extAddress);
+
+        sInstance->Get<SourceMatchController>().SetSrcMatchAsShort(*sChildren[i], /* aUseShortAddress */ true);
+    }
+}
+
+static void FinalizeTest(void) { testFreeInstance(sInstance); }
+
+static bool RadioHasEntry(uint8_t aChildIndex)
+{
+    return HasShortEntry(sRadio.mTable, sChildren[aChildIndex]->GetRloc16());
+}
+
+static void VerifyEnabled(bool aEnabled)
+{
+    VerifyOrQuit(sInstance->Get<SourceMatchController>().IsEnabled() == aEnabled);
+    VerifyOrQuit(sRadio.mTable.mEnabled == aEnabled);
+}
+
+void TestBatchCommit(void)
+{
+    Mac::ExtAddress extAddress;
+
+    printf("TestBatchCommit");
+
+    InitTest(/* aBatching */ true);
+
+    SourceMatchController &controller = sInstance->Get<SourceMatchController>();
+
+    // Nothing reaches the radio table until the outermost commit.
+
+    controller.BeginUpdate();
+    controller.IncrementMessageCount(*sChildren[0]);
+    controller.BeginUpdate();
+    controller.IncrementMessageCount(*sChildren[1]);
+    controller.SetSrcMatchAsShort(*sChildren[2], /* aUseShortAddress */ false);
+    controller.IncrementMessageCount(*sChildren[2]);
+    controller.CommitUpdate();
+
+    VerifyOrQuit(sRadio.mCommitCount == 0);
+    VerifyOrQuit(sRadio.mTable.mShortEntryCount == 0 && sRadio.mTable.mExtEntryCount == 0);
+
+    controller.CommitUpdate();
+
+    VerifyOrQuit(sRadio.mCommitCount == 1);
+    VerifyEnabled(true);
+    VerifyOrQuit(sRadio.mTable.mShortEntryCount == 2 && RadioHasEntry(0) && RadioHasEntry(1));
+
+    extAddress.Set(sChildren[2]->GetExtAddress().m8, Mac::ExtAddress::kReverseByteOrder);
+    VerifyOrQuit(sRadio.mTable.mExtEntryCount == 1 && HasExtEntry(sRadio.mTable, extAddress));
+
+    // A child is only removed once its last message is sent.
+
+    controller.IncrementMessageCount(*sChildren[0]);
+    controller.DecrementMessageCount(*sChildren[0]);
+    VerifyOrQuit(RadioHasEntry(0));
+    controller.DecrementMessageCount(*sChildren[0]);
+    VerifyOrQuit(!RadioHasEntry(0));
+    VerifyEnabled(true);
+
+    FinalizeTest();
+
+    printf(" -- PASS\n");
+}
+
+void TestCommitFailure(void)
+{
+    printf("TestCommitFailure");
+
+    InitTest(/* aBatching */ true);
+
+    SourceMatchController &controller = sInstance->Get<SourceMatchController>();
+
+    // A batch which does not fit in the radio table: the radio enables
+    // source matching on top of a partial table. The table is rebuilt
+    // and source matching is left disabled while a child is pending.
+
+    controller.BeginUpdate();
+
+    for (uint8_t i = 0; i <= kMaxShortEntries; i++)
+    {
+        controller.IncrementMessageCount(*sChildren[i]);
+    }
+
+    controller.CommitUpdate();
+
+    VerifyOrQuit(sRadio.mCommitCount == 1);
+    VerifyOrQuit(!sRadio.mClearedWhileEnabled);
+    VerifyEnabled(false);
+    VerifyOrQuit(sRadio.mTable.mShortEntryCount == kMaxShortEntries);
+
+    for (uint8_t i = 0; i < kMaxShortEntries; i++)
+    {
+        VerifyOrQuit(RadioHasEntry(i));
+    }
+
+    // Once a child leaves the table, the pending one is added in a batch
+    // and source matching is enabled again.
+
+    controller.DecrementMessageCount(*sChildren[0]);
+
+    VerifyOrQuit(sRadio.mCommitCount == 2);
+    VerifyEnabled(true);
+    VerifyOrQuit(sRadio.mTable.mShortEntryCount == kMaxShortEntries);
+    VerifyOrQuit(!RadioHasEntry(0) && RadioHasEntry(kMaxShortEntries));
+
+    // A batch which fits but fails: the rebuilt table matches the
+    // children with messages, without the entries of the failed batch.
+
+    sRadio.mFailCommit = true;
+
+    controller.BeginUpdate();
+    controller.DecrementMessageCount(*sChildren[1]);
+    controller.IncrementMessageCount(*sChildren[0]);
+    controller.CommitUpdate();
+
+    sRadio.mFailCommit = false;
+
+    VerifyOrQuit(sRadio.mCommitCount == 3);
+    VerifyOrQuit(!sRadio.mClearedWhileEnabled);
+    VerifyEnabled(true);
+    VerifyOrQuit(sRadio.mTable.mShortEntryCount == kMaxShortEntries);
+    VerifyOrQuit(RadioHasEntry(0) && !RadioHasEntry(1) && RadioHasEntry(2) && RadioHasEntry(kMaxShortEntries));
+
+    FinalizeTest();
+
+    printf(" -- PASS\n");
+}
+
+void TestFallback(void)
+{
+    printf("TestFallback");
+
+    // The radio does not batch, every change is applied immediately and
+    // the commit always succeeds.
+
+    InitTest(/* aBatching */ false);
+
+    SourceMatchController &controller = sInstance->Get<SourceMatchController>();
+
+    controller.BeginUpdate();
+
+    for (uint8_t i = 0; i < kMaxShortEntries; i++)
+    {
+        controller.IncrementMessageCount(*sChildren[i]);
+        VerifyOrQuit(RadioHasEntry(i));
+    }
+
+    controller.CommitUpdate();
+    VerifyEnabled(true);
+
+    // The table is full, source matching is disabled until the pending
+    // child is added.
+
+    controller.IncrementMessageCount(*sChildren[kMaxShortEntries]);
+    VerifyEnabled(false);
+    VerifyOrQuit(!RadioHasEntry(kMaxShortEntries));
+
+    controller.IncrementMessageCount(*sChildren[kMaxShortEntries + 1]);
+    VerifyEnabled(false);
+
+    controller.DecrementMessageCount(*sChildren[0]);
+    VerifyEnabled(false);
+    VerifyOrQuit(RadioHasEntry(kMaxShortEntries) && !RadioHasEntry(kMaxShortEntries + 1));
+
+    controller.DecrementMessageCount(*sChildren[1]);
+    VerifyEnabled(true);
+    VerifyOrQuit(sRadio.mTable.mShortEntryCount == kMaxShortEntries);
+    VerifyOrQuit(RadioHasEntry(2) && RadioHasEntry(kMaxShortEntries) && RadioHasEntry(kMaxShortEntries + 1));
+
+    VerifyOrQuit(sRadio.mCommitCount == 0);
+
+    FinalizeTest();
+
+    printf(" -- PASS\n");
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestBatchCommit();
+    ot::TestCommitFailure();
+    ot::TestFallback();
+
+    printf("\nAll tests passed.\n");
+    return 0;
+}
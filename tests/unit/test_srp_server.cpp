@@ -28,10 +28,13 @@
 
 #include <openthread/config.h>
 
+#include <time.h>
+
 #include "test_platform.h"
 #include "test_util.hpp"
 
 #include <openthread/dataset_ftd.h>
+#include <openthread/platform/flash.h>
 #include <openthread/srp_client.h>
 #include <openthread/srp_server.h>
 #include <openthread/thread.h>
@@ -107,7 +110,7 @@ uint32_t otPlatAlarmMilliGetNow(void) { return sNow; }
 
 //----------------------------------------------------------------------------------------------------------------------
 
-Array<void *, 500> sHeapAllocatedPtrs;
+Array<void *, 16000> sHeapAllocatedPtrs;
 
 #if OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
 void *otPlatCAlloc(size_t aNum, size_t aSize)
@@ -123,7 +126,19 @@ void otPlatFree(void *aPtr)
 {
     if (aPtr != nullptr)
     {
-        void **entry = sHeapAllocatedPtrs.Find(aPtr);
+        void **entry = nullptr;
+
+        // Search from the end, since most freed items are the
+        // recently allocated ones (e.g., mbedTLS temporaries).
+
+        for (uint16_t index = sHeapAllocatedPtrs.GetLength(); index > 0; index--)
+        {
+            if (sHeapAllocatedPtrs[index - 1] == aPtr)
+            {
+                entry = &sHeapAllocatedPtrs[index - 1];
+                break;
+            }
+        }
 
         VerifyOrQuit(entry != nullptr, "A heap allocated item is freed twice");
         sHeapAllocatedPtrs.Remove(*entry);
@@ -714,24 +729,45 @@ void TestSrpServerIgnore(void)
     Log("End of TestSrpServerIgnore");
 }
 
-#if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
-void TestUpdateLeaseShortVariant(void)
+void TestSrpServerIndexScale(void)
 {
-    // Test behavior of SRP client and server when short variant of
-    // Update Lease Option is used (which only include lease interval).
-    // This test uses `SetUseShortLeaseOption()` method of `Srp::Client`
-    // which changes the default behavior and is available under the
-    // `REFERENCE_DEVICE` config.
+    // Registers many hosts (each with a service and a sub-type) and
+    // validates the server name indexes against a linear search of
+    // all hosts and services. Also compares the lookup time of the
+    // two, and validates the indexes are maintained as hosts and
+    // services are removed or their leases expire.
+
+#if OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
+    static constexpr uint16_t kNumHosts = 1000;
+#else
+    // The internal heap (also used by mbedTLS) limits the number
+    // of hosts which can be registered.
+    static constexpr uint16_t kNumHosts = 40;
+#endif
+
+    static const char  kServiceName[]     = "_scale._udp";
+    static const char  kSubLabel[]        = "_sub1";
+    static const char *kSubLabels[]       = {kSubLabel, nullptr};
+    static const char  kFullServiceName[] = "_scale._udp.default.service.arpa.";
+    static const char  kFullSubTypeName[] = "_sub1._sub._scale._udp.default.service.arpa.";
 
     Srp::Server                *srpServer;
-    Srp::Server::LeaseConfig    leaseConfig;
-    const Srp::Server::Service *service;
     Srp::Client                *srpClient;
-    Srp::Client::Service        service1;
+    Srp::Client::Service        service;
     uint16_t                    heapAllocations;
+    char                        hostName[Dns::Name::kMaxLabelSize];
+    char                        instanceLabel[Dns::Name::kMaxLabelSize];
+    char                        fullName[Dns::Name::kMaxNameSize];
+    const Srp::Server::Host    *host;
+    const Srp::Server::Service *srpService;
+    uint16_t                    count;
+    clock_t                     start;
+    double                      indexDuration;
+    double                      linearDuration;
+    otSrpServerLeaseCounters    leaseCounters;
 
     Log("--------------------------------------------------------------------------------------------");
-    Log("TestUpdateLeaseShortVariant");
+    Log("TestSrpServerIndexScale");
 
     InitTest();
 
@@ -740,161 +776,246 @@ void TestUpdateLeaseShortVariant(void)
 
     heapAllocations = sHeapAllocatedPtrs.GetLength();
 
-    PrepareService1(service1);
-
     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-    // Start SRP server.
+    // Start SRP server and client.
 
     SuccessOrQuit(srpServer->SetAddressMode(Srp::Server::kAddressModeUnicast));
-    VerifyOrQuit(srpServer->GetState() == Srp::Server::kStateDisabled);
-
-    srpServer->SetServiceHandler(HandleSrpServerUpdate, sInstance);
-
     srpServer->SetEnabled(true);
-    VerifyOrQuit(srpServer->GetState() != Srp::Server::kStateDisabled);
-
     AdvanceTime(10000);
     VerifyOrQuit(srpServer->GetState() == Srp::Server::kStateRunning);
 
+    srpClient->SetCallback(HandleSrpClientCallback, sInstance);
+    srpClient->EnableAutoStartMode(nullptr, nullptr);
+    AdvanceTime(2000);
+    VerifyOrQuit(srpClient->IsRunning());
+
     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-    // Check the default Lease Config on SRP server.
-    // Server to accept lease in [30 sec, 27 hours] and
-    // key-lease in [30 sec, 189 hours].
+    // Register `kNumHosts` hosts one after the other. The client host
+    // info is cleared (without removing it on server) before the next
+    // host is registered, so the server keeps all of them. All hosts
+    // use the same client key so there are no name conflicts.
 
-    srpServer->GetLeaseConfig(leaseConfig);
+    start = clock();
 
-    VerifyOrQuit(leaseConfig.mMinLease == 30);             // 30 seconds
-    VerifyOrQuit(leaseConfig.mMaxLease == 27u * 3600);     // 27 hours
-    VerifyOrQuit(leaseConfig.mMinKeyLease == 30);          // 30 seconds
-    VerifyOrQuit(leaseConfig.mMaxKeyLease == 189u * 3600); // 189 hours
+    for (uint16_t i = 0; i < kNumHosts; i++)
+    {
+        snprintf(hostName, sizeof(hostName), "host-%u", i);
+        snprintf(instanceLabel, sizeof(instanceLabel), "inst-%u", i);
+
+        memset(&service, 0, sizeof(service));
+        service.mName          = kServiceName;
+        service.mInstanceName  = instanceLabel;
+        service.mSubTypeLabels = kSubLabels;
+        service.mPort          = 1000 + i;
+
+        srpClient->ClearHostAndServices();
+        SuccessOrQuit(srpClient->SetHostName(hostName));
+        SuccessOrQuit(srpClient->EnableAutoHostAddress());
+        SuccessOrQuit(srpClient->AddService(service));
+
+        sProcessedClientCallback = false;
+        AdvanceTime(2 * 1000);
+
+        VerifyOrQuit(sProcessedClientCallback);
+        VerifyOrQuit(sLastClientCallbackError == kErrorNone);
+        VerifyOrQuit(service.GetState() == Srp::Client::kRegistered);
+    }
 
-    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-    // Start SRP client.
+    Log("Registered %u hosts in %.3f sec", kNumHosts, static_cast<double>(clock() - start) / CLOCKS_PER_SEC);
 
-    srpClient->SetCallback(HandleSrpClientCallback, sInstance);
+    count = 0;
 
-    srpClient->EnableAutoStartMode(nullptr, nullptr);
-    VerifyOrQuit(srpClient->IsAutoStartModeEnabled());
+    for (host = srpServer->GetNextHost(nullptr); host != nullptr; host = srpServer->GetNextHost(host))
+    {
+        count++;
+    }
 
-    AdvanceTime(2000);
-    VerifyOrQuit(srpClient->IsRunning());
+    VerifyOrQuit(count == kNumHosts);
 
-    SuccessOrQuit(srpClient->SetHostName(kHostName));
-    SuccessOrQuit(srpClient->EnableAutoHostAddress());
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Look up every host and service instance using the indexes.
 
-    sUpdateHandlerMode = kAccept;
+    start = clock();
+
+    for (uint16_t i = 0; i < kNumHosts; i++)
+    {
+        snprintf(fullName, sizeof(fullName), "host-%u.default.service.arpa.", i);
+        host = srpServer->FindHost(fullName);
+        VerifyOrQuit(host != nullptr);
+        VerifyOrQuit(host->Matches(fullName));
+
+        snprintf(fullName, sizeof(fullName), "inst-%u.%s", i, kFullServiceName);
+        srpService = srpServer->FindNextService(nullptr, Srp::Server::kFlagsBaseTypeServiceOnly, nullptr, fullName);
+        VerifyOrQuit(srpService != nullptr);
+        VerifyOrQuit(&srpService->GetHost() == host);
+        VerifyOrQuit(srpService->GetPort() == 1000 + i);
+        VerifyOrQuit(srpServer->FindNextService(srpService, Srp::Server::kFlagsBaseTypeServiceOnly, nullptr,
+                                                fullName) == nullptr);
+    }
+
+    indexDuration = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
 
     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-    // Change default lease intervals on SRP client and enable
-    // "use short Update Lease Option" mode.
+    // Do the same lookups with a linear search over all hosts and
+    // their services.
 
-    srpClient->SetLeaseInterval(15u * 3600);
-    srpClient->SetKeyLeaseInterval(40u * 3600);
+    start = clock();
 
-    srpClient->SetUseShortLeaseOption(true);
+    for (uint16_t i = 0; i < kNumHosts; i++)
+    {
+        const Srp::Server::Host *matchedHost = nullptr;
 
-    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-    // Register a service, validate that update handler is called
-    // and service is successfully registered.
+        snprintf(fullName, sizeof(fullName), "host-%u.default.service.arpa.", i);
 
-    SuccessOrQuit(srpClient->AddService(service1));
+        for (host = srpServer->GetNextHost(nullptr); host != nullptr; host = srpServer->GetNextHost(host))
+        {
+            if (host->Matches(fullName))
+            {
+                matchedHost = host;
+                break;
+            }
+        }
 
-    sProcessedUpdateCallback = false;
-    sProcessedClientCallback = false;
+        VerifyOrQuit(matchedHost == srpServer->FindHost(fullName));
 
-    AdvanceTime(2 * 1000);
+        snprintf(fullName, sizeof(fullName), "inst-%u.%s", i, kFullServiceName);
+        srpService = nullptr;
 
-    VerifyOrQuit(sProcessedUpdateCallback);
-    VerifyOrQuit(sProcessedClientCallback);
-    VerifyOrQuit(sLastClientCallbackError == kErrorNone);
+        for (host = srpServer->GetNextHost(nullptr); (host != nullptr) && (srpService == nullptr);
+             host = srpServer->GetNextHost(host))
+        {
+            for (const Srp::Server::Service &hostService : host->GetServices())
+            {
+                if (!hostService.IsSubType() && hostService.MatchesInstanceName(fullName))
+                {
+                    srpService = &hostService;
+                    break;
+                }
+            }
+        }
 
-    VerifyOrQuit(service1.GetState() == Srp::Client::kRegistered);
+        VerifyOrQuit(srpService ==
+                     srpServer->FindNextService(nullptr, Srp::Server::kFlagsBaseTypeServiceOnly, nullptr, fullName));
+    }
 
-    ValidateHost(*srpServer, kHostName);
+    linearDuration = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+
+    Log("Looked up %u hosts and instances: indexed %.3f sec, linear search %.3f sec", kNumHosts, indexDuration,
+        linearDuration);
 
     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-    // Validate the lease info for service on SRP server. The client
-    // is set up to use "short Update Lease Option format, so it only
-    // include the lease interval as 15 hours in its request
-    // message. Server should then see 15 hours for both lease and
-    // key lease
+    // Browse the service and its sub-type.
 
-    VerifyOrQuit(sUpdateHostLeaseInfo.mLease == 15u * 3600 * 1000);
-    VerifyOrQuit(sUpdateHostLeaseInfo.mKeyLease == 15u * 3600 * 1000);
+    count      = 0;
+    srpService = nullptr;
+    start      = clock();
 
-    // Check that SRP server granted 15 hours for both lease and
-    // key lease.
+    while ((srpService = srpServer->FindNextService(srpService, Srp::Server::kFlagsAnyTypeActiveService,
+                                                   kFullServiceName, nullptr)) != nullptr)
+    {
+        VerifyOrQuit(!srpService->IsSubType());
+        count++;
+    }
 
-    service = srpServer->GetNextHost(nullptr)->GetServices().GetHead();
-    VerifyOrQuit(service != nullptr);
-    VerifyOrQuit(service->GetLease() == 15u * 3600);
-    VerifyOrQuit(service->GetKeyLease() == 15u * 3600);
+    VerifyOrQuit(count == kNumHosts);
 
-    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-    // Remove the service.
+    count      = 0;
+    srpService = nullptr;
 
-    SuccessOrQuit(srpClient->RemoveService(service1));
+    while ((srpService = srpServer->FindNextService(srpService, Srp::Server::kFlagsAnyTypeActiveService,
+                                                   kFullSubTypeName, nullptr)) != nullptr)
+    {
+        VerifyOrQuit(srpService->IsSubType());
+        count++;
+    }
 
-    sProcessedUpdateCallback = false;
-    sProcessedClientCallback = false;
+    VerifyOrQuit(count == kNumHosts);
 
-    AdvanceTime(2 * 1000);
+    Log("Browsed %u services and sub-types in %.3f sec", kNumHosts,
+        static_cast<double>(clock() - start) / CLOCKS_PER_SEC);
 
-    VerifyOrQuit(sProcessedUpdateCallback);
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Remove the last registered host (retaining its name) and
+    // validate its service is no longer active.
+
+    sProcessedClientCallback = false;
+    SuccessOrQuit(srpClient->RemoveHostAndServices(/* aShouldRemoveKeyLease */ false));
+    AdvanceTime(2 * 1000);
     VerifyOrQuit(sProcessedClientCallback);
-    VerifyOrQuit(sLastClientCallbackError == kErrorNone);
 
-    VerifyOrQuit(service1.GetState() == Srp::Client::kRemoved);
+    snprintf(fullName, sizeof(fullName), "host-%u.default.service.arpa.", kNumHosts - 1);
+    host = srpServer->FindHost(fullName);
+    VerifyOrQuit(host != nullptr);
+    VerifyOrQuit(host->IsDeleted());
+
+    snprintf(fullName, sizeof(fullName), "inst-%u.%s", kNumHosts - 1, kFullServiceName);
+    VerifyOrQuit(srpServer->FindNextService(nullptr, Srp::Server::kFlagsAnyTypeActiveService, nullptr, fullName) ==
+                 nullptr);
+    srpService = srpServer->FindNextService(nullptr, Srp::Server::kFlagsAnyService, nullptr, fullName);
+    VerifyOrQuit(srpService != nullptr);
+    VerifyOrQuit(srpService->IsDeleted());
 
     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-    // Register the service again, but this time change it to request
-    // a lease time that is larger than the `LeaseConfig.mMinLease` of
-    // 27 hours. This ensures that server needs to include the Lease
-    // Option in its response (since it need to grant a different
-    // lease interval).
+    // Let the leases of all hosts expire and validate that no active
+    // service remains while the names are still retained.
 
-    service1.mLease    = 100u * 3600; // 100 hours >= 27 hours.
-    service1.mKeyLease = 110u * 3600;
+    srpClient->ClearHostAndServices();
 
-    SuccessOrQuit(srpClient->AddService(service1));
+    leaseCounters = *srpServer->GetLeaseCounters();
+    start         = clock();
 
-    sProcessedUpdateCallback = false;
-    sProcessedClientCallback = false;
+    AdvanceTime(OPENTHREAD_CONFIG_SRP_CLIENT_DEFAULT_LEASE * 1000 + 60 * 1000);
 
-    AdvanceTime(2 * 1000);
+    Log("Expired %u host leases in %.3f sec", kNumHosts - 1, static_cast<double>(clock() - start) / CLOCKS_PER_SEC);
 
-    VerifyOrQuit(sProcessedUpdateCallback);
-    VerifyOrQuit(sProcessedClientCallback);
-    VerifyOrQuit(sLastClientCallbackError == kErrorNone);
+    // The last host was removed explicitly, all others expire. An
+    // expired host removes its services, so they are not counted.
 
-    VerifyOrQuit(service1.GetState() == Srp::Client::kRegistered);
+    VerifyOrQuit(srpServer->GetLeaseCounters()->mHostLeaseExpirations ==
+                 leaseCounters.mHostLeaseExpirations + kNumHosts - 1);
+    VerifyOrQuit(srpServer->GetLeaseCounters()->mServiceLeaseExpirations == leaseCounters.mServiceLeaseExpirations);
+    VerifyOrQuit(srpServer->GetLeaseCounters()->mHostKeyLeaseExpirations == leaseCounters.mHostKeyLeaseExpirations);
+    VerifyOrQuit(srpServer->GetLeaseCounters()->mLeaseTimerRuns > leaseCounters.mLeaseTimerRuns);
+    VerifyOrQuit(srpServer->GetLeaseCounters()->mMaxRunExpirations >= 1);
+    VerifyOrQuit(otSrpServerGetLeaseCounters(sInstance) == srpServer->GetLeaseCounters());
 
-    ValidateHost(*srpServer, kHostName);
+    VerifyOrQuit(srpServer->FindNextService(nullptr, Srp::Server::kFlagsAnyTypeActiveService, kFullServiceName,
+                                            nullptr) == nullptr);
+
+    for (uint16_t i = 0; i < kNumHosts; i++)
+    {
+        snprintf(fullName, sizeof(fullName), "host-%u.default.service.arpa.", i);
+        host = srpServer->FindHost(fullName);
+        VerifyOrQuit(host != nullptr);
+        VerifyOrQuit(host->IsDeleted());
+    }
 
     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-    // Validate the lease info for service on SRP server.
+    // Let the key leases of all hosts expire and validate that all
+    // hosts are removed.
 
-    // We should see the 100 hours in request from client
-    VerifyOrQuit(sUpdateHostLeaseInfo.mLease == 100u * 3600 * 1000);
-    VerifyOrQuit(sUpdateHostLeaseInfo.mKeyLease == 100u * 3600 * 1000);
+    leaseCounters = *srpServer->GetLeaseCounters();
 
-    // Check that SRP server granted  27 hours for both lease and
-    // key lease.
+    AdvanceTime(OPENTHREAD_CONFIG_SRP_CLIENT_DEFAULT_KEY_LEASE * 1000);
 
-    service = srpServer->GetNextHost(nullptr)->GetServices().GetHead();
-    VerifyOrQuit(service != nullptr);
-    VerifyOrQuit(service->GetLease() == 27u * 3600);
-    VerifyOrQuit(service->GetKeyLease() == 27u * 3600);
+    VerifyOrQuit(srpServer->GetNextHost(nullptr) == nullptr);
+    VerifyOrQuit(srpServer->GetLeaseCounters()->mHostKeyLeaseExpirations ==
+                 leaseCounters.mHostKeyLeaseExpirations + kNumHosts);
+    VerifyOrQuit(srpServer->GetLeaseCounters()->mHostLeaseExpirations == leaseCounters.mHostLeaseExpirations);
+    VerifyOrQuit(srpServer->GetLeaseCounters()->mLastRunExpirations >= 1);
+    VerifyOrQuit(srpServer->GetLeaseCounters()->mMaxRunExpirations >=
+                 srpServer->GetLeaseCounters()->mLastRunExpirations);
 
     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
     // Disable SRP server, verify that all heap allocations by SRP server
-    // are freed.
+    // (including the index buckets) are freed.
 
     Log("Disabling SRP server");
 
     srpServer->SetEnabled(false);
     AdvanceTime(100);
 
+    VerifyOrQuit(srpServer->GetNextHost(nullptr) == nullptr);
     VerifyOrQuit(heapAllocations == sHeapAllocatedPtrs.GetLength());
 
     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -905,19 +1026,1038 @@ void TestUpdateLeaseShortVariant(void)
 
     VerifyOrQuit(sHeapAllocatedPtrs.IsEmpty());
 
-    Log("End of TestUpdateLeaseShortVariant");
+    Log("End of TestSrpServerIndexScale");
 }
 
-#endif // OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
 
-#endif // ENABLE_SRP_TEST
+uint16_t GetNumSavedHostEntries(void)
+{
+    uint16_t numEntries = 0;
+    uint16_t length;
 
-int main(void)
+    while (true)
+    {
+        length = 0;
+
+        if (sInstance->Get<Settings>().ReadSrpServerHostRecord(numEntries, nullptr, length) != kErrorNone)
+        {
+            break;
+        }
+
+        VerifyOrQuit(length <= 255);
+        numEntries++;
+    }
+
+    return numEntries;
+}
+
+void RebootAndEnableSrpServer(bool aPowerLoss = false)
 {
-#if ENABLE_SRP_TEST
-    TestSrpServerBase();
-    TestSrpServerReject();
-    TestSrpServerIgnore();
+    // Simulates a device reboot. Unpublishing the SRP service entry
+    // stops the SRP server (freeing all its hosts) but keeps the saved
+    // host records. The OT instance is then freed without erasing the
+    // settings and a new instance is started with SRP server enabled.
+    //
+    // If `aPowerLoss` is set, the settings flash is reverted (once the
+    // OT instance is freed) to its content before the SRP server is
+    // stopped, discarding the records compacted on stop as if the
+    // device lost power.
+
+    static constexpr uint8_t  kNumFlashSwaps    = 2;
+    static constexpr uint32_t kMaxFlashSwapSize = 8192;
+
+    static uint8_t sFlash[kNumFlashSwaps][kMaxFlashSwapSize];
+
+    Srp::Server *srpServer;
+    uint32_t     swapSize = otPlatFlashGetSwapSize(sInstance);
+
+    Log("Rebooting%s", aPowerLoss ? " (power loss)" : "");
+
+    VerifyOrQuit(swapSize <= kMaxFlashSwapSize);
+
+    // Drop the saved Thread network info so that the new instance
+    // forms a new network and becomes leader (as in `InitTest()`).
+
+    IgnoreError(sInstance->Get<Settings>().Delete<Settings::NetworkInfo>());
+
+    if (aPowerLoss)
+    {
+        for (uint8_t swapIndex = 0; swapIndex < kNumFlashSwaps; swapIndex++)
+        {
+            otPlatFlashRead(sInstance, swapIndex, 0, sFlash[swapIndex], swapSize);
+        }
+    }
+
+    sInstance->Get<NetworkData::Publisher>().UnpublishDnsSrpService();
+    AdvanceTime(100);
+
+    VerifyOrQuit(sInstance->Get<Srp::Server>().GetState() == Srp::Server::kStateStopped);
+    VerifyOrQuit(sInstance->Get<Srp::Server>().GetNextHost(nullptr) == nullptr);
+    VerifyOrQuit(GetNumSavedHostEntries() > 0);
+
+    SuccessOrQuit(otIp6SetEnabled(sInstance, false));
+    SuccessOrQuit(otThreadSetEnabled(sInstance, false));
+    IgnoreError(sInstance->Get<Settings>().Delete<Settings::NetworkInfo>());
+    testFreeInstance(sInstance);
+
+    if (aPowerLoss)
+    {
+        for (uint8_t swapIndex = 0; swapIndex < kNumFlashSwaps; swapIndex++)
+        {
+            otPlatFlashErase(nullptr, swapIndex);
+            otPlatFlashWrite(nullptr, swapIndex, 0, sFlash[swapIndex], swapSize);
+        }
+    }
+
+    InitTest();
+
+    srpServer = &sInstance->Get<Srp::Server>();
+
+    SuccessOrQuit(srpServer->SetAddressMode(Srp::Server::kAddressModeUnicast));
+    srpServer->SetServiceHandler(HandleSrpServerUpdate, sInstance);
+
+    sUpdateHandlerMode       = kAccept;
+    sProcessedUpdateCallback = false;
+
+    srpServer->SetEnabled(true);
+    AdvanceTime(10000);
+    VerifyOrQuit(srpServer->GetState() == Srp::Server::kStateRunning);
+}
+
+void TestSrpServerPersistence(void)
+{
+    Srp::Server                *srpServer;
+    Srp::Client                *srpClient;
+    Srp::Client::Service        service1;
+    Srp::Client::Service        service2;
+    const Srp::Server::Host    *host;
+    const Srp::Server::Service *service;
+    Srp::Server::LeaseInfo      leaseInfo;
+    uint32_t                    hostLease;
+    uint32_t                    hostKeyLease;
+    uint8_t                     numAddresses;
+    uint8_t                     numRestoredAddresses;
+    uint16_t                    numActiveBaseTypes;
+    uint16_t                    numDeletedBaseTypes;
+    uint16_t                    numActiveSubTypes;
+    uint16_t                    numSavedEntries;
+    uint16_t                    txtDataLength;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestSrpServerPersistence");
+
+    InitTest();
+
+    srpServer = &sInstance->Get<Srp::Server>();
+    srpClient = &sInstance->Get<Srp::Client>();
+
+    PrepareService1(service1);
+    PrepareService2(service2);
+
+    VerifyOrQuit(GetNumSavedHostEntries() == 0);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start SRP server and client.
+
+    SuccessOrQuit(srpServer->SetAddressMode(Srp::Server::kAddressModeUnicast));
+    srpServer->SetServiceHandler(HandleSrpServerUpdate, sInstance);
+
+    srpServer->SetEnabled(true);
+    AdvanceTime(10000);
+    VerifyOrQuit(srpServer->GetState() == Srp::Server::kStateRunning);
+
+    srpClient->SetCallback(HandleSrpClientCallback, sInstance);
+    srpClient->EnableAutoStartMode(nullptr, nullptr);
+    AdvanceTime(2000);
+    VerifyOrQuit(srpClient->IsRunning());
+
+    SuccessOrQuit(srpClient->SetHostName(kHostName));
+    SuccessOrQuit(srpClient->EnableAutoHostAddress());
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Register two services and then remove the first one (its name
+    // is retained on server).
+
+    SuccessOrQuit(srpClient->AddService(service1));
+    SuccessOrQuit(srpClient->AddService(service2));
+
+    sUpdateHandlerMode       = kAccept;
+    sProcessedClientCallback = false;
+
+    AdvanceTime(2 * 1000);
+
+    VerifyOrQuit(sProcessedClientCallback);
+    VerifyOrQuit(sLastClientCallbackError == kErrorNone);
+    VerifyOrQuit(service1.GetState() == Srp::Client::kRegistered);
+    VerifyOrQuit(service2.GetState() == Srp::Client::kRegistered);
+
+    SuccessOrQuit(srpClient->RemoveService(service1));
+
+    sProcessedClientCallback = false;
+
+    AdvanceTime(2 * 1000);
+
+    VerifyOrQuit(sProcessedClientCallback);
+    VerifyOrQuit(sLastClientCallbackError == kErrorNone);
+    VerifyOrQuit(service1.GetState() == Srp::Client::kRemoved);
+
+    ValidateHost(*srpServer, kHostName);
+
+    host         = srpServer->GetNextHost(nullptr);
+    hostLease    = host->GetLease();
+    hostKeyLease = host->GetKeyLease();
+    IgnoreReturnValue(host->GetAddresses(numAddresses));
+
+    VerifyOrQuit(numAddresses > 0);
+
+    service = host->FindNextService(nullptr, Srp::Server::Service::kFlagBaseType | Srp::Server::Service::kFlagActive);
+    VerifyOrQuit(service != nullptr);
+    txtDataLength = service->GetTxtDataLength();
+
+    // The host is saved on each update and its record is larger than
+    // a single settings entry.
+    numSavedEntries = GetNumSavedHostEntries();
+    VerifyOrQuit(numSavedEntries > 1);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Reboot (SRP client is not started on the new instance) and
+    // validate that the host and its services are restored.
+
+    RebootAndEnableSrpServer();
+
+    srpServer = &sInstance->Get<Srp::Server>();
+
+    VerifyOrQuit(sProcessedUpdateCallback);
+    ValidateHost(*srpServer, kHostName);
+
+    host = srpServer->GetNextHost(nullptr);
+
+    VerifyOrQuit(!host->IsDeleted());
+    VerifyOrQuit(host->GetLease() == hostLease);
+    VerifyOrQuit(host->GetKeyLease() == hostKeyLease);
+    IgnoreReturnValue(host->GetAddresses(numRestoredAddresses));
+    VerifyOrQuit(numRestoredAddresses == numAddresses);
+
+    host->GetLeaseInfo(leaseInfo);
+    VerifyOrQuit(leaseInfo.mRemainingLease > 0);
+    VerifyOrQuit(leaseInfo.mRemainingLease < leaseInfo.mLease);
+
+    numActiveBaseTypes  = 0;
+    numDeletedBaseTypes = 0;
+    numActiveSubTypes   = 0;
+
+    for (service = host->GetServices().GetHead(); service != nullptr; service = service->GetNext())
+    {
+        Log("Service: %s%s", service->GetServiceName(), service->IsDeleted() ? " (deleted)" : "");
+
+        if (service->IsSubType())
+        {
+            numActiveSubTypes += service->IsDeleted() ? 0 : 1;
+        }
+        else if (service->IsDeleted())
+        {
+            numDeletedBaseTypes++;
+            VerifyOrQuit(StringStartsWith(service->GetInstanceName(), service1.GetInstanceName()));
+        }
+        else
+        {
+            numActiveBaseTypes++;
+            VerifyOrQuit(StringStartsWith(service->GetInstanceName(), service2.GetInstanceName()));
+            VerifyOrQuit(service->GetPort() == service2.GetPort());
+            VerifyOrQuit(service->GetPriority() == service2.GetPriority());
+            VerifyOrQuit(service->GetTxtDataLength() == txtDataLength);
+        }
+    }
+
+    VerifyOrQuit(numActiveBaseTypes == 1);
+    VerifyOrQuit(numDeletedBaseTypes == 1);
+    VerifyOrQuit(numActiveSubTypes == 1);
+
+    // The saved records are compacted to a single record per host.
+    VerifyOrQuit(GetNumSavedHostEntries() > 1);
+    VerifyOrQuit(GetNumSavedHostEntries() <= numSavedEntries);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Stop the SRP server (without a reboot), wait past the host lease
+    // and start it again. Validate that the time while stopped is
+    // counted: the host is restored as deleted and the service handler
+    // is not notified.
+
+    sInstance->Get<NetworkData::Publisher>().UnpublishDnsSrpService();
+    AdvanceTime(100);
+    VerifyOrQuit(srpServer->GetState() == Srp::Server::kStateStopped);
+    VerifyOrQuit(srpServer->GetNextHost(nullptr) == nullptr);
+
+    AdvanceTime(hostLease * 1000);
+
+    sProcessedUpdateCallback = false;
+    sInstance->Get<NetworkData::Publisher>().PublishDnsSrpServiceUnicast(srpServer->GetPort());
+    AdvanceTime(10000);
+    VerifyOrQuit(srpServer->GetState() == Srp::Server::kStateRunning);
+
+    VerifyOrQuit(!sProcessedUpdateCallback);
+    ValidateHost(*srpServer, kHostName);
+
+    host = srpServer->GetNextHost(nullptr);
+    VerifyOrQuit(host->IsDeleted());
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Let the host lease expire, reboot and validate that the host is
+    // restored as deleted (its name is retained until key lease expiry).
+
+    AdvanceTime(hostLease * 1000);
+
+    host = srpServer->GetNextHost(nullptr);
+    VerifyOrQuit(host != nullptr);
+    VerifyOrQuit(host->IsDeleted());
+
+    RebootAndEnableSrpServer();
+
+    srpServer = &sInstance->Get<Srp::Server>();
+
+    ValidateHost(*srpServer, kHostName);
+
+    host = srpServer->GetNextHost(nullptr);
+    VerifyOrQuit(host->IsDeleted());
+    VerifyOrQuit(host->GetKeyLease() == hostKeyLease);
+
+    for (service = host->GetServices().GetHead(); service != nullptr; service = service->GetNext())
+    {
+        VerifyOrQuit(service->IsDeleted());
+    }
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Disable SRP server and validate that saved records are deleted.
+
+    srpServer->SetEnabled(false);
+    AdvanceTime(100);
+
+    VerifyOrQuit(srpServer->GetNextHost(nullptr) == nullptr);
+    VerifyOrQuit(GetNumSavedHostEntries() == 0);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Finalize OT instance and validate all heap allocations are freed.
+
+    Log("Finalizing OT instance");
+    FinalizeTest();
+
+    VerifyOrQuit(sHeapAllocatedPtrs.IsEmpty());
+
+    Log("End of TestSrpServerPersistence");
+}
+
+void GetHostLabel(const Srp::Server::Host &aHost, char *aLabel, uint16_t aSize)
+{
+    const char *fullName = aHost.GetFullName();
+    uint16_t    length   = 0;
+
+    while ((fullName[length] != '.') && (length + 1 < aSize))
+    {
+        aLabel[length] = fullName[length];
+        length++;
+    }
+
+    aLabel[length] = '\0';
+}
+
+void TestSrpServerPersistenceFull(void)
+{
+    // Registers more hosts than fit in the saved records, so that the
+    // log is full right after it is compacted. Then updates a saved
+    // host (which is not saved, since the log is at its limit) and
+    // removes another one (which makes room, so the log is compacted
+    // again), and validates that neither the old record of the
+    // updated host nor the record of the removed host is restored
+    // after a reboot.
+
+    static constexpr uint16_t kMaxEntries = OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_MAX_ENTRIES;
+    static constexpr uint16_t kNumHosts   = kMaxEntries + 2;
+    static constexpr uint16_t kNewPort    = 4444;
+
+    static const char kServiceName[] = "_full._udp";
+
+    Srp::Server             *srpServer;
+    Srp::Client             *srpClient;
+    Srp::Client::Service     service;
+    const Srp::Server::Host *host;
+    char                     hostName[Dns::Name::kMaxLabelSize];
+    char                     updatedHostName[Dns::Name::kMaxLabelSize];
+    char                     removedHostName[Dns::Name::kMaxLabelSize];
+    char                     instanceLabel[Dns::Name::kMaxLabelSize];
+    char                     fullName[Dns::Name::kMaxNameSize];
+    uint16_t                 numRestoredHosts;
+    uint16_t                 count;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestSrpServerPersistenceFull");
+
+    InitTest();
+
+    srpServer = &sInstance->Get<Srp::Server>();
+    srpClient = &sInstance->Get<Srp::Client>();
+
+    VerifyOrQuit(GetNumSavedHostEntries() == 0);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start SRP server and client.
+
+    SuccessOrQuit(srpServer->SetAddressMode(Srp::Server::kAddressModeUnicast));
+    srpServer->SetServiceHandler(HandleSrpServerUpdate, sInstance);
+    sUpdateHandlerMode = kAccept;
+
+    srpServer->SetEnabled(true);
+    AdvanceTime(10000);
+    VerifyOrQuit(srpServer->GetState() == Srp::Server::kStateRunning);
+
+    srpClient->SetCallback(HandleSrpClientCallback, sInstance);
+    srpClient->EnableAutoStartMode(nullptr, nullptr);
+    AdvanceTime(2000);
+    VerifyOrQuit(srpClient->IsRunning());
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Register `kNumHosts` hosts (each saved as a single entry), as in
+    // `TestSrpServerIndexScale()`.
+
+    for (uint16_t i = 0; i < kNumHosts; i++)
+    {
+        snprintf(hostName, sizeof(hostName), "host-%u", i);
+        snprintf(instanceLabel, sizeof(instanceLabel), "inst-%u", i);
+
+        memset(&service, 0, sizeof(service));
+        service.mName         = kServiceName;
+        service.mInstanceName = instanceLabel;
+        service.mPort         = 1000 + i;
+
+        srpClient->ClearHostAndServices();
+        SuccessOrQuit(srpClient->SetHostName(hostName));
+        SuccessOrQuit(srpClient->EnableAutoHostAddress());
+        SuccessOrQuit(srpClient->AddService(service));
+
+        sProcessedClientCallback = false;
+        AdvanceTime(2 * 1000);
+
+        VerifyOrQuit(sProcessedClientCallback);
+        VerifyOrQuit(sLastClientCallbackError == kErrorNone);
+        VerifyOrQuit(service.GetState() == Srp::Client::kRegistered);
+
+        if (i == 0)
+        {
+            VerifyOrQuit(GetNumSavedHostEntries() == 1);
+        }
+    }
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Reboot. Only `kMaxEntries` hosts are restored and the records
+    // are compacted to fill the log.
+
+    srpClient->ClearHostAndServices();
+    RebootAndEnableSrpServer();
+
+    srpServer = &sInstance->Get<Srp::Server>();
+    srpClient = &sInstance->Get<Srp::Client>();
+
+    numRestoredHosts = 0;
+
+    for (host = srpServer->GetNextHost(nullptr); host != nullptr; host = srpServer->GetNextHost(host))
+    {
+        numRestoredHosts++;
+    }
+
+    VerifyOrQuit(numRestoredHosts == kMaxEntries);
+    VerifyOrQuit(GetNumSavedHostEntries() == kMaxEntries);
+
+    host = srpServer->GetNextHost(nullptr);
+    GetHostLabel(*host, updatedHostName, sizeof(updatedHostName));
+    snprintf(instanceLabel, sizeof(instanceLabel), "%s", host->GetServices().GetHead()->GetInstanceLabel());
+    host = srpServer->GetNextHost(host);
+    GetHostLabel(*host, removedHostName, sizeof(removedHostName));
+
+    srpClient->SetCallback(HandleSrpClientCallback, sInstance);
+    srpClient->EnableAutoStartMode(nullptr, nullptr);
+    AdvanceTime(2000);
+    VerifyOrQuit(srpClient->IsRunning());
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Update the service port of a restored host. Its new record does
+    // not fit in the full log, which is not compacted again.
+
+    Log("Updating host %s", updatedHostName);
+
+    memset(&service, 0, sizeof(service));
+    service.mName         = kServiceName;
+    service.mInstanceName = instanceLabel;
+    service.mPort         = kNewPort;
+
+    SuccessOrQuit(srpClient->SetHostName(updatedHostName));
+    SuccessOrQuit(srpClient->EnableAutoHostAddress());
+    SuccessOrQuit(srpClient->AddService(service));
+
+    sProcessedClientCallback = false;
+    AdvanceTime(2 * 1000);
+
+    VerifyOrQuit(sProcessedClientCallback);
+    VerifyOrQuit(sLastClientCallbackError == kErrorNone);
+    VerifyOrQuit(GetNumSavedHostEntries() <= kMaxEntries);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Remove another restored host (along with its key). Its removal
+    // record does not fit in the full log either, but the log is now
+    // compacted (saving the updated host as well).
+
+    Log("Removing host %s", removedHostName);
+
+    srpClient->ClearHostAndServices();
+    SuccessOrQuit(srpClient->SetHostName(removedHostName));
+    SuccessOrQuit(srpClient->RemoveHostAndServices(/* aShouldRemoveKeyLease */ true, /* aSendUnregToServer */ true));
+
+    sProcessedClientCallback = false;
+    AdvanceTime(2 * 1000);
+
+    VerifyOrQuit(sProcessedClientCallback);
+    VerifyOrQuit(sLastClientCallbackError == kErrorNone);
+
+    snprintf(fullName, sizeof(fullName), "%s.default.service.arpa.", removedHostName);
+    VerifyOrQuit(srpServer->FindHost(fullName) == nullptr);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Reboot on power loss (so the records are not compacted when the
+    // SRP server stops) and validate the restored hosts.
+
+    srpClient->ClearHostAndServices();
+    RebootAndEnableSrpServer(/* aPowerLoss */ true);
+
+    srpServer = &sInstance->Get<Srp::Server>();
+
+    count = 0;
+
+    for (host = srpServer->GetNextHost(nullptr); host != nullptr; host = srpServer->GetNextHost(host))
+    {
+        count++;
+    }
+
+    VerifyOrQuit(count == numRestoredHosts - 1);
+
+    snprintf(fullName, sizeof(fullName), "%s.default.service.arpa.", removedHostName);
+    VerifyOrQuit(srpServer->FindHost(fullName) == nullptr);
+
+    snprintf(fullName, sizeof(fullName), "%s.default.service.arpa.", updatedHostName);
+    host = srpServer->FindHost(fullName);
+    VerifyOrQuit(host != nullptr);
+
+    count = 0;
+
+    for (const Srp::Server::Service &srpService : host->GetServices())
+    {
+        if (!srpService.IsDeleted())
+        {
+            VerifyOrQuit(srpService.GetPort() == kNewPort);
+            count++;
+        }
+    }
+
+    VerifyOrQuit(count == 1);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Finalize OT instance and validate all heap allocations are freed.
+
+    srpServer->SetEnabled(false);
+    AdvanceTime(100);
+    VerifyOrQuit(GetNumSavedHostEntries() == 0);
+
+    Log("Finalizing OT instance");
+    FinalizeTest();
+
+    VerifyOrQuit(sHeapAllocatedPtrs.IsEmpty());
+
+    Log("End of TestSrpServerPersistenceFull");
+}
+
+void TestSrpServerPersistenceExpiryBurst(void)
+{
+    // Registers a host with several services sharing a shorter lease
+    // than the host (which is renewed by a later update with another
+    // service), so that all these services expire in the same lease
+    // timer run. Validates that the host is then saved once (a single
+    // record appended) rather than once per expired service.
+
+    static constexpr uint16_t kNumServices  = 5;
+    static constexpr uint32_t kServiceLease = 60;
+
+    static const char kServiceName[] = "_burst._udp";
+
+    Srp::Server             *srpServer;
+    Srp::Client             *srpClient;
+    Srp::Client::Service     services[kNumServices];
+    Srp::Client::Service     longLeaseService;
+    char                     instanceLabels[kNumServices][Dns::Name::kMaxLabelSize];
+    const Srp::Server::Host *host;
+    otSrpServerLeaseCounters leaseCounters;
+    uint16_t                 numSavedEntries;
+    uint16_t                 count;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestSrpServerPersistenceExpiryBurst");
+
+    InitTest();
+
+    srpServer = &sInstance->Get<Srp::Server>();
+    srpClient = &sInstance->Get<Srp::Client>();
+
+    VerifyOrQuit(GetNumSavedHostEntries() == 0);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start SRP server and client.
+
+    SuccessOrQuit(srpServer->SetAddressMode(Srp::Server::kAddressModeUnicast));
+    srpServer->SetServiceHandler(HandleSrpServerUpdate, sInstance);
+    sUpdateHandlerMode = kAccept;
+
+    srpServer->SetEnabled(true);
+    AdvanceTime(10000);
+    VerifyOrQuit(srpServer->GetState() == Srp::Server::kStateRunning);
+
+    srpClient->SetCallback(HandleSrpClientCallback, sInstance);
+    srpClient->EnableAutoStartMode(nullptr, nullptr);
+    AdvanceTime(2000);
+    VerifyOrQuit(srpClient->IsRunning());
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Register the host and the services with the shorter lease.
+
+    SuccessOrQuit(srpClient->SetHostName(kHostName));
+    SuccessOrQuit(srpClient->EnableAutoHostAddress());
+
+    for (uint16_t i = 0; i < kNumServices; i++)
+    {
+        snprintf(instanceLabels[i], sizeof(instanceLabels[i]), "burst-%u", i);
+
+        memset(&services[i], 0, sizeof(services[i]));
+        services[i].mName         = kServiceName;
+        services[i].mInstanceName = instanceLabels[i];
+        services[i].mPort         = 1000 + i;
+        services[i].mLease        = kServiceLease;
+
+        SuccessOrQuit(srpClient->AddService(services[i]));
+    }
+
+    sProcessedClientCallback = false;
+    AdvanceTime(2 * 1000);
+
+    VerifyOrQuit(sProcessedClientCallback);
+    VerifyOrQuit(sLastClientCallbackError == kErrorNone);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Register another service with the default lease, which also
+    // renews the host with the default lease.
+
+    memset(&longLeaseService, 0, sizeof(longLeaseService));
+    longLeaseService.mName         = kServiceName;
+    longLeaseService.mInstanceName = "long-lease";
+    longLeaseService.mPort         = 2000;
+
+    SuccessOrQuit(srpClient->AddService(longLeaseService));
+
+    sProcessedClientCallback = false;
+    AdvanceTime(2 * 1000);
+
+    VerifyOrQuit(sProcessedClientCallback);
+    VerifyOrQuit(sLastClientCallbackError == kErrorNone);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Reboot (SRP client is not started on the new instance, so the
+    // services are not renewed). The records are compacted to a
+    // single record of the host.
+
+    srpClient->ClearHostAndServices();
+    RebootAndEnableSrpServer();
+
+    srpServer = &sInstance->Get<Srp::Server>();
+
+    ValidateHost(*srpServer, kHostName);
+    numSavedEntries = GetNumSavedHostEntries();
+    VerifyOrQuit(numSavedEntries > 0);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Wait for the service leases to expire. Validate that all the
+    // services expire in a single run and that a single record of the
+    // host is appended.
+
+    leaseCounters = *srpServer->GetLeaseCounters();
+
+    AdvanceTime(kServiceLease * 1000);
+
+    VerifyOrQuit(srpServer->GetLeaseCounters()->mServiceLeaseExpirations ==
+                 leaseCounters.mServiceLeaseExpirations + kNumServices);
+    VerifyOrQuit(srpServer->GetLeaseCounters()->mLastRunExpirations == kNumServices);
+
+    host = srpServer->GetNextHost(nullptr);
+    VerifyOrQuit(host != nullptr);
+    VerifyOrQuit(!host->IsDeleted());
+
+    count = 0;
+
+    for (const Srp::Server::Service &service : host->GetServices())
+    {
+        count += service.IsDeleted() ? 1 : 0;
+    }
+
+    VerifyOrQuit(count == kNumServices);
+
+    Log("Saved entries: %u -> %u", numSavedEntries, GetNumSavedHostEntries());
+    VerifyOrQuit(GetNumSavedHostEntries() == 2 * numSavedEntries);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Reboot on power loss and validate that the host is restored with
+    // the expired services deleted.
+
+    RebootAndEnableSrpServer(/* aPowerLoss */ true);
+
+    srpServer = &sInstance->Get<Srp::Server>();
+
+    host = srpServer->GetNextHost(nullptr);
+    VerifyOrQuit(host != nullptr);
+    VerifyOrQuit(!host->IsDeleted());
+
+    count = 0;
+
+    for (const Srp::Server::Service &service : host->GetServices())
+    {
+        count += service.IsDeleted() ? 1 : 0;
+    }
+
+    VerifyOrQuit(count == kNumServices);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Finalize OT instance and validate all heap allocations are freed.
+
+    srpServer->SetEnabled(false);
+    AdvanceTime(100);
+    VerifyOrQuit(GetNumSavedHostEntries() == 0);
+
+    Log("Finalizing OT instance");
+    FinalizeTest();
+
+    VerifyOrQuit(sHeapAllocatedPtrs.IsEmpty());
+
+    Log("End of TestSrpServerPersistenceExpiryBurst");
+}
+
+#endif // OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+
+void TestLeaseExpiryQueue(void)
+{
+    // Adds, updates and removes entries at random and validates the
+    // queue top against the earliest deadline of all queued entries.
+
+    static constexpr uint16_t kNumEntries    = 500;
+    static constexpr uint16_t kNumOperations = 20000;
+
+    Srp::LeaseExpiryQueue        queue;
+    Srp::LeaseExpiryQueue::Entry entries[kNumEntries];
+    TimeMilli                    deadlines[kNumEntries];
+    TimeMilli                    now(0);
+    uint16_t                     numQueued = 0;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestLeaseExpiryQueue");
+
+    srand(0);
+
+    VerifyOrQuit(queue.IsEmpty());
+    VerifyOrQuit(queue.GetTop() == nullptr);
+
+    for (uint16_t i = 0; i < kNumOperations; i++)
+    {
+        uint16_t                            index    = static_cast<uint16_t>(rand()) % kNumEntries;
+        const Srp::LeaseExpiryQueue::Entry *earliest = nullptr;
+        const Srp::LeaseExpiryQueue::Entry *top;
+
+        switch (rand() % 4)
+        {
+        case 0:
+            // Pop the earliest entry (as the lease timer does).
+            if (!queue.IsEmpty())
+            {
+                Srp::LeaseExpiryQueue::Entry *entry = queue.GetTop();
+
+                now = entry->GetDeadline();
+                queue.Remove(*entry);
+                numQueued--;
+            }
+            break;
+
+        case 1:
+            if (entries[index].IsQueued())
+            {
+                numQueued--;
+            }
+
+            queue.Remove(entries[index]);
+            break;
+
+        default:
+            if (!entries[index].IsQueued())
+            {
+                numQueued++;
+            }
+
+            deadlines[index] = now + static_cast<uint32_t>(rand() % 100000);
+            queue.Update(entries[index], deadlines[index]);
+            VerifyOrQuit(entries[index].GetDeadline() == deadlines[index]);
+            break;
+        }
+
+        VerifyOrQuit(queue.GetNumEntries() == numQueued);
+
+        for (uint16_t j = 0; j < kNumEntries; j++)
+        {
+            if (entries[j].IsQueued() && ((earliest == nullptr) || (deadlines[j] < earliest->GetDeadline())))
+            {
+                earliest = &entries[j];
+            }
+        }
+
+        top = queue.GetTop();
+
+        if (earliest == nullptr)
+        {
+            VerifyOrQuit(top == nullptr);
+            VerifyOrQuit(queue.IsEmpty());
+        }
+        else
+        {
+            VerifyOrQuit(top != nullptr);
+            VerifyOrQuit(top->IsQueued());
+            VerifyOrQuit(top->GetDeadline() == earliest->GetDeadline());
+        }
+    }
+
+    while (!queue.IsEmpty())
+    {
+        Srp::LeaseExpiryQueue::Entry *entry = queue.GetTop();
+
+        VerifyOrQuit(entry->GetDeadline() >= now);
+        now = entry->GetDeadline();
+        queue.Remove(*entry);
+    }
+
+    VerifyOrQuit(queue.GetNumEntries() == 0);
+
+    Log("End of TestLeaseExpiryQueue");
+}
+
+#if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
+void TestUpdateLeaseShortVariant(void)
+{
+    // Test behavior of SRP client and server when short variant of
+    // Update Lease Option is used (which only include lease interval).
+    // This test uses `SetUseShortLeaseOption()` method of `Srp::Client`
+    // which changes the default behavior and is available under the
+    // `REFERENCE_DEVICE` config.
+
+    Srp::Server                *srpServer;
+    Srp::Server::LeaseConfig    leaseConfig;
+    const Srp::Server::Service *service;
+    Srp::Client                *srpClient;
+    Srp::Client::Service        service1;
+    uint16_t                    heapAllocations;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestUpdateLeaseShortVariant");
+
+    InitTest();
+
+    srpServer = &sInstance->Get<Srp::Server>();
+    srpClient = &sInstance->Get<Srp::Client>();
+
+    heapAllocations = sHeapAllocatedPtrs.GetLength();
+
+    PrepareService1(service1);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start SRP server.
+
+    SuccessOrQuit(srpServer->SetAddressMode(Srp::Server::kAddressModeUnicast));
+    VerifyOrQuit(srpServer->GetState() == Srp::Server::kStateDisabled);
+
+    srpServer->SetServiceHandler(HandleSrpServerUpdate, sInstance);
+
+    srpServer->SetEnabled(true);
+    VerifyOrQuit(srpServer->GetState() != Srp::Server::kStateDisabled);
+
+    AdvanceTime(10000);
+    VerifyOrQuit(srpServer->GetState() == Srp::Server::kStateRunning);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Check the default Lease Config on SRP server.
+    // Server to accept lease in [30 sec, 27 hours] and
+    // key-lease in [30 sec, 189 hours].
+
+    srpServer->GetLeaseConfig(leaseConfig);
+
+    VerifyOrQuit(leaseConfig.mMinLease == 30);             // 30 seconds
+    VerifyOrQuit(leaseConfig.mMaxLease == 27u * 3600);     // 27 hours
+    VerifyOrQuit(leaseConfig.mMinKeyLease == 30);          // 30 seconds
+    VerifyOrQuit(leaseConfig.mMaxKeyLease == 189u * 3600); // 189 hours
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start SRP client.
+
+    srpClient->SetCallback(HandleSrpClientCallback, sInstance);
+
+    srpClient->EnableAutoStartMode(nullptr, nullptr);
+    VerifyOrQuit(srpClient->IsAutoStartModeEnabled());
+
+    AdvanceTime(2000);
+    VerifyOrQuit(srpClient->IsRunning());
+
+    SuccessOrQuit(srpClient->SetHostName(kHostName));
+    SuccessOrQuit(srpClient->EnableAutoHostAddress());
+
+    sUpdateHandlerMode = kAccept;
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Change default lease intervals on SRP client and enable
+    // "use short Update Lease Option" mode.
+
+    srpClient->SetLeaseInterval(15u * 3600);
+    srpClient->SetKeyLeaseInterval(40u * 3600);
+
+    srpClient->SetUseShortLeaseOption(true);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Register a service, validate that update handler is called
+    // and service is successfully registered.
+
+    SuccessOrQuit(srpClient->AddService(service1));
+
+    sProcessedUpdateCallback = false;
+    sProcessedClientCallback = false;
+
+    AdvanceTime(2 * 1000);
+
+    VerifyOrQuit(sProcessedUpdateCallback);
+    VerifyOrQuit(sProcessedClientCallback);
+    VerifyOrQuit(sLastClientCallbackError == kErrorNone);
+
+    VerifyOrQuit(service1.GetState() == Srp::Client::kRegistered);
+
+    ValidateHost(*srpServer, kHostName);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Validate the lease info for service on SRP server. The client
+    // is set up to use "short Update Lease Option format, so it only
+    // include the lease interval as 15 hours in its request
+    // message. Server should then see 15 hours for both lease and
+    // key lease
+
+    VerifyOrQuit(sUpdateHostLeaseInfo.mLease == 15u * 3600 * 1000);
+    VerifyOrQuit(sUpdateHostLeaseInfo.mKeyLease == 15u * 3600 * 1000);
+
+    // Check that SRP server granted 15 hours for both lease and
+    // key lease.
+
+    service = srpServer->GetNextHost(nullptr)->GetServices().GetHead();
+    VerifyOrQuit(service != nullptr);
+    VerifyOrQuit(service->GetLease() == 15u * 3600);
+    VerifyOrQuit(service->GetKeyLease() == 15u * 3600);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Remove the service.
+
+    SuccessOrQuit(srpClient->RemoveService(service1));
+
+    sProcessedUpdateCallback = false;
+    sProcessedClientCallback = false;
+
+    AdvanceTime(2 * 1000);
+
+    VerifyOrQuit(sProcessedUpdateCallback);
+    VerifyOrQuit(sProcessedClientCallback);
+    VerifyOrQuit(sLastClientCallbackError == kErrorNone);
+
+    VerifyOrQuit(service1.GetState() == Srp::Client::kRemoved);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Register the service again, but this time change it to request
+    // a lease time that is larger than the `LeaseConfig.mMinLease` of
+    // 27 hours. This ensures that server needs to include the Lease
+    // Option in its response (since it need to grant a different
+    // lease interval).
+
+    service1.mLease    = 100u * 3600; // 100 hours >= 27 hours.
+    service1.mKeyLease = 110u * 3600;
+
+    SuccessOrQuit(srpClient->AddService(service1));
+
+    sProcessedUpdateCallback = false;
+    sProcessedClientCallback = false;
+
+    AdvanceTime(2 * 1000);
+
+    VerifyOrQuit(sProcessedUpdateCallback);
+    VerifyOrQuit(sProcessedClientCallback);
+    VerifyOrQuit(sLastClientCallbackError == kErrorNone);
+
+    VerifyOrQuit(service1.GetState() == Srp::Client::kRegistered);
+
+    ValidateHost(*srpServer, kHostName);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Validate the lease info for service on SRP server.
+
+    // We should see the 100 hours in request from client
+    VerifyOrQuit(sUpdateHostLeaseInfo.mLease == 100u * 3600 * 1000);
+    VerifyOrQuit(sUpdateHostLeaseInfo.mKeyLease == 100u * 3600 * 1000);
+
+    // Check that SRP server granted  27 hours for both lease and
+    // key lease.
+
+    service = srpServer->GetNextHost(nullptr)->GetServices().GetHead();
+    VerifyOrQuit(service != nullptr);
+    VerifyOrQuit(service->GetLease() == 27u * 3600);
+    VerifyOrQuit(service->GetKeyLease() == 27u * 3600);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Disable SRP server, verify that all heap allocations by SRP server
+    // are freed.
+
+    Log("Disabling SRP server");
+
+    srpServer->SetEnabled(false);
+    AdvanceTime(100);
+
+    VerifyOrQuit(heapAllocations == sHeapAllocatedPtrs.GetLength());
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Finalize OT instance and validate all heap allocations are freed.
+
+    Log("Finalizing OT instance");
+    FinalizeTest();
+
+    VerifyOrQuit(sHeapAllocatedPtrs.IsEmpty());
+
+    Log("End of TestUpdateLeaseShortVariant");
+}
+
+#endif // OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
+
+#endif // ENABLE_SRP_TEST
+
+int main(void)
+{
+#if ENABLE_SRP_TEST
+    TestLeaseExpiryQueue();
+    TestSrpServerBase();
+    TestSrpServerReject();
+    TestSrpServerIgnore();
+    TestSrpServerIndexScale();
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+    TestSrpServerPersistence();
+    TestSrpServerPersistenceFull();
+    TestSrpServerPersistenceExpiryBurst();
+#endif
 #if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
     TestUpdateLeaseShortVariant();
 #endif
@@ -0,0 +1,669 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "test_platform.h"
+#include "test_util.h"
+
+#include "common/array.hpp"
+#include "common/code_utils.hpp"
+#include "common/debug.hpp"
+#include "common/instance.hpp"
+#include "common/linked_list.hpp"
+#include "common/num_utils.hpp"
+#include "common/time.hpp"
+#include "common/timer.hpp"
+#include "common/timer_wheel.hpp"
+
+static uint32_t sNow;
+static uint32_t sAlarmT0;
+static uint32_t sAlarmDt;
+static bool     sAlarmOn;
+
+extern "C" {
+
+void otPlatAlarmMilliStop(otInstance *) { sAlarmOn = false; }
+
+void otPlatAlarmMilliStartAt(otInstance *, uint32_t aT0, uint32_t aDt)
+{
+    sAlarmOn = true;
+    sAlarmT0 = aT0;
+    sAlarmDt = aDt;
+}
+
+uint32_t otPlatAlarmMilliGetNow(void) { return sNow; }
+
+} // extern "C"
+
+namespace ot {
+
+// `Entry` mirrors the fields `Timer` uses when scheduled, so that
+// the timing wheel can be compared against the sorted linked list
+// used by the default `Timer::Scheduler`.
+
+struct Entry : public LinkedListEntry<Entry>
+{
+    Entry(void)
+        : mNext(this)
+        , mPrev(nullptr)
+        , mId(0)
+    {
+    }
+
+    bool   IsRunning(void) const { return (mNext != this); }
+    Time   GetFireTime(void) const { return mFireTime; }
+    Entry *GetPrev(void) { return mPrev; }
+    void   SetPrev(Entry *aPrev) { mPrev = aPrev; }
+
+    bool DoesFireBefore(const Entry &aOther, Time aNow) const
+    {
+        bool isBeforeNow = (mFireTime < aNow);
+
+        return ((aOther.mFireTime < aNow) != isBeforeNow) ? isBeforeNow : (mFireTime < aOther.mFireTime);
+    }
+
+    Entry   *mNext;
+    Entry   *mPrev;
+    Time     mFireTime;
+    uint16_t mId;
+};
+
+// Same insertion logic as the linked-list `Timer::Scheduler`.
+class ListScheduler
+{
+public:
+    void Add(Entry &aEntry, Time aFireTime, Time aNow)
+    {
+        Entry *prev = nullptr;
+
+        Remove(aEntry);
+        aEntry.mFireTime = aFireTime;
+
+        for (Entry &cur : mList)
+        {
+            if (aEntry.DoesFireBefore(cur, aNow))
+            {
+                break;
+            }
+
+            prev = &cur;
+        }
+
+        if (prev == nullptr)
+        {
+            mList.Push(aEntry);
+        }
+        else
+        {
+            mList.PushAfter(aEntry, *prev);
+        }
+    }
+
+    void Remove(Entry &aEntry)
+    {
+        VerifyOrExit(aEntry.IsRunning());
+        IgnoreError(mList.Remove(aEntry));
+        aEntry.SetNext(&aEntry);
+
+    exit:
+        return;
+    }
+
+    Entry *PopExpired(Time aNow)
+    {
+        Entry *entry = mList.GetHead();
+
+        if ((entry != nullptr) && (aNow >= entry->mFireTime))
+        {
+            Remove(*entry);
+        }
+        else
+        {
+            entry = nullptr;
+        }
+
+        return entry;
+    }
+
+    bool GetEarliestFireTime(Time &aFireTime) const
+    {
+        const Entry *head = mList.GetHead();
+
+        if (head != nullptr)
+        {
+            aFireTime = head->mFireTime;
+        }
+
+        return (head != nullptr);
+    }
+
+private:
+    LinkedList<Entry> mList;
+};
+
+// Same start/stop semantics as the timing wheel `Timer::Scheduler`.
+class WheelScheduler
+{
+public:
+    void Add(Entry &aEntry, Time aFireTime, Time aNow)
+    {
+        Remove(aEntry);
+        aEntry.mFireTime = aFireTime;
+        mWheel.Add(aEntry, aNow);
+    }
+
+    void Remove(Entry &aEntry)
+    {
+        VerifyOrExit(aEntry.IsRunning());
+        mWheel.Remove(aEntry);
+        aEntry.SetNext(&aEntry);
+
+    exit:
+        return;
+    }
+
+    Entry *PopExpired(Time aNow)
+    {
+        Entry *entry;
+
+        mWheel.Advance(aNow);
+        entry = mWheel.GetNextExpired();
+
+        if (entry != nullptr)
+        {
+            Remove(*entry);
+        }
+
+        return entry;
+    }
+
+    bool GetEarliestFireTime(Time &aFireTime) const { return mWheel.FindEarliestFireTime(aFireTime); }
+
+private:
+    TimerWheel<Entry> mWheel;
+};
+
+static uint32_t sRandomState = 0x12345678;
+
+static uint32_t GetRandom(void)
+{
+    // xorshift32
+    sRandomState ^= sRandomState << 13;
+    sRandomState ^= sRandomState >> 17;
+    sRandomState ^= sRandomState << 5;
+
+    return sRandomState;
+}
+
+static uint32_t GetRandomDelay(void)
+{
+    static const uint32_t kMaxDelays[] = {0, 1, 63, 64, 4095, 4096, 60000, 1u << 24, (1u << 31) - 1};
+
+    uint32_t maxDelay = kMaxDelays[GetRandom() % GetArrayLength(kMaxDelays)];
+
+    return (maxDelay == 0) ? 0 : (GetRandom() % (maxDelay + 1));
+}
+
+static uint64_t GetNowInNsec(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return static_cast<uint64_t>(now.tv_sec) * 1000000000ull + static_cast<uint64_t>(now.tv_nsec);
+}
+
+void TestTimerWheelMatchesList(void)
+{
+    static constexpr uint16_t kNumEntries = 300;
+    static constexpr uint32_t kNumSteps   = 40000;
+
+    static Entry listEntries[kNumEntries];
+    static Entry wheelEntries[kNumEntries];
+
+    ListScheduler  list;
+    WheelScheduler wheel;
+    uint32_t       numFired = 0;
+
+    printf("TestTimerWheelMatchesList() ");
+
+    for (uint16_t i = 0; i < kNumEntries; i++)
+    {
+        listEntries[i].mId  = i;
+        wheelEntries[i].mId = i;
+    }
+
+    // Start close to the 32-bit wrap to exercise it.
+
+    for (Time now(0xfff00000); numFired < kNumSteps;)
+    {
+        uint16_t index = static_cast<uint16_t>(GetRandom() % kNumEntries);
+        uint32_t op    = GetRandom() % 8;
+        Time     listFireTime;
+        Time     wheelFireTime;
+        bool     hasListFireTime;
+        bool     hasWheelFireTime;
+
+        if (op < 4)
+        {
+            Time fireTime = now + GetRandomDelay();
+
+            list.Add(listEntries[index], fireTime, now);
+            wheel.Add(wheelEntries[index], fireTime, now);
+        }
+        else if (op < 5)
+        {
+            list.Remove(listEntries[index]);
+            wheel.Remove(wheelEntries[index]);
+        }
+        else
+        {
+            // Advance the time, either by a random amount or
+            // (as an alarm would) to the earliest fire time.
+
+            hasListFireTime = list.GetEarliestFireTime(listFireTime);
+
+            if (op < 7)
+            {
+                uint32_t delay = GetRandom() % ((op == 5) ? 64 : 100000);
+
+                if (hasListFireTime && (now < listFireTime) && (listFireTime - now < delay))
+                {
+                    delay = listFireTime - now;
+                }
+
+                now += delay;
+            }
+            else if (hasListFireTime && (now < listFireTime))
+            {
+                now = listFireTime;
+            }
+
+            while (true)
+            {
+                Entry *listEntry  = list.PopExpired(now);
+                Entry *wheelEntry = wheel.PopExpired(now);
+
+                if (listEntry == nullptr)
+                {
+                    VerifyOrQuit(wheelEntry == nullptr);
+                    break;
+                }
+
+                VerifyOrQuit(wheelEntry != nullptr);
+                VerifyOrQuit(wheelEntry->mFireTime == listEntry->mFireTime);
+                numFired++;
+            }
+        }
+
+        hasListFireTime  = list.GetEarliestFireTime(listFireTime);
+        hasWheelFireTime = wheel.GetEarliestFireTime(wheelFireTime);
+
+        VerifyOrQuit(hasListFireTime == hasWheelFireTime);
+        VerifyOrQuit(!hasListFireTime || (listFireTime == wheelFireTime));
+
+        for (uint16_t i = 0; i < kNumEntries; i++)
+        {
+            VerifyOrQuit(listEntries[i].IsRunning() == wheelEntries[i].IsRunning());
+        }
+    }
+
+    printf(" --> PASSED\n");
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// `TimerMilli` tests, going through the `Timer::Scheduler` of an instance (which uses the timing wheel when
+// `OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE` is set).
+
+static constexpr uint16_t kNumTestTimers = 8;
+
+static uint16_t sFiredIds[kNumTestTimers * 2];
+static uint32_t sFiredTimes[kNumTestTimers * 2];
+static uint16_t sNumFired;
+
+class TestTimer : public TimerMilli
+{
+public:
+    TestTimer(Instance &aInstance, uint16_t aId)
+        : TimerMilli(aInstance, TestTimer::HandleTimerFired)
+        , mId(aId)
+    {
+    }
+
+    static void RemoveAll(Instance &aInstance) { TimerMilli::RemoveAll(aInstance); }
+
+private:
+    static void HandleTimerFired(Timer &aTimer) { static_cast<TestTimer &>(aTimer).HandleTimerFired(); }
+
+    void HandleTimerFired(void)
+    {
+        VerifyOrQuit(sNumFired < GetArrayLength(sFiredIds));
+        sFiredIds[sNumFired]   = mId;
+        sFiredTimes[sNumFired] = sNow;
+        sNumFired++;
+    }
+
+    uint16_t mId;
+};
+
+static Instance &InitTimerTest(uint32_t aNow)
+{
+    Instance *instance;
+
+    sNow      = aNow;
+    sNumFired = 0;
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr);
+    TestTimer::RemoveAll(*instance);
+
+    return *instance;
+}
+
+static uint32_t GetAlarmFireTime(void) { return sAlarmT0 + sAlarmDt; }
+
+static void AdvanceTime(Instance &aInstance, uint32_t aDuration)
+{
+    // Moves the time forward one msec at a time, signaling the
+    // alarm whenever it expires (as the platform would).
+
+    for (; aDuration > 0; aDuration--)
+    {
+        sNow++;
+
+        while (sAlarmOn && (sNow - sAlarmT0 >= sAlarmDt))
+        {
+            sAlarmOn = false;
+            otPlatAlarmMilliFired(&aInstance);
+        }
+    }
+}
+
+// Starts the timers in order with the given delays and checks that they all fire at their fire time, in the order
+// of `aExpectedIds`.
+static void VerifyFireOrder(TestTimer (&aTimers)[kNumTestTimers],
+                            const uint32_t (&aDelays)[kNumTestTimers],
+                            const uint16_t (&aExpectedIds)[kNumTestTimers])
+{
+    Instance &instance  = aTimers[0].GetInstance();
+    uint32_t  startTime = sNow;
+    uint32_t  maxDelay  = 0;
+    uint32_t  minDelay  = aDelays[0];
+
+    sNumFired = 0;
+
+    for (uint16_t i = 0; i < kNumTestTimers; i++)
+    {
+        aTimers[i].Start(aDelays[i]);
+        VerifyOrQuit(aTimers[i].GetFireTime().GetValue() == startTime + aDelays[i]);
+
+        maxDelay = Max(maxDelay, aDelays[i]);
+        minDelay = Min(minDelay, aDelays[i]);
+    }
+
+    VerifyOrQuit(sAlarmOn && (GetAlarmFireTime() == startTime + minDelay));
+
+    AdvanceTime(instance, maxDelay);
+
+    VerifyOrQuit(sNumFired == kNumTestTimers);
+    VerifyOrQuit(!sAlarmOn);
+
+    for (uint16_t i = 0; i < kNumTestTimers; i++)
+    {
+        VerifyOrQuit(sFiredIds[i] == aExpectedIds[i]);
+        VerifyOrQuit(sFiredTimes[i] == startTime + aDelays[aExpectedIds[i]]);
+        VerifyOrQuit(!aTimers[i].IsRunning());
+    }
+}
+
+void TestTimerMilliStartStop(void)
+{
+    Instance &instance = InitTimerTest(1000);
+    TestTimer timerA(instance, 0);
+    TestTimer timerB(instance, 1);
+
+    printf("TestTimerMilliStartStop() ");
+
+    timerA.Start(100);
+    VerifyOrQuit(timerA.IsRunning());
+    VerifyOrQuit(timerA.GetFireTime().GetValue() == 1100);
+    VerifyOrQuit(sAlarmOn && (sAlarmT0 == 1000) && (sAlarmDt == 100));
+
+    timerA.Stop();
+    VerifyOrQuit(!timerA.IsRunning());
+    VerifyOrQuit(!sAlarmOn);
+
+    // Re-start the stopped timer, then start an earlier one.
+
+    timerA.Start(50);
+    VerifyOrQuit(sAlarmOn && (GetAlarmFireTime() == 1050));
+
+    timerB.Start(20);
+    VerifyOrQuit(sAlarmOn && (GetAlarmFireTime() == 1020));
+
+    timerB.Stop();
+    VerifyOrQuit(sAlarmOn && (GetAlarmFireTime() == 1050));
+
+    // Re-start the running timer the alarm is set for to a later
+    // time, then stop it while another timer is running.
+
+    timerA.Start(200);
+    VerifyOrQuit(timerA.GetFireTime().GetValue() == 1200);
+    VerifyOrQuit(sAlarmOn && (GetAlarmFireTime() == 1200));
+
+    timerB.Start(300);
+    VerifyOrQuit(sAlarmOn && (GetAlarmFireTime() == 1200));
+
+    timerA.Stop();
+    VerifyOrQuit(sAlarmOn && (GetAlarmFireTime() == 1300));
+
+    AdvanceTime(instance, 299);
+    VerifyOrQuit(sNumFired == 0);
+    VerifyOrQuit(timerB.IsRunning());
+
+    AdvanceTime(instance, 1);
+    VerifyOrQuit(sNumFired == 1);
+    VerifyOrQuit((sFiredIds[0] == 1) && (sFiredTimes[0] == 1300));
+    VerifyOrQuit(!timerA.IsRunning() && !timerB.IsRunning());
+    VerifyOrQuit(!sAlarmOn);
+
+    // Re-start a timer after it has fired.
+
+    timerB.Start(10);
+    AdvanceTime(instance, 10);
+    VerifyOrQuit(sNumFired == 2);
+    VerifyOrQuit((sFiredIds[1] == 1) && (sFiredTimes[1] == 1310));
+    VerifyOrQuit(!sAlarmOn);
+
+    testFreeInstance(&instance);
+
+    printf(" --> PASSED\n");
+}
+
+void TestTimerMilliFireOrder(void)
+{
+    // The delays fall on different levels of the timing wheel.
+    static const uint32_t kDelays[kNumTestTimers]      = {70, 10, 4096, 64, 4095, 1, 63, 300000};
+    static const uint16_t kExpectedIds[kNumTestTimers] = {5, 1, 6, 3, 0, 4, 2, 7};
+
+    Instance &instance = InitTimerTest(12345);
+    TestTimer timers[kNumTestTimers] = {{instance, 0}, {instance, 1}, {instance, 2}, {instance, 3},
+                                        {instance, 4}, {instance, 5}, {instance, 6}, {instance, 7}};
+    uint32_t  fireTime;
+
+    printf("TestTimerMilliFireOrder() ");
+
+    VerifyFireOrder(timers, kDelays, kExpectedIds);
+
+    // Timers with the same fire time fire in the order they were
+    // started. The fire time is far enough for the timers to be
+    // moved down the levels of the timing wheel before firing.
+    // Re-starting a timer (here at a later time, for the same fire
+    // time) moves it after the others.
+
+    sNumFired = 0;
+    fireTime  = sNow + 5000;
+
+    for (TestTimer &timer : timers)
+    {
+        timer.FireAt(TimeMilli(fireTime));
+    }
+
+    AdvanceTime(instance, 100);
+    timers[3].Start(4900);
+    VerifyOrQuit(timers[3].GetFireTime().GetValue() == fireTime);
+
+    AdvanceTime(instance, 4900);
+    VerifyOrQuit(sNumFired == kNumTestTimers);
+    VerifyOrQuit(!sAlarmOn);
+
+    {
+        static const uint16_t kEqualExpectedIds[kNumTestTimers] = {0, 1, 2, 4, 5, 6, 7, 3};
+
+        for (uint16_t i = 0; i < kNumTestTimers; i++)
+        {
+            VerifyOrQuit(sFiredIds[i] == kEqualExpectedIds[i]);
+            VerifyOrQuit(sFiredTimes[i] == fireTime);
+        }
+    }
+
+    testFreeInstance(&instance);
+
+    printf(" --> PASSED\n");
+}
+
+void TestTimerMilliTimeWrap(void)
+{
+    // Starting 256 msec before the 32-bit time wraps, timers 1 and
+    // 5 fire right before and right at the wrap, timers 2 and 6 at
+    // the same time after it.
+    static const uint32_t kDelays[kNumTestTimers]      = {100, 255, 300, 70000, 1, 256, 300, 4000};
+    static const uint16_t kExpectedIds[kNumTestTimers] = {4, 0, 1, 5, 2, 6, 7, 3};
+
+    Instance &instance = InitTimerTest(0xffffff00);
+    TestTimer timers[kNumTestTimers] = {{instance, 0}, {instance, 1}, {instance, 2}, {instance, 3},
+                                        {instance, 4}, {instance, 5}, {instance, 6}, {instance, 7}};
+
+    printf("TestTimerMilliTimeWrap() ");
+
+    VerifyFireOrder(timers, kDelays, kExpectedIds);
+
+    VerifyOrQuit(sFiredTimes[2] == 0xffffffff);
+    VerifyOrQuit(sFiredTimes[3] == 0);
+
+    // Timers whose alarm is signaled late, after the time has
+    // wrapped, still fire in order.
+
+    sNow = 0xffffffff;
+    timers[0].Start(1);
+    sNow = 2;
+    timers[1].Start(0);
+    AdvanceTime(instance, 1);
+    VerifyOrQuit(sNumFired == kNumTestTimers + 2);
+    VerifyOrQuit((sFiredIds[kNumTestTimers] == 0) && (sFiredIds[kNumTestTimers + 1] == 1));
+
+    testFreeInstance(&instance);
+
+    printf(" --> PASSED\n");
+}
+
+template <typename SchedulerType> uint64_t MeasureRestarts(uint16_t aNumTimers, uint32_t aNumRestarts)
+{
+    static constexpr uint16_t kMaxTimers = 1000;
+
+    static Entry  entries[kMaxTimers];
+    SchedulerType scheduler;
+    Time          now(1000);
+    uint64_t      startTime;
+
+    OT_ASSERT(aNumTimers <= kMaxTimers);
+
+    sRandomState = 0x2468ace0;
+
+    for (uint16_t i = 0; i < aNumTimers; i++)
+    {
+        entries[i].mNext = &entries[i];
+        scheduler.Add(entries[i], now + 1 + (GetRandom() % 60000), now);
+    }
+
+    startTime = GetNowInNsec();
+
+    // Restart timers with new random delays (e.g., as retransmission
+    // and supervision timers do), advancing the time and firing the
+    // expired timers as it goes.
+
+    for (uint32_t i = 0; i < aNumRestarts; i++)
+    {
+        Entry *entry;
+
+        scheduler.Add(entries[i % aNumTimers], now + 1 + (GetRandom() % 60000), now);
+
+        now += 1;
+
+        while ((entry = scheduler.PopExpired(now)) != nullptr)
+        {
+            scheduler.Add(*entry, now + 1 + (GetRandom() % 60000), now);
+        }
+    }
+
+    return GetNowInNsec() - startTime;
+}
+
+void BenchmarkTimerWheel(void)
+{
+    static const uint16_t kNumTimers[] = {10, 100, 1000};
+    static const uint32_t kNumRestarts = 200000;
+
+    printf("BenchmarkTimerWheel()\n");
+
+    for (uint16_t numTimers : kNumTimers)
+    {
+        uint64_t listTime  = MeasureRestarts<ListScheduler>(numTimers, kNumRestarts);
+        uint64_t wheelTime = MeasureRestarts<WheelScheduler>(numTimers, kNumRestarts);
+
+        printf("  %4u timers: list %6.1f ns/restart, wheel %6.1f ns/restart\n", numTimers,
+               static_cast<double>(listTime) / kNumRestarts, static_cast<double>(wheelTime) / kNumRestarts);
+    }
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestTimerWheelMatchesList();
+    ot::TestTimerMilliStartStop();
+    ot::TestTimerMilliFireOrder();
+    ot::TestTimerMilliTimeWrap();
+    ot::BenchmarkTimerWheel();
+
+    printf("All tests passed\n");
+    return 0;
+}
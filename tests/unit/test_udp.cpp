@@ -0,0 +1,379 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <time.h>
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "net/udp6.hpp"
+
+#include "test_util.h"
+
+namespace ot {
+
+static constexpr uint16_t kMaxSockets = 80;
+
+static Ip6::Udp::SocketHandle *sReceivedSocket;
+
+static void HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    OT_UNUSED_VARIABLE(aMessage);
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    sReceivedSocket = static_cast<Ip6::Udp::SocketHandle *>(aContext);
+}
+
+static uint32_t sRandomState = 0x13572468;
+
+static uint32_t GetRandom(void)
+{
+    // xorshift32
+    sRandomState ^= sRandomState << 13;
+    sRandomState ^= sRandomState >> 17;
+    sRandomState ^= sRandomState << 5;
+
+    return sRandomState;
+}
+
+static uint64_t GetNowInNsec(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return static_cast<uint64_t>(now.tv_sec) * 1000000000ull + static_cast<uint64_t>(now.tv_nsec);
+}
+
+// Finds the destination socket the same way as the linear search of the
+// socket list (first matching socket in list order).
+static Ip6::Udp::SocketHandle *FindSocketInList(Instance &aInstance, const Ip6::MessageInfo &aMessageInfo)
+{
+    Ip6::Udp::SocketHandle *socket = aInstance.Get<Ip6::Udp>().GetUdpSockets();
+
+    for (; socket != nullptr; socket = socket->GetNext())
+    {
+        const Ip6::SockAddr &sockName = socket->GetSockName();
+        const Ip6::SockAddr &peerName = socket->GetPeerName();
+
+        if (sockName.GetPort() != aMessageInfo.GetSockPort())
+        {
+            continue;
+        }
+
+        if (!aMessageInfo.GetSockAddr().IsMulticast() && !sockName.GetAddress().IsUnspecified() &&
+            (sockName.GetAddress() != aMessageInfo.GetSockAddr()))
+        {
+            continue;
+        }
+
+        if ((peerName.GetPort() != 0) &&
+            ((peerName.GetPort() != aMessageInfo.GetPeerPort()) ||
+             (!peerName.GetAddress().IsUnspecified() && (peerName.GetAddress() != aMessageInfo.GetPeerAddr()))))
+        {
+            continue;
+        }
+
+        break;
+    }
+
+    return socket;
+}
+
+static Ip6::Udp::SocketHandle *Deliver(Instance &aInstance, Message &aMessage, Ip6::MessageInfo &aMessageInfo)
+{
+    sReceivedSocket = nullptr;
+    aInstance.Get<Ip6::Udp>().HandlePayload(aMessage, aMessageInfo);
+
+    return sReceivedSocket;
+}
+
+static void OpenSocket(Instance &aInstance, Ip6::Udp::SocketHandle &aSocket, uint16_t aPort)
+{
+    Ip6::Udp &udp = aInstance.Get<Ip6::Udp>();
+
+    SuccessOrQuit(udp.Open(aSocket, HandleUdpReceive, &aSocket));
+    SuccessOrQuit(udp.Bind(aSocket, Ip6::SockAddr(aPort), Ip6::kNetifThread));
+}
+
+void TestUdpSocketDemux(void)
+{
+    static constexpr uint16_t kNumPorts = 12;
+    static constexpr uint16_t kNumSteps = 5000;
+
+    static Ip6::Udp::SocketHandle sockets[kMaxSockets];
+
+    Instance        *instance = testInitInstance();
+    Ip6::Udp        &udp      = instance->Get<Ip6::Udp>();
+    Message         *message;
+    Ip6::MessageInfo messageInfo;
+    Ip6::Address     peerAddr;
+    Ip6::Address     sockAddr;
+    Ip6::Address     multicastAddr;
+
+    printf("TestUdpSocketDemux() ");
+
+    VerifyOrQuit(instance != nullptr);
+
+    message = udp.NewMessage();
+    VerifyOrQuit(message != nullptr);
+
+    SuccessOrQuit(peerAddr.FromString("fd00::1"));
+    SuccessOrQuit(sockAddr.FromString("fd00::2"));
+    SuccessOrQuit(multicastAddr.FromString("ff03::1"));
+
+    // Randomly open, connect, and close sockets sharing a small set of
+    // ports, and verify that every datagram goes to the same socket as
+    // a search of the socket list. The number of open sockets goes
+    // above and below the index size.
+
+    for (uint16_t step = 0; step < kNumSteps; step++)
+    {
+        Ip6::Udp::SocketHandle &socket = sockets[GetRandom() % kMaxSockets];
+        uint32_t                op     = GetRandom() % 4;
+
+        if (op == 0)
+        {
+            if (udp.IsOpen(socket))
+            {
+                SuccessOrQuit(udp.Close(socket));
+            }
+        }
+        else if (!udp.IsOpen(socket))
+        {
+            OpenSocket(*instance, socket, static_cast<uint16_t>(1000 + GetRandom() % kNumPorts));
+
+            if (op == 1)
+            {
+                Ip6::SockAddr peer(static_cast<uint16_t>(2000 + GetRandom() % 2));
+
+                if (GetRandom() % 2)
+                {
+                    peer.SetAddress(peerAddr);
+                }
+
+                SuccessOrQuit(udp.Connect(socket, peer));
+            }
+        }
+
+        for (uint16_t i = 0; i < 4; i++)
+        {
+            messageInfo.Clear();
+            messageInfo.SetSockAddr((GetRandom() % 2) ? sockAddr : multicastAddr);
+            messageInfo.SetSockPort(static_cast<uint16_t>(1000 + GetRandom() % (kNumPorts + 1)));
+            messageInfo.SetPeerAddr(peerAddr);
+            messageInfo.SetPeerPort(static_cast<uint16_t>(2000 + GetRandom() % 3));
+
+            VerifyOrQuit(Deliver(*instance, *message, messageInfo) == FindSocketInList(*instance, messageInfo));
+        }
+
+        VerifyOrQuit(udp.IsPortInUse(1000 + kNumPorts) == false);
+    }
+
+    for (Ip6::Udp::SocketHandle &socket : sockets)
+    {
+        if (udp.IsOpen(socket))
+        {
+            SuccessOrQuit(udp.Close(socket));
+        }
+    }
+
+    message->Free();
+    testFreeInstance(instance);
+
+    printf(" --> PASSED\n");
+}
+
+#if OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_ENABLE
+
+class UnitTester
+{
+public:
+    static void TestUdpSocketIndexOverflow(void)
+    {
+        static constexpr uint16_t kIndexSize  = OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE;
+        static constexpr uint16_t kNumSockets = kIndexSize + 4;
+
+        static Ip6::Udp::SocketHandle sockets[kNumSockets + 1];
+
+        Instance        *instance = testInitInstance();
+        Ip6::Udp        &udp      = instance->Get<Ip6::Udp>();
+        Message         *message;
+        Ip6::MessageInfo messageInfo;
+
+        printf("TestUdpSocketIndexOverflow() ");
+
+        VerifyOrQuit(instance != nullptr);
+
+        message = udp.NewMessage();
+        VerifyOrQuit(message != nullptr);
+
+        messageInfo.Clear();
+        SuccessOrQuit(messageInfo.GetSockAddr().FromString("fd00::2"));
+        SuccessOrQuit(messageInfo.GetPeerAddr().FromString("fd00::1"));
+        messageInfo.SetPeerPort(2000);
+
+        // Open more sockets than the index can hold. The index enters
+        // the overflow state and datagrams are delivered by searching
+        // the list.
+
+        for (uint16_t i = 0; i < kNumSockets; i++)
+        {
+            OpenSocket(*instance, sockets[i], 3000 + i);
+        }
+
+        for (uint16_t i = 0; i < kNumSockets; i++)
+        {
+            messageInfo.SetSockPort(3000 + i);
+            VerifyOrQuit(Deliver(*instance, *message, messageInfo) == &sockets[i]);
+            VerifyOrQuit(udp.mSocketIndex.IsOverflowed());
+        }
+
+        // Opening another socket (or binding one) keeps the overflow
+        // state, so that the index is not rebuilt on every datagram.
+
+        OpenSocket(*instance, sockets[kNumSockets], 3000 + kNumSockets);
+        VerifyOrQuit(udp.mSocketIndex.IsOverflowed());
+        VerifyOrQuit(!udp.mSocketIndex.ShouldBuild());
+
+        messageInfo.SetSockPort(3000 + kNumSockets);
+        VerifyOrQuit(Deliver(*instance, *message, messageInfo) == &sockets[kNumSockets]);
+        VerifyOrQuit(udp.mSocketIndex.IsOverflowed());
+
+        // Once the number of open sockets drops back to the index
+        // size, the index is rebuilt and used again.
+
+        for (uint16_t i = kIndexSize; i <= kNumSockets; i++)
+        {
+            SuccessOrQuit(udp.Close(sockets[i]));
+            VerifyOrQuit(udp.mSocketIndex.ShouldBuild());
+        }
+
+        for (uint16_t i = 0; i <= kNumSockets; i++)
+        {
+            messageInfo.SetSockPort(3000 + i);
+            VerifyOrQuit(Deliver(*instance, *message, messageInfo) == ((i < kIndexSize) ? &sockets[i] : nullptr));
+            VerifyOrQuit(udp.mSocketIndex.IsValid());
+        }
+
+        for (uint16_t i = 0; i < kIndexSize; i++)
+        {
+            SuccessOrQuit(udp.Close(sockets[i]));
+        }
+
+        message->Free();
+        testFreeInstance(instance);
+
+        printf(" --> PASSED\n");
+    }
+};
+
+#endif // OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_ENABLE
+
+void BenchmarkUdpReceive(void)
+{
+    static constexpr uint16_t kNumSockets  = 60;
+    static constexpr uint32_t kNumReceives = 200000;
+
+    static Ip6::Udp::SocketHandle sockets[kNumSockets];
+
+    Instance        *instance = testInitInstance();
+    Ip6::Udp        &udp      = instance->Get<Ip6::Udp>();
+    Message         *message;
+    Ip6::MessageInfo messageInfo;
+    uint64_t         startTime;
+    uint64_t         receiveTime;
+    uint64_t         listTime;
+
+    printf("BenchmarkUdpReceive()\n");
+
+    message = udp.NewMessage();
+    VerifyOrQuit(message != nullptr);
+
+    for (uint16_t i = 0; i < kNumSockets; i++)
+    {
+        OpenSocket(*instance, sockets[i], 1000 + i);
+    }
+
+    messageInfo.Clear();
+    SuccessOrQuit(messageInfo.GetSockAddr().FromString("fd00::2"));
+    SuccessOrQuit(messageInfo.GetPeerAddr().FromString("fd00::1"));
+    messageInfo.SetPeerPort(2000);
+
+    // Receive on all ports in turn, comparing the receive path with a
+    // search of the socket list.
+
+    startTime = GetNowInNsec();
+
+    for (uint32_t i = 0; i < kNumReceives; i++)
+    {
+        messageInfo.SetSockPort(static_cast<uint16_t>(1000 + i % kNumSockets));
+        VerifyOrQuit(Deliver(*instance, *message, messageInfo) == &sockets[i % kNumSockets]);
+    }
+
+    receiveTime = GetNowInNsec() - startTime;
+    startTime   = GetNowInNsec();
+
+    for (uint32_t i = 0; i < kNumReceives; i++)
+    {
+        messageInfo.SetSockPort(static_cast<uint16_t>(1000 + i % kNumSockets));
+        VerifyOrQuit(FindSocketInList(*instance, messageInfo) == &sockets[i % kNumSockets]);
+    }
+
+    listTime = GetNowInNsec() - startTime;
+
+    printf("  %u sockets: receive %6.1f ns/datagram, list search %6.1f ns/datagram (socket index %s)\n", kNumSockets,
+           static_cast<double>(receiveTime) / kNumReceives, static_cast<double>(listTime) / kNumReceives,
+           OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_ENABLE ? "enabled" : "disabled");
+
+    for (Ip6::Udp::SocketHandle &socket : sockets)
+    {
+        SuccessOrQuit(udp.Close(socket));
+    }
+
+    message->Free();
+    testFreeInstance(instance);
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestUdpSocketDemux();
+#if OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_ENABLE
+    ot::UnitTester::TestUdpSocketIndexOverflow();
+#endif
+    ot::BenchmarkUdpReceive();
+
+    printf("All tests passed\n");
+    return 0;
+}